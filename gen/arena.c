@@ -0,0 +1,267 @@
+#include <assert.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "arena.h"
+
+// Constants
+
+#define ARENA_ALIGN         alignof(max_align_t)  // Alignment of buffers.
+#define ARENA_CHUNKSIZE_DEF ( 64 * 1024 )         // Default chunk size.
+
+#define ARENA_ROUND(size) ( ( (size) + ARENA_ALIGN - 1 ) & ~( ARENA_ALIGN - 1 ) )
+
+// Chunk header
+
+typedef struct arena_chunk_t
+{
+    struct arena_chunk_t *prev;  // The older chunk.
+    size_t                size;  // Size of the chunk, include this header.
+    size_t                base;  // Size used in the older chunks.
+} arena_chunk_t;
+
+#define ARENA_CHUNKHEAD ARENA_ROUND(sizeof(arena_chunk_t))
+
+//------------------------------------------------------------------------------
+static
+char* chunk_get_begin(arena_chunk_t *chunk)
+{
+    return (char*) chunk + ARENA_CHUNKHEAD;
+}
+//------------------------------------------------------------------------------
+static
+char* chunk_get_end(arena_chunk_t *chunk)
+{
+    return (char*) chunk + chunk->size;
+}
+//------------------------------------------------------------------------------
+void arena_init(arena_t *arena, size_t chunksize)
+{
+    /**
+     * @memberof arena_t
+     * @brief Constructor.
+     *
+     * @param arena     Object instance.
+     * @param chunksize Size of each chunk allocated from the system,
+     *                  and ZERO to use the default size.
+     *                  A larger chunk will be allocated for a buffer larger than a chunk.
+     *
+     * @remarks No memory will be allocated until the first buffer requested.
+     */
+    assert( arena );
+
+    arena->chunksize = ( chunksize )?( chunksize ):( ARENA_CHUNKSIZE_DEF );
+    arena->chunk     = NULL;
+    arena->bump      = NULL;
+    arena->end       = NULL;
+    arena->last      = NULL;
+}
+//------------------------------------------------------------------------------
+void arena_deinit(arena_t *arena)
+{
+    /**
+     * @memberof arena_t
+     * @brief Destructor.
+     *
+     * @param arena Object instance.
+     */
+    assert( arena );
+
+    arena_rewind(arena, (arena_mark_t){ .chunk = NULL, .bump = NULL });
+}
+//------------------------------------------------------------------------------
+static
+bool arena_add_chunk(arena_t *arena, size_t size)
+{
+    // Allocate a new chunk which can hold a buffer of the size at least.
+    size_t         chunksize = arena->chunksize;
+    arena_chunk_t *chunk;
+
+    if( size > SIZE_MAX - ARENA_CHUNKHEAD ) return false;
+    if( chunksize < ARENA_CHUNKHEAD + size ) chunksize = ARENA_CHUNKHEAD + size;
+
+    if( !( chunk = malloc(chunksize) ) ) return false;
+
+    chunk->prev = arena->chunk;
+    chunk->size = chunksize;
+    chunk->base = arena_get_used_size(arena);
+
+    arena->chunk = chunk;
+    arena->bump  = chunk_get_begin(chunk);
+    arena->end   = chunk_get_end(chunk);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+void* arena_allocate(arena_t *arena, size_t size)
+{
+    /**
+     * @memberof arena_t
+     * @brief Allocate a buffer.
+     *
+     * @param arena Object instance.
+     * @param size  Size of the buffer.
+     * @return The buffer allocated; or NULL if out of memory.
+     *         The buffer is aligned as the one returned by malloc.
+     */
+    assert( arena );
+
+    if( size > SIZE_MAX - ARENA_ALIGN ) return NULL;
+    size = ( size )?( ARENA_ROUND(size) ):( ARENA_ALIGN );
+
+    if( !arena->chunk || (size_t)( arena->end - arena->bump ) < size )
+    {
+        if( !arena_add_chunk(arena, size) ) return NULL;
+    }
+
+    arena->last  = arena->bump;
+    arena->bump += size;
+
+    return arena->last;
+}
+//------------------------------------------------------------------------------
+void* arena_reallocate(arena_t *arena, void *buf, size_t oldsize, size_t newsize)
+{
+    /**
+     * @memberof arena_t
+     * @brief Change the size of a buffer.
+     *
+     * @param arena   Object instance.
+     * @param buf     The buffer to be resized, or NULL to allocate a new one.
+     * @param oldsize The current size of the buffer.
+     * @param newsize The new size of the buffer.
+     * @return The buffer resized, and the data are kept; or NULL if out of memory,
+     *         and the original buffer is not changed.
+     *
+     * @remarks The last buffer allocated will be resized in place if the chunk has space enough;
+     *          otherwise, the data will be moved to a new buffer,
+     *          and the old one will not be reused until the arena rewound.
+     */
+    void *newbuf;
+
+    assert( arena );
+
+    if( !buf ) return arena_allocate(arena, newsize);
+
+    if( buf == arena->last )
+    {
+        size_t size = ( newsize )?( ARENA_ROUND(newsize) ):( ARENA_ALIGN );
+        if( newsize <= SIZE_MAX - ARENA_ALIGN && (size_t)( arena->end - (char*) buf ) >= size )
+        {
+            arena->bump = (char*) buf + size;
+            return buf;
+        }
+    }
+    else if( newsize <= oldsize )
+    {
+        return buf;
+    }
+
+    if( !( newbuf = arena_allocate(arena, newsize) ) ) return NULL;
+    memcpy(newbuf, buf, ( oldsize < newsize )?( oldsize ):( newsize ));
+
+    return newbuf;
+}
+//------------------------------------------------------------------------------
+void arena_deallocate(arena_t *arena, void *buf)
+{
+    /**
+     * @memberof arena_t
+     * @brief Release a buffer.
+     *
+     * @param arena Object instance.
+     * @param buf   The buffer to be released.
+     *
+     * @remarks Only the space of the last buffer allocated will be reused,
+     *          and other buffers will be kept until the arena rewound.
+     */
+    assert( arena );
+
+    if( buf && buf == arena->last )
+    {
+        arena->bump = buf;
+        arena->last = NULL;
+    }
+}
+//------------------------------------------------------------------------------
+arena_mark_t arena_get_mark(const arena_t *arena)
+{
+    /**
+     * @memberof arena_t
+     * @brief Get the current position of the arena.
+     *
+     * @param arena Object instance.
+     * @return The position, that can be passed to ::arena_rewind later.
+     */
+    assert( arena );
+    return (arena_mark_t){ .chunk = arena->chunk, .bump = arena->bump };
+}
+//------------------------------------------------------------------------------
+void arena_rewind(arena_t *arena, arena_mark_t mark)
+{
+    /**
+     * @memberof arena_t
+     * @brief Release all buffers allocated after a mark.
+     *
+     * @param arena Object instance.
+     * @param mark  The mark returned by ::arena_get_mark.
+     *              The mark must not be older than the last rewind or reset.
+     */
+    assert( arena );
+
+    while( arena->chunk != mark.chunk )
+    {
+        arena_chunk_t *chunk = arena->chunk;
+        assert( chunk );
+
+        arena->chunk = chunk->prev;
+        free(chunk);
+    }
+
+    arena->bump = mark.bump;
+    arena->end  = ( arena->chunk )?( chunk_get_end(arena->chunk) ):( NULL );
+    arena->last = NULL;
+}
+//------------------------------------------------------------------------------
+void arena_reset(arena_t *arena)
+{
+    /**
+     * @memberof arena_t
+     * @brief Release all buffers.
+     *
+     * @param arena Object instance.
+     *
+     * @remarks The oldest chunk is kept for the buffers allocated later.
+     */
+    arena_chunk_t *chunk;
+
+    assert( arena );
+
+    if( !( chunk = arena->chunk ) ) return;
+    while( chunk->prev ) chunk = chunk->prev;
+
+    arena_rewind(arena, (arena_mark_t){ .chunk = chunk, .bump = chunk_get_begin(chunk) });
+}
+//------------------------------------------------------------------------------
+size_t arena_get_used_size(const arena_t *arena)
+{
+    /**
+     * @memberof arena_t
+     * @brief Get the size of all buffers allocated.
+     *
+     * @param arena Object instance.
+     * @return The size of buffers allocated, include the padding
+     *         and the space wasted in the end of chunks.
+     */
+    assert( arena );
+
+    if( !arena->chunk ) return 0;
+    return arena->chunk->base + ( arena->bump - chunk_get_begin(arena->chunk) );
+}
+//------------------------------------------------------------------------------
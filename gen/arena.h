@@ -0,0 +1,83 @@
+/**
+ * @file
+ * @brief     Arena allocator.
+ * @details   Bump allocation from chunks, for the data that die together,
+ *            such like the temporary buffers of a request.
+ * @author    王文佑
+ * @date      2026.10.17
+ * @copyright ZLib Licence
+ * @see       http://www.openfoundry.org/of/projects/2419
+ */
+#ifndef _GEN_ARENA_H_
+#define _GEN_ARENA_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * When to use the arena allocator ?
+ *
+ *     An arena takes memory from the system by chunks, and hands out buffers
+ * by moving a pointer forward in the current chunk. Buffers are not released
+ * one by one; instead, the arena can be rewound to a mark taken before,
+ * or reset to release everything at once, and both cost only O(chunks).
+ *
+ *     A buffer of ::mem_t can be allocated from an arena by ::mem_init_arena,
+ * and the nodes of containers can be allocated from an arena through
+ * a slab created by ::slab_init_arena.
+ *
+ *     An arena has no lock, and can only be used by one thread at a time.
+ */
+
+/**
+ * @class arena_t
+ * @brief Arena allocator.
+ */
+typedef struct arena_t
+{
+    // WARNING : All members are private!
+
+    size_t                chunksize;  // Default size of each chunk.
+    struct arena_chunk_t *chunk;      // The current chunk, and older chunks are linked behind it.
+    char                 *bump;       // Unused space of the current chunk.
+    char                 *end;        // End of the current chunk.
+    void                 *last;       // The last buffer allocated, that can be resized in place.
+
+} arena_t;
+
+/**
+ * @memberof arena_t
+ * @brief Position of an arena, to rewind the arena to later.
+ */
+typedef struct arena_mark_t
+{
+    struct arena_chunk_t *chunk;
+    char                 *bump;
+} arena_mark_t;
+
+// constructor and destructor
+void arena_init  (arena_t *arena, size_t chunksize);
+void arena_deinit(arena_t *arena);
+
+// allocation
+void* arena_allocate  (arena_t *arena, size_t size);
+void* arena_reallocate(arena_t *arena, void *buf, size_t oldsize, size_t newsize);
+void  arena_deallocate(arena_t *arena, void *buf);
+
+// scope
+arena_mark_t arena_get_mark(const arena_t *arena);
+void         arena_rewind  (arena_t *arena, arena_mark_t mark);
+void         arena_reset   (arena_t *arena);
+
+// information
+size_t arena_get_used_size(const arena_t *arena);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "container/list.h"
+#include "arena.h"
+#include "memobj.h"
+#include "slab.h"
+#include "systime.h"
+
+#define BENCH_BUFFERS  16   // Buffers built in a request.
+#define BENCH_APPENDS  32   // Appends to each buffer.
+#define BENCH_NODES    256  // List nodes in a request.
+#define BENCH_DURATION 500  // Milliseconds.
+
+static const char line[] = "Accept-Encoding: gzip, deflate, br\r\n";
+
+typedef void(*bench_func_t)(arena_t *arena);
+
+//------------------------------------------------------------------------------
+void bench_request_malloc(arena_t *arena)
+{
+    // Build temporary buffers and a list, and free them piece by piece.
+    mem_t   bufs[BENCH_BUFFERS];
+    glist_t list;
+
+    (void) arena;
+
+    glist_init(&list, NULL);
+    for(int i=0; i<BENCH_BUFFERS; ++i)
+    {
+        mem_init(&bufs[i], 0);
+        for(int j=0; j<BENCH_APPENDS; ++j)
+            mem_append(&bufs[i], line, sizeof(line) - 1);
+    }
+    for(int i=0; i<BENCH_NODES; ++i)
+        glist_push_back(&list, bufs[ i % BENCH_BUFFERS ].buf);
+
+    glist_deinit(&list);
+    for(int i=0; i<BENCH_BUFFERS; ++i)
+        mem_deinit(&bufs[i]);
+}
+//------------------------------------------------------------------------------
+void bench_request_arena(arena_t *arena)
+{
+    // Build temporary buffers and a list from an arena, and drop them all at once.
+    mem_t   bufs[BENCH_BUFFERS];
+    slab_t  slab;
+    glist_t list;
+
+    slab_init_arena(&slab, sizeof(glist_node_t), 0, arena);
+    glist_init_slab(&list, NULL, &slab);
+    for(int i=0; i<BENCH_BUFFERS; ++i)
+    {
+        mem_init_arena(&bufs[i], 0, arena);
+        for(int j=0; j<BENCH_APPENDS; ++j)
+            mem_append(&bufs[i], line, sizeof(line) - 1);
+    }
+    for(int i=0; i<BENCH_NODES; ++i)
+        glist_push_back(&list, bufs[ i % BENCH_BUFFERS ].buf);
+
+    arena_reset(arena);
+}
+//------------------------------------------------------------------------------
+double bench_rounds(bench_func_t func, arena_t *arena)
+{
+    // Run the function repeatedly in a period of time, and return the rounds per second.
+    unsigned rounds = 0;
+
+    func(arena);  // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(arena);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    return rounds / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+int main(void)
+{
+    arena_t arena;
+
+    arena_init(&arena, 0);
+
+    double speed_malloc = bench_rounds(bench_request_malloc, NULL);
+    double speed_arena  = bench_rounds(bench_request_arena, &arena);
+
+    printf("Request : %d buffers of %d appends, %d list nodes\n",
+           BENCH_BUFFERS,
+           BENCH_APPENDS,
+           BENCH_NODES);
+    printf("malloc/free : %10.1f requests/s\n", speed_malloc);
+    printf("arena       : %10.1f requests/s (x%.2f)\n", speed_arena, speed_arena / speed_malloc);
+
+    arena_deinit(&arena);
+    return 0;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,128 @@
+#include <assert.h>
+#include <stdalign.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "arena.h"
+
+#ifdef NDEBUG
+    #error This test program must work with macro "ASSERT" enabled!
+#endif
+
+#define TEST_BUFFERS 1000
+
+//------------------------------------------------------------------------------
+void test_allocate(void)
+{
+    static unsigned char *bufs[TEST_BUFFERS];
+    arena_t               arena;
+
+    arena_init(&arena, 1024);
+    assert( 0 == arena_get_used_size(&arena) );
+
+    // Buffers are aligned and not overlapped, over many chunks and larger than a chunk.
+    for(int i=0; i<TEST_BUFFERS; ++i)
+    {
+        size_t size = ( i % 100 == 99 )?( 4000 ):( 1 + i % 37 );
+
+        bufs[i] = arena_allocate(&arena, size);
+        assert( bufs[i] );
+        assert( (uintptr_t) bufs[i] % alignof(max_align_t) == 0 );
+        memset(bufs[i], i & 0xFF, size);
+    }
+    assert( arena_get_used_size(&arena) > 4000 * ( TEST_BUFFERS / 100 ) );
+
+    for(int i=0; i<TEST_BUFFERS; ++i)
+    {
+        size_t size = ( i % 100 == 99 )?( 4000 ):( 1 + i % 37 );
+        for(size_t j=0; j<size; ++j) assert( bufs[i][j] == ( i & 0xFF ) );
+    }
+
+    // Reset, and the space is reused.
+    arena_reset(&arena);
+    assert( 0 == arena_get_used_size(&arena) );
+    assert( arena_allocate(&arena, 16) );
+    assert( 16 <= arena_get_used_size(&arena) );
+
+    arena_deinit(&arena);
+    assert( 0 == arena_get_used_size(&arena) );
+}
+//------------------------------------------------------------------------------
+void test_reallocate(void)
+{
+    arena_t  arena;
+    char    *buf1, *buf2, *buf3;
+
+    arena_init(&arena, 1024);
+
+    // The last buffer grows in place.
+    buf1 = arena_reallocate(&arena, NULL, 0, 10);
+    memcpy(buf1, "0123456789", 10);
+    assert( buf1 == arena_reallocate(&arena, buf1, 10, 100) );
+    assert( 0 == memcmp(buf1, "0123456789", 10) );
+
+    // Other buffers are moved to grow, and kept to shrink.
+    buf2 = arena_allocate(&arena, 10);
+    assert( buf1 == arena_reallocate(&arena, buf1, 100, 50) );
+    buf3 = arena_reallocate(&arena, buf1, 100, 200);
+    assert( buf3 && buf3 != buf1 && buf3 > buf2 );
+    assert( 0 == memcmp(buf3, "0123456789", 10) );
+
+    // The last buffer is moved to a new chunk if the chunk is full.
+    buf1 = arena_reallocate(&arena, buf3, 200, 2000);
+    assert( buf1 && buf1 != buf3 );
+    assert( 0 == memcmp(buf1, "0123456789", 10) );
+
+    // The space of the last buffer is reused after released.
+    arena_deallocate(&arena, buf1);
+    assert( buf1 == arena_allocate(&arena, 8) );
+    arena_deallocate(&arena, buf2);
+    arena_deallocate(&arena, NULL);
+
+    arena_deinit(&arena);
+}
+//------------------------------------------------------------------------------
+void test_rewind(void)
+{
+    arena_t       arena;
+    arena_mark_t  mark_empty, mark;
+    void         *buf;
+    size_t        size;
+
+    arena_init(&arena, 256);
+    mark_empty = arena_get_mark(&arena);
+
+    assert( arena_allocate(&arena, 100) );
+    mark = arena_get_mark(&arena);
+    size = arena_get_used_size(&arena);
+
+    // Rewind over many chunks.
+    buf = arena_allocate(&arena, 100);
+    for(int i=0; i<100; ++i) assert( arena_allocate(&arena, 100) );
+    assert( arena_get_used_size(&arena) > 100 * 100 );
+
+    arena_rewind(&arena, mark);
+    assert( size == arena_get_used_size(&arena) );
+    assert( buf == arena_allocate(&arena, 100) );
+
+    // Rewind to the empty arena.
+    arena_rewind(&arena, mark_empty);
+    assert( 0 == arena_get_used_size(&arena) );
+    assert( arena_allocate(&arena, 100) );
+
+    arena_deinit(&arena);
+}
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    test_allocate();
+    test_reallocate();
+    test_rewind();
+
+    return 0;
+}
+//------------------------------------------------------------------------------
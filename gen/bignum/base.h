@@ -27,6 +27,9 @@ bool uintbig_is_lessthen  (const uintbig_t *obj1, const uintbig_t *obj2);
 bool uintbig_is_greatequal(const uintbig_t *obj1, const uintbig_t *obj2);
 bool uintbig_is_lessequal (const uintbig_t *obj1, const uintbig_t *obj2);
 
+int  uintbig_ct_compare(const uintbig_t *obj1, const uintbig_t *obj2);
+void uintbig_ct_swap   (uintbig_t *obj1, uintbig_t *obj2, bool swap);
+
 uintbig_t uintbig_and(const uintbig_t *obj1, const uintbig_t *obj2);
 uintbig_t uintbig_or (const uintbig_t *obj1, const uintbig_t *obj2);
 uintbig_t uintbig_xor(const uintbig_t *obj1, const uintbig_t *obj2);
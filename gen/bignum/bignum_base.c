@@ -128,6 +128,58 @@ bool uintbig_is_lessequal (const uintbig_t *obj1, const uintbig_t *obj2)
     return false;
 }
 //------------------------------------------------------------------------------
+int uintbig_ct_compare(const uintbig_t *obj1, const uintbig_t *obj2)
+{
+    /**
+     * 以固定時間比較數值大小
+     * @return : obj1 小於、等於、大於 obj2 時，分別傳回 -1、0、1。
+     * Note : 所有 BIGNUM_DIGSZ 個位數都會被比較，不會依數值提早結束或產生分支，
+     *        適用於私密資料的比較；物件不可為 NaN。
+     */
+    unsigned gt = 0, lt = 0;
+    int      i;
+
+    assert( obj1 && obj2 );
+
+    for(i=BIGNUM_DIGSZ-1; i>=0; --i)
+    {
+        unsigned x = obj1->digit[i];
+        unsigned y = obj2->digit[i];
+        unsigned undecided = ~( gt | lt ) & 1;
+
+        // The sign bit of the difference tells the order, and the first different digit decides.
+        gt |= ( ( y - x ) >> ( sizeof(unsigned) * 8 - 1 ) ) & undecided;
+        lt |= ( ( x - y ) >> ( sizeof(unsigned) * 8 - 1 ) ) & undecided;
+    }
+
+    return (int) gt - (int) lt;
+}
+//------------------------------------------------------------------------------
+void uintbig_ct_swap(uintbig_t *obj1, uintbig_t *obj2, bool swap)
+{
+    /**
+     * 以固定時間進行條件交換：swap 為 TRUE 時交換兩個物件的數值，否則保持不變。
+     * Note : 兩種情況下的運算與記憶體存取都相同。
+     */
+    uint8_t mask  = 0 - (uint8_t) swap;
+    int     imask = 0 - (int) swap;
+    int     d, i;
+
+    assert( obj1 && obj2 );
+
+    for(i=0; i<BIGNUM_DIGSZ; ++i)
+    {
+        uint8_t t = ( obj1->digit[i] ^ obj2->digit[i] ) & mask;
+
+        obj1->digit[i] ^= t;
+        obj2->digit[i] ^= t;
+    }
+
+    d = ( obj1->ndig ^ obj2->ndig ) & imask;
+    obj1->ndig ^= d;
+    obj2->ndig ^= d;
+}
+//------------------------------------------------------------------------------
 uintbig_t uintbig_and(const uintbig_t *obj1, const uintbig_t *obj2)
 {
     uintbig_t ret;
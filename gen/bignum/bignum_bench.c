@@ -0,0 +1,505 @@
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "../systime.h"
+#include "./const.h"
+#include "./io.h"
+#include "./math.h"
+#include "./mont.h"
+#include "./prime.h"
+#include "./var.h"
+
+#if BIGNUM_DIGSZ < 512
+    #error This benchmark must run with BIGNUM_DIGSZ great equal to 512!
+#endif
+
+#define BENCH_DURATION       1000 // Milliseconds.
+#define BENCH_LIMBS_DURATION 200  // Milliseconds.
+
+typedef uintbig_t(*bench_func_t)(const uintbig_t *a, const uintbig_t *b, const uintbig_t *n);
+typedef uintbig_t(*bench_prime_func_t)(unsigned ndig, mt_rand64_t *rndobj, unsigned threads);
+typedef size_t(*bench_to_dec_func_t)(char *buf, size_t bufsz, const uintbig_t *obj);
+typedef uintbig_t(*bench_from_dec_func_t)(const char *str);
+typedef bool(*bench_var_func_t)(uintvar_t *r, const uintvar_t *a, const uintvar_t *b, const uintvar_t *n);
+typedef void(*bench_limbs_func_t)(limb_t *r, const limb_t *a, const limb_t *b, int n, limb_t *ws);
+
+//------------------------------------------------------------------------------
+void bench_mul_comba(limb_t *r, const limb_t *a, const limb_t *b, int n, limb_t *ws)
+{
+    limbs_mul_comba(r, a, n, b, n);
+}
+//------------------------------------------------------------------------------
+void bench_mul_karatsuba(limb_t *r, const limb_t *a, const limb_t *b, int n, limb_t *ws)
+{
+    // One level of Karatsuba, and Comba for the sub-products.
+    limbs_mul_karatsuba(r, a, b, n, n, ws);
+}
+//------------------------------------------------------------------------------
+void bench_sqr_comba(limb_t *r, const limb_t *a, const limb_t *b, int n, limb_t *ws)
+{
+    limbs_sqr_comba(r, a, n);
+}
+//------------------------------------------------------------------------------
+void bench_sqr_karatsuba(limb_t *r, const limb_t *a, const limb_t *b, int n, limb_t *ws)
+{
+    limbs_sqr_karatsuba(r, a, n, n, ws);
+}
+//------------------------------------------------------------------------------
+double bench_limbs_ns(bench_limbs_func_t func, int n)
+{
+    // Run the function repeatedly in a period of time, and return the nanoseconds per call.
+    static limb_t a [BIGNUM_LIMBS];
+    static limb_t b [BIGNUM_LIMBS];
+    static limb_t r [2*BIGNUM_LIMBS];
+    static limb_t ws[ LIMBS_KARATSUBA_WORKSPACE(BIGNUM_LIMBS) ];
+    unsigned      rounds = 0;
+
+    for(int i=0; i<n; ++i)
+    {
+        a[i] = (limb_t) 0x9E3779B97F4A7C15ULL * ( i + 1 );
+        b[i] = (limb_t) 0xC2B2AE3D27D4EB4FULL * ( i + 1 );
+    }
+
+    func(r, a, b, n, ws);  // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        for(int i=0; i<64; ++i)
+        {
+            func(r, a, b, n, ws);
+            a[0] ^= r[n];   // Keep the calls from being optimized out.
+        }
+        rounds += 64;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_LIMBS_DURATION );
+
+    return time_passed * 1e6 / rounds;
+}
+//------------------------------------------------------------------------------
+int bench_print_threshold(const char *name, bench_limbs_func_t comba, bench_limbs_func_t karatsuba)
+{
+    /*
+     * Compare Comba's method with one level of Karatsuba's method for some operand sizes,
+     * and return the smallest size from which Karatsuba's method keeps winning.
+     */
+    static const int sizes[] = { 4, 8, 12, 16, 20, 24, 32, 40, 48, 56, 64 };
+    int threshold = 0;
+
+    for(size_t i=0; i<sizeof(sizes)/sizeof(sizes[0]); ++i)
+    {
+        int n = sizes[i];
+        if( n > BIGNUM_LIMBS ) break;
+
+        double time_comba = bench_limbs_ns(comba    , n);
+        double time_kara  = bench_limbs_ns(karatsuba, n);
+
+        printf("%s %3d limbs  comba: %9.1f ns, karatsuba: %9.1f ns (x%.2f)\n",
+               name,
+               n,
+               time_comba,
+               time_kara,
+               time_comba / time_kara);
+
+        if( time_kara >= time_comba )
+            threshold = 0;
+        else if( !threshold )
+            threshold = n;
+    }
+
+    return threshold;
+}
+//------------------------------------------------------------------------------
+uintbig_t bench_powermod_division(const uintbig_t *a, const uintbig_t *b, const uintbig_t *n)
+{
+    // The square-and-multiply method with a long division for every step,
+    // which is the way uintbig_powermod worked before the Montgomery reduction.
+    uintbig_t ret = uintbig_const_one;
+    int       idig, ibit;
+
+    for(idig=b->ndig-1; idig>=0; --idig)
+    {
+        uint8_t mask = 0x80;
+
+        for(ibit=8; ibit; --ibit, mask>>=1)
+        {
+            ret = uintbig_mul(&ret, &ret);
+            ret = uintbig_mod(&ret, n);
+            if( b->digit[idig] & mask )
+            {
+                ret = uintbig_mul(&ret, a);
+                ret = uintbig_mod(&ret, n);
+            }
+        }
+    }
+
+    return ret;
+}
+//------------------------------------------------------------------------------
+uintbig_t bench_powermod_mont(const uintbig_t *a, const uintbig_t *b, const uintbig_t *n)
+{
+    // The Montgomery context is initialized on every call, as uintbig_powermod does.
+    uintbig_mont_t ctx;
+
+    uintbig_mont_init(&ctx, n);
+    return uintbig_mont_powermod(&ctx, a, b);
+}
+//------------------------------------------------------------------------------
+uintbig_t bench_powermod_ct(const uintbig_t *a, const uintbig_t *b, const uintbig_t *n)
+{
+    uintbig_mont_t ctx;
+
+    uintbig_mont_init(&ctx, n);
+    return uintbig_mont_powermod_ct(&ctx, a, b);
+}
+//------------------------------------------------------------------------------
+double bench_ops(bench_func_t func, const uintbig_t *a, const uintbig_t *b, const uintbig_t *n)
+{
+    // Run the function repeatedly in a period of time, and return the operations per second.
+    unsigned rounds = 0;
+
+    func(a, b, n);  // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(a, b, n);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    return rounds / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_print_powermod(unsigned bits, mt_rand64_t *rndobj)
+{
+    // Modulus and exponent with full size, and the highest bit and the lowest bit set.
+    unsigned  ndig = bits / 8;
+    uintbig_t n    = uintbig_rand_ndig(ndig, rndobj);
+    uintbig_t b    = uintbig_rand_ndig(ndig, rndobj);
+    uintbig_t a;
+
+    n.digit[0]      |= 0x01;
+    n.digit[ndig-1] |= 0x80;
+    n.ndig           = ndig;
+    b.digit[ndig-1] |= 0x80;
+    b.ndig           = ndig;
+    a = uintbig_rand_range(&uintbig_const_two, &n, rndobj);
+
+    uintbig_t r0 = bench_powermod_division(&a, &b, &n);
+    uintbig_t r1 = bench_powermod_mont    (&a, &b, &n);
+    if( !uintbig_is_equal(&r0, &r1) )
+    {
+        printf("powermod %4u bits : results mismatch!\n", bits);
+        return;
+    }
+
+    double speed_base = bench_ops(bench_powermod_division, &a, &b, &n);
+    double speed_fast = bench_ops(bench_powermod_mont    , &a, &b, &n);
+
+    printf("powermod %4u bits  division: %9.2f ops/s, montgomery: %9.2f ops/s (x%.2f)\n",
+           bits,
+           speed_base,
+           speed_fast,
+           speed_fast / speed_base);
+
+    // The overhead of the constant time mode against the fast path.
+    uintbig_t r2 = bench_powermod_ct(&a, &b, &n);
+    if( !uintbig_is_equal(&r0, &r2) )
+    {
+        printf("powermod %4u bits : constant time results mismatch!\n", bits);
+        return;
+    }
+
+    double speed_ct = bench_ops(bench_powermod_ct, &a, &b, &n);
+
+    printf("powermod %4u bits  montgomery: %9.2f ops/s, constant time: %9.2f ops/s (overhead x%.2f)\n",
+           bits,
+           speed_fast,
+           speed_ct,
+           speed_fast / speed_ct);
+}
+//------------------------------------------------------------------------------
+uintbig_t bench_mul_fixed(const uintbig_t *a, const uintbig_t *b, const uintbig_t *n)
+{
+    return uintbig_mul(a, b);
+}
+//------------------------------------------------------------------------------
+bool bench_mul_var(uintvar_t *r, const uintvar_t *a, const uintvar_t *b, const uintvar_t *n)
+{
+    return uintvar_mul(r, a, b);
+}
+//------------------------------------------------------------------------------
+uintbig_t bench_powermod_fixed(const uintbig_t *a, const uintbig_t *b, const uintbig_t *n)
+{
+    return uintbig_powermod(a, b, n);
+}
+//------------------------------------------------------------------------------
+double bench_var_ops(bench_var_func_t func, const uintvar_t *a, const uintvar_t *b, const uintvar_t *n)
+{
+    // The same as bench_ops, for the variable length numbers.
+    uintvar_t r      = UINTVAR_INIT;
+    unsigned  rounds = 0;
+
+    func(&r, a, b, n);  // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(&r, a, b, n);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    uintvar_deinit(&r);
+    return rounds / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_print_var(const char *name, unsigned bits, bench_func_t fixed, bench_var_func_t var, mt_rand64_t *rndobj)
+{
+    // Compare the fixed length numbers of BIGNUM_DIGSZ bytes with the variable length numbers.
+    unsigned  ndig = bits / 8;
+    uintbig_t n    = uintbig_rand_ndig(ndig, rndobj);
+    uintbig_t b    = uintbig_rand_ndig(ndig, rndobj);
+    uintbig_t a    = uintbig_rand_ndig(ndig, rndobj);
+    uintvar_t vn   = UINTVAR_INIT;
+    uintvar_t vb   = UINTVAR_INIT;
+    uintvar_t va   = UINTVAR_INIT;
+    uintvar_t vr   = UINTVAR_INIT;
+    uintbig_t r0, r1;
+
+    n.digit[0]      |= 0x01;
+    n.digit[ndig-1] |= 0x80;
+    n.ndig           = ndig;
+
+    uintvar_from_uintbig(&vn, &n);
+    uintvar_from_uintbig(&vb, &b);
+    uintvar_from_uintbig(&va, &a);
+
+    r0 = fixed(&a, &b, &n);
+    var(&vr, &va, &vb, &vn);
+    if( !uintvar_to_uintbig(&r1, &vr) || !uintbig_is_equal(&r0, &r1) )
+    {
+        printf("%-8s %4u bits : results mismatch!\n", name, bits);
+    }
+    else
+    {
+        double speed_fixed = bench_ops    (fixed, &a , &b , &n );
+        double speed_var   = bench_var_ops(var  , &va, &vb, &vn);
+
+        printf("%-8s %4u bits  fixed: %12.2f ops/s, variable: %12.2f ops/s (x%.2f)\n",
+               name,
+               bits,
+               speed_fixed,
+               speed_var,
+               speed_var / speed_fixed);
+    }
+
+    uintvar_deinit(&vn);
+    uintvar_deinit(&vb);
+    uintvar_deinit(&va);
+    uintvar_deinit(&vr);
+}
+//------------------------------------------------------------------------------
+size_t bench_to_dec_division(char *buf, size_t bufsz, const uintbig_t *obj)
+{
+    // Divide the number by ten for every digit, which is the plain way with uintbig_divmod.
+    uintbig_t ten = uintbig_from_int(10);
+    uintbig_t val = *obj;
+    size_t    n   = 0;
+
+    do
+    {
+        uintbig_t quo, rem;
+
+        uintbig_divmod(&val, &ten, &quo, &rem);
+        buf[ n++ ] = '0' + rem.digit[0];
+        val = quo;
+    } while( !uintbig_is_zero(&val) && n < bufsz );
+
+    for(size_t i=0; i<n/2; ++i)
+    {
+        char c = buf[i];
+        buf[i]           = buf[ n - 1 - i ];
+        buf[ n - 1 - i ] = c;
+    }
+    buf[n] = 0;
+
+    return n + 1;
+}
+//------------------------------------------------------------------------------
+uintbig_t bench_from_dec_multiply(const char *str)
+{
+    // Multiply the number by ten and add a digit for every character.
+    uintbig_t ten = uintbig_from_int(10);
+    uintbig_t ret = uintbig_const_zero;
+
+    for(; *str; ++str)
+    {
+        uintbig_t dig = uintbig_from_int(*str - '0');
+
+        ret = uintbig_mul(&ret, &ten);
+        ret = uintbig_add(&ret, &dig);
+    }
+
+    return ret;
+}
+//------------------------------------------------------------------------------
+double bench_to_dec_us(bench_to_dec_func_t func, const uintbig_t *obj, char *buf, size_t bufsz)
+{
+    // Convert repeatedly in a period of time, and return the microseconds per conversion.
+    unsigned rounds = 0;
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(buf, bufsz, obj);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_LIMBS_DURATION );
+
+    return time_passed * 1e3 / rounds;
+}
+//------------------------------------------------------------------------------
+double bench_from_dec_us(bench_from_dec_func_t func, const char *str)
+{
+    unsigned rounds = 0;
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(str);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_LIMBS_DURATION );
+
+    return time_passed * 1e3 / rounds;
+}
+//------------------------------------------------------------------------------
+void bench_print_dec(unsigned bits, mt_rand64_t *rndobj)
+{
+    static char buf0[ 3 * BIGNUM_DIGSZ ];
+    static char buf1[ 3 * BIGNUM_DIGSZ ];
+    uintbig_t   val = uintbig_rand_ndig(bits / 8, rndobj);
+    uintbig_t   res;
+
+    bench_to_dec_division(buf0, sizeof(buf0), &val);
+    uintbig_to_dec(buf1, sizeof(buf1), &val);
+    res = uintbig_from_dec(buf1);
+    if( strcmp(buf0, buf1) || !uintbig_is_equal(&res, &val) )
+    {
+        printf("decimal  %4u bits : results mismatch!\n", bits);
+        return;
+    }
+
+    double time_to_base   = bench_to_dec_us  (bench_to_dec_division  , &val, buf0, sizeof(buf0));
+    double time_to_fast   = bench_to_dec_us  (uintbig_to_dec         , &val, buf0, sizeof(buf0));
+    double time_from_base = bench_from_dec_us(bench_from_dec_multiply, buf1);
+    double time_from_fast = bench_from_dec_us(uintbig_from_dec       , buf1);
+
+    printf("to_dec   %4u bits  division: %9.2f us, chunks: %9.2f us (x%.2f)\n",
+           bits,
+           time_to_base,
+           time_to_fast,
+           time_to_base / time_to_fast);
+    printf("from_dec %4u bits  multiply: %9.2f us, chunks: %9.2f us (x%.2f)\n",
+           bits,
+           time_from_base,
+           time_from_fast,
+           time_from_base / time_from_fast);
+}
+//------------------------------------------------------------------------------
+uintbig_t bench_prime_rand(unsigned ndig, mt_rand64_t *rndobj, unsigned threads)
+{
+    // Test random candidates by Miller-Rabin until a prime be found,
+    // which is the way rsa_generate_keys worked before the prime search.
+    uintbig_t ret;
+
+    do
+    {
+        ret = uintbig_rand_ndig(ndig, rndobj);
+        ret.digit[     0] |= 0x01;
+        ret.digit[ndig-1] |= 0xC0;
+        ret.ndig           = ndig;
+    } while( !uintbig_prime_test(&ret, 8, rndobj) );
+
+    return ret;
+}
+//------------------------------------------------------------------------------
+uintbig_t bench_prime_search(unsigned ndig, mt_rand64_t *rndobj, unsigned threads)
+{
+    return uintbig_prime_search(ndig, 8, rndobj, threads);
+}
+//------------------------------------------------------------------------------
+double bench_prime_ms(bench_prime_func_t func, unsigned ndig, mt_rand64_t *rndobj, unsigned threads)
+{
+    // Search primes repeatedly in a period of time, and return the milliseconds per prime.
+    unsigned rounds = 0;
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(ndig, rndobj, threads);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    return (double) time_passed / rounds;
+}
+//------------------------------------------------------------------------------
+void bench_print_prime(unsigned bits, mt_rand64_t *rndobj)
+{
+    double time_rand   = bench_prime_ms(bench_prime_rand  , bits / 8, rndobj, 1);
+    double time_search = bench_prime_ms(bench_prime_search, bits / 8, rndobj, 1);
+    double time_mt     = bench_prime_ms(bench_prime_search, bits / 8, rndobj, 0);
+
+    printf("prime    %4u bits  random: %9.2f ms, search: %9.2f ms (x%.2f), threads: %9.2f ms (x%.2f)\n",
+           bits,
+           time_rand,
+           time_search,
+           time_rand / time_search,
+           time_mt,
+           time_rand / time_mt);
+}
+//------------------------------------------------------------------------------
+int main(void)
+{
+    static const unsigned bits[] = { 512, 1024, 2048 };
+    mt_rand64_t           rndobj;
+
+    int thr_mul = bench_print_threshold("mul", bench_mul_comba, bench_mul_karatsuba);
+    int thr_sqr = bench_print_threshold("sqr", bench_sqr_comba, bench_sqr_karatsuba);
+    printf("measured thresholds (%d bits limbs): BIGNUM_KARATSUBA_MUL_THRESHOLD=%d, BIGNUM_KARATSUBA_SQR_THRESHOLD=%d\n",
+           BIGNUM_LIMB_BITS,
+           thr_mul,
+           thr_sqr);
+    printf("current  thresholds (%d bits limbs): BIGNUM_KARATSUBA_MUL_THRESHOLD=%d, BIGNUM_KARATSUBA_SQR_THRESHOLD=%d\n",
+           BIGNUM_LIMB_BITS,
+           BIGNUM_KARATSUBA_MUL_THRESHOLD,
+           BIGNUM_KARATSUBA_SQR_THRESHOLD);
+
+    uintbig_srand(&rndobj, 1);
+    for(size_t i=0; i<sizeof(bits)/sizeof(bits[0]); ++i)
+        bench_print_powermod(bits[i], &rndobj);
+    for(size_t i=0; i<sizeof(bits)/sizeof(bits[0]); ++i)
+        bench_print_prime(bits[i] / 2, &rndobj);
+    for(size_t i=0; i<sizeof(bits)/sizeof(bits[0]); ++i)
+        bench_print_var("mul", bits[i] / 8, bench_mul_fixed, bench_mul_var, &rndobj);
+    bench_print_var("powermod", 8 * BIGNUM_DIGSZ, bench_powermod_fixed, uintvar_powermod, &rndobj);
+    for(size_t i=0; i<sizeof(bits)/sizeof(bits[0]); ++i)
+        bench_print_dec(bits[i] * 2, &rndobj);
+    uintvar_scratch_release();
+
+    return 0;
+}
+//------------------------------------------------------------------------------
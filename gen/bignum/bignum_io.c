@@ -1,7 +1,6 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <string.h>
-#include <stdio.h>
 
 #ifdef __BORLANDC__
 #pragma hdrstop
@@ -11,6 +10,61 @@
 #include "../minmax.h"
 #include "./const.h"
 #include "./io.h"
+#include "./limb.h"
+
+#define HEX_INVALID 0xFF
+
+/*
+ * Decimal numbers are converted by chunks, and a chunk is the largest power of ten in a limb,
+ * so that one limb division (or multiplication) processes several digits at once.
+ */
+#if BIGNUM_LIMB_BITS == 64
+    #define DEC_CHUNK_BASE   ( (limb_t) 10000000000000000000ULL )
+    #define DEC_CHUNK_DIGITS 19
+#else
+    #define DEC_CHUNK_BASE   ( (limb_t) 1000000000UL )
+    #define DEC_CHUNK_DIGITS 9
+#endif
+
+/*
+ * Numbers with limbs no less than this value are converted to decimal by divide-and-conquer,
+ * they are split by powers of the chunk base, and the parts are converted separately.
+ * The value is measured with 64 bits limbs, and the long division makes the split
+ * cheaper than the chunk divisions from about 2048 bits.
+ */
+#define DEC_DC_THRESHOLD 32
+
+#define DEC_POWERS_MAX ( sizeof(int) * 8 )
+#define DEC_DIGITS_MAX ( BIGNUM_DIGSZ * 5 / 2 + 1 )    // 8*log10(2) < 2.5 digits a byte.
+
+/*
+ * Conversion tables of the hexadecimal characters,
+ * so that a digit is translated by looking up the tables instead of comparing its range.
+ */
+static const char    hex_chars[] = "0123456789ABCDEF";
+static const char    dec_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+static const uint8_t hex_values[256] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
 
 //------------------------------------------------------------------------------
 uintbig_t uintbig_from_bin(const void *src, size_t size)
@@ -66,24 +120,13 @@ uintbig_t uintbig_from_int(uint64_t val)
 INLINE
 bool is_hex_char(char c)
 {
-    return ( '0' <= c && c <= '9' )||
-           ( 'A' <= c && c <= 'F' )||
-           ( 'a' <= c && c <= 'f' );
-}
-//------------------------------------------------------------------------------
-static
-uint8_t hexch_to_num(char c)
-{
-    if     ( '0' <= c && c <= '9' ) return c - '0';
-    else if( 'A' <= c && c <= 'F' ) return c - 'A' + 10;
-    else if( 'a' <= c && c <= 'f' ) return c - 'a' + 10;
-    else                            return 0;
+    return hex_values[ (uint8_t) c ] != HEX_INVALID;
 }
 //------------------------------------------------------------------------------
 INLINE
 uint8_t hexchs_to_bin(char c1, char c0)
 {
-    return ( hexch_to_num(c1) << 4 ) | hexch_to_num(c0);
+    return ( hex_values[ (uint8_t) c1 ] << 4 ) | hex_values[ (uint8_t) c0 ];
 }
 //------------------------------------------------------------------------------
 uintbig_t uintbig_from_hex(const char *str)
@@ -125,7 +168,7 @@ uintbig_t uintbig_from_hex(const char *str)
     }
     if( ++str == str0 )
     {
-        *digbuf = hexchs_to_bin(0, *str);
+        *digbuf = hex_values[ (uint8_t) *str ];
     }
 
     ret.ndig = uintbig_get_digit_usage(ret.digit);
@@ -133,6 +176,57 @@ uintbig_t uintbig_from_hex(const char *str)
     return ret;
 }
 //------------------------------------------------------------------------------
+uintbig_t uintbig_from_dec(const char *str)
+{
+    /**
+     * 讀取十進位字串表達的數值並匯入物件
+     * @str    : 來源字串，並注意：
+     *           1. 字串分析與轉換將從第一個數字字元起始，
+     *              至開始之後的第一個非數字字元或字串結尾中止。
+     *           2. 物件無法容納的數值將會被截斷(從數位較大的一端截斷)
+     * @return : 轉換成功傳回含有數值資訊的物件；失敗時傳回意義為 NAN 的物件。
+     */
+    limb_t    x[BIGNUM_LIMBS];
+    int       nx = 0;
+    uintbig_t ret;
+
+    if( !str ) return uintbig_const_nan;
+
+    // Find string start
+    while( *str && !( '0' <= *str && *str <= '9' ) ) ++str;
+    if( *str == 0 ) return uintbig_const_nan;
+
+    // x = x * 10^k + chunk, for every chunk of 'k' digits
+    while( '0' <= *str && *str <= '9' )
+    {
+        limb_t chunk = 0;
+        limb_t mul   = 1;
+        limb_t carry;
+        int    i;
+
+        for(i=0; i<DEC_CHUNK_DIGITS && '0' <= *str && *str <= '9'; ++i, ++str)
+        {
+            chunk = chunk * 10 + ( *str - '0' );
+            mul  *= 10;
+        }
+
+        carry = chunk;
+        for(i=0; i<nx; ++i)
+            x[i] = limb_mul_add(x[i], mul, carry, 0, &carry);
+        if( carry && nx < BIGNUM_LIMBS )
+            x[ nx++ ] = carry;
+    }
+
+    if( nx )
+        limbs_store(&ret, x, nx);
+    else
+        ret = uintbig_const_zero;
+
+    memset(x, 0, sizeof(x));
+
+    return ret;
+}
+//------------------------------------------------------------------------------
 uint64_t uintbig_to_int(const uintbig_t *obj)
 {
     /**
@@ -179,7 +273,254 @@ size_t uintbig_to_str(char *buf, size_t bufsz, const uintbig_t *obj)
         if( bufsz < wcnt ) return 0;
 
         for(i=obj->ndig-1; i>=0; --i, buf+=2)
-            sprintf(buf, "%2.2X", obj->digit[i]);
+        {
+            buf[0] = hex_chars[ obj->digit[i] >> 4   ];
+            buf[1] = hex_chars[ obj->digit[i] & 0x0F ];
+        }
+        *buf = 0;
+    }
+    else
+    {
+        switch( obj->ndig )
+        {
+        case -1:
+            wcnt = strlen("NAN") + 1;
+            if( bufsz < wcnt ) return 0;
+            strcpy(buf, "NAN");
+            break;
+        default:
+            return 0;
+        }
+    }
+
+    return wcnt;
+}
+//------------------------------------------------------------------------------
+static
+int limbs_trim(const limb_t *x, int n)
+{
+    while( n && !x[n-1] ) --n;
+    return n;
+}
+//------------------------------------------------------------------------------
+static
+void dec_write_chunk(char *end, limb_t val, int ndigits)
+{
+    // Write 'ndigits' digits of the value backward from the end, two digits a step.
+    while( ndigits >= 2 )
+    {
+        int k = ( val % 100 ) << 1;
+
+        val     /= 100;
+        end     -= 2;
+        end[0]   = dec_pairs[k];
+        end[1]   = dec_pairs[k+1];
+        ndigits -= 2;
+    }
+    if( ndigits )
+        *--end = '0' + val % 10;
+}
+//------------------------------------------------------------------------------
+static
+void dec_convert_chunks(char         /*out*/ *out,
+                        int          /*in */  ndigits,
+                        const limb_t /*in */ *x,
+                        int          /*in */  n,
+                        limb_t       /*tmp*/ *ws)
+{
+    /*
+     * Write exactly 'ndigits' digits of 'x' (padded by zeros) by dividing the chunk base repeatedly.
+     * @ws : Work space with 'n' limbs at least.
+     */
+    char *end = out + ndigits;
+
+    memcpy(ws, x, n * sizeof(limb_t));
+    n = limbs_trim(ws, n);
+
+    while( n && end > out )
+    {
+        limb_t rem = limbs_divmod_limb(ws, ws, n, DEC_CHUNK_BASE);
+        int    cnt = MIN( DEC_CHUNK_DIGITS , end - out );
+
+        n = limbs_trim(ws, n);
+        dec_write_chunk(end, rem, cnt);
+        end -= cnt;
+    }
+
+    memset(out, '0', end - out);
+}
+//------------------------------------------------------------------------------
+static
+void dec_divmod(limb_t       /*out*/ *quo,
+                limb_t       /*out*/ *rem,
+                const limb_t /*in */ *u,
+                int          /*in */  m,
+                const limb_t /*in */ *v,
+                int          /*in */  n,
+                limb_t       /*tmp*/ *ws)
+{
+    /*
+     * quo = u / v with max(m-n+1,1) limbs, and rem = u mod v with 'n' limbs,
+     * the highest limb of 'v' must not be zero.
+     */
+    if( m < n )
+    {
+        quo[0] = 0;
+        memcpy(rem, u, m * sizeof(limb_t));
+        memset(rem + m, 0, ( n - m ) * sizeof(limb_t));
+    }
+    else if( n == 1 )
+    {
+        rem[0] = limbs_divmod_limb(quo, u, m, v[0]);
+    }
+    else
+    {
+        limbs_divmod(quo, rem, u, m, v, n, ws);
+    }
+}
+//------------------------------------------------------------------------------
+typedef struct dec_powers_t
+{
+    const limb_t *p[DEC_POWERS_MAX];    // DEC_CHUNK_BASE^(2^k)
+    int           n[DEC_POWERS_MAX];    // Number of limbs of the powers.
+} dec_powers_t;
+
+//------------------------------------------------------------------------------
+static
+void dec_convert(char               /*out*/ *out,
+                 const limb_t       /*in */ *x,
+                 int                /*in */  n,
+                 int                /*in */  level,
+                 const dec_powers_t /*in */ *pows,
+                 limb_t             /*tmp*/ *ws)
+{
+    /*
+     * Write exactly DEC_CHUNK_DIGITS*2^level digits of 'x',
+     * and 'x' must be less than the power of the level.
+     * The number is split into the quotient and the remainder of the power of the lower level,
+     * and both of them have half the digits.
+     */
+    const limb_t *v;
+    int           nv, nq, half;
+    limb_t       *q, *r;
+
+    n = limbs_trim(x, n);
+    if( !level || n < DEC_DC_THRESHOLD )
+    {
+        dec_convert_chunks(out, DEC_CHUNK_DIGITS << level, x, n, ws);
+        return;
+    }
+
+    v    = pows->p[ level - 1 ];
+    nv   = pows->n[ level - 1 ];
+    nq   = MAX( n - nv + 1 , 1 );
+    half = DEC_CHUNK_DIGITS << ( level - 1 );
+    q    = ws;
+    r    = q + nq;
+    dec_divmod(q, r, x, n, v, nv, r + nv);
+
+    dec_convert(out       , q, nq, level - 1, pows, r + nv);
+    dec_convert(out + half, r, nv, level - 1, pows, r + nv);
+}
+//------------------------------------------------------------------------------
+static
+char* dec_from_limbs(char *end, limb_t *x, int n)
+{
+    /*
+     * Write the decimal digits of 'x' backward from the end, and return the start of the digits.
+     * The content of 'x' will be destroyed.
+     */
+    limb_t       pool[ 2 * BIGNUM_LIMBS + DEC_POWERS_MAX ];
+    limb_t       ws  [ 8 * BIGNUM_LIMBS + 4 * DEC_POWERS_MAX ];
+    dec_powers_t pows;
+    limb_t      *pnext = pool;
+    int          level = 0;
+    char        *str   = end;
+
+    n = limbs_trim(x, n);
+
+    // Powers of the chunk base, up to about a quarter to a half of the number.
+    pool[0]   = DEC_CHUNK_BASE;
+    pows.p[0] = pnext;
+    pows.n[0] = 1;
+    pnext    += 1;
+    while( n >= DEC_DC_THRESHOLD && 4 * pows.n[level] - 1 <= n && level + 1 < (int) DEC_POWERS_MAX )
+    {
+        limbs_sqr(pnext, pows.p[level], pows.n[level]);
+        ++level;
+        pows.p[level] = pnext;
+        pows.n[level] = limbs_trim(pnext, 2 * pows.n[ level - 1 ]);
+        pnext        += pows.n[level];
+    }
+
+    // Split the lower parts of the highest power from the number, and convert them separately.
+    // A limb has one more digit than a chunk at most, and zero has one digit.
+    if( !level )
+    {
+        int ndigits = MAX( n , 1 ) * ( DEC_CHUNK_DIGITS + 1 );
+
+        str -= ndigits;
+        dec_convert_chunks(str, ndigits, x, n, ws);
+    }
+    else
+    {
+        const limb_t *v  = pows.p[level];
+        int           nv = pows.n[level];
+
+        while( n >= nv )
+        {
+            limb_t *q = ws;
+            limb_t *r = q + ( n - nv + 1 );
+
+            dec_divmod(q, r, x, n, v, nv, r + nv);
+            str -= DEC_CHUNK_DIGITS << level;
+            dec_convert(str, r, nv, level, &pows, r + nv);
+
+            n = limbs_trim(q, n - nv + 1);
+            memcpy(x, q, n * sizeof(limb_t));
+        }
+
+        str -= DEC_CHUNK_DIGITS << level;
+        dec_convert(str, x, n, level, &pows, ws);
+    }
+
+    // Remove the leading zeros.
+    while( *str == '0' && str + 1 < end ) ++str;
+
+    memset(pool, 0, sizeof(pool));
+    memset(ws  , 0, sizeof(ws  ));
+
+    return str;
+}
+//------------------------------------------------------------------------------
+size_t uintbig_to_dec(char *buf, size_t bufsz, const uintbig_t *obj)
+{
+    /**
+     * 將物件內容數值轉換為十進位字串
+     * @buf    : 接收轉換後字串的緩衝區
+     * @bufsz  : 緩衝區大小
+     * @obj    : 物件
+     * @return : 轉換成功時傳回寫入緩衝區的字元組數；轉換失敗傳回零。
+     * Note : 數值以機器字組所能容納的最大十的次方為單位轉換，
+     *        較大的數值則先以十的次方分割為較小的部份再分別轉換。
+     */
+    char   digits[ 2 * DEC_DIGITS_MAX + 2 * DEC_CHUNK_DIGITS ];
+    limb_t x[BIGNUM_LIMBS];
+    char  *str;
+    size_t wcnt;
+
+    if( !buf || !obj ) return 0;
+
+    if( obj->ndig > 0 )
+    {
+        int n = limbs_load(x, obj);
+
+        str  = dec_from_limbs(digits + sizeof(digits), x, n);
+        wcnt = digits + sizeof(digits) - str + 1;
+        if( bufsz < wcnt ) return 0;
+
+        memcpy(buf, str, wcnt - 1);
+        buf[ wcnt - 1 ] = 0;
     }
     else
     {
@@ -0,0 +1,629 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "./limb.h"
+
+//------------------------------------------------------------------------------
+//---- Helpers -----------------------------------------------------------------
+//------------------------------------------------------------------------------
+INLINE
+void acc_mul_add(limb_t *c0, limb_t *c1, limb_t *c2, limb_t a, limb_t b)
+{
+    // (c2,c1,c0) += a*b
+    limb_t hi, lo;
+
+    lo   = limb_mul(a, b, &hi);
+    *c0 += lo;
+    hi  += *c0 < lo;   // No overflow, 'hi' is less than LIMB_MAX.
+    *c1 += hi;
+    *c2 += *c1 < hi;
+}
+//------------------------------------------------------------------------------
+static
+limb_t limbs_add_to(limb_t *r, int rn, const limb_t *x, int xn)
+{
+    // r += x, where 'r' has 'rn' limbs and 'x' has 'xn' limbs, and return the carry.
+    limb_t carry = 0;
+    int    i;
+
+    assert( rn >= xn );
+
+    for(i=0; i<xn; ++i)
+    {
+        limb_t sum = r[i] + carry;
+
+        carry  = sum < carry;
+        r[i]   = sum + x[i];
+        carry += r[i] < sum;
+    }
+    for(; carry && i<rn; ++i)
+        carry = !++r[i];
+
+    return carry;
+}
+//------------------------------------------------------------------------------
+static
+limb_t limbs_sub_from(limb_t *r, int rn, const limb_t *x, int xn)
+{
+    // r -= x, where 'r' has 'rn' limbs and 'x' has 'xn' limbs, and return the borrow.
+    limb_t borrow = 0;
+    int    i;
+
+    assert( rn >= xn );
+
+    for(i=0; i<xn; ++i)
+    {
+        limb_t dif = r[i] - x[i];
+        limb_t bor = r[i] < x[i];
+
+        r[i]   = dif - borrow;
+        borrow = bor | ( dif < borrow );
+    }
+    for(; borrow && i<rn; ++i)
+        borrow = !r[i]--;
+
+    return borrow;
+}
+//------------------------------------------------------------------------------
+static
+bool limbs_abs_diff(limb_t *d, const limb_t *x, int xn, const limb_t *y, int yn)
+{
+    /*
+     * d = | x - y |, where xn >= yn, and 'd' has 'xn' limbs.
+     * Return TRUE if x < y.
+     */
+    bool less = false;
+    int  i;
+
+    assert( xn >= yn );
+
+    for(i=xn-1; i>=yn && !x[i]; --i) ;
+    if( i < yn )
+    {
+        for(; i>=0 && x[i] == y[i]; --i) ;
+        less = i >= 0 && x[i] < y[i];
+    }
+
+    if( less )
+    {
+        memcpy(d, y, yn * sizeof(limb_t));
+        memset(d + yn, 0, ( xn - yn ) * sizeof(limb_t));
+        limbs_sub_from(d, xn, x, xn);
+    }
+    else
+    {
+        memcpy(d, x, xn * sizeof(limb_t));
+        limbs_sub_from(d, xn, y, yn);
+    }
+
+    return less;
+}
+//------------------------------------------------------------------------------
+//---- Comba -------------------------------------------------------------------
+//------------------------------------------------------------------------------
+void limbs_mul_comba(limb_t       /*out*/ *r,
+                     const limb_t /*in */ *a,
+                     int          /*in */  na,
+                     const limb_t /*in */ *b,
+                     int          /*in */  nb)
+{
+    /*
+     * Column-wise multiplication, every limb of the result is finished
+     * in one pass with a three limbs accumulator, and is written only once.
+     */
+    limb_t c0 = 0, c1 = 0, c2 = 0;
+    int    i, k;
+
+    assert( r && a && b && na > 0 && nb > 0 );
+
+    for(k=0; k<na+nb-1; ++k)
+    {
+        int imin = k < nb ? 0 : k - nb + 1;
+        int imax = k < na ? k : na - 1;
+
+        for(i=imin; i<=imax; ++i)
+            acc_mul_add(&c0, &c1, &c2, a[i], b[k-i]);
+
+        r[k] = c0;
+        c0   = c1;
+        c1   = c2;
+        c2   = 0;
+    }
+    r[k] = c0;
+}
+//------------------------------------------------------------------------------
+void limbs_sqr_comba(limb_t       /*out*/ *r,
+                     const limb_t /*in */ *a,
+                     int          /*in */  n)
+{
+    /*
+     * Column-wise squaring, the products a[i]*a[j] and a[j]*a[i] are equal,
+     * so they are calculated once and doubled.
+     */
+    limb_t c0 = 0, c1 = 0, c2 = 0;
+    int    i, k;
+
+    assert( r && a && n > 0 );
+
+    for(k=0; k<2*n-1; ++k)
+    {
+        int    imin = k < n ? 0 : k - n + 1;
+        limb_t p0 = 0, p1 = 0, p2 = 0;
+
+        // Products under the diagonal
+        for(i=imin; i<k-i; ++i)
+            acc_mul_add(&p0, &p1, &p2, a[i], a[k-i]);
+
+        // Double them
+        p2 = ( p2 << 1 ) | ( p1 >> ( BIGNUM_LIMB_BITS - 1 ) );
+        p1 = ( p1 << 1 ) | ( p0 >> ( BIGNUM_LIMB_BITS - 1 ) );
+        p0 = ( p0 << 1 );
+
+        // The diagonal
+        if( !( k & 1 ) )
+            acc_mul_add(&p0, &p1, &p2, a[k>>1], a[k>>1]);
+
+        // Add to the accumulator
+        c0 += p0;
+        p0  = c0 < p0;
+        c1 += p0;
+        p0  = c1 < p0;
+        c1 += p1;
+        c2 += p2 + p0 + ( c1 < p1 );
+
+        r[k] = c0;
+        c0   = c1;
+        c1   = c2;
+        c2   = 0;
+    }
+    r[k] = c0;
+}
+//------------------------------------------------------------------------------
+//---- Karatsuba ---------------------------------------------------------------
+//------------------------------------------------------------------------------
+void limbs_mul_karatsuba(limb_t       /*out*/ *r,
+                         const limb_t /*in */ *a,
+                         const limb_t /*in */ *b,
+                         int          /*in */  n,
+                         int          /*in */  threshold,
+                         limb_t       /*tmp*/ *ws)
+{
+    /*
+     * Multiply two 'n' limbs operands, the result has 2n limbs.
+     * Operands smaller than 'threshold' are multiplied by Comba's method.
+     * @ws : Work space with LIMBS_KARATSUBA_WORKSPACE(n) limbs at least.
+     *
+     * Split a = a1*B + a0, b = b1*B + b0, then
+     * a*b = z2*B^2 + ( z2 + z0 - (a0-a1)*(b0-b1) )*B + z0,
+     * where z2 = a1*b1, z0 = a0*b0,
+     * and the signed product of differences is calculated by their absolute values.
+     */
+    int     m = ( n + 1 ) >> 1;
+    int     k = n - m;
+    limb_t *da, *db, *d, *t, *next;
+    bool    neg;
+
+    assert( r && a && b && ws );
+
+    if( n < threshold || n < 4 )
+    {
+        limbs_mul_comba(r, a, n, b, n);
+        return;
+    }
+
+    da   = ws;
+    db   = ws + m;
+    d    = ws + 2*m;
+    t    = ws + 4*m;
+    next = ws + 6*m + 1;
+
+    neg  = limbs_abs_diff(da, a, m, a + m, k);
+    neg ^= limbs_abs_diff(db, b, m, b + m, k);
+
+    limbs_mul_karatsuba(r      , a    , b    , m, threshold, next);  // z0
+    limbs_mul_karatsuba(r + 2*m, a + m, b + m, k, threshold, next);  // z2
+    limbs_mul_karatsuba(d      , da   , db   , m, threshold, next);
+
+    // t = z0 + z2 -/+ d
+    memcpy(t, r, 2 * m * sizeof(limb_t));
+    t[2*m] = limbs_add_to(t, 2*m, r + 2*m, 2*k);
+    if( neg )
+        limbs_add_to  (t, 2*m+1, d, 2*m);
+    else
+        limbs_sub_from(t, 2*m+1, d, 2*m);
+
+    limbs_add_to(r + m, 2*n - m, t, 2*m+1);
+}
+//------------------------------------------------------------------------------
+void limbs_sqr_karatsuba(limb_t       /*out*/ *r,
+                         const limb_t /*in */ *a,
+                         int          /*in */  n,
+                         int          /*in */  threshold,
+                         limb_t       /*tmp*/ *ws)
+{
+    /*
+     * Square an 'n' limbs operand, the result has 2n limbs.
+     * The same as limbs_mul_karatsuba, but (a0-a1)^2 is never negative.
+     */
+    int     m = ( n + 1 ) >> 1;
+    int     k = n - m;
+    limb_t *da, *d, *t, *next;
+
+    assert( r && a && ws );
+
+    if( n < threshold || n < 4 )
+    {
+        limbs_sqr_comba(r, a, n);
+        return;
+    }
+
+    da   = ws;
+    d    = ws + m;
+    t    = ws + 3*m;
+    next = ws + 5*m + 1;
+
+    limbs_abs_diff(da, a, m, a + m, k);
+
+    limbs_sqr_karatsuba(r      , a    , m, threshold, next);  // z0
+    limbs_sqr_karatsuba(r + 2*m, a + m, k, threshold, next);  // z2
+    limbs_sqr_karatsuba(d      , da   , m, threshold, next);
+
+    // t = z0 + z2 - d
+    memcpy(t, r, 2 * m * sizeof(limb_t));
+    t[2*m] = limbs_add_to(t, 2*m, r + 2*m, 2*k);
+    limbs_sub_from(t, 2*m+1, d, 2*m);
+
+    limbs_add_to(r + m, 2*n - m, t, 2*m+1);
+}
+//------------------------------------------------------------------------------
+//---- Dispatch ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void limbs_mul_ws(limb_t       /*out*/ *r,
+                  const limb_t /*in */ *a,
+                  int          /*in */  na,
+                  const limb_t /*in */ *b,
+                  int          /*in */  nb,
+                  limb_t       /*tmp*/ *ws)
+{
+    /*
+     * Multiply operands with any size, the result has na+nb limbs.
+     * @ws : Work space with LIMBS_MUL_WORKSPACE(MIN(na,nb)) limbs at least.
+     */
+    limb_t *tmp;
+    int     off;
+
+    assert( r && a && b && ws );
+    assert( na > 0 && nb > 0 );
+
+    if( na < nb )
+    {
+        const limb_t *p = a;
+        int           n = na;
+
+        a  = b;
+        na = nb;
+        b  = p;
+        nb = n;
+    }
+
+    if( nb < BIGNUM_KARATSUBA_MUL_THRESHOLD )
+    {
+        limbs_mul_comba(r, a, na, b, nb);
+        return;
+    }
+
+    // Multiply the larger operand slice by slice,
+    // every slice has the same size as the smaller one except the last.
+    tmp = ws;
+    ws += 2 * nb;
+    memset(r, 0, ( na + nb ) * sizeof(limb_t));
+    for(off=0; off<na; off+=nb)
+    {
+        int len = MIN( nb , na - off );
+
+        if( len == nb )
+            limbs_mul_karatsuba(tmp, a + off, b, nb, BIGNUM_KARATSUBA_MUL_THRESHOLD, ws);
+        else
+            limbs_mul_comba(tmp, b, nb, a + off, len);
+
+        limbs_add_to(r + off, na + nb - off, tmp, len + nb);
+    }
+}
+//------------------------------------------------------------------------------
+void limbs_sqr_ws(limb_t       /*out*/ *r,
+                  const limb_t /*in */ *a,
+                  int          /*in */  n,
+                  limb_t       /*tmp*/ *ws)
+{
+    /*
+     * Square an operand with any size, the result has 2n limbs.
+     * @ws : Work space with LIMBS_KARATSUBA_WORKSPACE(n) limbs at least.
+     */
+    assert( r && a && ws );
+    assert( n > 0 );
+
+    if( n < BIGNUM_KARATSUBA_SQR_THRESHOLD )
+        limbs_sqr_comba(r, a, n);
+    else
+        limbs_sqr_karatsuba(r, a, n, BIGNUM_KARATSUBA_SQR_THRESHOLD, ws);
+}
+//------------------------------------------------------------------------------
+void limbs_mul(limb_t       /*out*/ *r,
+               const limb_t /*in */ *a,
+               int          /*in */  na,
+               const limb_t /*in */ *b,
+               int          /*in */  nb)
+{
+    /*
+     * Multiply operands with no more than BIGNUM_LIMBS limbs,
+     * the result has na+nb limbs.
+     */
+    limb_t ws[ LIMBS_MUL_WORKSPACE(BIGNUM_LIMBS) ];
+
+    assert( 0 < na && na <= BIGNUM_LIMBS );
+    assert( 0 < nb && nb <= BIGNUM_LIMBS );
+
+    limbs_mul_ws(r, a, na, b, nb, ws);
+}
+//------------------------------------------------------------------------------
+void limbs_sqr(limb_t       /*out*/ *r,
+               const limb_t /*in */ *a,
+               int          /*in */  n)
+{
+    /*
+     * Square an operand with no more than BIGNUM_LIMBS limbs,
+     * the result has 2n limbs.
+     */
+    limb_t ws[ LIMBS_KARATSUBA_WORKSPACE(BIGNUM_LIMBS) ];
+
+    assert( 0 < n && n <= BIGNUM_LIMBS );
+
+    limbs_sqr_ws(r, a, n, ws);
+}
+//------------------------------------------------------------------------------
+//---- Division ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+limb_t limbs_divmod_limb(limb_t       /*out*/ *quo,
+                         const limb_t /*in */ *u,
+                         int          /*in */  m,
+                         limb_t       /*in */  v)
+{
+    /*
+     * Divide 'm' limbs of 'u' by a single limb 'v',
+     * return the remainder.
+     */
+    limb_t rem = 0;
+    int    i;
+
+    for(i=m-1; i>=0; --i)
+        quo[i] = limb_div(rem, u[i], v, &rem);
+
+    return rem;
+}
+//------------------------------------------------------------------------------
+void limbs_divmod(limb_t       /*out*/ *quo,
+                  limb_t       /*out*/ *rem,
+                  const limb_t /*in */ *u,
+                  int          /*in */  m,
+                  const limb_t /*in */ *v,
+                  int          /*in */  n,
+                  limb_t       /*tmp*/ *ws)
+{
+    /*
+     * Long division of limbs (Knuth, TAOCP Vol.2, 4.3.1, Algorithm D).
+     * @quo : Receive m-n+1 limbs of the quotient.
+     * @rem : Receive n limbs of the remainder.
+     * @u   : The dividend, with 'm' limbs.
+     * @v   : The divisor, with 'n' limbs and n >= 2, and the highest limb must not be zero.
+     * @ws  : Work space with LIMBS_DIVMOD_WORKSPACE(m,n) limbs at least.
+     */
+    limb_t *un = ws;
+    limb_t *vn = ws + m + 1;
+    int     s, i, j;
+
+    assert( quo && rem && u && v && ws );
+    assert( n >= 2 && m >= n && v[n-1] );
+
+    // Normalize, so that the highest bit of the divisor is set.
+    s = limb_count_leading_zeros(v[n-1]);
+    if( s )
+    {
+        for(i=n-1; i>0; --i)
+            vn[i] = ( v[i] << s ) | ( v[i-1] >> ( BIGNUM_LIMB_BITS - s ) );
+        vn[0] = v[0] << s;
+
+        un[m] = u[m-1] >> ( BIGNUM_LIMB_BITS - s );
+        for(i=m-1; i>0; --i)
+            un[i] = ( u[i] << s ) | ( u[i-1] >> ( BIGNUM_LIMB_BITS - s ) );
+        un[0] = u[0] << s;
+    }
+    else
+    {
+        for(i=0; i<n; ++i) vn[i] = v[i];
+        for(i=0; i<m; ++i) un[i] = u[i];
+        un[m] = 0;
+    }
+
+    for(j=m-n; j>=0; --j)
+    {
+        limb_t qhat, rhat, carry, borrow;
+        bool   rhat_overflow;
+
+        // Estimate the quotient limb by the highest two limbs.
+        if( un[j+n] >= vn[n-1] )
+        {
+            qhat          = LIMB_MAX;
+            rhat          = un[j+n-1] + vn[n-1];
+            rhat_overflow = rhat < vn[n-1];
+        }
+        else
+        {
+            qhat          = limb_div(un[j+n], un[j+n-1], vn[n-1], &rhat);
+            rhat_overflow = false;
+        }
+        while( !rhat_overflow )
+        {
+            limb_t hi, lo;
+
+            lo = limb_mul(qhat, vn[n-2], &hi);
+            if( hi < rhat || ( hi == rhat && lo <= un[j+n-2] ) ) break;
+
+            --qhat;
+            rhat         += vn[n-1];
+            rhat_overflow = rhat < vn[n-1];
+        }
+
+        // Multiply and subtract.
+        carry = 0;
+        for(i=0; i<n; ++i)
+        {
+            limb_t hi, lo;
+
+            lo  = limb_mul(qhat, vn[i], &hi);
+            lo += carry;
+            hi += lo < carry;
+
+            borrow    = un[i+j] < lo;
+            un[i+j]  -= lo;
+            carry     = hi + borrow;
+        }
+        borrow   = un[j+n] < carry;
+        un[j+n] -= carry;
+
+        // Add back if the estimation is one too large.
+        if( borrow )
+        {
+            --qhat;
+            un[j+n] += limbs_add_to(un + j, n, vn, n);
+        }
+
+        quo[j] = qhat;
+    }
+
+    // Unnormalize the remainder.
+    if( s )
+    {
+        for(i=0; i<n; ++i)
+            rem[i] = ( un[i] >> s ) | ( un[i+1] << ( BIGNUM_LIMB_BITS - s ) );
+    }
+    else
+    {
+        for(i=0; i<n; ++i)
+            rem[i] = un[i];
+    }
+}
+//------------------------------------------------------------------------------
+//---- Montgomery --------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+limb_t mont_reduce_limbs(limb_t *t, const limb_t *np, int n, limb_t ninv)
+{
+    /*
+     * Add multiples of the modulus to 't' limb by limb, so that its lower 'n' limbs become zero,
+     * and the higher 'n' limbs hold the unreduced result. Return the carry out of the highest limb.
+     */
+    limb_t top = 0;
+    int    i, j;
+
+    for(i=0; i<n; ++i)
+    {
+        // Add m*n, where m makes the lowest limb be zero.
+        limb_t m = t[i] * ninv;
+        limb_t c = 0;
+        limb_t s;
+
+        for(j=0; j<n; ++j)
+            t[i+j] = limb_mul_add(m, np[j], t[i+j], c, &c);
+
+        s      = t[i+n] + c;
+        c      = s < c;
+        t[i+n] = s + top;
+        top    = c + ( t[i+n] < s );
+    }
+
+    return top;
+}
+//------------------------------------------------------------------------------
+void limbs_mont_reduce(limb_t       /*out*/ *r,
+                       limb_t       /*in */ *t,
+                       const limb_t /*in */ *np,
+                       int          /*in */  n,
+                       limb_t       /*in */  ninv)
+{
+    /*
+     * r = t*R^(-1) mod n, where R = 2^(BIGNUM_LIMB_BITS*n),
+     * and 't' has 2n limbs and must be less than n*R, and its content will be destroyed.
+     * @np   : The modulus with 'n' limbs.
+     * @ninv : -np^(-1) mod 2^BIGNUM_LIMB_BITS.
+     */
+    limb_t top = mont_reduce_limbs(t, np, n, ninv);
+    int    i;
+
+    // The result is less than 2n, and only one subtraction is needed.
+    if( !top )
+    {
+        for(i=n-1; i>=0 && t[n+i] == np[i]; --i) ;
+        top = i < 0 || t[n+i] > np[i];
+    }
+    if( top )
+        limbs_sub_from(t + n, n, np, n);
+
+    memcpy(r, t + n, n * sizeof(limb_t));
+}
+//------------------------------------------------------------------------------
+void limbs_mont_reduce_ct(limb_t       /*out*/ *r,
+                          limb_t       /*in */ *t,
+                          const limb_t /*in */ *np,
+                          int          /*in */  n,
+                          limb_t       /*in */  ninv)
+{
+    /*
+     * The same as limbs_mont_reduce, but the final subtraction is always calculated,
+     * and the result is selected by a mask instead of a branch,
+     * so that the running time does not depend on the values.
+     * 'r' must not overlap 't'.
+     */
+    limb_t top    = mont_reduce_limbs(t, np, n, ninv);
+    limb_t borrow = 0;
+    limb_t mask;
+    int    i;
+
+    for(i=0; i<n; ++i)
+    {
+        limb_t dif = t[n+i] - np[i];
+        limb_t bor = t[n+i] < np[i];
+
+        r[i]   = dif - borrow;
+        borrow = bor | ( dif < borrow );
+    }
+
+    // Keep the difference if the sum overflowed or the subtraction did not borrow.
+    mask = 0 - ( top | ( borrow ^ 1 ) );
+    for(i=0; i<n; ++i)
+        r[i] = ( r[i] & mask ) | ( t[n+i] & ~mask );
+}
+//------------------------------------------------------------------------------
+//---- Constant Time -----------------------------------------------------------
+//------------------------------------------------------------------------------
+void limbs_ct_swap(limb_t *a, limb_t *b, int n, limb_t mask)
+{
+    /*
+     * Swap 'a' and 'b' if the mask is all ones, or keep them if the mask is zero,
+     * the same memory accesses are made in both cases.
+     */
+    int i;
+
+    for(i=0; i<n; ++i)
+    {
+        limb_t d = ( a[i] ^ b[i] ) & mask;
+
+        a[i] ^= d;
+        b[i] ^= d;
+    }
+}
+//------------------------------------------------------------------------------
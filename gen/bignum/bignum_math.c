@@ -7,7 +7,9 @@
 
 #include "../minmax.h"
 #include "./const.h"
+#include "./limb.h"
 #include "./math.h"
+#include "./mont.h"
 
 //------------------------------------------------------------------------------
 //---- Basic Operator ----------------------------------------------------------
@@ -17,29 +19,28 @@ uintbig_t uintbig_add(const uintbig_t *a, const uintbig_t *b)
     /**
      * a add b
      */
-    int       carry = 0;
-    int       i, ndigmax;
+    limb_t    la[BIGNUM_LIMBS], lb[BIGNUM_LIMBS];
+    limb_t    carry = 0;
+    int       i, nlimbs;
     uintbig_t ret;
 
     assert( a && b );
 
     if( a->ndig <= 0 || b ->ndig <= 0 ) return uintbig_const_nan;
 
-    ndigmax = MIN( MAX( a->ndig , b->ndig ) + 1 , BIGNUM_DIGSZ );
-    for(i=0; i<ndigmax; ++i)
+    nlimbs = MAX( limbs_load(la, a) , limbs_load(lb, b) );
+    for(i=0; i<nlimbs; ++i)
     {
-        int temp;
+        limb_t sum = la[i] + carry;
 
-        temp         = a->digit[i] + b->digit[i] + carry;
-        ret.digit[i] = temp;
-        carry        = temp >> 8;
-    }
-    while( i<BIGNUM_DIGSZ )
-    {
-        ret.digit[i++] = 0;
+        carry  = sum < carry;
+        la[i]  = sum + lb[i];
+        carry += la[i] < sum;
     }
+    if( carry && nlimbs < BIGNUM_LIMBS )
+        la[nlimbs++] = carry;
 
-    ret.ndig = uintbig_get_digit_usage(ret.digit);
+    limbs_store(&ret, la, nlimbs);
 
     return ret;
 }
@@ -49,116 +50,33 @@ uintbig_t uintbig_sub(const uintbig_t *a, const uintbig_t *b)
     /**
      * a subtract b
      */
-    int       borrow = 0;
-    int       i, ndigmax;
+    limb_t    la[BIGNUM_LIMBS], lb[BIGNUM_LIMBS];
+    limb_t    borrow = 0;
+    int       i, nlimbs;
     uintbig_t ret;
 
     assert( a && b );
 
     if( a->ndig <= 0 || b ->ndig <= 0 ) return uintbig_const_nan;
 
-    ndigmax = MAX( a->ndig , b->ndig );
-    for(i=0; i<ndigmax; ++i)
+    nlimbs = MAX( limbs_load(la, a) , limbs_load(lb, b) );
+    for(i=0; i<nlimbs; ++i)
     {
-        int temp;
+        limb_t dif = la[i] - lb[i];
+        limb_t bor = la[i] < lb[i];
 
-        temp = (int)a->digit[i] - (int)b->digit[i] - borrow;
-        if( temp < 0 )
-        {
-            ret.digit[i] = temp + 0x100;
-            borrow       = 1;
-        }
-        else
-        {
-            ret.digit[i] = temp;
-            borrow       = 0;
-        }
+        la[i]  = dif - borrow;
+        borrow = bor | ( dif < borrow );
     }
-
     if( borrow )
     {
-        while( i < BIGNUM_DIGSZ )
-            ret.digit[i++] = 0xFF;
-    }
-    else
-    {
-        while( i < BIGNUM_DIGSZ )
-            ret.digit[i++] = 0;
-    }
-
-    ret.ndig = uintbig_get_digit_usage(ret.digit);
-
-    return ret;
-}
-//------------------------------------------------------------------------------
-static
-uintbig_t uintbig_mulint(const uintbig_t *a, int b)
-{
-    int            carry = 0;
-    int            ndig, nzeros;
-    const uint8_t *src;
-    uint8_t       *dest;
-    uintbig_t      ret;
-
-    assert( a && a->ndig > 0 );
-
-    ndig   = MIN( a->ndig + 1 , BIGNUM_DIGSZ );
-    nzeros = BIGNUM_DIGSZ - ndig;
-    src    = a->digit;
-    dest   = ret.digit;
-
-    while( ndig-- )
-    {
-        int temp;
-
-        temp    = *src++ * b + carry;
-        *dest++ = temp  & 0xFF;
-        carry   = temp >> 8;
-    }
-    while( nzeros-- )
-    {
-        *dest++ = 0;
+        // The result wraps around, as an unsigned integer of the object size.
+        for(i=nlimbs; i<BIGNUM_LIMBS; ++i)
+            la[i] = LIMB_MAX;
+        nlimbs = BIGNUM_LIMBS;
     }
 
-    ret.ndig = uintbig_get_digit_usage(ret.digit);
-
-    return ret;
-}
-//------------------------------------------------------------------------------
-static
-uintbig_t uintbig_mulint_and_byteshift_left(const uintbig_t *a, int b, unsigned int s)
-{
-    int            carry = 0;
-    int            ndig, nzeros;
-    const uint8_t *src;
-    uint8_t       *dest;
-    uintbig_t      ret;
-
-    assert( a && a->ndig > 0 );
-
-    ndig   = MIN( a->ndig + 1 , BIGNUM_DIGSZ - (int)s );
-    nzeros = BIGNUM_DIGSZ - ndig - s;
-    src    = a->digit;
-    dest   = ret.digit;
-
-    while( s-- )
-    {
-        *dest++ = 0;
-    }
-    while( ndig-- )
-    {
-        int temp;
-
-        temp    = *src++ * b + carry;
-        *dest++ = temp  & 0xFF;
-        carry   = temp >> 8;
-    }
-    while( nzeros-- )
-    {
-        *dest++ = 0;
-    }
-
-    ret.ndig = uintbig_get_digit_usage(ret.digit);
+    limbs_store(&ret, la, nlimbs);
 
     return ret;
 }
@@ -168,111 +86,25 @@ uintbig_t uintbig_mul(const uintbig_t *a, const uintbig_t *b)
     /**
      * a multiply b
      */
-    int       i;
+    limb_t    la[BIGNUM_LIMBS], lb[BIGNUM_LIMBS], lr[2*BIGNUM_LIMBS];
+    int       na, nb;
     uintbig_t ret;
 
     assert( a && b );
 
     if( a->ndig <= 0 || b ->ndig <= 0 ) return uintbig_const_nan;
 
-    ret = uintbig_mulint(a, b->digit[0]);
-    for(i=1; i<b->ndig; ++i)
-    {
-        uintbig_t temp = uintbig_mulint_and_byteshift_left(a, b->digit[i], i);
-        ret = uintbig_add(&ret, &temp);
-    }
-
-    return ret;
-}
-//------------------------------------------------------------------------------
-static
-int divmod_directly(const uintbig_t *a, const uintbig_t *b, uintbig_t *rem)
-{
-    int q = 0;
-
-    assert( a && b && rem );
-
-    *rem = *a;
-    while( uintbig_is_greatthen(rem, b) )
-    {
-        ++q;
-        *rem = uintbig_sub(rem, b);
-    }
-    if( uintbig_is_equal(rem, b) )
-    {
-        ++q;
-        *rem = uintbig_const_zero;
-    }
-
-    return q;
-}
-//------------------------------------------------------------------------------
-static
-int divmod_bisection(const uintbig_t *a, const uintbig_t *b, uintbig_t *rem)
-{
-    /**
-     * Note and WARNING :
-     *
-     * The quotient range supports are between 0 to 255,
-     * that is the input 'a' and 'b' must have a quotient in this range,
-     * or the result will be incorrectly!
-     */
-    int       q, ql, qu;
-    uintbig_t fq;
-
-    assert( a && b && rem );
-
-    // Special cases
-    if( uintbig_is_zero(a) )
-    {
-        *rem = uintbig_const_zero;
-        return 0;
-    }
-    if( uintbig_is_equal(a,b) )
-    {
-        *rem = uintbig_const_zero;
-        return 1;
-    }
-    if( uintbig_is_lessthen(a,b) )
-    {
-        *rem = *a;
-        return 0;
-    }
+    na = limbs_load(la, a);
+    nb = limbs_load(lb, b);
+    if( a == b )
+        limbs_sqr(lr, la, na);
+    else
+        limbs_mul(lr, la, na, lb, nb);
 
-    // Get initial value
-    // - Lower
-    ql = 1;
-    // - Upper
-    qu = 0xFF;
-    fq = uintbig_mulint(b, qu);
-    if( uintbig_is_lessequal(&fq, a) )
-    {
-        *rem = uintbig_sub(a, &fq);
-        return qu;
-    }
-    // Solve quotient
-    while(( qu - ql > 1 )||( q != ql ))
-    {
-        q  = ( ql + qu ) >> 1;
-        fq = uintbig_mulint(b, q);
-        if( uintbig_is_greatthen(&fq, a) )
-        {
-            qu = q;
-        }
-        else if( uintbig_is_lessthen(&fq, a) )
-        {
-            ql = q;
-        }
-        else
-        {
-            *rem = uintbig_const_zero;
-            return q;
-        }
-    }
-    // Solve remainder
-    *rem = uintbig_sub(a, &fq);
+    // The product out of the object range is dropped.
+    limbs_store(&ret, lr, MIN( na + nb , BIGNUM_LIMBS ));
 
-    return q;
+    return ret;
 }
 //------------------------------------------------------------------------------
 void uintbig_divmod(const uintbig_t *a, const uintbig_t *b, uintbig_t *quo, uintbig_t *rem)
@@ -304,7 +136,10 @@ void uintbig_divmod(const uintbig_t *a, const uintbig_t *b, uintbig_t *quo, uint
      *    quo will be ZERO, and
      *    rem will be the same of 'a'.
      */
-    int i, nquo;
+    limb_t la[BIGNUM_LIMBS], lb[BIGNUM_LIMBS];
+    limb_t lq[BIGNUM_LIMBS], lr[BIGNUM_LIMBS];
+    limb_t ws[ LIMBS_DIVMOD_WORKSPACE(BIGNUM_LIMBS, BIGNUM_LIMBS) ];
+    int    na, nb;
 
     assert( a && b && quo && rem );
 
@@ -340,31 +175,17 @@ void uintbig_divmod(const uintbig_t *a, const uintbig_t *b, uintbig_t *quo, uint
         return;
     }
 
-    // Solve quotient and remainder
-    if( b->ndig == BIGNUM_DIGSZ )
-    {
-        // Solve by clumsy iteration if the value of 'b' is VERY large.
-        uintbig_set_dig(quo, divmod_directly(a, b, rem));
-    }
+    // Solve quotient and remainder by long division of limbs
+    na = limbs_load(la, a);
+    nb = limbs_load(lb, b);
+    while( !lb[nb-1] ) --nb;
+    if( nb > 1 )
+        limbs_divmod(lq, lr, la, na, lb, nb, ws);
     else
-    {
-        // Solve by long division
-        nquo = a->ndig - b->ndig + 1;
-        *rem = *a;
-        uintbig_byteshift_right(rem, nquo );
-        for(i=BIGNUM_DIGSZ-1; i>=nquo; --i)
-        {
-            quo->digit[i] = 0;
-        }
-        for(i=nquo-1; i>=0; --i)
-        {
-            uintbig_byteshift_left(rem, 1);
-            rem->digit[0] = a->digit[i];
-            quo->digit[i] = divmod_bisection(rem, b, rem);
-        }
-        // Update digit usage count
-        quo->ndig = uintbig_get_digit_usage(quo->digit);
-    }
+        lr[0] = limbs_divmod_limb(lq, la, na, lb[0]);
+
+    limbs_store(quo, lq, na - nb + 1);
+    limbs_store(rem, lr, nb);
 }
 //------------------------------------------------------------------------------
 uintbig_t uintbig_div(const uintbig_t *a, const uintbig_t *b)
@@ -453,7 +274,8 @@ uintbig_t uintbig_power2(const uintbig_t *a)
      * 演算法分析筆記：
      *
      * Note :
-     * 1. The unit of data shift is BYTE
+     * 1. The unit of data shift is a limb, and the products are summed column by column,
+     *    see limbs_sqr_comba.
      * 2. a^n means 'a' to the power of 'n', not XOR!
      *
      * [10]  [9]  [8]  [7]  [6]  [5]  [4]  [3]  [2]  [1]  [0]
@@ -474,56 +296,19 @@ uintbig_t uintbig_power2(const uintbig_t *a)
      *  + (2*a3*a4)<<7 + (2*a3*a5)<<8
      *  + (2*a4*a5)<<9
      */
-#ifndef UNDEF
-    // 因為 power2 的演算法存在運算效率低落的問題，因此在改進之前將其封存，
-    // 改為呼叫乘法函式。
-    return uintbig_mul(a,a);
-#else
+    limb_t    la[BIGNUM_LIMBS], lr[2*BIGNUM_LIMBS];
+    int       na;
     uintbig_t ret;
-    int       i, k, off0;
 
     assert( a );
 
-    if( a->ndig <= 0       ) return uintbig_const_nan;
-    if( uintbig_is_zero(a) ) return uintbig_const_zero;
+    if( a->ndig <= 0 ) return uintbig_const_nan;
 
-    ret = uintbig_const_zero;
-    for( i=0 ; i < MIN( a->ndig , BIGNUM_DIGSZ/2 ) ; ++i )
-    {
-        int off = i << 1;
-        int val = a->digit[i] * a->digit[i];
-
-        ret.digit[off++] = val & 0xFF;
-        if( off != BIGNUM_DIGSZ )
-            ret.digit[off] = val >> 8;
-    }
-    ret.ndig = uintbig_get_digit_usage(ret.digit);
-
-    for(( k=0, off0=1 );(( k < a->ndig )&&( off0 < BIGNUM_DIGSZ ));( ++k, off0+=2 ))
-    {
-        int off;
-
-        for(( i=k+1, off=off0 );(( i < a->ndig )&&( off < BIGNUM_DIGSZ ));( ++i, ++off ))
-        {
-            int       val;
-            uintbig_t temp;
-
-            val           = a->digit[k] * a->digit[i];
-            temp          = uintbig_const_zero;
-            temp.digit[0] = val & 0xFF;
-            temp.digit[1] = val >> 8;
-            temp.ndig     = temp.digit[1] ? 2 : 1;
-
-            temp = uintbig_add(&temp, &temp);
-            uintbig_byteshift_left(&temp, off);
-
-            ret = uintbig_add(&ret, &temp);
-        }
-    }
-    ret.ndig = uintbig_get_digit_usage(ret.digit);
+    na = limbs_load(la, a);
+    limbs_sqr(lr, la, na);
+    limbs_store(&ret, lr, MIN( 2 * na , BIGNUM_LIMBS ));
 
     return ret;
-#endif
 }
 //------------------------------------------------------------------------------
 uintbig_t uintbig_power(const uintbig_t *a, const uintbig_t *b)
@@ -561,8 +346,9 @@ uintbig_t uintbig_powermod(const uintbig_t *a, const uintbig_t *b, const uintbig
     /**
      * Calculate 'a'^'b' modulo 'n', 'a' to the power of 'b' for the remainder of 'n'.
      */
-    uintbig_t ret;
-    int       idig, ibit;
+    uintbig_mont_t ctx;
+    uintbig_t      ret;
+    int            idig, ibit;
 
     assert( a && b && n );
 
@@ -576,6 +362,11 @@ uintbig_t uintbig_powermod(const uintbig_t *a, const uintbig_t *b, const uintbig
     if( uintbig_is_zero(b) ) return uintbig_const_one;
     if( uintbig_is_zero(a) ) return uintbig_const_zero;
 
+    // Odd modulus, which is the usual case of cryptography,
+    // can be reduced without division.
+    if( uintbig_mont_init(&ctx, n) )
+        return uintbig_mont_powermod(&ctx, a, b);
+
     ret = uintbig_const_one;
     for(idig=b->ndig-1; idig>=0; --idig)
     {
@@ -831,15 +622,15 @@ void separate_value_to_the_power_combination_of_two(const uintbig_t /* in*/ *n,
 }
 //------------------------------------------------------------------------------
 static
-bool miller_rabin_test(const uintbig_t *n,
-                       const uintbig_t *ns1,
-                       const uintbig_t *d,
-                       int              s,
-                       const uintbig_t *a)
+bool miller_rabin_test(const uintbig_mont_t *ctx,
+                       const uintbig_t      *ns1,
+                       const uintbig_t      *d,
+                       int                   s,
+                       const uintbig_t      *a)
 {
     /**
      * Miller-Rabin primality test
-     * @n      : A value to test if it is a prime number.
+     * @ctx    : The Montgomery context of 'n', a value to test if it is a prime number.
      * @ns1    : The same value as n-1.
      * @d      : A component of 'n', so that n-1=d*2^s.
      * @s      : A component of 'n', so that n-1=d*2^s.
@@ -866,9 +657,9 @@ bool miller_rabin_test(const uintbig_t *n,
      */
     uintbig_t x;
 
-    assert( n && ns1 && d && a );
+    assert( ctx && ns1 && d && a );
 
-    x = uintbig_powermod(a, d, n);
+    x = uintbig_mont_powermod(ctx, a, d);
     if( uintbig_is_equal(&x, &uintbig_const_one) ||
         uintbig_is_equal(&x,  ns1              ) )
     {
@@ -877,8 +668,7 @@ bool miller_rabin_test(const uintbig_t *n,
 
     while( --s )
     {
-        x = uintbig_power2(&x);
-        x = uintbig_mod(&x, n);
+        x = uintbig_mont_mulmod(ctx, &x, &x);
         if( uintbig_is_equal(&x, &uintbig_const_one) ) return false;
         if( uintbig_is_equal(&x,  ns1              ) ) return true;
     }
@@ -897,10 +687,11 @@ bool uintbig_prime_test(const uintbig_t *val, unsigned int times, mt_rand64_t *r
      *           and FALSE if it is a composite value.
      * Note : This function test the input value by Miller–Rabin primality test.
      */
-    uintbig_t d;
-    int       s;
-    uintbig_t a;
-    uintbig_t n_sub_1;
+    uintbig_mont_t ctx;
+    uintbig_t      d;
+    int            s;
+    uintbig_t      a;
+    uintbig_t      n_sub_1;
 
     assert( val );
 
@@ -917,12 +708,13 @@ bool uintbig_prime_test(const uintbig_t *val, unsigned int times, mt_rand64_t *r
     separate_value_to_the_power_combination_of_two(val, &d, &s);
 
     // Witness loop
+    uintbig_mont_init(&ctx, val);
     n_sub_1 = *val;
     uintbig_minusminus(&n_sub_1);
     while( times-- )
     {
         a = uintbig_rand_range(&uintbig_const_two, &n_sub_1, rndobj);
-        if( !miller_rabin_test(val, &n_sub_1, &d, s, &a) )
+        if( !miller_rabin_test(&ctx, &n_sub_1, &d, s, &a) )
             return false;
     }
 
@@ -0,0 +1,410 @@
+#include <assert.h>
+#include <string.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "../minmax.h"
+#include "./const.h"
+#include "./math.h"
+#include "./mont.h"
+
+/*
+ * Numbers in the Montgomery form are kept in limbs,
+ * and a value 'x' is represented by x*R mod n, where R = 2^(BIGNUM_LIMB_BITS*nlimbs).
+ * The product of two numbers in the Montgomery form is calculated first,
+ * by the Comba or Karatsuba functions, and then reduced limb by limb
+ * (the separated operand scanning method), see:
+ * C. K. Koc, T. Acar, B. S. Kaliski, "Analyzing and Comparing Montgomery Multiplication Algorithms", 1996.
+ */
+
+// The maximum size of the sliding window in exponentiation.
+#define MONT_WINDOW_MAX 6
+
+//------------------------------------------------------------------------------
+static
+bool limbs_is_less(const limb_t *a, const limb_t *b, int n)
+{
+    while( n-- )
+    {
+        if( a[n] != b[n] ) return a[n] < b[n];
+    }
+
+    return false;
+}
+//------------------------------------------------------------------------------
+static
+limb_t limbs_sub(limb_t *r, const limb_t *a, const limb_t *b, int n)
+{
+    // r = a - b, and return the borrow.
+    limb_t borrow = 0;
+    int    i;
+
+    for(i=0; i<n; ++i)
+    {
+        limb_t dif = a[i] - b[i];
+        limb_t bor = a[i] < b[i];
+
+        r[i]   = dif - borrow;
+        borrow = bor | ( dif < borrow );
+    }
+
+    return borrow;
+}
+//------------------------------------------------------------------------------
+static
+void mont_mul(limb_t               /*out*/ *r,
+              const limb_t         /*in */ *a,
+              const limb_t         /*in */ *b,
+              const uintbig_mont_t /*in */ *ctx)
+{
+    /*
+     * r = a*b*R^(-1) mod n,
+     * 'a' and 'b' must be less than n, and 'r' can be the same as 'a' or 'b'.
+     */
+    limb_t t[2*BIGNUM_LIMBS];
+
+    limbs_mul(t, a, ctx->nlimbs, b, ctx->nlimbs);
+    limbs_mont_reduce(r, t, ctx->n, ctx->nlimbs, ctx->ninv);
+}
+//------------------------------------------------------------------------------
+static
+void mont_sqr(limb_t               /*out*/ *r,
+              const limb_t         /*in */ *a,
+              const uintbig_mont_t /*in */ *ctx)
+{
+    /*
+     * r = a*a*R^(-1) mod n,
+     * 'a' must be less than n, and 'r' can be the same as 'a'.
+     */
+    limb_t t[2*BIGNUM_LIMBS];
+
+    limbs_sqr(t, a, ctx->nlimbs);
+    limbs_mont_reduce(r, t, ctx->n, ctx->nlimbs, ctx->ninv);
+}
+//------------------------------------------------------------------------------
+static
+void mont_mul_ct(limb_t               /*out*/ *r,
+                 const limb_t         /*in */ *a,
+                 const limb_t         /*in */ *b,
+                 const uintbig_mont_t /*in */ *ctx)
+{
+    /*
+     * The constant time version of mont_mul.
+     * Karatsuba's method compares the operand halves, so only Comba's method is used.
+     */
+    limb_t t[2*BIGNUM_LIMBS];
+
+    limbs_mul_comba(t, a, ctx->nlimbs, b, ctx->nlimbs);
+    limbs_mont_reduce_ct(r, t, ctx->n, ctx->nlimbs, ctx->ninv);
+
+    memset(t, 0, sizeof(t));
+}
+//------------------------------------------------------------------------------
+static
+void mont_sqr_ct(limb_t               /*out*/ *r,
+                 const limb_t         /*in */ *a,
+                 const uintbig_mont_t /*in */ *ctx)
+{
+    // The constant time version of mont_sqr.
+    limb_t t[2*BIGNUM_LIMBS];
+
+    limbs_sqr_comba(t, a, ctx->nlimbs);
+    limbs_mont_reduce_ct(r, t, ctx->n, ctx->nlimbs, ctx->ninv);
+
+    memset(t, 0, sizeof(t));
+}
+//------------------------------------------------------------------------------
+static
+void mont_double(limb_t *x, const uintbig_mont_t *ctx)
+{
+    // x = 2*x mod n
+    int    n     = ctx->nlimbs;
+    limb_t carry = x[n-1] >> ( BIGNUM_LIMB_BITS - 1 );
+    int    i;
+
+    for(i=n-1; i>0; --i)
+        x[i] = ( x[i] << 1 ) | ( x[i-1] >> ( BIGNUM_LIMB_BITS - 1 ) );
+    x[0] <<= 1;
+
+    if( carry || !limbs_is_less(x, ctx->n, n) )
+        limbs_sub(x, x, ctx->n, n);
+}
+//------------------------------------------------------------------------------
+static
+void mont_load(limb_t *x, const uintbig_t *a, const uintbig_mont_t *ctx)
+{
+    // Convert a number to the Montgomery form.
+    uintbig_t rem;
+
+    if( uintbig_is_lessthen(a, &ctx->modulus) )
+    {
+        limbs_load(x, a);
+    }
+    else
+    {
+        rem = uintbig_mod(a, &ctx->modulus);
+        limbs_load(x, &rem);
+    }
+
+    mont_mul(x, x, ctx->rr, ctx);
+}
+//------------------------------------------------------------------------------
+static
+uintbig_t mont_store(const limb_t *x, const uintbig_mont_t *ctx)
+{
+    // Convert a number from the Montgomery form.
+    limb_t    unit[BIGNUM_LIMBS] = {1};
+    limb_t    r   [BIGNUM_LIMBS];
+    uintbig_t ret;
+
+    mont_mul(r, x, unit, ctx);
+    limbs_store(&ret, r, ctx->nlimbs);
+
+    return ret;
+}
+//------------------------------------------------------------------------------
+bool uintbig_mont_init(uintbig_mont_t *ctx, const uintbig_t *n)
+{
+    /**
+     * 初始化 Montgomery 運算環境
+     * @ctx    : 運算環境物件
+     * @n      : 模數，必須為大於 1 的奇數。
+     * @return : 成功時傳回 TRUE；模數不符合要求時傳回 FALSE。
+     */
+    limb_t n0, inv;
+    int    nbits, nsqrs;
+    int    i;
+
+    assert( ctx && n );
+
+    ctx->nlimbs = 0;
+    if( n->ndig <= 0 || !( n->digit[0] & 0x01 ) ) return false;
+    if( uintbig_is_equal(n, &uintbig_const_one) ) return false;
+
+    ctx->modulus = *n;
+    ctx->nlimbs  = limbs_load(ctx->n, n);
+
+    // Solve n^(-1) mod 2^BIGNUM_LIMB_BITS by Newton's iteration,
+    // every iteration doubles the number of correct bits, and the initial value has 3 bits.
+    n0  = ctx->n[0];
+    inv = n0;
+    for(i=0; i<5; ++i)
+        inv *= 2 - n0 * inv;
+    ctx->ninv = 0 - inv;
+
+    // Solve R mod n by doubling.
+    for(i=0; i<BIGNUM_LIMBS; ++i)
+        ctx->one[i] = 0;
+    ctx->one[0] = 1;
+    for(i=0; i<BIGNUM_LIMB_BITS*ctx->nlimbs; ++i)
+        mont_double(ctx->one, ctx);
+
+    /*
+     * Solve R^2 mod n by squaring,
+     * the Montgomery square of R*2^k is R*2^(2k), so let bits = k*2^j,
+     * double R for k times, and then square it for j times.
+     */
+    nbits = BIGNUM_LIMB_BITS * ctx->nlimbs;
+    nsqrs = 0;
+    while( !( nbits & 1 ) )
+    {
+        nbits >>= 1;
+        ++nsqrs;
+    }
+
+    memcpy(ctx->rr, ctx->one, sizeof(ctx->rr));
+    for(i=0; i<nbits; ++i)
+        mont_double(ctx->rr, ctx);
+    for(i=0; i<nsqrs; ++i)
+        mont_sqr(ctx->rr, ctx->rr, ctx);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+uintbig_t uintbig_mont_mulmod(const uintbig_mont_t *ctx, const uintbig_t *a, const uintbig_t *b)
+{
+    /**
+     * 計算 ( a * b ) mod n
+     * @ctx    : 已初始化的運算環境物件，其中含有模數 n。
+     * @a      : 乘數
+     * @b      : 乘數
+     * @return : 計算結果
+     */
+    limb_t    x[BIGNUM_LIMBS], y[BIGNUM_LIMBS];
+    uintbig_t ret;
+
+    assert( ctx && ctx->nlimbs && a && b );
+
+    if( a->ndig <= 0 || b->ndig <= 0 ) return uintbig_const_nan;
+
+    // x*R * y * R^(-1) = x*y, so only one of the operands needs to be converted.
+    mont_load(x, a, ctx);
+    if( uintbig_is_lessthen(b, &ctx->modulus) )
+    {
+        limbs_load(y, b);
+    }
+    else
+    {
+        ret = uintbig_mod(b, &ctx->modulus);
+        limbs_load(y, &ret);
+    }
+    mont_mul(x, x, y, ctx);
+    limbs_store(&ret, x, ctx->nlimbs);
+
+    return ret;
+}
+//------------------------------------------------------------------------------
+static
+int get_window_size(int nbits)
+{
+    // Window sizes that minimize the number of multiplications.
+    int w;
+
+    if     ( nbits > 671 ) w = 6;
+    else if( nbits > 239 ) w = 5;
+    else if( nbits >  79 ) w = 4;
+    else if( nbits >  23 ) w = 3;
+    else                   w = 1;
+
+    return MIN( w , MONT_WINDOW_MAX );
+}
+//------------------------------------------------------------------------------
+static
+int get_bit(const uintbig_t *obj, int i)
+{
+    return ( obj->digit[ i >> 3 ] >> ( i & 0x07 ) ) & 0x01;
+}
+//------------------------------------------------------------------------------
+uintbig_t uintbig_mont_powermod(const uintbig_mont_t *ctx, const uintbig_t *a, const uintbig_t *b)
+{
+    /**
+     * 計算 ( a ^ b ) mod n
+     * @ctx    : 已初始化的運算環境物件，其中含有模數 n。
+     * @a      : 底數
+     * @b      : 指數
+     * @return : 計算結果
+     * Note : 使用由左至右的滑動視窗(sliding window)演算法，
+     *        預先計算底數的奇數次方以減少乘法次數。
+     */
+    limb_t table[ 1 << ( MONT_WINDOW_MAX - 1 ) ][BIGNUM_LIMBS];
+    limb_t x[BIGNUM_LIMBS];
+    int    nbits, w, i, k;
+    bool   started;
+
+    assert( ctx && ctx->nlimbs && a && b );
+
+    if( a->ndig <= 0 || b->ndig <= 0 ) return uintbig_const_nan;
+    if( uintbig_is_zero(b)           ) return uintbig_const_one;
+    if( uintbig_is_zero(a)           ) return uintbig_const_zero;
+
+    // Number of the exponent bits
+    nbits = b->ndig << 3;
+    while( !get_bit(b, nbits-1) ) --nbits;
+
+    // Odd powers of the base : a^1, a^3, a^5, ...
+    w = get_window_size(nbits);
+    mont_load(table[0], a, ctx);
+    if( w > 1 )
+    {
+        limb_t a2[BIGNUM_LIMBS];
+
+        mont_sqr(a2, table[0], ctx);
+        for(k=1; k < 1 << ( w - 1 ); ++k)
+            mont_mul(table[k], table[k-1], a2, ctx);
+    }
+
+    // Scan the exponent from the highest bit
+    started = false;
+    memcpy(x, ctx->one, sizeof(x));
+    for(i=nbits-1; i>=0; )
+    {
+        int j, val;
+
+        if( !get_bit(b, i) )
+        {
+            if( started ) mont_sqr(x, x, ctx);
+            --i;
+            continue;
+        }
+
+        // Find the longest window which ends with a bit of one
+        j = MAX( i - w + 1 , 0 );
+        while( !get_bit(b, j) ) ++j;
+
+        val = 0;
+        for(k=i; k>=j; --k)
+            val = ( val << 1 ) | get_bit(b, k);
+
+        if( started )
+        {
+            for(k=i; k>=j; --k)
+                mont_sqr(x, x, ctx);
+            mont_mul(x, x, table[ val >> 1 ], ctx);
+        }
+        else
+        {
+            memcpy(x, table[ val >> 1 ], sizeof(x));
+            started = true;
+        }
+
+        i = j - 1;
+    }
+
+    return mont_store(x, ctx);
+}
+//------------------------------------------------------------------------------
+uintbig_t uintbig_mont_powermod_ct(const uintbig_mont_t *ctx, const uintbig_t *a, const uintbig_t *b)
+{
+    /**
+     * 以固定時間計算 ( a ^ b ) mod n，用於指數為私密資料的場合(如 RSA 私鑰運算)。
+     * @ctx    : 已初始化的運算環境物件，其中含有模數 n。
+     * @a      : 底數
+     * @b      : 指數
+     * @return : 計算結果，與 uintbig_mont_powermod 相同。
+     * Note : 使用 Montgomery ladder 演算法，每個指數位元都固定進行一次乘法與一次平方，
+     *        兩個暫存值以遮罩進行條件交換，執行時間與記憶體存取不受指數位元影響；
+     *        掃描的位元數為模數的字組位元數(指數的字組數較多時則為指數的字組位元數)。
+     *        底數與模數視為公開資料，且此函式比 uintbig_mont_powermod 慢。
+     */
+    limb_t    e   [BIGNUM_LIMBS];
+    limb_t    r0  [BIGNUM_LIMBS];
+    limb_t    r1  [BIGNUM_LIMBS];
+    limb_t    unit[BIGNUM_LIMBS] = {1};
+    limb_t    swap = 0;
+    int       nbits, i;
+    uintbig_t ret;
+
+    assert( ctx && ctx->nlimbs && a && b );
+
+    if( a->ndig <= 0 || b->ndig <= 0 ) return uintbig_const_nan;
+
+    nbits = BIGNUM_LIMB_BITS * MAX( limbs_load(e, b) , ctx->nlimbs );
+
+    // Invariant : r1 = r0 * a, and r0 = a^(the scanned bits).
+    memcpy(r0, ctx->one, sizeof(r0));
+    mont_load(r1, a, ctx);
+    for(i=nbits-1; i>=0; --i)
+    {
+        limb_t bit = ( e[ i / BIGNUM_LIMB_BITS ] >> ( i % BIGNUM_LIMB_BITS ) ) & 1;
+
+        // Swap lazily, the pair is swapped only when the bit differs from the previous one.
+        limbs_ct_swap(r0, r1, ctx->nlimbs, 0 - ( bit ^ swap ));
+        swap = bit;
+
+        mont_mul_ct(r1, r0, r1, ctx);
+        mont_sqr_ct(r0, r0, ctx);
+    }
+    limbs_ct_swap(r0, r1, ctx->nlimbs, 0 - swap);
+
+    mont_mul_ct(r1, r0, unit, ctx);
+    limbs_store(&ret, r1, ctx->nlimbs);
+
+    memset(e , 0, sizeof(e ));
+    memset(r0, 0, sizeof(r0));
+    memset(r1, 0, sizeof(r1));
+
+    return ret;
+}
+//------------------------------------------------------------------------------
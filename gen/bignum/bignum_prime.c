@@ -0,0 +1,354 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "../cpufeat.h"
+#include "../minmax.h"
+#include "./io.h"
+#include "./limb.h"
+#include "./math.h"
+#include "./prime.h"
+
+#define SMALL_PRIMES_COUNT 2048  // Number of the small odd primes, from 3 to 17881.
+#define SMALL_PRIMES_LIMIT 17882
+#define SIEVE_PRIMES_COUNT 1024  // The smaller primes used by the sieve, and the others are used by the trial division.
+#define SIEVE_WINDOW       4096  // Number of odd candidates in a sieve window.
+#define THREADS_MAX        64
+
+/*
+ * Products of consecutive small primes that fit in 32 bits,
+ * so that a number can be divided by several primes with one long division.
+ */
+typedef struct prime_group_t
+{
+    uint32_t product;
+    int      first;
+    int      last;
+} prime_group_t;
+
+static uint16_t      small_primes[SMALL_PRIMES_COUNT];
+static prime_group_t prime_groups[SMALL_PRIMES_COUNT];
+static int           sieve_groups_count;  // Groups of the sieve primes, and the trial primes follow them.
+static int           prime_groups_count;
+static once_flag     small_primes_once = ONCE_FLAG_INIT;
+
+//------------------------------------------------------------------------------
+//---- Small Primes ------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void prime_groups_build(int first, int last)
+{
+    int i = first;
+
+    while( i < last )
+    {
+        prime_group_t *group = &prime_groups[ prime_groups_count++ ];
+        uint64_t       prod  = small_primes[i];
+
+        group->first = i;
+        while( ++i < last && prod * small_primes[i] <= UINT32_MAX )
+            prod *= small_primes[i];
+        group->last    = i;
+        group->product = prod;
+    }
+}
+//------------------------------------------------------------------------------
+static
+void small_primes_init(void)
+{
+    // Sieve of Eratosthenes for the odd numbers.
+    static bool composite[SMALL_PRIMES_LIMIT];
+    int         count = 0;
+    int         p, q;
+
+    for(p=3; count<SMALL_PRIMES_COUNT; p+=2)
+    {
+        assert( p < SMALL_PRIMES_LIMIT );
+        if( composite[p] ) continue;
+
+        small_primes[ count++ ] = p;
+        for(q=p*p; q<SMALL_PRIMES_LIMIT; q+=2*p)
+            composite[q] = true;
+    }
+
+    prime_groups_count = 0;
+    prime_groups_build(0, SIEVE_PRIMES_COUNT);
+    sieve_groups_count = prime_groups_count;
+    prime_groups_build(SIEVE_PRIMES_COUNT, SMALL_PRIMES_COUNT);
+}
+//------------------------------------------------------------------------------
+static
+uint32_t limbs_mod_word(const limb_t *x, int n, uint32_t d)
+{
+    // Return x mod d, and the dividend is processed 32 bits each step.
+    uint64_t rem = 0;
+
+    while( n-- )
+    {
+#if BIGNUM_LIMB_BITS == 64
+        rem = ( ( rem << 32 ) | ( x[n] >> 32        ) ) % d;
+        rem = ( ( rem << 32 ) | ( x[n] & UINT32_MAX ) ) % d;
+#else
+        rem = ( ( rem << 32 ) | x[n] ) % d;
+#endif
+    }
+
+    return rem;
+}
+//------------------------------------------------------------------------------
+static
+bool trial_division(const uintbig_t *val)
+{
+    // Return FALSE if the value can be divided by one of the trial primes.
+    limb_t x[BIGNUM_LIMBS];
+    int    nlimbs = limbs_load(x, val);
+    int    i, k;
+
+    for(i=sieve_groups_count; i<prime_groups_count; ++i)
+    {
+        const prime_group_t *group = &prime_groups[i];
+        uint32_t             rem   = limbs_mod_word(x, nlimbs, group->product);
+
+        for(k=group->first; k<group->last; ++k)
+        {
+            if( rem % small_primes[k] == 0 ) return false;
+        }
+    }
+
+    return true;
+}
+//------------------------------------------------------------------------------
+//---- Search ------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+uintbig_t rand_start(unsigned int ndig, mt_rand64_t *rndobj)
+{
+    // A random odd number, and the highest two bits are set,
+    // so that the product of two such numbers has the full size.
+    uintbig_t ret = uintbig_rand_ndig(ndig, rndobj);
+
+    ret.digit[     0] |= 0x01;
+    ret.digit[ndig-1] |= 0xC0;
+    ret.ndig           = ndig;
+
+    return ret;
+}
+//------------------------------------------------------------------------------
+static
+void sieve_residues(uint16_t *residues, const uintbig_t *base)
+{
+    limb_t x[BIGNUM_LIMBS];
+    int    nlimbs = limbs_load(x, base);
+    int    i, k;
+
+    for(i=0; i<sieve_groups_count; ++i)
+    {
+        const prime_group_t *group = &prime_groups[i];
+        uint32_t             rem   = limbs_mod_word(x, nlimbs, group->product);
+
+        for(k=group->first; k<group->last; ++k)
+            residues[k] = rem % small_primes[k];
+    }
+}
+//------------------------------------------------------------------------------
+static
+void sieve_window(bool *composite, const uint16_t *residues)
+{
+    /*
+     * Mark the candidates base+2*k which can be divided by the sieve primes,
+     * where the prime 'p' divides base+2*k if k = (p-r)/2 mod p,
+     * and 'r' is the residue of base mod p.
+     */
+    int i;
+
+    memset(composite, 0, SIEVE_WINDOW * sizeof(composite[0]));
+    for(i=0; i<SIEVE_PRIMES_COUNT; ++i)
+    {
+        uint32_t p = small_primes[i];
+        uint32_t r = residues[i];
+        uint32_t k = r ? ( p - r ) * ( ( p + 1 ) >> 1 ) % p : 0;
+
+        for(; k<SIEVE_WINDOW; k+=p)
+            composite[k] = true;
+    }
+}
+//------------------------------------------------------------------------------
+static
+bool search_from_rand(uintbig_t    /*out*/ *result,
+                      unsigned int /*in */  ndig,
+                      unsigned int /*in */  times,
+                      mt_rand64_t  /*in */ *rndobj,
+                      atomic_bool  /*in */ *stop)
+{
+    /*
+     * Search a prime with 'ndig' digits from a random starting point.
+     * Return FALSE if the search is stopped by the flag (can be NULL) before a prime be found.
+     */
+    uintbig_t step = uintbig_from_int( 2 * SIEVE_WINDOW );
+    uint16_t  residues [SIEVE_PRIMES_COUNT];
+    bool      composite[SIEVE_WINDOW];
+    int       i, k;
+
+    for(;;)
+    {
+        uintbig_t base = rand_start(ndig, rndobj);
+
+        sieve_residues(residues, &base);
+        while( base.ndig == (int) ndig )
+        {
+            sieve_window(composite, residues);
+            for(k=0; k<SIEVE_WINDOW; ++k)
+            {
+                uintbig_t offset, cand;
+
+                if( composite[k] ) continue;
+                if( stop && atomic_load_explicit(stop, memory_order_relaxed) ) return false;
+
+                offset = uintbig_from_int( 2 * k );
+                cand   = uintbig_add(&base, &offset);
+                if( cand.ndig != (int) ndig ) break;    // Overflowed, restart from another point.
+
+                if( !trial_division(&cand) ) continue;
+                if( !uintbig_prime_test(&cand, times, rndobj) ) continue;
+
+                *result = cand;
+                return true;
+            }
+
+            // Move to the next window.
+            base = uintbig_add(&base, &step);
+            for(i=0; i<SIEVE_PRIMES_COUNT; ++i)
+                residues[i] = ( residues[i] + 2 * SIEVE_WINDOW ) % small_primes[i];
+        }
+    }
+}
+//------------------------------------------------------------------------------
+//---- Threads -----------------------------------------------------------------
+//------------------------------------------------------------------------------
+typedef struct search_t
+{
+    unsigned int ndig;
+    unsigned int times;
+    atomic_bool  done;
+    uintbig_t    result;
+} search_t;
+
+typedef struct worker_t
+{
+    search_t    *search;
+    mt_rand64_t  rndobj;
+} worker_t;
+
+//------------------------------------------------------------------------------
+static
+int worker_process(worker_t *worker)
+{
+    search_t *search = worker->search;
+    uintbig_t prime;
+
+    if( search_from_rand(&prime, search->ndig, search->times, &worker->rndobj, &search->done) &&
+        !atomic_exchange(&search->done, true) )
+    {
+        search->result = prime;
+    }
+
+    memset(&prime, 0, sizeof(prime));
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+bool search_parallel(uintbig_t *result, unsigned int ndig, unsigned int times, mt_rand64_t *rndobj, unsigned threads)
+{
+    /*
+     * Search by multiple threads from different starting points,
+     * and return FALSE if it is not able to do that,
+     * so that the caller can search serially.
+     */
+    worker_t *workers = malloc(threads * sizeof(worker_t));
+    if( !workers ) return false;
+
+    search_t search =
+    {
+        .ndig  = ndig,
+        .times = times,
+    };
+    atomic_init(&search.done, false);
+
+    // Every thread has its own random object.
+    for(unsigned i=0; i<threads; ++i)
+    {
+        workers[i].search = &search;
+        mt_srand64(&workers[i].rndobj, mt_rand64(rndobj));
+    }
+
+    thrd_t   threadids[THREADS_MAX];
+    unsigned started = 0;
+    for(unsigned i=1; i<threads; ++i)
+    {
+        if( thrd_success != thrd_create(&threadids[started], (thrd_start_t) worker_process, &workers[i]) ) break;
+        ++started;
+    }
+
+    // The caller thread works too, and will find the prime alone if no worker be started.
+    worker_process(&workers[0]);
+
+    for(unsigned i=0; i<started; ++i)
+        thrd_join(threadids[i], NULL);
+
+    *result = search.result;
+
+    memset(&search, 0, sizeof(search));
+    memset(workers, 0, threads * sizeof(worker_t));
+    free(workers);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+uintbig_t uintbig_prime_search(unsigned int  ndig,
+                               unsigned int  times,
+                               mt_rand64_t  *rndobj,
+                               unsigned int  threads)
+{
+    /**
+     * 搜尋隨機的質數
+     * @ndig    : 質數的位數(位元組數)，其最高兩個位元固定為 1，
+     *            使兩個相同位數的質數乘積具有完整的位數。
+     * @times   : Miller-Rabin 質數測試的次數，參見 uintbig_prime_test。
+     * @rndobj  : 亂數物件，可為 NULL 以使用全域物件。
+     * @threads : 可使用的最大執行緒數量(包含呼叫者本身)，輸入零則使用處理器的數量。
+     *            使用一個執行緒時，相同的亂數物件狀態會得到相同的結果。
+     * @return  : 搜尋到的質數。
+     */
+    uintbig_t ret;
+
+    ndig = MAX( 1 , MIN( ndig , BIGNUM_DIGSZ ) );
+
+    // Small numbers might be the small primes themselves, and are tested directly.
+    if( ndig < 3 )
+    {
+        do
+        {
+            ret = rand_start(ndig, rndobj);
+        } while( !uintbig_prime_test(&ret, times, rndobj) );
+
+        return ret;
+    }
+
+    call_once(&small_primes_once, small_primes_init);
+
+    if( !threads ) threads = cpufeat_get_cpu_count();
+    if( threads > THREADS_MAX ) threads = THREADS_MAX;
+
+    if( threads > 1 && search_parallel(&ret, ndig, times, rndobj, threads) )
+        return ret;
+
+    search_from_rand(&ret, ndig, times, rndobj, NULL);
+    return ret;
+}
+//------------------------------------------------------------------------------
@@ -1,4 +1,5 @@
 #include <assert.h>
+#include <stdio.h>
 #include <string.h>
 
 #ifdef __BORLANDC__
@@ -10,6 +11,9 @@
 #include "./base.h"
 #include "./io.h"
 #include "./math.h"
+#include "./mont.h"
+#include "./prime.h"
+#include "./var.h"
 
 #ifdef NDEBUG
     #error This test program must work with macro "ASSERT" enabled!
@@ -108,20 +112,20 @@ static const uint32_t ans_of_powermod[] =
 {
     0xC3,
     0x86,
-    0x0277,
-    0x31,
-    0x07,
-    0x0154,
-    0x0207,
+    0xB5,
+    0x01C6,
+    0x02A4,
+    0x01,
+    0x01DD,
     0x0306,
     0x02DA,
     0x01,
     0x019E,
     0x00,
-    0x0107,
-    0x7F,
-    0x02DB,
-    0x0280,
+    0x026E,
+    0x66,
+    0xA2,
+    0x01C3,
     0,       // No use
     0x25,
     0x24,
@@ -311,6 +315,29 @@ void test_import_and_export(void)
         assert( obj.ndig == obj2.ndig && !memcmp(obj.digit, obj2.digit, BIGNUM_DIGSZ) );
     }
 
+    // Import from decimal string
+    {
+        static const uint32_t values[] = { 0, 7, 10, 99, 1000000000, 4294967295U };
+        uintbig_t obj;
+        char      str[32];
+        size_t    i;
+
+        assert( uintbig_from_dec(  NULL).ndig == -1 );
+        assert( uintbig_from_dec(""    ).ndig == -1 );
+        assert( uintbig_from_dec("$#AB").ndig == -1 );
+
+        for(i=0; i<sizeof(values)/sizeof(values[0]); ++i)
+        {
+            sprintf(str, "==%010u==%u", values[i], values[i] + 1);
+            obj = uintbig_from_dec(str);
+            assert( is_uintbig_equal_to_int32(&obj, values[i]) );
+        }
+
+        // The value out of range is truncated.
+        obj = uintbig_from_dec("1234567890123456789012345");
+        assert( is_uintbig_equal_to_int32(&obj, 0x3DE2DF79) );
+    }
+
     // Export to integer
     {
         uintbig_t obj;
@@ -323,6 +350,7 @@ void test_import_and_export(void)
     {
         uintbig_t obj;
         char      buf[1024];
+        int       i;
 
         obj = uintbig_from_int(0x00940075);
 
@@ -332,6 +360,26 @@ void test_import_and_export(void)
 
         assert( 7 == uintbig_to_str(buf, sizeof(buf), &obj) );
         assert( 0 == strncmp(buf, "940075", sizeof(buf)) );
+
+        assert( 0 == uintbig_to_dec(NULL,         100, &obj) );
+        assert( 0 == uintbig_to_dec(buf ,           7, &obj) );
+        assert( 0 == uintbig_to_dec(buf , sizeof(buf), NULL) );
+
+        assert( 8 == uintbig_to_dec(buf, sizeof(buf), &obj) );
+        assert( 0 == strncmp(buf, "9699445", sizeof(buf)) );
+
+        for(i=0; i<testcnt; ++i)
+        {
+            char ans[16];
+
+            obj = uintbig_from_int(aa[i]);
+            sprintf(ans, "%u", aa[i]);
+            assert( strlen(ans) + 1 == uintbig_to_dec(buf, sizeof(buf), &obj) );
+            assert( 0 == strcmp(buf, ans) );
+        }
+
+        assert( 4 == uintbig_to_dec(buf, sizeof(buf), &uintbig_const_nan) );
+        assert( 0 == strcmp(buf, "NAN") );
     }
 }
 //------------------------------------------------------------------------------
@@ -372,6 +420,15 @@ void test_base_operation(void)
         assert( !( uintbig_is_greatequal(&obja, &objb) ^ ( aa[i] >= bb[i] ) ) );
         assert( !( uintbig_is_lessequal (&obja, &obja) ^ ( aa[i] <= aa[i] ) ) );
         assert( !( uintbig_is_lessequal (&obja, &objb) ^ ( aa[i] <= bb[i] ) ) );
+
+        assert( uintbig_ct_compare(&obja, &obja) == 0 );
+        assert( uintbig_ct_compare(&obja, &objb) == ( aa[i] < bb[i] ? -1 : aa[i] > bb[i] ) );
+        assert( uintbig_ct_compare(&objb, &obja) == ( bb[i] < aa[i] ? -1 : bb[i] > aa[i] ) );
+
+        uintbig_ct_swap(&obja, &objb, false);
+        assert( is_uintbig_equal_to_int32(&obja, aa[i]) && is_uintbig_equal_to_int32(&objb, bb[i]) );
+        uintbig_ct_swap(&obja, &objb, true);
+        assert( is_uintbig_equal_to_int32(&obja, bb[i]) && is_uintbig_equal_to_int32(&objb, aa[i]) );
     }
 
     for(i=0; i<testcnt; ++i)
@@ -589,6 +646,59 @@ void test_math_advanced(void)
     }
 }
 //------------------------------------------------------------------------------
+void test_math_montgomery(void)
+{
+    uintbig_mont_t ctx;
+    uint32_t       n, a, b;
+
+    // Invalid modulus
+    {
+        uintbig_t obj;
+
+        obj = uintbig_from_int(0);
+        assert( !uintbig_mont_init(&ctx, &obj) );
+        obj = uintbig_from_int(1);
+        assert( !uintbig_mont_init(&ctx, &obj) );
+        obj = uintbig_from_int(778);
+        assert( !uintbig_mont_init(&ctx, &obj) );
+        assert( !uintbig_mont_init(&ctx, &uintbig_const_nan) );
+    }
+
+    // Multiplication and power with modulo
+    for(n=3; n<0x10000; n=n*3+2)
+    {
+        uintbig_t objn = uintbig_from_int(n);
+
+        assert( uintbig_mont_init(&ctx, &objn) );
+        for(a=0; a<0x10000; a=a*5+3)
+        {
+            for(b=0; b<0x10000; b=b*7+1)
+            {
+                uintbig_t obja = uintbig_from_int(a);
+                uintbig_t objb = uintbig_from_int(b);
+                uintbig_t objr;
+                uint32_t  ans;
+                uint32_t  base, exp;
+
+                objr = uintbig_mont_mulmod(&ctx, &obja, &objb);
+                assert( is_uintbig_equal_to_int32(&objr, a * b % n) );
+
+                for(( ans=1, base=a%n, exp=b );( exp );( exp>>=1, base=base*base%n ))
+                {
+                    if( exp & 1 ) ans = ans * base % n;
+                }
+                if( b == 0 ) ans = 1;
+                if( a == 0 && b != 0 ) ans = 0;
+
+                objr = uintbig_mont_powermod(&ctx, &obja, &objb);
+                assert( is_uintbig_equal_to_int32(&objr, ans) );
+                objr = uintbig_mont_powermod_ct(&ctx, &obja, &objb);
+                assert( is_uintbig_equal_to_int32(&objr, ans) );
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------
 bool test_rand_digs(const uintbig_t *obj, size_t ndig)
 {
     assert( obj );
@@ -675,6 +785,187 @@ void test_math_random_and_prime(void)
         if( prime ) assert(  uintbig_prime_test(&a, 32, NULL) );
         else        assert( !uintbig_prime_test(&a, 32, NULL) );
     }
+
+    // Prime search
+
+    for(n=1; n<=4; ++n)
+    {
+        for(i=0; i<20; ++i)
+        {
+            uintbig_t a = uintbig_prime_search(n, 32, NULL, i & 1 ? 3 : 1);
+            uint32_t  val, div;
+
+            assert( a.ndig == n );
+            assert( a.digit[n-1] >= 0xC0 );
+
+            val = uintbig_to_int(&a);
+            for(div=2; div*div<=val; ++div)
+                assert( val % div );
+        }
+    }
+}
+//------------------------------------------------------------------------------
+uint64_t var_to_int64(const uintvar_t *obj)
+{
+    uint8_t  buf[8];
+    uint64_t val = 0;
+    int      i;
+
+    assert( uintvar_to_bin(buf, sizeof(buf), obj) <= sizeof(buf) );
+    for(i=7; i>=0; --i)
+        val = ( val << 8 ) | buf[i];
+
+    return val;
+}
+//------------------------------------------------------------------------------
+uint64_t int64_powermod(uint64_t a, uint64_t b, uint64_t n)
+{
+    uint64_t ans = 1 % n;
+
+    for(a%=n; b; b>>=1, a=a*a%n)
+    {
+        if( b & 1 ) ans = ans * a % n;
+    }
+
+    return ans;
+}
+//------------------------------------------------------------------------------
+void test_variable_length(void)
+{
+    uintvar_t a = UINTVAR_INIT, b = UINTVAR_INIT, n = UINTVAR_INIT;
+    uintvar_t q = UINTVAR_INIT, r = UINTVAR_INIT, t = UINTVAR_INIT;
+    int       i, k;
+
+    // Import and export
+
+    for(i=0; i<testcnt; ++i)
+    {
+        uintbig_t obj = uintbig_from_int(aa[i]);
+        uint8_t   buf[6];
+
+        assert( uintvar_from_uintbig(&a, &obj) );
+        assert( var_to_int64(&a) == aa[i] );
+        assert( uintvar_to_uintbig(&obj, &a) );
+        assert( is_uintbig_equal_to_int32(&obj, aa[i]) );
+
+        assert( uintvar_to_bin(buf, sizeof(buf), &a) == ( uintvar_get_bits(&a) + 7 ) / 8 );
+        assert( uintvar_from_bin(&b, buf, sizeof(buf)) );
+        assert( uintvar_compare(&a, &b) == 0 );
+        assert( uintvar_is_zero(&a) == !aa[i] );
+    }
+
+    assert( !uintvar_from_uintbig(&a, &uintbig_const_nan) );
+    assert( uintvar_from_int(&a, 0x123456789AULL) );
+    assert( uintvar_get_bits(&a) == 37 );
+    {
+        uintbig_t obj = uintbig_from_int(5);
+        assert( !uintvar_to_uintbig(&obj, &a) );
+        assert( is_uintbig_equal_to_int32(&obj, 5) );
+    }
+
+    // Operations compared with the 64 bits integers
+
+    for(i=0; i<testcnt; ++i)
+    {
+        uint64_t x = aa[i], y = bb[i];
+
+        assert( uintvar_from_int(&a, x) && uintvar_from_int(&b, y) );
+
+        assert( uintvar_compare(&a, &b) == ( x < y ? -1 : x > y ) );
+        assert( uintvar_and(&r, &a, &b) && var_to_int64(&r) == ( x & y ) );
+        assert( uintvar_or (&r, &a, &b) && var_to_int64(&r) == ( x | y ) );
+        assert( uintvar_xor(&r, &a, &b) && var_to_int64(&r) == ( x ^ y ) );
+        assert( uintvar_add(&r, &a, &b) && var_to_int64(&r) == x + y );
+        assert( uintvar_mul(&r, &a, &b) && var_to_int64(&r) == x * y );
+        assert( uintvar_mul(&r, &a, &a) && var_to_int64(&r) == x * x );
+        assert( uintvar_sub(&r, &a, &b) == ( x >= y ) );
+        if( x >= y ) assert( var_to_int64(&r) == x - y );
+
+        for(k=0; k<32; k+=5)
+        {
+            assert( uintvar_shift_left (&r, &a, k) && var_to_int64(&r) == x << k );
+            assert( uintvar_shift_right(&r, &a, k) && var_to_int64(&r) == x >> k );
+        }
+
+        if( y )
+        {
+            assert( uintvar_divmod(&q, &r, &a, &b) );
+            assert( var_to_int64(&q) == x / y );
+            assert( var_to_int64(&r) == x % y );
+            assert( uintvar_powermod(&r, &a, &b, &b) );
+            assert( var_to_int64(&r) == int64_powermod(x, y, y) );
+            assert( uintvar_powermod(&r, &b, &a, &b) );
+            assert( var_to_int64(&r) == int64_powermod(y, x, y) );
+        }
+        else
+        {
+            assert( !uintvar_divmod(&q, &r, &a, &b) );
+            assert( !uintvar_powermod(&r, &a, &b, &b) );
+        }
+
+        // Outputs are the same as the inputs.
+        assert( uintvar_add(&a, &a, &b) && var_to_int64(&a) == x + y );
+        assert( uintvar_mul(&b, &a, &b) && var_to_int64(&b) == ( x + y ) * y );
+        if( y )
+        {
+            assert( uintvar_divmod(&a, &b, &b, &a) );
+            assert( var_to_int64(&a) == ( x + y ) * y / ( x + y ) );
+            assert( var_to_int64(&b) == 0 );
+        }
+    }
+
+    // Large numbers
+
+    for(i=0; i<20; ++i)
+    {
+        uint8_t buf[600];
+
+        for(k=0; k<(int)sizeof(buf); ++k)
+            buf[k] = uintbig_rand_ndig(1, NULL).digit[0];
+
+        assert( uintvar_from_bin(&a, buf, sizeof(buf)) );
+        assert( uintvar_from_bin(&b, buf, 24 * ( i + 1 )) );
+
+        // a = q*b + r, and r < b
+        assert( uintvar_divmod(&q, &r, &a, &b) );
+        assert( uintvar_compare(&r, &b) < 0 );
+        assert( uintvar_mul(&t, &q, &b) && uintvar_add(&t, &t, &r) );
+        assert( uintvar_compare(&t, &a) == 0 );
+
+        // (a<<k)>>k = a, and (a*a)/a = a
+        assert( uintvar_shift_left (&t, &a, 67 * i) );
+        assert( uintvar_shift_right(&t, &t, 67 * i) );
+        assert( uintvar_compare(&t, &a) == 0 );
+        assert( uintvar_mul(&t, &a, &a) );
+        assert( uintvar_divmod(&t, NULL, &t, &a) );
+        assert( uintvar_compare(&t, &a) == 0 );
+    }
+
+    // a^(p-1) mod p = 1, where p = 2^127-1 is a prime,
+    // and the odd modulus p and the even modulus 2p give the same result modulo p.
+    assert( uintvar_from_int(&t, 1) );
+    assert( uintvar_shift_left(&n, &t, 127) && uintvar_sub(&n, &n, &t) );
+    assert( uintvar_sub(&b, &n, &t) );
+    for(i=2; i<50; i+=7)
+    {
+        assert( uintvar_from_int(&a, i) && uintvar_shift_left(&a, &a, 99) );
+        assert( uintvar_powermod(&r, &a, &b, &n) );
+        assert( uintvar_compare(&r, &t) == 0 );
+
+        assert( uintvar_shift_left(&q, &n, 1) );
+        assert( uintvar_powermod(&q, &a, &a, &q) );
+        assert( uintvar_divmod(NULL, &q, &q, &n) );
+        assert( uintvar_powermod(&r, &a, &a, &n) );
+        assert( uintvar_compare(&q, &r) == 0 );
+    }
+
+    uintvar_deinit(&a);
+    uintvar_deinit(&b);
+    uintvar_deinit(&n);
+    uintvar_deinit(&q);
+    uintvar_deinit(&r);
+    uintvar_deinit(&t);
+    uintvar_scratch_release();
 }
 //------------------------------------------------------------------------------
 int main(void)
@@ -688,7 +979,9 @@ int main(void)
     test_base_operation();
     test_math_basic();
     test_math_advanced();
+    test_math_montgomery();
     test_math_random_and_prime();
+    test_variable_length();
 
     return 0;
 }
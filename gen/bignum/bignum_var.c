@@ -0,0 +1,835 @@
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "../minmax.h"
+#include "./var.h"
+
+/*
+ * Work spaces of the operations, see limbs_mul_ws and limbs_divmod,
+ * the remainder of 'm' limbs modulo 'n' limbs needs a quotient and the division work space.
+ */
+#define VAR_MOD_WORKSPACE(m,n) ( (m) + 1 + LIMBS_DIVMOD_WORKSPACE(m,n) )
+
+// The maximum size of the sliding window in exponentiation.
+#define VAR_WINDOW_MAX 6
+
+/*
+ * The scratch arena of a thread,
+ * an operation takes the whole buffer for its temporaries and splits it by itself,
+ * so the buffer is allocated only when a larger operation than before comes.
+ */
+typedef struct scratch_t
+{
+    limb_t *buf;
+    size_t  cap;    // Number of limbs.
+} scratch_t;
+
+static thread_local scratch_t scratch;
+
+//------------------------------------------------------------------------------
+//---- Helpers -----------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+limb_t* scratch_get(size_t nlimbs)
+{
+    // Return a buffer with 'nlimbs' limbs at least, or NULL if the allocation failed.
+    // Contents of the buffer are not kept between calls.
+    if( scratch.cap < nlimbs )
+    {
+        size_t  cap = MAX( nlimbs , 2 * scratch.cap );
+        limb_t *buf = malloc(cap * sizeof(limb_t));
+        if( !buf ) return NULL;
+
+        uintvar_scratch_release();
+        scratch.buf = buf;
+        scratch.cap = cap;
+    }
+
+    return scratch.buf;
+}
+//------------------------------------------------------------------------------
+static
+void var_trim(uintvar_t *obj)
+{
+    // Remove the high limbs that are zero.
+    while( obj->nlimbs && !obj->limbs[ obj->nlimbs - 1 ] )
+        --obj->nlimbs;
+}
+//------------------------------------------------------------------------------
+static
+bool var_assign(uintvar_t *dest, const limb_t *src, int n)
+{
+    // Set the value by limbs, and 'src' must not be the limbs of 'dest'.
+    if( !uintvar_reserve(dest, n) ) return false;
+
+    if( n ) memcpy(dest->limbs, src, n * sizeof(limb_t));
+    dest->nlimbs = n;
+    var_trim(dest);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+static
+void limbs_mod(limb_t       /*out*/ *r,
+               const limb_t /*in */ *u,
+               int          /*in */  m,
+               const limb_t /*in */ *v,
+               int          /*in */  n,
+               limb_t       /*tmp*/ *ws)
+{
+    /*
+     * r = u mod v, where 'r' receives 'n' limbs.
+     * @v  : The divisor with 'n' limbs, and the highest limb must not be zero.
+     * @ws : Work space with VAR_MOD_WORKSPACE(m,n) limbs at least.
+     */
+    if( m < n )
+    {
+        if( m ) memcpy(r, u, m * sizeof(limb_t));
+        memset(r + m, 0, ( n - m ) * sizeof(limb_t));
+    }
+    else if( n == 1 )
+    {
+        r[0] = limbs_divmod_limb(ws, u, m, v[0]);
+    }
+    else
+    {
+        limbs_divmod(ws, r, u, m, v, n, ws + m + 1);
+    }
+}
+//------------------------------------------------------------------------------
+//---- Management --------------------------------------------------------------
+//------------------------------------------------------------------------------
+void uintvar_init(uintvar_t *obj)
+{
+    /**
+     * 初始化數值物件，其值為零。
+     */
+    assert( obj );
+
+    obj->limbs  = NULL;
+    obj->nlimbs = 0;
+    obj->cap    = 0;
+}
+//------------------------------------------------------------------------------
+void uintvar_deinit(uintvar_t *obj)
+{
+    /**
+     * 清除數值並釋放其記憶體
+     */
+    assert( obj );
+
+    if( obj->limbs )
+    {
+        memset(obj->limbs, 0, obj->cap * sizeof(limb_t));
+        free(obj->limbs);
+    }
+
+    uintvar_init(obj);
+}
+//------------------------------------------------------------------------------
+bool uintvar_reserve(uintvar_t *obj, int nlimbs)
+{
+    /**
+     * 預先配置記憶體
+     * @obj    : 數值物件
+     * @nlimbs : 需要的字組數
+     * @return : 成功時傳回 TRUE；記憶體不足時傳回 FALSE，且物件內容不變。
+     */
+    limb_t *limbs;
+    int     cap;
+
+    assert( obj && nlimbs >= 0 );
+
+    if( nlimbs <= obj->cap ) return true;
+
+    // The old buffer is wiped rather than reallocated, so that no copy of the value is left.
+    cap   = obj->cap > INT_MAX / 2 ? nlimbs : MAX( nlimbs , 2 * obj->cap );
+    limbs = malloc((size_t) cap * sizeof(limb_t));
+    if( !limbs ) return false;
+
+    if( obj->limbs )
+    {
+        memcpy(limbs, obj->limbs, obj->nlimbs * sizeof(limb_t));
+        memset(obj->limbs, 0, obj->cap * sizeof(limb_t));
+        free(obj->limbs);
+    }
+
+    obj->limbs = limbs;
+    obj->cap   = cap;
+
+    return true;
+}
+//------------------------------------------------------------------------------
+bool uintvar_copy(uintvar_t *dest, const uintvar_t *src)
+{
+    /**
+     * 複製數值
+     */
+    assert( dest && src );
+
+    if( dest == src ) return true;
+    return var_assign(dest, src->limbs, src->nlimbs);
+}
+//------------------------------------------------------------------------------
+void uintvar_scratch_release(void)
+{
+    /**
+     * 清除並釋放呼叫者執行緒的暫存記憶體，
+     * 在執行緒結束前呼叫此函式以避免記憶體洩漏。
+     */
+    if( scratch.buf )
+    {
+        memset(scratch.buf, 0, scratch.cap * sizeof(limb_t));
+        free(scratch.buf);
+    }
+
+    scratch.buf = NULL;
+    scratch.cap = 0;
+}
+//------------------------------------------------------------------------------
+//---- Import and Export -------------------------------------------------------
+//------------------------------------------------------------------------------
+bool uintvar_from_int(uintvar_t *dest, uint64_t val)
+{
+    /**
+     * 由整數設定數值
+     */
+    limb_t limbs[ 64 / BIGNUM_LIMB_BITS ];
+    int    i;
+
+    assert( dest );
+
+    for(i=0; i<64/BIGNUM_LIMB_BITS; ++i)
+    {
+        limbs[i] = val;
+        val = BIGNUM_LIMB_BITS < 64 ? val >> ( BIGNUM_LIMB_BITS % 64 ) : 0;
+    }
+
+    return var_assign(dest, limbs, 64 / BIGNUM_LIMB_BITS);
+}
+//------------------------------------------------------------------------------
+bool uintvar_from_bin(uintvar_t *dest, const void *src, size_t size)
+{
+    /**
+     * 由二進位資料設定數值
+     * @dest   : 數值物件
+     * @src    : 二進位資料，使用 Little-Endian 格式。
+     * @size   : 資料大小(位元組數)
+     * @return : 成功時傳回 TRUE；記憶體不足時傳回 FALSE。
+     */
+    const uint8_t *bytes = src;
+    size_t         n     = ( size + LIMB_BYTES - 1 ) / LIMB_BYTES;
+    size_t         i;
+
+    assert( dest && ( src || !size ) );
+
+    if( n > INT_MAX || !uintvar_reserve(dest, n) ) return false;
+
+    for(i=0; i<n; ++i)
+        dest->limbs[i] = 0;
+    for(i=0; i<size; ++i)
+        dest->limbs[ i / LIMB_BYTES ] |= (limb_t) bytes[i] << ( 8 * ( i % LIMB_BYTES ) );
+
+    dest->nlimbs = n;
+    var_trim(dest);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+size_t uintvar_to_bin(void *dest, size_t size, const uintvar_t *src)
+{
+    /**
+     * 輸出數值為二進位資料
+     * @dest   : 接收資料的緩衝區，資料使用 Little-Endian 格式，不足的部份以零填補。
+     * @size   : 緩衝區大小(位元組數)
+     * @src    : 數值物件
+     * @return : 完整表示數值所需的位元組數，大於 size 時表示輸出的資料被截斷。
+     */
+    uint8_t *bytes = dest;
+    size_t   nbytes;
+    size_t   i;
+
+    assert( ( dest || !size ) && src );
+
+    nbytes = (size_t) src->nlimbs * LIMB_BYTES;
+    for(i=0; i<size; ++i)
+        bytes[i] = i < nbytes ? src->limbs[ i / LIMB_BYTES ] >> ( 8 * ( i % LIMB_BYTES ) ) : 0;
+
+    return ( uintvar_get_bits(src) + 7 ) / 8;
+}
+//------------------------------------------------------------------------------
+bool uintvar_from_uintbig(uintvar_t *dest, const uintbig_t *src)
+{
+    /**
+     * 由固定長度的數值設定數值
+     * @return : 成功時傳回 TRUE；來源為 NaN 或記憶體不足時傳回 FALSE。
+     */
+    limb_t limbs[BIGNUM_LIMBS];
+    bool   res;
+
+    assert( dest && src );
+
+    if( src->ndig <= 0 ) return false;
+
+    res = var_assign(dest, limbs, limbs_load(limbs, src));
+    memset(limbs, 0, sizeof(limbs));
+
+    return res;
+}
+//------------------------------------------------------------------------------
+bool uintvar_to_uintbig(uintbig_t *dest, const uintvar_t *src)
+{
+    /**
+     * 輸出數值為固定長度的數值
+     * @return : 成功時傳回 TRUE；數值超出 BIGNUM_DIGSZ 的範圍時傳回 FALSE。
+     */
+    assert( dest && src );
+
+    if( uintvar_get_bits(src) > 8 * BIGNUM_DIGSZ ) return false;
+
+    limbs_store(dest, src->limbs, src->nlimbs);
+    return true;
+}
+//------------------------------------------------------------------------------
+//---- Basic Operation ---------------------------------------------------------
+//------------------------------------------------------------------------------
+unsigned uintvar_get_bits(const uintvar_t *obj)
+{
+    /**
+     * 取得數值的有效位元數，數值為零時傳回零。
+     */
+    assert( obj );
+
+    if( !obj->nlimbs ) return 0;
+    return obj->nlimbs * BIGNUM_LIMB_BITS - limb_count_leading_zeros(obj->limbs[ obj->nlimbs - 1 ]);
+}
+//------------------------------------------------------------------------------
+bool uintvar_is_zero(const uintvar_t *obj)
+{
+    assert( obj );
+    return !obj->nlimbs;
+}
+//------------------------------------------------------------------------------
+int uintvar_compare(const uintvar_t *obj1, const uintvar_t *obj2)
+{
+    /**
+     * 比較數值大小
+     * @return : obj1 小於、等於、大於 obj2 時，分別傳回負數、零、正數。
+     */
+    int i;
+
+    assert( obj1 && obj2 );
+
+    if( obj1->nlimbs != obj2->nlimbs )
+        return obj1->nlimbs < obj2->nlimbs ? -1 : 1;
+
+    for(i=obj1->nlimbs-1; i>=0; --i)
+    {
+        if( obj1->limbs[i] != obj2->limbs[i] )
+            return obj1->limbs[i] < obj2->limbs[i] ? -1 : 1;
+    }
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+bool uintvar_and(uintvar_t *r, const uintvar_t *a, const uintvar_t *b)
+{
+    /**
+     * 計算 r = a AND b
+     */
+    int n = MIN( a->nlimbs , b->nlimbs );
+    int i;
+
+    assert( r && a && b );
+
+    if( !uintvar_reserve(r, n) ) return false;
+
+    for(i=0; i<n; ++i)
+        r->limbs[i] = a->limbs[i] & b->limbs[i];
+
+    r->nlimbs = n;
+    var_trim(r);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+bool uintvar_or(uintvar_t *r, const uintvar_t *a, const uintvar_t *b)
+{
+    /**
+     * 計算 r = a OR b
+     */
+    int n;
+    int i;
+
+    assert( r && a && b );
+
+    if( a->nlimbs < b->nlimbs )
+    {
+        const uintvar_t *t = a;
+
+        a = b;
+        b = t;
+    }
+
+    n = a->nlimbs;
+    if( !uintvar_reserve(r, n) ) return false;
+
+    for(i=0; i<b->nlimbs; ++i)
+        r->limbs[i] = a->limbs[i] | b->limbs[i];
+    for(; i<n; ++i)
+        r->limbs[i] = a->limbs[i];
+
+    r->nlimbs = n;
+
+    return true;
+}
+//------------------------------------------------------------------------------
+bool uintvar_xor(uintvar_t *r, const uintvar_t *a, const uintvar_t *b)
+{
+    /**
+     * 計算 r = a XOR b
+     */
+    int n;
+    int i;
+
+    assert( r && a && b );
+
+    if( a->nlimbs < b->nlimbs )
+    {
+        const uintvar_t *t = a;
+
+        a = b;
+        b = t;
+    }
+
+    n = a->nlimbs;
+    if( !uintvar_reserve(r, n) ) return false;
+
+    for(i=0; i<b->nlimbs; ++i)
+        r->limbs[i] = a->limbs[i] ^ b->limbs[i];
+    for(; i<n; ++i)
+        r->limbs[i] = a->limbs[i];
+
+    r->nlimbs = n;
+    var_trim(r);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+bool uintvar_shift_left(uintvar_t *r, const uintvar_t *a, unsigned int n)
+{
+    /**
+     * 計算 r = a << n
+     */
+    int na    = a->nlimbs;
+    int words = n / BIGNUM_LIMB_BITS;
+    int bits  = n % BIGNUM_LIMB_BITS;
+    int i;
+
+    assert( r && a );
+
+    if( !na ) return uintvar_from_int(r, 0);
+    if( n / BIGNUM_LIMB_BITS > (unsigned) ( INT_MAX - na - 1 ) ) return false;
+    if( !uintvar_reserve(r, na + words + 1) ) return false;
+
+    // From the high limbs to the low limbs, so that 'r' can be the same as 'a'.
+    if( bits )
+    {
+        r->limbs[ na + words ] = a->limbs[ na - 1 ] >> ( BIGNUM_LIMB_BITS - bits );
+        for(i=na-1; i>0; --i)
+            r->limbs[ i + words ] = ( a->limbs[i] << bits ) | ( a->limbs[ i - 1 ] >> ( BIGNUM_LIMB_BITS - bits ) );
+        r->limbs[words] = a->limbs[0] << bits;
+    }
+    else
+    {
+        r->limbs[ na + words ] = 0;
+        for(i=na-1; i>=0; --i)
+            r->limbs[ i + words ] = a->limbs[i];
+    }
+
+    for(i=0; i<words; ++i)
+        r->limbs[i] = 0;
+
+    r->nlimbs = na + words + 1;
+    var_trim(r);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+bool uintvar_shift_right(uintvar_t *r, const uintvar_t *a, unsigned int n)
+{
+    /**
+     * 計算 r = a >> n
+     */
+    unsigned words = n / BIGNUM_LIMB_BITS;
+    int      bits  = n % BIGNUM_LIMB_BITS;
+    int      nr, i;
+
+    assert( r && a );
+
+    if( words >= (unsigned) a->nlimbs ) return uintvar_from_int(r, 0);
+
+    nr = a->nlimbs - words;
+    if( !uintvar_reserve(r, nr) ) return false;
+
+    // From the low limbs to the high limbs, so that 'r' can be the same as 'a'.
+    if( bits )
+    {
+        for(i=0; i<nr-1; ++i)
+            r->limbs[i] = ( a->limbs[ i + words ] >> bits ) | ( a->limbs[ i + words + 1 ] << ( BIGNUM_LIMB_BITS - bits ) );
+        r->limbs[ nr - 1 ] = a->limbs[ a->nlimbs - 1 ] >> bits;
+    }
+    else
+    {
+        for(i=0; i<nr; ++i)
+            r->limbs[i] = a->limbs[ i + words ];
+    }
+
+    r->nlimbs = nr;
+    var_trim(r);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+//---- Math --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+bool uintvar_add(uintvar_t *r, const uintvar_t *a, const uintvar_t *b)
+{
+    /**
+     * 計算 r = a + b
+     */
+    limb_t carry = 0;
+    int    n, i;
+
+    assert( r && a && b );
+
+    if( a->nlimbs < b->nlimbs )
+    {
+        const uintvar_t *t = a;
+
+        a = b;
+        b = t;
+    }
+
+    n = a->nlimbs;
+    if( n == INT_MAX || !uintvar_reserve(r, n + 1) ) return false;
+
+    for(i=0; i<b->nlimbs; ++i)
+    {
+        limb_t s = a->limbs[i] + carry;
+        carry  = s < carry;
+        s     += b->limbs[i];
+        carry += s < b->limbs[i];
+        r->limbs[i] = s;
+    }
+    for(; i<n; ++i)
+    {
+        limb_t s = a->limbs[i] + carry;
+        carry = s < carry;
+        r->limbs[i] = s;
+    }
+
+    r->limbs[n] = carry;
+    r->nlimbs   = n + carry;
+
+    return true;
+}
+//------------------------------------------------------------------------------
+bool uintvar_sub(uintvar_t *r, const uintvar_t *a, const uintvar_t *b)
+{
+    /**
+     * 計算 r = a - b
+     * @return : 成功時傳回 TRUE；a 小於 b 或記憶體不足時傳回 FALSE。
+     */
+    limb_t borrow = 0;
+    int    n, i;
+
+    assert( r && a && b );
+
+    if( uintvar_compare(a, b) < 0 ) return false;
+
+    n = a->nlimbs;
+    if( !uintvar_reserve(r, n) ) return false;
+
+    for(i=0; i<b->nlimbs; ++i)
+    {
+        limb_t x = a->limbs[i];
+        limb_t y = b->limbs[i];
+        limb_t d = x - y;
+
+        r->limbs[i] = d - borrow;
+        borrow      = ( x < y ) | ( d < borrow );
+    }
+    for(; i<n; ++i)
+    {
+        limb_t x = a->limbs[i];
+
+        r->limbs[i] = x - borrow;
+        borrow      = x < borrow;
+    }
+
+    r->nlimbs = n;
+    var_trim(r);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+bool uintvar_mul(uintvar_t *r, const uintvar_t *a, const uintvar_t *b)
+{
+    /**
+     * 計算 r = a * b，a 與 b 為同一個物件時使用平方運算。
+     */
+    int     na = a->nlimbs;
+    int     nb = b->nlimbs;
+    limb_t *t;
+
+    assert( r && a && b );
+
+    if( !na || !nb ) return uintvar_from_int(r, 0);
+    if( na > INT_MAX - nb ) return false;
+
+    t = scratch_get( (size_t) na + nb + LIMBS_MUL_WORKSPACE( MAX( na , nb ) ) );
+    if( !t ) return false;
+
+    if( a == b )
+        limbs_sqr_ws(t, a->limbs, na, t + na + nb);
+    else
+        limbs_mul_ws(t, a->limbs, na, b->limbs, nb, t + na + nb);
+
+    return var_assign(r, t, na + nb);
+}
+//------------------------------------------------------------------------------
+bool uintvar_divmod(uintvar_t *quo, uintvar_t *rem, const uintvar_t *a, const uintvar_t *b)
+{
+    /**
+     * 計算 a / b 的商數與餘數
+     * @quo    : 接收商數，可為 NULL。
+     * @rem    : 接收餘數，可為 NULL，且不可與 quo 為同一個物件。
+     * @a      : 被除數
+     * @b      : 除數
+     * @return : 成功時傳回 TRUE；除數為零或記憶體不足時傳回 FALSE。
+     */
+    int     m = a->nlimbs;
+    int     n = b->nlimbs;
+    limb_t *q, *rr;
+
+    assert( a && b );
+    assert( !quo || quo != rem );
+
+    if( !n ) return false;
+
+    if( m < n )
+    {
+        if( rem && !uintvar_copy(rem, a) ) return false;
+        if( quo ) quo->nlimbs = 0;
+        return true;
+    }
+
+    q = scratch_get( (size_t) n + VAR_MOD_WORKSPACE(m, n) );
+    if( !q ) return false;
+
+    // limbs_mod leaves the quotient in the beginning of its work space.
+    rr = q + VAR_MOD_WORKSPACE(m, n);
+    limbs_mod(rr, a->limbs, m, b->limbs, n, q);
+
+    // Allocate both outputs before any of them be changed.
+    if( quo && !uintvar_reserve(quo, m - n + 1) ) return false;
+    if( rem && !uintvar_reserve(rem, n        ) ) return false;
+
+    if( quo ) var_assign(quo, q , m - n + 1);
+    if( rem ) var_assign(rem, rr, n);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+static
+int get_window_size(int nbits)
+{
+    // Window sizes that minimize the number of multiplications, see bignum_mont.c.
+    int w;
+
+    if     ( nbits > 671 ) w = 6;
+    else if( nbits > 239 ) w = 5;
+    else if( nbits >  79 ) w = 4;
+    else if( nbits >  23 ) w = 3;
+    else                   w = 1;
+
+    return MIN( w , VAR_WINDOW_MAX );
+}
+//------------------------------------------------------------------------------
+static
+int get_bit(const uintvar_t *obj, int i)
+{
+    return ( obj->limbs[ i / BIGNUM_LIMB_BITS ] >> ( i % BIGNUM_LIMB_BITS ) ) & 0x01;
+}
+//------------------------------------------------------------------------------
+static
+bool powermod_mont(uintvar_t *r, const uintvar_t *a, const uintvar_t *b, const uintvar_t *n)
+{
+    /*
+     * The left-to-right sliding window exponentiation in the Montgomery form,
+     * the same as uintbig_mont_powermod, and the modulus must be odd and greater than one.
+     */
+    const limb_t *np    = n->limbs;
+    int           nl    = n->nlimbs;
+    int           ml    = MAX( a->nlimbs , 2 * nl + 1 );
+    int           nbits = uintvar_get_bits(b);
+    int           w     = get_window_size(nbits);
+    limb_t       *unit, *rr, *table, *x, *t, *ws;
+    limb_t        n0, inv, ninv;
+    int           i, k;
+    bool          started;
+
+    // unit, rr, x, table, t, and the larger one of the multiplication and the reduction work spaces.
+    size_t size = (size_t) ( 3 + ( 1 << ( w - 1 ) ) ) * nl + ml +
+                  MAX( LIMBS_MUL_WORKSPACE(nl) , VAR_MOD_WORKSPACE(ml, nl) );
+
+    unit = scratch_get(size);
+    if( !unit ) return false;
+
+    rr    = unit  + nl;
+    x     = rr    + nl;
+    table = x     + nl;
+    t     = table + ( (size_t) nl << ( w - 1 ) );
+    ws    = t     + ml;
+
+    // -n^(-1) mod 2^BIGNUM_LIMB_BITS by Newton's iteration, see uintbig_mont_init.
+    n0  = np[0];
+    inv = n0;
+    for(i=0; i<5; ++i)
+        inv *= 2 - n0 * inv;
+    ninv = 0 - inv;
+
+    // R^2 mod n by a long division.
+    memset(t, 0, 2 * nl * sizeof(limb_t));
+    t[ 2 * nl ] = 1;
+    limbs_mod(rr, t, 2 * nl + 1, np, nl, ws);
+
+    memset(unit, 0, nl * sizeof(limb_t));
+    unit[0] = 1;
+
+    // Odd powers of the base : a^1, a^3, a^5, ..., in the Montgomery form.
+    limbs_mod(x, a->limbs, a->nlimbs, np, nl, ws);
+    limbs_mul_ws(t, x, nl, rr, nl, ws);
+    limbs_mont_reduce(table, t, np, nl, ninv);
+    if( w > 1 )
+    {
+        limbs_sqr_ws(t, table, nl, ws);
+        limbs_mont_reduce(x, t, np, nl, ninv);
+        for(k=1; k < 1 << ( w - 1 ); ++k)
+        {
+            limbs_mul_ws(t, table + ( k - 1 ) * nl, nl, x, nl, ws);
+            limbs_mont_reduce(table + k * nl, t, np, nl, ninv);
+        }
+    }
+
+    // Scan the exponent from the highest bit, and the highest bit is always one.
+    started = false;
+    for(i=nbits-1; i>=0; )
+    {
+        int j, val;
+
+        if( !get_bit(b, i) )
+        {
+            limbs_sqr_ws(t, x, nl, ws);
+            limbs_mont_reduce(x, t, np, nl, ninv);
+            --i;
+            continue;
+        }
+
+        // Find the longest window which ends with a bit of one
+        j = MAX( i - w + 1 , 0 );
+        while( !get_bit(b, j) ) ++j;
+
+        val = 0;
+        for(k=i; k>=j; --k)
+            val = ( val << 1 ) | get_bit(b, k);
+
+        if( started )
+        {
+            for(k=i; k>=j; --k)
+            {
+                limbs_sqr_ws(t, x, nl, ws);
+                limbs_mont_reduce(x, t, np, nl, ninv);
+            }
+            limbs_mul_ws(t, x, nl, table + ( val >> 1 ) * nl, nl, ws);
+            limbs_mont_reduce(x, t, np, nl, ninv);
+        }
+        else
+        {
+            memcpy(x, table + ( val >> 1 ) * nl, nl * sizeof(limb_t));
+            started = true;
+        }
+
+        i = j - 1;
+    }
+
+    // Convert the result from the Montgomery form.
+    limbs_mul_ws(t, x, nl, unit, nl, ws);
+    limbs_mont_reduce(x, t, np, nl, ninv);
+
+    return var_assign(r, x, nl);
+}
+//------------------------------------------------------------------------------
+static
+bool powermod_division(uintvar_t *r, const uintvar_t *a, const uintvar_t *b, const uintvar_t *n)
+{
+    // The square-and-multiply method with a long division for every step, for the even moduli.
+    const limb_t *np = n->limbs;
+    int           nl = n->nlimbs;
+    int           ml = MAX( a->nlimbs , 2 * nl );
+    limb_t       *x, *am, *t, *ws;
+    int           i;
+
+    size_t size = (size_t) 4 * nl + MAX( LIMBS_MUL_WORKSPACE(nl) , VAR_MOD_WORKSPACE(ml, nl) );
+
+    x = scratch_get(size);
+    if( !x ) return false;
+
+    am = x  + nl;
+    t  = am + nl;
+    ws = t  + 2 * nl;
+
+    limbs_mod(am, a->limbs, a->nlimbs, np, nl, ws);
+    memset(x, 0, nl * sizeof(limb_t));
+    x[0] = 1;
+
+    for(i=uintvar_get_bits(b)-1; i>=0; --i)
+    {
+        limbs_sqr_ws(t, x, nl, ws);
+        limbs_mod(x, t, 2 * nl, np, nl, ws);
+
+        if( b->limbs[ i / BIGNUM_LIMB_BITS ] >> ( i % BIGNUM_LIMB_BITS ) & 1 )
+        {
+            limbs_mul_ws(t, x, nl, am, nl, ws);
+            limbs_mod(x, t, 2 * nl, np, nl, ws);
+        }
+    }
+
+    return var_assign(r, x, nl);
+}
+//------------------------------------------------------------------------------
+bool uintvar_powermod(uintvar_t *r, const uintvar_t *a, const uintvar_t *b, const uintvar_t *n)
+{
+    /**
+     * 計算 r = ( a ^ b ) mod n
+     * @return : 成功時傳回 TRUE；模數為零或記憶體不足時傳回 FALSE。
+     * Note : 模數為奇數時使用 Montgomery 形式的滑動視窗演算法，
+     *        其他情況下使用每步驟都進行長除法的平方乘法演算法。
+     */
+    assert( r && a && b && n );
+
+    if( !n->nlimbs ) return false;
+    if( n->nlimbs == 1 && n->limbs[0] == 1 ) return uintvar_from_int(r, 0);
+    if( !b->nlimbs ) return uintvar_from_int(r, 1);
+
+    return n->limbs[0] & 1 ? powermod_mont(r, a, b, n) : powermod_division(r, a, b, n);
+}
+//------------------------------------------------------------------------------
@@ -19,8 +19,10 @@ extern "C" {
 uintbig_t uintbig_from_bin(const void *src, size_t size);
 uintbig_t uintbig_from_int(uint64_t val);
 uintbig_t uintbig_from_hex(const char *str);
+uintbig_t uintbig_from_dec(const char *str);
 uint64_t  uintbig_to_int  (const uintbig_t *obj);
 size_t    uintbig_to_str  (char *buf, size_t bufsz, const uintbig_t *obj);
+size_t    uintbig_to_dec  (char *buf, size_t bufsz, const uintbig_t *obj);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -0,0 +1,292 @@
+/******************************************************************************
+ * Name      : Large Number Limbs
+ * Purpose   : Sub Module of Large Number Library : Machine Word Arithmetic.
+ * Author    : 王文佑
+ * Created   : 2026.10.17
+ * Licence   : ZLib Licence
+ * Reference : http://www.openfoundry.org/of/projects/2419
+ ******************************************************************************/
+#ifndef _GEN_BIGNUM_LIMB_H_
+#define _GEN_BIGNUM_LIMB_H_
+
+#include <assert.h>
+#include "../inline.h"
+#include "../minmax.h"
+#include "./type.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+/*
+ * The number data are still stored in bytes (see type.h),
+ * but the arithmetic functions load them into limbs of machine words,
+ * so that carries and products are calculated a word at a time.
+ *
+ * BIGNUM_LIMB_BITS selects the limb size, and can be defined to 32 or 64 by the user.
+ * By default 64 bits limbs are used if a double word multiply is available
+ * (__int128 of GCC and Clang, or _umul128 of MSVC on x64), and 32 bits limbs otherwise.
+ */
+
+#ifndef BIGNUM_LIMB_BITS
+    #if defined(__SIZEOF_INT128__) || ( defined(_MSC_VER) && defined(_M_X64) )
+        #define BIGNUM_LIMB_BITS 64
+    #else
+        #define BIGNUM_LIMB_BITS 32
+    #endif
+#endif
+
+#if BIGNUM_LIMB_BITS == 64
+    typedef uint64_t limb_t;
+    #if defined(__SIZEOF_INT128__)
+        #define LIMB_DWORD_INT128
+    #elif defined(_MSC_VER) && defined(_M_X64)
+        #define LIMB_DWORD_MSVC
+    #else
+        #error 64 bits limbs need __int128 or _umul128!
+    #endif
+#elif BIGNUM_LIMB_BITS == 32
+    typedef uint32_t limb_t;
+#else
+    #error BIGNUM_LIMB_BITS must be 32 or 64
+#endif
+
+#define LIMB_BYTES ( BIGNUM_LIMB_BITS / 8 )
+#define LIMB_MAX   ( (limb_t) -1 )
+
+// Number of limbs to cover all bytes of a number object.
+#define BIGNUM_LIMBS ( ( BIGNUM_DIGSZ + LIMB_BYTES - 1 ) / LIMB_BYTES )
+
+/*
+ * Operands with the number of limbs great equal to these thresholds
+ * are multiplied by Karatsuba's method, and smaller ones by Comba's method.
+ * The default values are measured by bignum_bench, and can be redefined by the user.
+ */
+#ifndef BIGNUM_KARATSUBA_MUL_THRESHOLD
+#define BIGNUM_KARATSUBA_MUL_THRESHOLD 32
+#endif
+#ifndef BIGNUM_KARATSUBA_SQR_THRESHOLD
+#define BIGNUM_KARATSUBA_SQR_THRESHOLD 64
+#endif
+
+// Size of the work space needed by the Karatsuba functions for 'n' limbs operands.
+#define LIMBS_KARATSUBA_WORKSPACE(n) ( 8 * (n) + 64 )
+// Size of the work space needed by limbs_mul_ws, where 'n' is the size of the smaller operand.
+#define LIMBS_MUL_WORKSPACE(n) ( LIMBS_KARATSUBA_WORKSPACE(n) + 2 * (n) )
+// Size of the work space needed by limbs_divmod for 'm' limbs dividend and 'n' limbs divisor.
+#define LIMBS_DIVMOD_WORKSPACE(m,n) ( (m) + (n) + 1 )
+
+//------------------------------------------------------------------------------
+INLINE
+limb_t limb_mul(limb_t a, limb_t b, limb_t /*out*/ *hi)
+{
+    /*
+     * Calculate a*b, return the lower word and output the higher word.
+     */
+#if   defined(LIMB_DWORD_INT128)
+    unsigned __int128 r = (unsigned __int128) a * b;
+    *hi = r >> 64;
+    return r;
+#elif defined(LIMB_DWORD_MSVC)
+    return _umul128(a, b, hi);
+#else
+    uint64_t r = (uint64_t) a * b;
+    *hi = r >> 32;
+    return r;
+#endif
+}
+//------------------------------------------------------------------------------
+INLINE
+limb_t limb_mul_add(limb_t a, limb_t b, limb_t c, limb_t d, limb_t /*out*/ *hi)
+{
+    /*
+     * Calculate a*b+c+d, return the lower word and output the higher word.
+     * The result always fits in a double word.
+     */
+    limb_t lo = limb_mul(a, b, hi);
+
+    lo  += c;
+    *hi += lo < c;
+    lo  += d;
+    *hi += lo < d;
+
+    return lo;
+}
+//------------------------------------------------------------------------------
+INLINE
+limb_t limb_div(limb_t hi, limb_t lo, limb_t d, limb_t /*out*/ *rem)
+{
+    /*
+     * Divide the double word (hi,lo) by d, where hi must be less than d,
+     * return the quotient and output the remainder.
+     */
+    assert( hi < d );
+#if   defined(LIMB_DWORD_INT128)
+    unsigned __int128 n = ( (unsigned __int128) hi << 64 ) | lo;
+    *rem = n % d;
+    return n / d;
+#elif defined(LIMB_DWORD_MSVC)
+    return _udiv128(hi, lo, d, rem);
+#else
+    uint64_t n = ( (uint64_t) hi << 32 ) | lo;
+    *rem = n % d;
+    return n / d;
+#endif
+}
+//------------------------------------------------------------------------------
+INLINE
+int limb_count_leading_zeros(limb_t x)
+{
+    // WARNING : 'x' must not be zero.
+    int n = 0;
+
+    assert( x );
+
+    while( !( x >> ( BIGNUM_LIMB_BITS - 1 ) ) )
+    {
+        x <<= 1;
+        ++n;
+    }
+
+    return n;
+}
+//------------------------------------------------------------------------------
+INLINE
+int limbs_load(limb_t limbs[BIGNUM_LIMBS], const uintbig_t *obj)
+{
+    /*
+     * Load the number data into limbs, all limbs will be filled.
+     * Return the number of limbs in use, and it is one at least.
+     */
+    int nlimbs = MIN( ( obj->ndig + LIMB_BYTES - 1 ) / LIMB_BYTES , BIGNUM_LIMBS );
+    int i, k;
+
+    assert( obj->ndig > 0 );
+
+    for(i=0; i<nlimbs; ++i)
+    {
+        const uint8_t *src = obj->digit + i * LIMB_BYTES;
+        int            n   = MIN( LIMB_BYTES , BIGNUM_DIGSZ - i * LIMB_BYTES );
+        limb_t         val = 0;
+
+        for(k=n-1; k>=0; --k)
+            val = ( val << 8 ) | src[k];
+        limbs[i] = val;
+    }
+    for(; i<BIGNUM_LIMBS; ++i)
+    {
+        limbs[i] = 0;
+    }
+
+    return nlimbs;
+}
+//------------------------------------------------------------------------------
+INLINE
+void limbs_store(uintbig_t *obj, const limb_t *limbs, int nlimbs)
+{
+    /*
+     * Store limbs to the number object,
+     * the data out of the object range will be truncated.
+     */
+    uint8_t *dest = obj->digit;
+    int      ndig = MIN( nlimbs * LIMB_BYTES , BIGNUM_DIGSZ );
+    int      i;
+
+    for(i=0; i<ndig; ++i)
+        dest[i] = limbs[ i / LIMB_BYTES ] >> ( ( i % LIMB_BYTES ) << 3 );
+    for(; i<BIGNUM_DIGSZ; ++i)
+        dest[i] = 0;
+
+    while( ndig > 1 && !dest[ndig-1] ) --ndig;
+    obj->ndig = MAX( ndig , 1 );
+}
+//------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Multiplication of limb arrays,
+ * the result 'r' receives the full product, and cannot be the same as the operands.
+ */
+
+void limbs_mul_comba(limb_t       /*out*/ *r,
+                     const limb_t /*in */ *a,
+                     int          /*in */  na,
+                     const limb_t /*in */ *b,
+                     int          /*in */  nb);
+void limbs_sqr_comba(limb_t       /*out*/ *r,
+                     const limb_t /*in */ *a,
+                     int          /*in */  n);
+
+void limbs_mul_karatsuba(limb_t       /*out*/ *r,
+                         const limb_t /*in */ *a,
+                         const limb_t /*in */ *b,
+                         int          /*in */  n,
+                         int          /*in */  threshold,
+                         limb_t       /*tmp*/ *ws);
+void limbs_sqr_karatsuba(limb_t       /*out*/ *r,
+                         const limb_t /*in */ *a,
+                         int          /*in */  n,
+                         int          /*in */  threshold,
+                         limb_t       /*tmp*/ *ws);
+
+void limbs_mul_ws(limb_t       /*out*/ *r,
+                  const limb_t /*in */ *a,
+                  int          /*in */  na,
+                  const limb_t /*in */ *b,
+                  int          /*in */  nb,
+                  limb_t       /*tmp*/ *ws);
+void limbs_sqr_ws(limb_t       /*out*/ *r,
+                  const limb_t /*in */ *a,
+                  int          /*in */  n,
+                  limb_t       /*tmp*/ *ws);
+
+void limbs_mul(limb_t       /*out*/ *r,
+               const limb_t /*in */ *a,
+               int          /*in */  na,
+               const limb_t /*in */ *b,
+               int          /*in */  nb);
+void limbs_sqr(limb_t       /*out*/ *r,
+               const limb_t /*in */ *a,
+               int          /*in */  n);
+
+/*
+ * Division and Montgomery reduction of limb arrays.
+ */
+
+limb_t limbs_divmod_limb(limb_t       /*out*/ *quo,
+                         const limb_t /*in */ *u,
+                         int          /*in */  m,
+                         limb_t       /*in */  v);
+void   limbs_divmod     (limb_t       /*out*/ *quo,
+                         limb_t       /*out*/ *rem,
+                         const limb_t /*in */ *u,
+                         int          /*in */  m,
+                         const limb_t /*in */ *v,
+                         int          /*in */  n,
+                         limb_t       /*tmp*/ *ws);
+
+void limbs_mont_reduce(limb_t       /*out*/ *r,
+                       limb_t       /*in */ *t,
+                       const limb_t /*in */ *np,
+                       int          /*in */  n,
+                       limb_t       /*in */  ninv);
+void limbs_mont_reduce_ct(limb_t       /*out*/ *r,
+                          limb_t       /*in */ *t,
+                          const limb_t /*in */ *np,
+                          int          /*in */  n,
+                          limb_t       /*in */  ninv);
+
+/*
+ * Constant time helpers, whose running time and memory accesses depend only on the sizes.
+ */
+
+void limbs_ct_swap(limb_t *a, limb_t *b, int n, limb_t mask);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
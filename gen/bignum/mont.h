@@ -0,0 +1,50 @@
+/******************************************************************************
+ * Name      : Large Number Montgomery
+ * Purpose   : Sub Module of Large Number Library : Montgomery Modular Arithmetic.
+ * Author    : 王文佑
+ * Created   : 2026.10.17
+ * Licence   : ZLib Licence
+ * Reference : http://www.openfoundry.org/of/projects/2419
+ ******************************************************************************/
+#ifndef _GEN_BIGNUM_MONT_H_
+#define _GEN_BIGNUM_MONT_H_
+
+#include <stdbool.h>
+#include "./base.h"
+#include "./limb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A Montgomery context holds the values derived from an odd modulus,
+ * so that the modular multiplications with the same modulus
+ * need no division.
+ * The context can be shared by threads after it is initialized.
+ */
+typedef struct uintbig_mont_t
+{
+    uintbig_t modulus;             // 模數
+    limb_t    n  [BIGNUM_LIMBS];   // 模數的字組資料
+    limb_t    rr [BIGNUM_LIMBS];   // R^2 mod n，其中 R = 2^(字組位元數*nlimbs)
+    limb_t    one[BIGNUM_LIMBS];   // R mod n，即數值 1 的 Montgomery 表示法
+    limb_t    ninv;                // -n^(-1) mod 2^(字組位元數)
+    int       nlimbs;              // 模數使用的字組數
+} uintbig_mont_t;
+
+bool      uintbig_mont_init    (uintbig_mont_t *ctx, const uintbig_t *n);
+uintbig_t uintbig_mont_mulmod  (const uintbig_mont_t *ctx, const uintbig_t *a, const uintbig_t *b);
+uintbig_t uintbig_mont_powermod(const uintbig_mont_t *ctx, const uintbig_t *a, const uintbig_t *b);
+
+/*
+ * The constant time mode, for the secret exponents.
+ * It is slower than the fast path above, so the caller picks the mode by the data.
+ */
+uintbig_t uintbig_mont_powermod_ct(const uintbig_mont_t *ctx, const uintbig_t *a, const uintbig_t *b);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,39 @@
+/******************************************************************************
+ * Name      : Large Number Prime
+ * Purpose   : Sub Module of Large Number Library : Prime Number Search.
+ * Author    : 王文佑
+ * Created   : 2026.10.17
+ * Licence   : ZLib Licence
+ * Reference : http://www.openfoundry.org/of/projects/2419
+ ******************************************************************************/
+#ifndef _GEN_BIGNUM_PRIME_H_
+#define _GEN_BIGNUM_PRIME_H_
+
+#include "../mtrand.h"
+#include "./base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The prime search starts from a random odd number and scans the following odd numbers,
+ * candidates are filtered by three stages before they are accepted:
+ *   1. Sieve : Multiples of the smaller primes in a window of candidates are marked out at once,
+ *              with a residue table that is updated incrementally from window to window.
+ *   2. Trial : Survivors of the sieve are divided by the larger primes.
+ *   3. Miller-Rabin : The remained candidates are tested by uintbig_prime_test.
+ * Multiple threads can search from different starting points at the same time,
+ * and the first prime found will be returned.
+ */
+
+uintbig_t uintbig_prime_search(unsigned int  ndig,
+                               unsigned int  times,
+                               mt_rand64_t  *rndobj,
+                               unsigned int  threads);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Name      : Large Number Variable Length
+ * Purpose   : Sub Module of Large Number Library : Variable Length Number.
+ * Author    : 王文佑
+ * Created   : 2026.10.17
+ * Licence   : ZLib Licence
+ * Reference : http://www.openfoundry.org/of/projects/2419
+ ******************************************************************************/
+#ifndef _GEN_BIGNUM_VAR_H_
+#define _GEN_BIGNUM_VAR_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "./base.h"
+#include "./limb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The variable length number has no size limit of BIGNUM_DIGSZ,
+ * its limbs are allocated dynamically, and only the limbs in use are processed.
+ *
+ * 1. Results are written to the output parameters, which can be the same objects as the operands.
+ * 2. Temporaries are allocated from a scratch arena of the calling thread,
+ *    the arena grows on demand and is reused by the later calls,
+ *    and can be freed by uintvar_scratch_release before the thread exits.
+ * 3. Functions return FALSE if the memory allocation fails,
+ *    or the operation is not defined (see the notes of each function),
+ *    and the output objects are not changed in these cases.
+ */
+typedef struct uintvar_t
+{
+    limb_t *limbs;   // 數值的字組資料，使用 Little-Endian 格式。
+    int     nlimbs;  // 使用中的字組數，最高字組不為零；數值為零時為零。
+    int     cap;     // 已配置的字組數
+} uintvar_t;
+
+#define UINTVAR_INIT { NULL, 0, 0 }
+
+void uintvar_init   (uintvar_t *obj);
+void uintvar_deinit (uintvar_t *obj);
+bool uintvar_reserve(uintvar_t *obj, int nlimbs);
+bool uintvar_copy   (uintvar_t *dest, const uintvar_t *src);
+
+// Import and Export
+
+bool   uintvar_from_int    (uintvar_t *dest, uint64_t val);
+bool   uintvar_from_bin    (uintvar_t *dest, const void *src, size_t size);
+size_t uintvar_to_bin      (void *dest, size_t size, const uintvar_t *src);
+bool   uintvar_from_uintbig(uintvar_t *dest, const uintbig_t *src);
+bool   uintvar_to_uintbig  (uintbig_t *dest, const uintvar_t *src);
+
+// Basic Operation
+
+unsigned uintvar_get_bits(const uintvar_t *obj);
+bool     uintvar_is_zero (const uintvar_t *obj);
+int      uintvar_compare (const uintvar_t *obj1, const uintvar_t *obj2);
+
+bool uintvar_and(uintvar_t *r, const uintvar_t *a, const uintvar_t *b);
+bool uintvar_or (uintvar_t *r, const uintvar_t *a, const uintvar_t *b);
+bool uintvar_xor(uintvar_t *r, const uintvar_t *a, const uintvar_t *b);
+
+bool uintvar_shift_left (uintvar_t *r, const uintvar_t *a, unsigned int n);
+bool uintvar_shift_right(uintvar_t *r, const uintvar_t *a, unsigned int n);
+
+// Math
+
+bool uintvar_add     (uintvar_t *r, const uintvar_t *a, const uintvar_t *b);
+bool uintvar_sub     (uintvar_t *r, const uintvar_t *a, const uintvar_t *b);
+bool uintvar_mul     (uintvar_t *r, const uintvar_t *a, const uintvar_t *b);
+bool uintvar_divmod  (uintvar_t *quo, uintvar_t *rem, const uintvar_t *a, const uintvar_t *b);
+bool uintvar_powermod(uintvar_t *r, const uintvar_t *a, const uintvar_t *b, const uintvar_t *n);
+
+void uintvar_scratch_release(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -8,8 +8,387 @@
 
 #include "../inline.h"
 #include "aes_table.h"
+#include "aes_ni.h"
 #include "aes.h"
 
+//------------------------------------------------------------------------------
+//---- Bitsliced Routines ------------------------------------------------------
+//------------------------------------------------------------------------------
+#ifdef AES_CONST_TIME
+/*
+ * Constant time routines, no table lookup and no branch depends on the state or the keys.
+ * Up to four states (64 bytes) are bitsliced into eight planes,
+ * plane[i] holds bit i of all bytes, and bit n of a plane belongs to byte n.
+ * All steps of the rounds work on planes directly:
+ * the S-box is a boolean circuit,
+ * and ShiftRows and MixColumns become rotations of bits in each state or each column.
+ */
+#define SLICE_BYTES  64 // Maximum number of bytes bitsliced together.
+#define SLICE_STATES ( SLICE_BYTES / sizeof(aes_state_t) )
+
+typedef uint64_t plane_t;
+
+#define MASK_EACH(pattern) ( (plane_t)(pattern) * 0x0001000100010001ULL )   // Repeat a 16-bit pattern for each state.
+
+static
+uint64_t bits_transpose(uint64_t x)
+{
+    /*
+     * Transpose a 8x8 bit matrix, bit j of byte i will be moved to bit i of byte j.
+     */
+    x = ( x & 0xAA55AA55AA55AA55ULL ) | ( ( x & 0x00AA00AA00AA00AAULL ) <<  7 ) | ( ( x >>  7 ) & 0x00AA00AA00AA00AAULL );
+    x = ( x & 0xCCCC3333CCCC3333ULL ) | ( ( x & 0x0000CCCC0000CCCCULL ) << 14 ) | ( ( x >> 14 ) & 0x0000CCCC0000CCCCULL );
+    x = ( x & 0xF0F0F0F00F0F0F0FULL ) | ( ( x & 0x00000000F0F0F0F0ULL ) << 28 ) | ( ( x >> 28 ) & 0x00000000F0F0F0F0ULL );
+    return x;
+}
+//------------------------------------------------------------------------------
+static
+void slice_pack(plane_t /*out*/ planes[8], const byte_t /*in*/ *bytes, size_t /*in*/ size)
+{
+    size_t g, i;
+
+    for(i=0; i<8; ++i)
+        planes[i] = 0;
+
+    for(g=0; g<8 && ( g << 3 ) < size; ++g)
+    {
+        uint64_t x = 0;
+
+        for(i=0; i<8 && ( g << 3 ) + i < size; ++i)
+            x |= (uint64_t) bytes[ ( g << 3 ) + i ] << ( i << 3 );
+
+        x = bits_transpose(x);
+        for(i=0; i<8; ++i)
+            planes[i] |= ( ( x >> ( i << 3 ) ) & 0xFF ) << ( g << 3 );
+    }
+}
+//------------------------------------------------------------------------------
+static
+void slice_unpack(byte_t /*out*/ *bytes, size_t /*in*/ size, const plane_t /*in*/ planes[8])
+{
+    size_t g, i;
+
+    for(g=0; g<8 && ( g << 3 ) < size; ++g)
+    {
+        uint64_t x = 0;
+
+        for(i=0; i<8; ++i)
+            x |= ( ( planes[i] >> ( g << 3 ) ) & 0xFF ) << ( i << 3 );
+
+        x = bits_transpose(x);
+        for(i=0; i<8 && ( g << 3 ) + i < size; ++i)
+            bytes[ ( g << 3 ) + i ] = x >> ( i << 3 );
+    }
+}
+//------------------------------------------------------------------------------
+static
+void slice_subbytes(plane_t /*inout*/ q[8])
+{
+    /*
+     * The S-box circuit of Boyar and Peralta (113 gates),
+     * which calculates the inversion in a tower field and merges the affine transformation.
+     */
+    plane_t x0, x1, x2, x3, x4, x5, x6, x7;
+    plane_t y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11;
+    plane_t y12, y13, y14, y15, y16, y17, y18, y19, y20, y21;
+    plane_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    plane_t z10, z11, z12, z13, z14, z15, z16, z17;
+    plane_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    plane_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    plane_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    plane_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    plane_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    plane_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    plane_t t60, t61, t62, t63, t64, t65, t66, t67;
+    plane_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+    x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+    // Top linear transformation
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9  = x0 ^ x3;
+    y8  = x0 ^ x5;
+    t0  = x1 ^ x2;
+    y1  = t0 ^ x7;
+    y4  = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2  = y1 ^ x0;
+    y5  = y1 ^ x6;
+    y3  = y5 ^ y8;
+    t1  = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6  = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7  = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    // Non-linear section
+    t2  = y12 & y15;
+    t3  = y3 & y6;
+    t4  = t3 ^ t2;
+    t5  = y4 & x7;
+    t6  = t5 ^ t2;
+    t7  = y13 & y16;
+    t8  = y5 & y1;
+    t9  = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0  = t44 & y15;
+    z1  = t37 & y6;
+    z2  = t33 & x7;
+    z3  = t43 & y16;
+    z4  = t40 & y1;
+    z5  = t29 & y7;
+    z6  = t42 & y11;
+    z7  = t45 & y17;
+    z8  = t41 & y10;
+    z9  = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    // Bottom linear transformation
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0  = t59 ^ t63;
+    s6  = t56 ^ ~t62;
+    s7  = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3  = t53 ^ t66;
+    s4  = t51 ^ t66;
+    s5  = t47 ^ t65;
+    s1  = t64 ^ ~s3;
+    s2  = t55 ^ ~t67;
+
+    q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+    q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+}
+//------------------------------------------------------------------------------
+static
+void slice_affine_inv(plane_t /*inout*/ x[8])
+{
+    // Inverse affine transformation with constant 0x05
+    plane_t y[8];
+    int     i;
+
+    for(i=0; i<8; ++i)
+        y[i] = x[(i+2)&7] ^ x[(i+5)&7] ^ x[(i+7)&7] ^ -(plane_t)( ( 0x05 >> i ) & 1 );
+
+    for(i=0; i<8; ++i)
+        x[i] = y[i];
+}
+//------------------------------------------------------------------------------
+static
+void slice_subbytes_inv(plane_t /*inout*/ x[8])
+{
+    /*
+     * The inverse S-box equals to L(S(L(x))),
+     * where L is the inverse affine transformation,
+     * because the S-box is the affine transformation of the inversion.
+     */
+    slice_affine_inv(x);
+    slice_subbytes  (x);
+    slice_affine_inv(x);
+}
+//------------------------------------------------------------------------------
+static
+void slice_xtime(plane_t /*out*/ res[8], const plane_t /*in*/ a[8])
+{
+    // Multiply by x (0x02), the carried out bit is reduced by 0x1B.
+    plane_t carry = a[7];
+
+    res[7] = a[6];
+    res[6] = a[5];
+    res[5] = a[4];
+    res[4] = a[3] ^ carry;
+    res[3] = a[2] ^ carry;
+    res[2] = a[1];
+    res[1] = a[0] ^ carry;
+    res[0] = carry;
+}
+//------------------------------------------------------------------------------
+INLINE
+plane_t slice_rotate_state(plane_t x, int n)
+{
+    // Rotate bytes toward the beginning of each state by n positions.
+    return ( ( x >> n ) & MASK_EACH( 0xFFFF >> n ) ) | ( ( x << ( 16 - n ) ) & ~MASK_EACH( 0xFFFF >> n ) );
+}
+//------------------------------------------------------------------------------
+INLINE
+plane_t slice_rotate_column(plane_t x, int n)
+{
+    // Rotate bytes toward the beginning of each column by n positions.
+    return ( ( x >> n ) & MASK_EACH( 0x1111 * ( 0xF >> n ) ) ) | ( ( x << ( 4 - n ) ) & ~MASK_EACH( 0x1111 * ( 0xF >> n ) ) );
+}
+//------------------------------------------------------------------------------
+static
+void slice_shiftrows(plane_t /*inout*/ x[8], bool /*in*/ inverse)
+{
+    /*
+     * Byte (row r, column c) comes from (row r, column c+r),
+     * that is the rotation of row r by 4*r bytes in each state.
+     */
+    int i, r;
+
+    for(i=0; i<8; ++i)
+    {
+        plane_t res = x[i] & MASK_EACH( 0x1111 );
+
+        for(r=1; r<4; ++r)
+            res |= slice_rotate_state(x[i] & MASK_EACH( 0x1111 << r ), inverse ? 16 - 4*r : 4*r);
+
+        x[i] = res;
+    }
+}
+//------------------------------------------------------------------------------
+static
+void slice_mixcolumns(plane_t /*inout*/ x[8])
+{
+    // Same as state_mixword: a + ( a + b + c + d ) + {02}( a + b ).
+    plane_t pair[8], all[8], xt[8];
+    int     i;
+
+    for(i=0; i<8; ++i)
+    {
+        pair[i] = x[i] ^ slice_rotate_column(x[i], 1);
+        all [i] = pair[i] ^ slice_rotate_column(pair[i], 2);
+    }
+
+    slice_xtime(xt, pair);
+
+    for(i=0; i<8; ++i)
+        x[i] ^= all[i] ^ xt[i];
+}
+//------------------------------------------------------------------------------
+static
+void slice_mixcolumns_inv(plane_t /*inout*/ x[8])
+{
+    // Same as state_mixword_inv: add {04}( a + c ) to a and c, and {04}( b + d ) to b and d first.
+    plane_t t[8], u[8];
+    int     i;
+
+    for(i=0; i<8; ++i)
+        t[i] = x[i] ^ slice_rotate_column(x[i], 2);
+
+    slice_xtime(u, t);
+    slice_xtime(t, u);
+
+    for(i=0; i<8; ++i)
+        x[i] ^= t[i];
+
+    slice_mixcolumns(x);
+}
+//------------------------------------------------------------------------------
+static
+void slice_add(plane_t /*inout*/ x[8], const plane_t /*in*/ key[8])
+{
+    int i;
+    for(i=0; i<8; ++i)
+        x[i] ^= key[i];
+}
+//------------------------------------------------------------------------------
+static
+void slice_keys(plane_t           /*out*/ keys[][8],
+                const aes_state_t /*in */ *rndkeys,
+                size_t            /*in */  rndkeys_cnt)
+{
+    // Slice round keys, each key is repeated for all states.
+    byte_t buf[SLICE_BYTES];
+    size_t i, j;
+
+    for(i=0; i<rndkeys_cnt; ++i)
+    {
+        for(j=0; j<SLICE_STATES; ++j)
+            memcpy(buf + j*sizeof(aes_state_t), &rndkeys[i], sizeof(aes_state_t));
+        slice_pack(keys[i], buf, sizeof(buf));
+    }
+
+    memset(buf, 0, sizeof(buf));
+}
+//------------------------------------------------------------------------------
+static
+void sbox_ct(byte_t /*inout*/ *bytes, size_t /*in*/ size)
+{
+    /*
+     * Substitute bytes with the S-box in constant time.
+     */
+    plane_t x[8];
+
+    assert( size <= SLICE_BYTES );
+
+    slice_pack(x, bytes, size);
+    slice_subbytes(x);
+    slice_unpack(bytes, size, x);
+}
+#endif  // AES_CONST_TIME
 //------------------------------------------------------------------------------
 //---- Key Expansion -----------------------------------------------------------
 //------------------------------------------------------------------------------
@@ -67,11 +446,15 @@ uint32_t key_rotword(uint32_t word)
 static
 uint32_t key_subword(uint32_t word)
 {
+#ifdef AES_CONST_TIME
+    sbox_ct((byte_t*)&word, sizeof(word));
+#else
     byte_t *arr  = (byte_t*)&word;
     size_t  i;
 
     for(i=0; i<4; ++i)
         arr[i] = aes_table_sbox[arr[i]];
+#endif
 
     return word;
 }
@@ -145,7 +528,7 @@ void state_add(aes_state_t /*inout*/ *state, const aes_state_t /*in*/ *target)
         state->word[i] ^= target->word[i];
 }
 //------------------------------------------------------------------------------
-static
+INLINE
 void state_subbytes(aes_state_t /*inout*/ *state, const byte_t table[256])
 {
     size_t i;
@@ -153,7 +536,7 @@ void state_subbytes(aes_state_t /*inout*/ *state, const byte_t table[256])
         state->byte[i] = table[ state->byte[i] ];
 }
 //------------------------------------------------------------------------------
-static
+INLINE
 void state_rearrange(aes_state_t /*inout*/ *state, const int table[16])
 {
     aes_state_t temp = *state;
@@ -163,7 +546,7 @@ void state_rearrange(aes_state_t /*inout*/ *state, const int table[16])
         state->byte[i] = temp.byte[ table[i] ];
 }
 //------------------------------------------------------------------------------
-static
+INLINE
 byte_t finite_add(byte_t a, byte_t b)
 {
     /*
@@ -172,7 +555,7 @@ byte_t finite_add(byte_t a, byte_t b)
     return a ^ b;
 }
 //------------------------------------------------------------------------------
-static
+INLINE
 byte_t finite_mul(byte_t a, byte_t b)
 {
     /*
@@ -196,7 +579,17 @@ byte_t finite_mul(byte_t a, byte_t b)
     return res;
 }
 //------------------------------------------------------------------------------
-static
+INLINE
+byte_t finite_xtime(byte_t a)
+{
+    /*
+     * Multiply a number by x (0x02) in the GF(2^8) finite field,
+     * without any branch depends on the data.
+     */
+    return ( a << 1 ) ^ ( 0x1B & -( a >> 7 ) );
+}
+//------------------------------------------------------------------------------
+INLINE
 uint32_t state_mixword(uint32_t word)
 {
     union exg
@@ -207,16 +600,18 @@ uint32_t state_mixword(uint32_t word)
 
     union exg src = { .value=word };
     union exg res;
+    byte_t    all = src.bytes[0] ^ src.bytes[1] ^ src.bytes[2] ^ src.bytes[3];
 
-    res.bytes[0] = finite_add( finite_add( finite_mul(0x02,src.bytes[0]), finite_mul(0x03,src.bytes[1]) ), finite_add(                 src.bytes[2] ,                 src.bytes[3]  ) );
-    res.bytes[1] = finite_add( finite_add(                 src.bytes[0] , finite_mul(0x02,src.bytes[1]) ), finite_add( finite_mul(0x03,src.bytes[2]),                 src.bytes[3]  ) );
-    res.bytes[2] = finite_add( finite_add(                 src.bytes[0] ,                 src.bytes[1]  ), finite_add( finite_mul(0x02,src.bytes[2]), finite_mul(0x03,src.bytes[3]) ) );
-    res.bytes[3] = finite_add( finite_add( finite_mul(0x03,src.bytes[0]),                 src.bytes[1]  ), finite_add(                 src.bytes[2] , finite_mul(0x02,src.bytes[3]) ) );
+    // {02}a + {03}b + c + d == a + ( b + c + d + a ) + {02}( a + b ), and so on.
+    res.bytes[0] = src.bytes[0] ^ all ^ finite_xtime( src.bytes[0] ^ src.bytes[1] );
+    res.bytes[1] = src.bytes[1] ^ all ^ finite_xtime( src.bytes[1] ^ src.bytes[2] );
+    res.bytes[2] = src.bytes[2] ^ all ^ finite_xtime( src.bytes[2] ^ src.bytes[3] );
+    res.bytes[3] = src.bytes[3] ^ all ^ finite_xtime( src.bytes[3] ^ src.bytes[0] );
 
     return res.value;
 }
 //------------------------------------------------------------------------------
-static
+INLINE
 uint32_t state_mixword_inv(uint32_t word)
 {
     union exg
@@ -226,17 +621,19 @@ uint32_t state_mixword_inv(uint32_t word)
     };
 
     union exg src = { .value=word };
-    union exg res;
+    byte_t    u   = finite_xtime( finite_xtime( src.bytes[0] ^ src.bytes[2] ) );
+    byte_t    v   = finite_xtime( finite_xtime( src.bytes[1] ^ src.bytes[3] ) );
 
-    res.bytes[0] = finite_add( finite_add( finite_mul(0x0E,src.bytes[0]), finite_mul(0x0B,src.bytes[1]) ), finite_add( finite_mul(0x0D,src.bytes[2]), finite_mul(0x09,src.bytes[3]) ) );
-    res.bytes[1] = finite_add( finite_add( finite_mul(0x09,src.bytes[0]), finite_mul(0x0E,src.bytes[1]) ), finite_add( finite_mul(0x0B,src.bytes[2]), finite_mul(0x0D,src.bytes[3]) ) );
-    res.bytes[2] = finite_add( finite_add( finite_mul(0x0D,src.bytes[0]), finite_mul(0x09,src.bytes[1]) ), finite_add( finite_mul(0x0E,src.bytes[2]), finite_mul(0x0B,src.bytes[3]) ) );
-    res.bytes[3] = finite_add( finite_add( finite_mul(0x0B,src.bytes[0]), finite_mul(0x0D,src.bytes[1]) ), finite_add( finite_mul(0x09,src.bytes[2]), finite_mul(0x0E,src.bytes[3]) ) );
+    // The inverse matrix equals to the forward matrix multiplied by {04}x^2 + {05}.
+    src.bytes[0] ^= u;
+    src.bytes[1] ^= v;
+    src.bytes[2] ^= u;
+    src.bytes[3] ^= v;
 
-    return res.value;
+    return state_mixword(src.value);
 }
 //------------------------------------------------------------------------------
-static
+INLINE
 void state_mixcolumn(aes_state_t /*inout*/ *state)
 {
     size_t i;
@@ -244,7 +641,7 @@ void state_mixcolumn(aes_state_t /*inout*/ *state)
         state->word[i] = state_mixword( state->word[i] );
 }
 //------------------------------------------------------------------------------
-static
+INLINE
 void state_mixcolumn_inv(aes_state_t /*inout*/ *state)
 {
     size_t i;
@@ -295,11 +692,334 @@ void aes_private_debug_test(void)
     res = memcmp(&block, &block_shift, sizeof(aes_state_t));   assert( res == 0 );
     state_mixcolumn(&block);
     res = memcmp(&block, &block_mixcol, sizeof(aes_state_t));  assert( res == 0 );
+
+#ifdef AES_CONST_TIME
+    // Constant time S-box
+    {
+        byte_t bytes[16];
+        int    i, j;
+
+        for(i=0; i<256; i+=16)
+        {
+            plane_t planes[8];
+
+            for(j=0; j<16; ++j) bytes[j] = i + j;
+            sbox_ct(bytes, sizeof(bytes));
+            for(j=0; j<16; ++j) assert( bytes[j] == aes_table_sbox[i+j] );
+
+            for(j=0; j<16; ++j) bytes[j] = i + j;
+            slice_pack(planes, bytes, sizeof(bytes));
+            slice_subbytes_inv(planes);
+            slice_unpack(bytes, sizeof(bytes), planes);
+            for(j=0; j<16; ++j) assert( bytes[j] == aes_table_sbox_inv[i+j] );
+        }
+    }
+#endif
 }
 #endif
 //------------------------------------------------------------------------------
 //---- Block Unit Cipher Routine -----------------------------------------------
 //------------------------------------------------------------------------------
+#ifndef AES_CONST_TIME
+/*
+ * Table driven rounds:
+ * SubBytes, ShiftRows and MixColumns of each column are combined into four table lookups.
+ * Columns are handled as little-endian words to match the tables.
+ */
+INLINE
+uint32_t load_word(const byte_t /*in*/ *src)
+{
+    return (uint32_t) src[0]         |
+           (uint32_t) src[1] <<  8   |
+           (uint32_t) src[2] << 16   |
+           (uint32_t) src[3] << 24;
+}
+//------------------------------------------------------------------------------
+INLINE
+void store_word(byte_t /*out*/ *dest, uint32_t /*in*/ word)
+{
+    dest[0] = word;
+    dest[1] = word >>  8;
+    dest[2] = word >> 16;
+    dest[3] = word >> 24;
+}
+//------------------------------------------------------------------------------
+#define TABLE_COLUMN(table, a, b, c, d, key)  \
+    ( table[0][ (a)         & 0xFF ] ^        \
+      table[1][ ( (b) >>  8 ) & 0xFF ] ^      \
+      table[2][ ( (c) >> 16 ) & 0xFF ] ^      \
+      table[3][   (d) >> 24          ] ^      \
+      load_word(key) )
+//------------------------------------------------------------------------------
+static
+void state_encipher(aes_state_t       /*inout*/ *state,
+                    const aes_state_t /*in   */ *rndkeys,
+                    size_t            /*in   */  rndkeys_cnt)
+{
+    size_t   Nr = rndkeys_cnt - 1;
+    uint32_t s0, s1, s2, s3;
+    uint32_t t0, t1, t2, t3;
+    size_t   i;
+
+    s0 = load_word(state->byte +  0) ^ load_word(rndkeys[0].byte +  0);
+    s1 = load_word(state->byte +  4) ^ load_word(rndkeys[0].byte +  4);
+    s2 = load_word(state->byte +  8) ^ load_word(rndkeys[0].byte +  8);
+    s3 = load_word(state->byte + 12) ^ load_word(rndkeys[0].byte + 12);
+
+    for(i=1; i<Nr; ++i)
+    {
+        t0 = TABLE_COLUMN(aes_table_te, s0, s1, s2, s3, rndkeys[i].byte +  0);
+        t1 = TABLE_COLUMN(aes_table_te, s1, s2, s3, s0, rndkeys[i].byte +  4);
+        t2 = TABLE_COLUMN(aes_table_te, s2, s3, s0, s1, rndkeys[i].byte +  8);
+        t3 = TABLE_COLUMN(aes_table_te, s3, s0, s1, s2, rndkeys[i].byte + 12);
+
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    // The last round has no MixColumns.
+    store_word(state->byte +  0, s0);
+    store_word(state->byte +  4, s1);
+    store_word(state->byte +  8, s2);
+    store_word(state->byte + 12, s3);
+    state_subbytes (state, aes_table_sbox);
+    state_rearrange(state, aes_table_shiftraw);
+    state_add      (state, &rndkeys[Nr]);
+}
+//------------------------------------------------------------------------------
+static
+void keys_prepare_decipher(aes_state_t       /*out*/ *deckeys,
+                           const aes_state_t /*in */ *rndkeys,
+                           size_t            /*in */  rndkeys_cnt)
+{
+    /*
+     * Round keys of the equivalent inverse cipher (FIPS-197, section 5.3.5),
+     * which have InvMixColumns applied except the first and the last one.
+     */
+    size_t i;
+
+    memcpy(deckeys, rndkeys, rndkeys_cnt*sizeof(aes_state_t));
+    for(i=1; i<rndkeys_cnt-1; ++i)
+        state_mixcolumn_inv(&deckeys[i]);
+}
+//------------------------------------------------------------------------------
+static
+void state_decipher_prepared(aes_state_t       /*inout*/ *state,
+                             const aes_state_t /*in   */ *deckeys,
+                             size_t            /*in   */  rndkeys_cnt)
+{
+    size_t   Nr = rndkeys_cnt - 1;
+    uint32_t s0, s1, s2, s3;
+    uint32_t t0, t1, t2, t3;
+    size_t   i;
+
+    s0 = load_word(state->byte +  0) ^ load_word(deckeys[Nr].byte +  0);
+    s1 = load_word(state->byte +  4) ^ load_word(deckeys[Nr].byte +  4);
+    s2 = load_word(state->byte +  8) ^ load_word(deckeys[Nr].byte +  8);
+    s3 = load_word(state->byte + 12) ^ load_word(deckeys[Nr].byte + 12);
+
+    for(i=Nr-1; i>0; --i)
+    {
+        t0 = TABLE_COLUMN(aes_table_td, s0, s3, s2, s1, deckeys[i].byte +  0);
+        t1 = TABLE_COLUMN(aes_table_td, s1, s0, s3, s2, deckeys[i].byte +  4);
+        t2 = TABLE_COLUMN(aes_table_td, s2, s1, s0, s3, deckeys[i].byte +  8);
+        t3 = TABLE_COLUMN(aes_table_td, s3, s2, s1, s0, deckeys[i].byte + 12);
+
+        s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+    }
+
+    // The last round has no InvMixColumns.
+    store_word(state->byte +  0, s0);
+    store_word(state->byte +  4, s1);
+    store_word(state->byte +  8, s2);
+    store_word(state->byte + 12, s3);
+    state_rearrange(state, aes_table_shiftraw_inv);
+    state_subbytes (state, aes_table_sbox_inv);
+    state_add      (state, &deckeys[0]);
+}
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void states_encipher(aes_state_t       /*inout*/ *states,
+                     size_t            /*in   */  count,
+                     const aes_state_t /*in   */ *rndkeys,
+                     size_t            /*in   */  rndkeys_cnt)
+{
+    size_t i;
+    for(i=0; i<count; ++i)
+        state_encipher(&states[i], rndkeys, rndkeys_cnt);
+}
+//------------------------------------------------------------------------------
+static
+void states_decipher_prepared(aes_state_t       /*inout*/ *states,
+                              size_t            /*in   */  count,
+                              const aes_state_t /*in   */ *deckeys,
+                              size_t            /*in   */  rndkeys_cnt)
+{
+    size_t i;
+    for(i=0; i<count; ++i)
+        state_decipher_prepared(&states[i], deckeys, rndkeys_cnt);
+}
+//------------------------------------------------------------------------------
+static
+void states_cbc_encipher(aes_state_t       /*inout*/ *states,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *iv,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt)
+{
+    size_t i;
+    for(i=0; i<count; ++i)
+    {
+        state_add(&states[i], i ? &states[i-1] : iv);
+        state_encipher(&states[i], rndkeys, rndkeys_cnt);
+    }
+}
+//------------------------------------------------------------------------------
+#else   // AES_CONST_TIME
+/*
+ * Constant time rounds, see "Bitsliced Routines".
+ */
+static
+void slice_encipher(plane_t       /*inout*/ x[8],
+                    const plane_t /*in   */ keys[][8],
+                    size_t        /*in   */ rndkeys_cnt)
+{
+    size_t Nr = rndkeys_cnt - 1;
+    size_t i;
+
+    slice_add(x, keys[0]);
+    for(i=1; i<Nr; ++i)
+    {
+        slice_subbytes  (x);
+        slice_shiftrows (x, false);
+        slice_mixcolumns(x);
+        slice_add       (x, keys[i]);
+    }
+    slice_subbytes (x);
+    slice_shiftrows(x, false);
+    slice_add      (x, keys[Nr]);
+}
+//------------------------------------------------------------------------------
+static
+void states_encipher(aes_state_t       /*inout*/ *states,
+                     size_t            /*in   */  count,
+                     const aes_state_t /*in   */ *rndkeys,
+                     size_t            /*in   */  rndkeys_cnt)
+{
+    plane_t keys[15][8];
+    plane_t x[8];
+    size_t  n;
+
+    slice_keys(keys, rndkeys, rndkeys_cnt);
+
+    for(; count; count -= n, states += n)
+    {
+        n = count < SLICE_STATES ? count : SLICE_STATES;
+        slice_pack(x, states->byte, n*sizeof(aes_state_t));
+        slice_encipher(x, keys, rndkeys_cnt);
+        slice_unpack(states->byte, n*sizeof(aes_state_t), x);
+    }
+
+    memset(keys, 0, sizeof(keys));
+    memset(x   , 0, sizeof(x));
+}
+//------------------------------------------------------------------------------
+static
+void states_cbc_encipher(aes_state_t       /*inout*/ *states,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *iv,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt)
+{
+    /*
+     * The chain is serial, so only one state is in the planes each time,
+     * but the round keys only need to be sliced once.
+     */
+    plane_t keys[15][8];
+    plane_t x[8];
+    size_t  i;
+
+    slice_keys(keys, rndkeys, rndkeys_cnt);
+
+    for(i=0; i<count; ++i)
+    {
+        state_add(&states[i], i ? &states[i-1] : iv);
+        slice_pack(x, states[i].byte, sizeof(aes_state_t));
+        slice_encipher(x, keys, rndkeys_cnt);
+        slice_unpack(states[i].byte, sizeof(aes_state_t), x);
+    }
+
+    memset(keys, 0, sizeof(keys));
+    memset(x   , 0, sizeof(x));
+}
+//------------------------------------------------------------------------------
+static
+void states_decipher_prepared(aes_state_t       /*inout*/ *states,
+                              size_t            /*in   */  count,
+                              const aes_state_t /*in   */ *deckeys,
+                              size_t            /*in   */  rndkeys_cnt)
+{
+    size_t  Nr = rndkeys_cnt - 1;
+    plane_t keys[15][8];
+    plane_t x[8];
+    size_t  n, i;
+
+    slice_keys(keys, deckeys, rndkeys_cnt);
+
+    for(; count; count -= n, states += n)
+    {
+        n = count < SLICE_STATES ? count : SLICE_STATES;
+        slice_pack(x, states->byte, n*sizeof(aes_state_t));
+
+        slice_add(x, keys[Nr]);
+        for(i=Nr-1; i>0; --i)
+        {
+            slice_shiftrows     (x, true);
+            slice_subbytes_inv  (x);
+            slice_add           (x, keys[i]);
+            slice_mixcolumns_inv(x);
+        }
+        slice_shiftrows   (x, true);
+        slice_subbytes_inv(x);
+        slice_add         (x, keys[0]);
+
+        slice_unpack(states->byte, n*sizeof(aes_state_t), x);
+    }
+
+    memset(keys, 0, sizeof(keys));
+    memset(x   , 0, sizeof(x));
+}
+//------------------------------------------------------------------------------
+static
+void keys_prepare_decipher(aes_state_t       /*out*/ *deckeys,
+                           const aes_state_t /*in */ *rndkeys,
+                           size_t            /*in */  rndkeys_cnt)
+{
+    // The straight inverse cipher uses the round keys as they are.
+    memcpy(deckeys, rndkeys, rndkeys_cnt*sizeof(aes_state_t));
+}
+//------------------------------------------------------------------------------
+static
+void state_encipher(aes_state_t       /*inout*/ *state,
+                    const aes_state_t /*in   */ *rndkeys,
+                    size_t            /*in   */  rndkeys_cnt)
+{
+    states_encipher(state, 1, rndkeys, rndkeys_cnt);
+}
+//------------------------------------------------------------------------------
+#endif  // AES_CONST_TIME
+static
+void state_decipher(aes_state_t       /*inout*/ *state,
+                    const aes_state_t /*in   */ *rndkeys,
+                    size_t            /*in   */  rndkeys_cnt)
+{
+    aes_state_t deckeys[15];
+
+    keys_prepare_decipher(deckeys, rndkeys, rndkeys_cnt);
+    states_decipher_prepared(state, 1, deckeys, rndkeys_cnt);
+    memset(deckeys, 0, sizeof(deckeys));
+}
+//------------------------------------------------------------------------------
 void aes_state_encipher(aes_state_t       /*inout*/ *state,
                         const aes_state_t /*in   */ *rndkeys,
                         size_t            /*in   */  rndkeys_cnt)
@@ -310,25 +1030,20 @@ void aes_state_encipher(aes_state_t       /*inout*/ *state,
      * @rndkeys     : 回合密鑰陣列，此資料可由 aes_key_expand 取得。
      * @rndkeys_cnt : 回合密鑰數量，此值輸入即為 aes_key_expand 的回傳值，此參數只能為 11, 13, 或 15。
      */
-    size_t Nr, i;
-
     assert( state && rndkeys );
     assert( rndkeys_cnt == 11 ||
             rndkeys_cnt == 13 ||
             rndkeys_cnt == 15 );
 
-    Nr = rndkeys_cnt - 1;
-    state_add(state, &rndkeys[0]);
-    for(i=1; i<Nr; ++i)
+#ifdef AES_NI_AVAILABLE
+    if( cpufeat_has(AES_NI_FEATURES) )
     {
-        state_subbytes (state, aes_table_sbox);
-        state_rearrange(state, aes_table_shiftraw);
-        state_mixcolumn(state);
-        state_add      (state, &rndkeys[i]);
+        aes_ni_encipher(state, 1, rndkeys, rndkeys_cnt);
+        return;
     }
-    state_subbytes (state, aes_table_sbox);
-    state_rearrange(state, aes_table_shiftraw);
-    state_add      (state, &rndkeys[i]);
+#endif
+
+    state_encipher(state, rndkeys, rndkeys_cnt);
 }
 //------------------------------------------------------------------------------
 void aes_state_decipher(aes_state_t       /*inout*/ *state,
@@ -341,25 +1056,20 @@ void aes_state_decipher(aes_state_t       /*inout*/ *state,
      * @rndkeys     : 回合密鑰陣列，此資料可由 aes_key_expand 取得。
      * @rndkeys_cnt : 回合密鑰數量，此值輸入即為 aes_key_expand 的回傳值，此參數只能為 11, 13, 或 15。
      */
-    size_t Nr, i;
-
     assert( state && rndkeys );
     assert( rndkeys_cnt == 11 ||
             rndkeys_cnt == 13 ||
             rndkeys_cnt == 15 );
 
-    Nr = rndkeys_cnt - 1;
-    state_add(state, &rndkeys[Nr]);
-    for(i=Nr-1; i>0; --i)
+#ifdef AES_NI_AVAILABLE
+    if( cpufeat_has(AES_NI_FEATURES) )
     {
-        state_rearrange    (state, aes_table_shiftraw_inv);
-        state_subbytes     (state, aes_table_sbox_inv);
-        state_add          (state, &rndkeys[i]);
-        state_mixcolumn_inv(state);
+        aes_ni_decipher(state, 1, rndkeys, rndkeys_cnt);
+        return;
     }
-    state_rearrange(state, aes_table_shiftraw_inv);
-    state_subbytes (state, aes_table_sbox_inv);
-    state_add      (state, &rndkeys[i]);
+#endif
+
+    state_decipher(state, rndkeys, rndkeys_cnt);
 }
 //------------------------------------------------------------------------------
 //---- Multi Block Cipher ------------------------------------------------------
@@ -376,6 +1086,84 @@ size_t get_decipher_buffer_size(size_t datasize)
     return datasize & ~0x0F;
 }
 //------------------------------------------------------------------------------
+static
+void blocks_encipher(aes_state_t       /*inout*/ *blocks,
+                     size_t            /*in   */  count,
+                     const aes_state_t /*in   */ *rndkeys,
+                     size_t            /*in   */  rndkeys_cnt)
+{
+#ifdef AES_NI_AVAILABLE
+    if( cpufeat_has(AES_NI_FEATURES) )
+    {
+        aes_ni_encipher(blocks, count, rndkeys, rndkeys_cnt);
+        return;
+    }
+#endif
+
+    states_encipher(blocks, count, rndkeys, rndkeys_cnt);
+}
+//------------------------------------------------------------------------------
+static
+void blocks_decipher(aes_state_t       /*inout*/ *blocks,
+                     size_t            /*in   */  count,
+                     const aes_state_t /*in   */ *rndkeys,
+                     size_t            /*in   */  rndkeys_cnt)
+{
+    aes_state_t deckeys[15];
+
+#ifdef AES_NI_AVAILABLE
+    if( cpufeat_has(AES_NI_FEATURES) )
+    {
+        aes_ni_decipher(blocks, count, rndkeys, rndkeys_cnt);
+        return;
+    }
+#endif
+
+    keys_prepare_decipher(deckeys, rndkeys, rndkeys_cnt);
+    states_decipher_prepared(blocks, count, deckeys, rndkeys_cnt);
+    memset(deckeys, 0, sizeof(deckeys));
+}
+//------------------------------------------------------------------------------
+void aes_states_encipher(aes_state_t       /*inout*/ *states,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt)
+{
+    /**
+     * 多區塊加密(各區塊獨立運算)
+     * @states      : 輸入欲加密的資料，並傳回加密後的資料。
+     * @count       : 區塊數量。
+     * @rndkeys     : 回合密鑰陣列，此資料可由 aes_key_expand 取得。
+     * @rndkeys_cnt : 回合密鑰數量，此值輸入即為 aes_key_expand 的回傳值，此參數只能為 11, 13, 或 15。
+     */
+    assert( ( states || !count ) && rndkeys );
+    assert( rndkeys_cnt == 11 ||
+            rndkeys_cnt == 13 ||
+            rndkeys_cnt == 15 );
+
+    blocks_encipher(states, count, rndkeys, rndkeys_cnt);
+}
+//------------------------------------------------------------------------------
+void aes_states_decipher(aes_state_t       /*inout*/ *states,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt)
+{
+    /**
+     * 多區塊解密(各區塊獨立運算)
+     * @states      : 輸入欲解密的資料，並傳回解密後的資料。
+     * @count       : 區塊數量。
+     * @rndkeys     : 回合密鑰陣列，此資料可由 aes_key_expand 取得。
+     * @rndkeys_cnt : 回合密鑰數量，此值輸入即為 aes_key_expand 的回傳值，此參數只能為 11, 13, 或 15。
+     */
+    assert( ( states || !count ) && rndkeys );
+    assert( rndkeys_cnt == 11 ||
+            rndkeys_cnt == 13 ||
+            rndkeys_cnt == 15 );
+
+    blocks_decipher(states, count, rndkeys, rndkeys_cnt);
+}
+//------------------------------------------------------------------------------
 size_t aes_ecb_encipher(void       /*out*//*opt*/ *out,
                         const void /*in*/         *in,
                         size_t     /*in*/          insz,
@@ -392,7 +1180,6 @@ size_t aes_ecb_encipher(void       /*out*//*opt*/ *out,
     aes_state_t  rndkeys[15*sizeof(aes_state_t)];
     size_t       rndkeys_cnt;
     size_t       outsz = get_encipher_buffer_size(insz);
-    size_t       off;
 
     if( !in    ) return 0;
     if( !out   ) return outsz;
@@ -405,8 +1192,7 @@ size_t aes_ecb_encipher(void       /*out*//*opt*/ *out,
     memcpy(out, in, insz);
     if( outsz != insz ) memset(out+insz, 0, outsz-insz);
     // Encipher blocks
-    for(off=0; off<outsz; off+=sizeof(aes_state_t))
-        aes_state_encipher((aes_state_t*)(out+off), rndkeys, rndkeys_cnt);
+    blocks_encipher(out, outsz/sizeof(aes_state_t), rndkeys, rndkeys_cnt);
     // Erase temporary data
     memset(rndkeys, 0, sizeof(rndkeys));
 
@@ -429,7 +1215,6 @@ size_t aes_ecb_decipher(void       /*out*//*opt*/ *out,
     aes_state_t rndkeys[15*sizeof(aes_state_t)];
     size_t      rndkeys_cnt;
     size_t      outsz = get_decipher_buffer_size(insz);
-    size_t      off;
 
     if( !in    ) return 0;
     if( !out   ) return outsz;
@@ -442,8 +1227,7 @@ size_t aes_ecb_decipher(void       /*out*//*opt*/ *out,
     memcpy(out, in, insz);
     if( outsz != insz ) memset(out+insz, 0, outsz-insz);
     // Decipher blocks
-    for(off=0; off<outsz; off+=sizeof(aes_state_t))
-        aes_state_decipher((aes_state_t*)(out+off), rndkeys, rndkeys_cnt);
+    blocks_decipher(out, outsz/sizeof(aes_state_t), rndkeys, rndkeys_cnt);
     // Erase temporary data
     memset(rndkeys, 0, sizeof(rndkeys));
 
@@ -512,7 +1296,6 @@ size_t aes_cbc_encipher(void       /*out*//*opt*/ *out,
     size_t       outsz   = get_encipher_buffer_size(insz);
     size_t       statcnt = outsz >> 4;
     aes_state_t *stat    = (aes_state_t*)out;
-    size_t       i;
 
     if( !in      ) return 0;
     if( !out     ) return outsz;
@@ -530,12 +1313,15 @@ size_t aes_cbc_encipher(void       /*out*//*opt*/ *out,
     memset(stat+statcnt-1, 0, sizeof(aes_state_t));
     memcpy(stat, in, insz);
     // Encipher blocks
-    state_add(&stat[0], &iv);
-    aes_state_encipher(&stat[0], rndkeys, rndkeys_cnt);
-    for(i=1; i<statcnt; ++i)
+#ifdef AES_NI_AVAILABLE
+    if( cpufeat_has(AES_NI_FEATURES) )
     {
-        state_add(&stat[i], &stat[i-1]);
-        aes_state_encipher(&stat[i], rndkeys, rndkeys_cnt);
+        aes_ni_cbc_encipher(stat, statcnt, &iv, rndkeys, rndkeys_cnt);
+    }
+    else
+#endif
+    {
+        states_cbc_encipher(stat, statcnt, &iv, rndkeys, rndkeys_cnt);
     }
     // Erase temporary data
     memset(rndkeys, 0, sizeof(rndkeys));
@@ -571,20 +1357,32 @@ size_t aes_cbc_decipher(void       /*out*//*opt*/ *out,
     // Calculate round keys
     rndkeys_cnt = aes_key_expand(rndkeys, key, keysz);
     if( !rndkeys_cnt ) return 0;
-    // Copy data to the buffer
-    datbak = malloc(outsz);
-    if( !datbak )
+    // Decipher blocks
+#ifdef AES_NI_AVAILABLE
+    if( cpufeat_has(AES_NI_FEATURES) )
     {
-        memset(rndkeys, 0, sizeof(rndkeys));
-        return 0;
+        // The hardware routine works in place and keeps the previous cipher blocks itself,
+        // so no backup buffer is needed.
+        memmove(stat, in, outsz);
+        aes_ni_cbc_decipher(stat, statcnt, rndkeys, rndkeys_cnt);
+    }
+    else
+#endif
+    {
+        // Copy data to the buffer
+        datbak = malloc(outsz);
+        if( !datbak )
+        {
+            memset(rndkeys, 0, sizeof(rndkeys));
+            return 0;
+        }
+        memcpy(datbak, in, outsz);
+        memcpy(stat  , in, outsz);
+        // Decipher blocks
+        blocks_decipher(stat, statcnt, rndkeys, rndkeys_cnt);
+        for(i=1; i<statcnt; ++i)  // Decipher blocks except the first block
+            state_add(&stat[i], &datbak[i-1]);
     }
-    memcpy(datbak, in, outsz);
-    memcpy(stat  , in, outsz);
-    // Decipher blocks
-    for(i=0; i<statcnt; ++i)
-        aes_state_decipher(&stat[i], rndkeys, rndkeys_cnt);
-    for(i=1; i<statcnt; ++i)  // Decipher blocks except the first block
-        state_add(&stat[i], &datbak[i-1]);
     // Select IV
     if( _iv )
         memcpy(&iv, _iv, sizeof(iv));
@@ -595,8 +1393,11 @@ size_t aes_cbc_decipher(void       /*out*//*opt*/ *out,
     // Erase temporary data and release buffer
     memset(rndkeys, 0, sizeof(rndkeys));
     memset(&iv    , 0, sizeof(iv));
-    memset(datbak , 0, statcnt*sizeof(aes_state_t));
-    free(datbak);
+    if( datbak )
+    {
+        memset(datbak, 0, statcnt*sizeof(aes_state_t));
+        free(datbak);
+    }
 
     return outsz;
 }
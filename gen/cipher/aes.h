@@ -11,6 +11,14 @@
 
 #include "../type.h"
 
+/*
+ * The portable block functions use T-tables by default.
+ * Define AES_CONST_TIME when building aes.c to use the bitsliced implementation instead,
+ * which has no table lookup depending on the data or the keys, but is slower.
+ * The AES-NI path is used in both cases if the processor supports it.
+ * The "ConstTime" target of cipher_test builds and tests this configuration.
+ */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -42,6 +50,15 @@ void aes_state_decipher(aes_state_t       /*inout*/ *state,
                         const aes_state_t /*in   */ *rndkeys,
                         size_t            /*in   */  rndkeys_cnt);
 
+void aes_states_encipher(aes_state_t       /*inout*/ *states,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt);
+void aes_states_decipher(aes_state_t       /*inout*/ *states,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt);
+
 /**
  * AES 任意長度資料加解密參數共同說明
  *
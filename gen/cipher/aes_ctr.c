@@ -0,0 +1,778 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "../cpufeat.h"
+#include "../endian.h"
+#include "../inline.h"
+#include "aes_ni.h"
+#include "ghash_ni.h"
+#include "aes_ctr.h"
+
+#define BLOCK_SIZE   sizeof(aes_state_t)
+#define STREAM_SIZE  64                 // Number of key stream blocks generated at once.
+#define SEGMENT_SIZE ( 64 * 1024 )      // Size of data processed by a thread each time.
+#define THREADS_MAX  64
+
+//------------------------------------------------------------------------------
+//---- Private Routines --------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void bytes_xor(byte_t *out, const byte_t *in, const byte_t *stream, size_t size)
+{
+    for(; size >= 8; size -= 8, out += 8, in += 8, stream += 8)
+    {
+        uint64_t a, b;
+        memcpy(&a, in    , 8);
+        memcpy(&b, stream, 8);
+        a ^= b;
+        memcpy(out, &a, 8);
+    }
+
+    for(; size; --size)
+        *out++ = *in++ ^ *stream++;
+}
+//------------------------------------------------------------------------------
+INLINE
+uint64_t load_be64(const byte_t *src)
+{
+    uint64_t val;
+    memcpy(&val, src, sizeof(val));
+    return endian_be_to_local_64(val);
+}
+//------------------------------------------------------------------------------
+INLINE
+void store_be64(byte_t *dest, uint64_t val)
+{
+    val = endian_local_to_be_64(val);
+    memcpy(dest, &val, sizeof(val));
+}
+//------------------------------------------------------------------------------
+static
+void counter_add(aes_state_t *counter, const aes_state_t *initial, uint64_t index, bool inc32)
+{
+    /*
+     * Calculate the counter block of the specified block index,
+     * the counter is a 128 bits big-endian integer,
+     * or only the lowest 32 bits of it when inc32 is set.
+     */
+    uint64_t hi = load_be64(initial->byte);
+    uint64_t lo = load_be64(initial->byte + 8);
+
+    if( inc32 )
+    {
+        lo = ( lo & 0xFFFFFFFF00000000ULL ) | (uint32_t)( lo + index );
+    }
+    else
+    {
+        uint64_t sum = lo + index;
+        hi += sum < lo;
+        lo  = sum;
+    }
+
+    store_be64(counter->byte    , hi);
+    store_be64(counter->byte + 8, lo);
+}
+//------------------------------------------------------------------------------
+static
+void ctr_xor(const aes_ctr_t *ctx, uint64_t offset, byte_t *out, const byte_t *in, size_t size)
+{
+    /*
+     * Combine data with the key stream started from the specified position.
+     */
+    aes_state_t stream[STREAM_SIZE];
+    uint64_t    index = offset / BLOCK_SIZE;
+    size_t      skip  = offset % BLOCK_SIZE;
+
+#ifdef AES_NI_AVAILABLE
+    if( !skip && cpufeat_has(AES_NI_FEATURES | CPUFEAT_SSSE3) )
+    {
+        size_t count = size / BLOCK_SIZE;
+        aes_ni_ctr_xor(out, in, count, &ctx->counter, index, ctx->inc32, ctx->rndkeys, ctx->rndkeys_cnt);
+
+        out   += count * BLOCK_SIZE;
+        in    += count * BLOCK_SIZE;
+        size  -= count * BLOCK_SIZE;
+        index += count;
+    }
+#endif
+
+    while( size )
+    {
+        size_t count = ( skip + size + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+        if( count > STREAM_SIZE ) count = STREAM_SIZE;
+
+        for(size_t i=0; i<count; ++i)
+            counter_add(&stream[i], &ctx->counter, index + i, ctx->inc32);
+        aes_states_encipher(stream, count, ctx->rndkeys, ctx->rndkeys_cnt);
+
+        size_t len = count * BLOCK_SIZE - skip;
+        if( len > size ) len = size;
+        bytes_xor(out, in, stream[0].byte + skip, len);
+
+        out   += len;
+        in    += len;
+        size  -= len;
+        index += count;
+        skip   = 0;
+    }
+
+    memset(stream, 0, sizeof(stream));
+}
+//------------------------------------------------------------------------------
+//---- GHASH -------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void gf_mul(aes_state_t *x, const aes_state_t *y)
+{
+    /*
+     * Multiply two elements of GF(2^128) bit by bit,
+     * used for the key powers which are calculated occasionally.
+     */
+    uint64_t xh = load_be64(x->byte), xl = load_be64(x->byte + 8);
+    uint64_t vh = load_be64(y->byte), vl = load_be64(y->byte + 8);
+    uint64_t zh = 0, zl = 0;
+
+    for(int i=0; i<128; ++i)
+    {
+        uint64_t bit  = ( i < 64 ? xh >> ( 63 - i ) : xl >> ( 127 - i ) ) & 1;
+        uint64_t mask = -bit;
+        zh ^= vh & mask;
+        zl ^= vl & mask;
+
+        uint64_t carry = -( vl & 1 );
+        vl = ( vl >> 1 ) | ( vh << 63 );
+        vh = ( vh >> 1 ) ^ ( carry & 0xE100000000000000ULL );
+    }
+
+    store_be64(x->byte    , zh);
+    store_be64(x->byte + 8, zl);
+}
+//------------------------------------------------------------------------------
+static
+void gf_pow(aes_state_t *result, const aes_state_t *base, uint64_t exp)
+{
+    aes_state_t power = *base;
+
+    memset(result, 0, sizeof(*result));
+    result->byte[0] = 0x80;     // The identity element.
+
+    for(; exp; exp >>= 1)
+    {
+        if( exp & 1 ) gf_mul(result, &power);
+        gf_mul(&power, &power);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void ghash_make_table(aes_gcm_t *ctx)
+{
+    /*
+     * The table has the products of the hash key and all 4 bits values,
+     * index bits are in the reflected order as GCM defined.
+     */
+    uint64_t vh = load_be64(ctx->hkey.byte);
+    uint64_t vl = load_be64(ctx->hkey.byte + 8);
+
+    ctx->table_hi[0] = ctx->table_lo[0] = 0;
+    ctx->table_hi[8] = vh;
+    ctx->table_lo[8] = vl;
+
+    for(int i=4; i; i >>= 1)
+    {
+        uint64_t carry = -( vl & 1 );
+        vl = ( vl >> 1 ) | ( vh << 63 );
+        vh = ( vh >> 1 ) ^ ( carry & 0xE100000000000000ULL );
+        ctx->table_hi[i] = vh;
+        ctx->table_lo[i] = vl;
+    }
+
+    for(int i=2; i<=8; i *= 2)
+    for(int j=1; j<i; ++j)
+    {
+        ctx->table_hi[i+j] = ctx->table_hi[i] ^ ctx->table_hi[j];
+        ctx->table_lo[i+j] = ctx->table_lo[i] ^ ctx->table_lo[j];
+    }
+}
+//------------------------------------------------------------------------------
+static
+void ghash_mul_table(const aes_gcm_t *ctx, aes_state_t *x)
+{
+    // Multiply the value with the hash key, four bits each time.
+    static const uint64_t reduce4[16] =
+    {
+        0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+        0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+    };
+
+    unsigned idx = x->byte[15] & 0x0F;
+    uint64_t zh  = ctx->table_hi[idx];
+    uint64_t zl  = ctx->table_lo[idx];
+
+    for(int i=15; i>=0; --i)
+    {
+        unsigned rem;
+
+        if( i != 15 )
+        {
+            idx = x->byte[i] & 0x0F;
+            rem = zl & 0x0F;
+            zl  = ( zh << 60 ) | ( zl >> 4 );
+            zh  = ( zh >> 4 ) ^ ( reduce4[rem] << 48 );
+            zh ^= ctx->table_hi[idx];
+            zl ^= ctx->table_lo[idx];
+        }
+
+        idx = x->byte[i] >> 4;
+        rem = zl & 0x0F;
+        zl  = ( zh << 60 ) | ( zl >> 4 );
+        zh  = ( zh >> 4 ) ^ ( reduce4[rem] << 48 );
+        zh ^= ctx->table_hi[idx];
+        zl ^= ctx->table_lo[idx];
+    }
+
+    store_be64(x->byte    , zh);
+    store_be64(x->byte + 8, zl);
+}
+//------------------------------------------------------------------------------
+static
+void ghash_blocks(const aes_gcm_t *ctx, aes_state_t *hash, const byte_t *data, size_t count)
+{
+#ifdef GHASH_NI_AVAILABLE
+    if( cpufeat_has(GHASH_NI_FEATURES) )
+    {
+        ghash_ni_update(hash, &ctx->hkey, data, count);
+        return;
+    }
+#endif
+
+    for(; count; --count, data += BLOCK_SIZE)
+    {
+        bytes_xor(hash->byte, hash->byte, data, BLOCK_SIZE);
+        ghash_mul_table(ctx, hash);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void ghash_padded(const aes_gcm_t *ctx, aes_state_t *hash, const byte_t *data, size_t size)
+{
+    // Hash data, and the last incomplete block be padded with zeros.
+    size_t count = size / BLOCK_SIZE;
+    ghash_blocks(ctx, hash, data, count);
+
+    if( size %= BLOCK_SIZE )
+    {
+        aes_state_t last = {{{0}}};
+        memcpy(&last, data + count * BLOCK_SIZE, size);
+        ghash_blocks(ctx, hash, last.byte, 1);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void ghash_stream(aes_gcm_t *ctx, const byte_t *data, size_t size)
+{
+    // Hash data in streaming, the incomplete block will be kept for the next time.
+    if( !size ) return;
+
+    if( ctx->restsz )
+    {
+        size_t fill = BLOCK_SIZE - ctx->restsz;
+        if( fill > size ) fill = size;
+
+        memcpy(ctx->rest.byte + ctx->restsz, data, fill);
+        ctx->restsz += fill;
+        data        += fill;
+        size        -= fill;
+
+        if( ctx->restsz < BLOCK_SIZE ) return;
+
+        ghash_blocks(ctx, &ctx->hash, ctx->rest.byte, 1);
+        ctx->restsz = 0;
+    }
+
+    size_t count = size / BLOCK_SIZE;
+    ghash_blocks(ctx, &ctx->hash, data, count);
+
+    ctx->restsz = size % BLOCK_SIZE;
+    memcpy(&ctx->rest, data + count * BLOCK_SIZE, ctx->restsz);
+}
+//------------------------------------------------------------------------------
+static
+void ghash_flush(aes_gcm_t *ctx)
+{
+    // Hash the incomplete block with zero padding.
+    if( !ctx->restsz ) return;
+
+    memset(ctx->rest.byte + ctx->restsz, 0, BLOCK_SIZE - ctx->restsz);
+    ghash_blocks(ctx, &ctx->hash, ctx->rest.byte, 1);
+    ctx->restsz = 0;
+}
+//------------------------------------------------------------------------------
+//---- Parallel Jobs -----------------------------------------------------------
+//------------------------------------------------------------------------------
+typedef struct job_t
+{
+    const aes_ctr_t *ctr;
+    const aes_gcm_t *gcm;       // NULL if there is no authentication.
+    byte_t          *out;
+    const byte_t    *in;
+    size_t           size;
+    size_t           count;     // Number of segments.
+    aes_state_t     *hashes;    // GHASH value of each segment.
+    atomic_size_t    next;      // Index of the next segment to be processed.
+} job_t;
+
+//------------------------------------------------------------------------------
+static
+void job_process(job_t *job)
+{
+    size_t index;
+    while( ( index = atomic_fetch_add(&job->next, 1) ) < job->count )
+    {
+        size_t        offset = index * SEGMENT_SIZE;
+        size_t        remain = job->size - offset;
+        size_t        size   = remain < SEGMENT_SIZE ? remain : SEGMENT_SIZE;
+        byte_t       *out    = job->out + offset;
+        const byte_t *in     = job->in  + offset;
+
+        if( !job->gcm )
+        {
+            ctr_xor(job->ctr, offset, out, in, size);
+            continue;
+        }
+
+        // Each segment is hashed from ZERO, and they will be combined later.
+        aes_state_t *hash = &job->hashes[index];
+        memset(hash, 0, sizeof(*hash));
+
+        if( job->gcm->encipher )
+        {
+            ctr_xor(job->ctr, offset, out, in, size);
+            ghash_padded(job->gcm, hash, out, size);
+        }
+        else
+        {
+            ghash_padded(job->gcm, hash, in, size);
+            ctr_xor(job->ctr, offset, out, in, size);
+        }
+    }
+}
+//------------------------------------------------------------------------------
+static
+int job_worker(job_t *job)
+{
+    job_process(job);
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+bool job_run(const aes_ctr_t *ctr, aes_gcm_t *gcm, byte_t *out, const byte_t *in, size_t size, unsigned threads)
+{
+    /*
+     * Process data from the beginning of the key stream by multiple threads,
+     * and return FALSE if it is not worth or not able to do that,
+     * so that the caller can process data serially.
+     */
+    if( !threads ) threads = cpufeat_get_cpu_count();
+    if( threads > THREADS_MAX ) threads = THREADS_MAX;
+
+    size_t count = ( size + SEGMENT_SIZE - 1 ) / SEGMENT_SIZE;
+    if( threads > count ) threads = count;
+    if( threads < 2 ) return false;
+
+    job_t job =
+    {
+        .ctr    = ctr,
+        .gcm    = gcm,
+        .out    = out,
+        .in     = in,
+        .size   = size,
+        .count  = count,
+        .hashes = gcm ? malloc(count * sizeof(aes_state_t)) : NULL,
+    };
+    if( gcm && !job.hashes ) return false;
+
+    atomic_init(&job.next, 0);
+
+    thrd_t   workers[THREADS_MAX];
+    unsigned started = 0;
+    for(unsigned i=1; i<threads; ++i)
+    {
+        if( thrd_success != thrd_create(&workers[started], (thrd_start_t) job_worker, &job) ) break;
+        ++started;
+    }
+
+    // The caller thread works too, and will finish all segments alone if no worker be started.
+    job_process(&job);
+
+    for(unsigned i=0; i<started; ++i)
+        thrd_join(workers[i], NULL);
+
+    if( gcm )
+    {
+        /*
+         * Combine the segment hashes by Horner's rule:
+         * the hash before a segment be multiplied with the key power of the segment blocks count,
+         * and then plus the segment hash.
+         */
+        aes_state_t hpow_full, hpow;
+        size_t      lastcnt = ( size - ( count - 1 ) * SEGMENT_SIZE + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+
+        ghash_flush(gcm);
+        gf_pow(&hpow_full, &gcm->hkey, SEGMENT_SIZE / BLOCK_SIZE);
+        for(size_t i=0; i<count; ++i)
+        {
+            if( i + 1 < count )
+                hpow = hpow_full;
+            else
+                gf_pow(&hpow, &gcm->hkey, lastcnt);
+
+            gf_mul(&gcm->hash, &hpow);
+            bytes_xor(gcm->hash.byte, gcm->hash.byte, job.hashes[i].byte, BLOCK_SIZE);
+        }
+        gcm->datasz += size;
+
+        free(job.hashes);
+    }
+
+    return true;
+}
+//------------------------------------------------------------------------------
+//---- CTR Mode ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+bool aes_ctr_init(aes_ctr_t  /*out*/ *ctx,
+                  const void /*in*/  *key,
+                  size_t     /*in*/   keysz,
+                  const void /*in*/  *counter)
+{
+    /**
+     * 初始化 CTR 模式運算物件
+     * 請參閱："AES 計數器模式共同說明"
+     * @ctx     : 運算物件。
+     * @counter : 初始計數器區塊(16 bytes)，每個區塊將其視為 128 位元大端序整數遞增。
+     * @return  : 成功時傳回 TRUE；密鑰長度不正確時傳回 FALSE。
+     */
+    assert( ctx && key && counter );
+
+    ctx->rndkeys_cnt = aes_key_expand(ctx->rndkeys, key, keysz);
+    if( !ctx->rndkeys_cnt ) return false;
+
+    memcpy(&ctx->counter, counter, sizeof(ctx->counter));
+    ctx->offset = 0;
+    ctx->inc32  = false;
+
+    return true;
+}
+//------------------------------------------------------------------------------
+void aes_ctr_seek(aes_ctr_t /*inout*/  *ctx,
+                  uint64_t  /*in*/      offset)
+{
+    /**
+     * 移動密鑰流的位置
+     * @ctx    : 運算物件。
+     * @offset : 資料的位置(以 byte 計算，從資料起始處開始)。
+     */
+    assert( ctx );
+    ctx->offset = offset;
+}
+//------------------------------------------------------------------------------
+void aes_ctr_update(aes_ctr_t  /*inout*/  *ctx,
+                    void       /*out*/    *out,
+                    const void /*in*/     *in,
+                    size_t     /*in*/      size)
+{
+    /**
+     * 加密或解密一段資料，並接續在前次運算的位置之後
+     * @ctx  : 運算物件。
+     * @out  : 輸出緩衝區，大小與輸入相同，也可以與 in 為同一個緩衝區。
+     * @in   : 輸入資料。
+     * @size : 資料大小，可以是任意長度。
+     */
+    assert( ctx && ( ( out && in ) || !size ) );
+
+    ctr_xor(ctx, ctx->offset, out, in, size);
+    ctx->offset += size;
+}
+//------------------------------------------------------------------------------
+void aes_ctr_final(aes_ctr_t /*inout*/  *ctx)
+{
+    /**
+     * 結束運算並清除運算物件中的密鑰資料
+     */
+    assert( ctx );
+    memset(ctx, 0, sizeof(*ctx));
+}
+//------------------------------------------------------------------------------
+bool aes_ctr_crypt(void       /*out*/ *out,
+                   const void /*in*/  *in,
+                   size_t     /*in*/   size,
+                   const void /*in*/  *key,
+                   size_t     /*in*/   keysz,
+                   const void /*in*/  *counter,
+                   unsigned   /*in*/   threads)
+{
+    /**
+     * 一次性加密或解密一段任意長度的資料(CTR 模式)
+     * 請參閱："AES 計數器模式共同說明"
+     * @out     : 輸出緩衝區，大小與輸入相同，也可以與 in 為同一個緩衝區。
+     * @in      : 輸入資料。
+     * @size    : 資料大小。
+     * @counter : 初始計數器區塊(16 bytes)。
+     * @return  : 成功時傳回 TRUE；密鑰長度不正確時傳回 FALSE。
+     */
+    aes_ctr_t ctx;
+
+    if( !aes_ctr_init(&ctx, key, keysz, counter) ) return false;
+
+    if( !job_run(&ctx, NULL, out, in, size, threads) )
+        aes_ctr_update(&ctx, out, in, size);
+
+    aes_ctr_final(&ctx);
+    return true;
+}
+//------------------------------------------------------------------------------
+//---- GCM Mode ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+bool aes_gcm_init(aes_gcm_t  /*out*/ *ctx,
+                  const void /*in*/  *key,
+                  size_t     /*in*/   keysz,
+                  const void /*in*/  *iv,
+                  size_t     /*in*/   ivsz,
+                  bool       /*in*/   encipher)
+{
+    /**
+     * 初始化 GCM 模式運算物件
+     * 請參閱："AES 計數器模式共同說明"
+     * @ctx      : 運算物件。
+     * @iv       : 初始化向量，建議使用 12 bytes 的長度。
+     * @ivsz     : 初始化向量長度，不可為零。
+     * @encipher : 加密時輸入 TRUE，解密時輸入 FALSE。
+     * @return   : 成功時傳回 TRUE；密鑰或初始化向量長度不正確時傳回 FALSE。
+     */
+    static const aes_state_t zero = {{{0}}};
+    aes_state_t j0;
+
+    assert( ctx && key && ( iv || !ivsz ) );
+    if( !ivsz ) return false;
+
+    memset(ctx, 0, sizeof(*ctx));
+    if( !aes_ctr_init(&ctx->ctr, key, keysz, &zero) ) return false;
+    ctx->ctr.inc32 = true;
+    ctx->encipher  = encipher;
+
+    // The hash key
+    aes_states_encipher(&ctx->hkey, 1, ctx->ctr.rndkeys, ctx->ctr.rndkeys_cnt);
+    ghash_make_table(ctx);
+
+    // The initial counter block
+    if( ivsz == 12 )
+    {
+        memcpy(&j0, iv, 12);
+        memcpy(j0.byte + 12, "\x00\x00\x00\x01", 4);
+    }
+    else
+    {
+        aes_state_t lenblk = {{{0}}};
+        store_be64(lenblk.byte + 8, (uint64_t) ivsz * 8);
+
+        memset(&j0, 0, sizeof(j0));
+        ghash_padded(ctx, &j0, iv, ivsz);
+        ghash_blocks(ctx, &j0, lenblk.byte, 1);
+    }
+
+    ctx->tagmask = j0;
+    aes_states_encipher(&ctx->tagmask, 1, ctx->ctr.rndkeys, ctx->ctr.rndkeys_cnt);
+
+    // Data is ciphered from the next counter of the initial counter block.
+    counter_add(&ctx->ctr.counter, &j0, 1, true);
+    memset(&j0, 0, sizeof(j0));
+
+    return true;
+}
+//------------------------------------------------------------------------------
+void aes_gcm_update_aad(aes_gcm_t  /*inout*/  *ctx,
+                        const void /*in*/     *aad,
+                        size_t     /*in*/      size)
+{
+    /**
+     * 輸入附加的驗證資料(不加密但受驗證保護的資料)
+     * @ctx  : 運算物件。
+     * @aad  : 附加資料。
+     * @size : 附加資料大小。
+     * Note :
+     *     附加資料可以分次輸入，但全部都必須在 aes_gcm_update 之前輸入。
+     */
+    assert( ctx && ( aad || !size ) );
+    assert( !ctx->datasz );
+
+    ghash_stream(ctx, aad, size);
+    ctx->aadsz += size;
+}
+//------------------------------------------------------------------------------
+void aes_gcm_update(aes_gcm_t  /*inout*/  *ctx,
+                    void       /*out*/    *out,
+                    const void /*in*/     *in,
+                    size_t     /*in*/      size)
+{
+    /**
+     * 加密或解密一段資料，並接續在前次運算的資料之後
+     * @ctx  : 運算物件。
+     * @out  : 輸出緩衝區，大小與輸入相同，也可以與 in 為同一個緩衝區。
+     * @in   : 輸入資料。
+     * @size : 資料大小，可以是任意長度。
+     */
+    assert( ctx && ( ( out && in ) || !size ) );
+
+    if( !ctx->datasz ) ghash_flush(ctx);    // End of the additional data.
+
+    if( ctx->encipher )
+    {
+        aes_ctr_update(&ctx->ctr, out, in, size);
+        ghash_stream(ctx, out, size);
+    }
+    else
+    {
+        ghash_stream(ctx, in, size);
+        aes_ctr_update(&ctx->ctr, out, in, size);
+    }
+
+    ctx->datasz += size;
+}
+//------------------------------------------------------------------------------
+void aes_gcm_final(aes_gcm_t /*inout*/  *ctx,
+                   void      /*out*/    *tag)
+{
+    /**
+     * 結束運算，計算驗證標籤，並清除運算物件中的密鑰資料
+     * @ctx : 運算物件。
+     * @tag : 用來接收驗證標籤的緩衝區，大小為 AES_GCM_TAG_SIZE。
+     */
+    aes_state_t lenblk;
+
+    assert( ctx && tag );
+
+    ghash_flush(ctx);
+    store_be64(lenblk.byte    , ctx->aadsz  * 8);
+    store_be64(lenblk.byte + 8, ctx->datasz * 8);
+    ghash_blocks(ctx, &ctx->hash, lenblk.byte, 1);
+
+    bytes_xor(tag, ctx->hash.byte, ctx->tagmask.byte, AES_GCM_TAG_SIZE);
+
+    memset(ctx, 0, sizeof(*ctx));
+}
+//------------------------------------------------------------------------------
+bool aes_gcm_final_verify(aes_gcm_t  /*inout*/  *ctx,
+                          const void /*in*/     *tag,
+                          size_t     /*in*/      tagsz)
+{
+    /**
+     * 結束運算，並比對驗證標籤
+     * @ctx    : 運算物件。
+     * @tag    : 欲比對的驗證標籤。
+     * @tagsz  : 驗證標籤的長度，可以是截短的標籤，但不可小於 4 也不可大於 AES_GCM_TAG_SIZE。
+     * @return : 驗證標籤相符時傳回 TRUE；否則傳回 FALSE。
+     * Note :
+     *     解密時必須在驗證成功後，才可以使用解密後的資料。
+     */
+    byte_t   expect[AES_GCM_TAG_SIZE];
+    unsigned diff = 0;
+
+    assert( ctx && tag );
+
+    aes_gcm_final(ctx, expect);
+    if( tagsz < 4 || tagsz > AES_GCM_TAG_SIZE ) return false;
+
+    // Compare in constant time.
+    for(size_t i=0; i<tagsz; ++i)
+        diff |= expect[i] ^ ((const byte_t*)tag)[i];
+
+    memset(expect, 0, sizeof(expect));
+
+    return !diff;
+}
+//------------------------------------------------------------------------------
+bool aes_gcm_encipher(void       /*out*/         *out,
+                      void       /*out*/         *tag,
+                      const void /*in*/          *in,
+                      size_t     /*in*/           insz,
+                      const void /*in*//*opt*/   *aad,
+                      size_t     /*in*/           aadsz,
+                      const void /*in*/          *key,
+                      size_t     /*in*/           keysz,
+                      const void /*in*/          *iv,
+                      size_t     /*in*/           ivsz,
+                      unsigned   /*in*/           threads)
+{
+    /**
+     * 一次性加密一段任意長度的資料，並產生驗證標籤(GCM 模式)
+     * 請參閱："AES 計數器模式共同說明"
+     * @out    : 輸出緩衝區，大小與輸入相同，也可以與 in 為同一個緩衝區。
+     * @tag    : 用來接收驗證標籤的緩衝區，大小為 AES_GCM_TAG_SIZE。
+     * @in     : 輸入資料。
+     * @insz   : 資料大小。
+     * @aad    : 附加的驗證資料，不需要時可以輸入 NULL。
+     * @aadsz  : 附加資料大小。
+     * @iv     : 初始化向量，建議使用 12 bytes 的長度。
+     * @ivsz   : 初始化向量長度。
+     * @return : 成功時傳回 TRUE；密鑰或初始化向量長度不正確時傳回 FALSE。
+     */
+    aes_gcm_t ctx;
+
+    if( !aes_gcm_init(&ctx, key, keysz, iv, ivsz, true) ) return false;
+    aes_gcm_update_aad(&ctx, aad, aadsz);
+
+    if( !job_run(&ctx.ctr, &ctx, out, in, insz, threads) )
+        aes_gcm_update(&ctx, out, in, insz);
+
+    aes_gcm_final(&ctx, tag);
+    return true;
+}
+//------------------------------------------------------------------------------
+bool aes_gcm_decipher(void       /*out*/         *out,
+                      const void /*in*/          *in,
+                      size_t     /*in*/           insz,
+                      const void /*in*/          *tag,
+                      size_t     /*in*/           tagsz,
+                      const void /*in*//*opt*/   *aad,
+                      size_t     /*in*/           aadsz,
+                      const void /*in*/          *key,
+                      size_t     /*in*/           keysz,
+                      const void /*in*/          *iv,
+                      size_t     /*in*/           ivsz,
+                      unsigned   /*in*/           threads)
+{
+    /**
+     * 一次性解密一段任意長度的資料，並比對驗證標籤(GCM 模式)
+     * 請參閱："AES 計數器模式共同說明"
+     * @out    : 輸出緩衝區，大小與輸入相同，也可以與 in 為同一個緩衝區。
+     * @in     : 輸入資料。
+     * @insz   : 資料大小。
+     * @tag    : 欲比對的驗證標籤。
+     * @tagsz  : 驗證標籤的長度。
+     * @aad    : 附加的驗證資料，不需要時可以輸入 NULL。
+     * @aadsz  : 附加資料大小。
+     * @iv     : 初始化向量。
+     * @ivsz   : 初始化向量長度。
+     * @return : 驗證成功時傳回 TRUE；
+     *           驗證失敗、密鑰或初始化向量長度不正確時傳回 FALSE，且輸出緩衝區將被清除。
+     */
+    aes_gcm_t ctx;
+
+    if( !aes_gcm_init(&ctx, key, keysz, iv, ivsz, false) ) return false;
+    aes_gcm_update_aad(&ctx, aad, aadsz);
+
+    if( !job_run(&ctx.ctr, &ctx, out, in, insz, threads) )
+        aes_gcm_update(&ctx, out, in, insz);
+
+    if( aes_gcm_final_verify(&ctx, tag, tagsz) ) return true;
+
+    if( insz ) memset(out, 0, insz);
+    return false;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Name      : AES CTR & GCM
+ * Purpose   : AES counter mode (CTR) and Galois/counter mode (GCM).
+ * Author    : 王文佑
+ * Created   : 2026.10.17
+ * Licence   : ZLib Licence
+ * Reference : http://www.openfoundry.org/of/projects/2419
+ *             NIST SP 800-38A, Recommendation for Block Cipher Modes of Operation.
+ *             NIST SP 800-38D, Recommendation for Block Cipher Modes of Operation: GCM and GMAC.
+ ******************************************************************************/
+#ifndef _GEN_AES_CTR_H_
+#define _GEN_AES_CTR_H_
+
+#include "../type.h"
+#include "aes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * AES 計數器模式共同說明
+ *
+ * 計數器模式將區塊加密器作為密鑰流產生器，加密與解密是相同的運算，
+ * 因此資料不需要補齊到區塊大小，且輸出與輸入可以是同一個緩衝區(原地運算)。
+ * 各區塊的密鑰流互相獨立，所以可以從任意位置開始運算，
+ * 大量資料的一次性函式也會將資料分段交由多個執行緒同時處理。
+ *
+ * @key     : 密鑰資料。
+ * @keysz   : 密鑰長度，AES 只接受 16, 24, 32 三值之一，超過尺寸的資料將被忽略；
+ *            函式將會自動挑選小於等於 keysz 的最接近數值使用。
+ * @threads : 一次性函式可使用的最大執行緒數量(包含呼叫者本身)，輸入零則使用處理器的數量。
+ *
+ * 注意：同一把密鑰不可以重複使用相同的初始計數器(CTR)或初始化向量(GCM)，
+ *       否則密鑰流重複將會使資料洩漏。
+ */
+
+#define AES_GCM_TAG_SIZE 16 ///< Size of the full GCM authentication tag.
+
+/// AES CTR mode context.
+typedef struct aes_ctr_t
+{
+    aes_state_t rndkeys[15];
+    size_t      rndkeys_cnt;
+    aes_state_t counter;    // The initial counter block.
+    uint64_t    offset;     // Current position of the key stream.
+    bool        inc32;      // Increase the lowest 32 bits of the counter only.
+} aes_ctr_t;
+
+bool aes_ctr_init(aes_ctr_t  /*out*/ *ctx,
+                  const void /*in*/  *key,
+                  size_t     /*in*/   keysz,
+                  const void /*in*/  *counter);
+void aes_ctr_seek(aes_ctr_t /*inout*/  *ctx,
+                  uint64_t  /*in*/      offset);
+void aes_ctr_update(aes_ctr_t  /*inout*/  *ctx,
+                    void       /*out*/    *out,
+                    const void /*in*/     *in,
+                    size_t     /*in*/      size);
+void aes_ctr_final(aes_ctr_t /*inout*/  *ctx);
+
+bool aes_ctr_crypt(void       /*out*/ *out,
+                   const void /*in*/  *in,
+                   size_t     /*in*/   size,
+                   const void /*in*/  *key,
+                   size_t     /*in*/   keysz,
+                   const void /*in*/  *counter,
+                   unsigned   /*in*/   threads);
+
+/// AES GCM context.
+typedef struct aes_gcm_t
+{
+    aes_ctr_t   ctr;
+    aes_state_t hkey;           // The hash key.
+    uint64_t    table_hi[16];   // Multiples of the hash key, for the portable GHASH.
+    uint64_t    table_lo[16];
+    aes_state_t tagmask;        // Cipher of the initial counter block.
+    aes_state_t hash;           // Current GHASH value.
+    aes_state_t rest;           // Data that is not enough to be a block yet.
+    size_t      restsz;
+    uint64_t    aadsz;
+    uint64_t    datasz;
+    bool        encipher;
+} aes_gcm_t;
+
+bool aes_gcm_init(aes_gcm_t  /*out*/ *ctx,
+                  const void /*in*/  *key,
+                  size_t     /*in*/   keysz,
+                  const void /*in*/  *iv,
+                  size_t     /*in*/   ivsz,
+                  bool       /*in*/   encipher);
+void aes_gcm_update_aad(aes_gcm_t  /*inout*/  *ctx,
+                        const void /*in*/     *aad,
+                        size_t     /*in*/      size);
+void aes_gcm_update(aes_gcm_t  /*inout*/  *ctx,
+                    void       /*out*/    *out,
+                    const void /*in*/     *in,
+                    size_t     /*in*/      size);
+void aes_gcm_final(aes_gcm_t /*inout*/  *ctx,
+                   void      /*out*/    *tag);
+bool aes_gcm_final_verify(aes_gcm_t  /*inout*/  *ctx,
+                          const void /*in*/     *tag,
+                          size_t     /*in*/      tagsz);
+
+bool aes_gcm_encipher(void       /*out*/         *out,
+                      void       /*out*/         *tag,
+                      const void /*in*/          *in,
+                      size_t     /*in*/           insz,
+                      const void /*in*//*opt*/   *aad,
+                      size_t     /*in*/           aadsz,
+                      const void /*in*/          *key,
+                      size_t     /*in*/           keysz,
+                      const void /*in*/          *iv,
+                      size_t     /*in*/           ivsz,
+                      unsigned   /*in*/           threads);
+bool aes_gcm_decipher(void       /*out*/         *out,
+                      const void /*in*/          *in,
+                      size_t     /*in*/           insz,
+                      const void /*in*/          *tag,
+                      size_t     /*in*/           tagsz,
+                      const void /*in*//*opt*/   *aad,
+                      size_t     /*in*/           aadsz,
+                      const void /*in*/          *key,
+                      size_t     /*in*/           keysz,
+                      const void /*in*/          *iv,
+                      size_t     /*in*/           ivsz,
+                      unsigned   /*in*/           threads);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,279 @@
+#include <assert.h>
+#include "aes_ni.h"
+
+#ifdef AES_NI_AVAILABLE
+
+#include <immintrin.h>
+
+/*
+ * Independent blocks are processed in groups of eight,
+ * so that the latency of each AES round instruction can be hidden
+ * by the rounds of the other blocks in the same group.
+ */
+
+#define WAYS 8
+
+#define EACH_WAY(stmt)                                                      \
+{                                                                           \
+    { enum{ j=0 }; stmt; } { enum{ j=1 }; stmt; }                           \
+    { enum{ j=2 }; stmt; } { enum{ j=3 }; stmt; }                           \
+    { enum{ j=4 }; stmt; } { enum{ j=5 }; stmt; }                           \
+    { enum{ j=6 }; stmt; } { enum{ j=7 }; stmt; }                           \
+}
+
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+static
+size_t load_enc_keys(__m128i keys[15], const aes_state_t *rndkeys, size_t rndkeys_cnt)
+{
+    assert( rndkeys_cnt == 11 ||
+            rndkeys_cnt == 13 ||
+            rndkeys_cnt == 15 );
+
+    for(size_t i=0; i<rndkeys_cnt; ++i)
+        keys[i] = _mm_loadu_si128((const __m128i*) &rndkeys[i]);
+
+    return rndkeys_cnt - 1;
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+static
+size_t load_dec_keys(__m128i keys[15], const aes_state_t *rndkeys, size_t rndkeys_cnt)
+{
+    // Round keys of the equivalent inverse cipher.
+    assert( rndkeys_cnt == 11 ||
+            rndkeys_cnt == 13 ||
+            rndkeys_cnt == 15 );
+
+    size_t Nr = rndkeys_cnt - 1;
+
+    keys[0]  = _mm_loadu_si128((const __m128i*) &rndkeys[Nr]);
+    for(size_t i=1; i<Nr; ++i)
+        keys[i] = _mm_aesimc_si128(_mm_loadu_si128((const __m128i*) &rndkeys[Nr-i]));
+    keys[Nr] = _mm_loadu_si128((const __m128i*) &rndkeys[0]);
+
+    return Nr;
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+static inline
+__m128i encipher_1(__m128i block, const __m128i keys[15], size_t Nr)
+{
+    block = _mm_xor_si128(block, keys[0]);
+    for(size_t i=1; i<Nr; ++i)
+        block = _mm_aesenc_si128(block, keys[i]);
+    return _mm_aesenclast_si128(block, keys[Nr]);
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+static inline
+__m128i decipher_1(__m128i block, const __m128i keys[15], size_t Nr)
+{
+    block = _mm_xor_si128(block, keys[0]);
+    for(size_t i=1; i<Nr; ++i)
+        block = _mm_aesdec_si128(block, keys[i]);
+    return _mm_aesdeclast_si128(block, keys[Nr]);
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+static inline
+void encipher_8(__m128i b[WAYS], const __m128i keys[15], size_t Nr)
+{
+    EACH_WAY( b[j] = _mm_xor_si128(b[j], keys[0]) );
+    for(size_t i=1; i<Nr; ++i)
+    {
+        __m128i key = keys[i];
+        EACH_WAY( b[j] = _mm_aesenc_si128(b[j], key) );
+    }
+    EACH_WAY( b[j] = _mm_aesenclast_si128(b[j], keys[Nr]) );
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+static inline
+void decipher_8(__m128i b[WAYS], const __m128i keys[15], size_t Nr)
+{
+    EACH_WAY( b[j] = _mm_xor_si128(b[j], keys[0]) );
+    for(size_t i=1; i<Nr; ++i)
+    {
+        __m128i key = keys[i];
+        EACH_WAY( b[j] = _mm_aesdec_si128(b[j], key) );
+    }
+    EACH_WAY( b[j] = _mm_aesdeclast_si128(b[j], keys[Nr]) );
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+void aes_ni_encipher(aes_state_t       /*inout*/ *blocks,
+                     size_t            /*in   */  count,
+                     const aes_state_t /*in   */ *rndkeys,
+                     size_t            /*in   */  rndkeys_cnt)
+{
+    /*
+     * Encipher independent blocks (ECB).
+     */
+    __m128i keys[15];
+    size_t  Nr = load_enc_keys(keys, rndkeys, rndkeys_cnt);
+    __m128i *p = (__m128i*) blocks;
+
+    for(; count >= WAYS; count -= WAYS, p += WAYS)
+    {
+        __m128i b[WAYS];
+        EACH_WAY( b[j] = _mm_loadu_si128(p + j) );
+        encipher_8(b, keys, Nr);
+        EACH_WAY( _mm_storeu_si128(p + j, b[j]) );
+    }
+
+    for(; count; --count, ++p)
+        _mm_storeu_si128(p, encipher_1(_mm_loadu_si128(p), keys, Nr));
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+void aes_ni_decipher(aes_state_t       /*inout*/ *blocks,
+                     size_t            /*in   */  count,
+                     const aes_state_t /*in   */ *rndkeys,
+                     size_t            /*in   */  rndkeys_cnt)
+{
+    /*
+     * Decipher independent blocks (ECB).
+     */
+    __m128i keys[15];
+    size_t  Nr = load_dec_keys(keys, rndkeys, rndkeys_cnt);
+    __m128i *p = (__m128i*) blocks;
+
+    for(; count >= WAYS; count -= WAYS, p += WAYS)
+    {
+        __m128i b[WAYS];
+        EACH_WAY( b[j] = _mm_loadu_si128(p + j) );
+        decipher_8(b, keys, Nr);
+        EACH_WAY( _mm_storeu_si128(p + j, b[j]) );
+    }
+
+    for(; count; --count, ++p)
+        _mm_storeu_si128(p, decipher_1(_mm_loadu_si128(p), keys, Nr));
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+void aes_ni_cbc_encipher(aes_state_t       /*inout*/ *blocks,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *iv,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt)
+{
+    /*
+     * Encipher blocks with CBC mode.
+     * The chain is serial by definition, so only the round keys can be kept in registers.
+     */
+    __m128i keys[15];
+    size_t  Nr = load_enc_keys(keys, rndkeys, rndkeys_cnt);
+    __m128i *p = (__m128i*) blocks;
+    __m128i prev = _mm_loadu_si128((const __m128i*) iv);
+
+    for(; count; --count, ++p)
+    {
+        prev = encipher_1(_mm_xor_si128(_mm_loadu_si128(p), prev), keys, Nr);
+        _mm_storeu_si128(p, prev);
+    }
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,sse2")
+void aes_ni_cbc_decipher(aes_state_t       /*inout*/ *blocks,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt)
+{
+    /*
+     * Decipher blocks with CBC mode, except that the first block will not be combined with IV.
+     * Blocks are processed from the end to the beginning,
+     * so that the previous cipher block of each block is still available
+     * when the work is done in place.
+     */
+    __m128i keys[15];
+    size_t  Nr = load_dec_keys(keys, rndkeys, rndkeys_cnt);
+    __m128i *p = (__m128i*) blocks;
+
+    while( count > WAYS )
+    {
+        __m128i *q = p + count - WAYS;
+        __m128i  b[WAYS], c[WAYS];
+
+        EACH_WAY( b[j] = c[j] = _mm_loadu_si128(q + j) );
+        __m128i prev = _mm_loadu_si128(q - 1);
+
+        decipher_8(b, keys, Nr);
+
+        _mm_storeu_si128(q, _mm_xor_si128(b[0], prev));
+        EACH_WAY( if( j ) _mm_storeu_si128(q + j, _mm_xor_si128(b[j], c[ j ? j-1 : 0 ])) );
+
+        count -= WAYS;
+    }
+
+    for(; count > 1; --count)
+    {
+        __m128i *q = p + count - 1;
+        __m128i  prev = _mm_loadu_si128(q - 1);
+        _mm_storeu_si128(q, _mm_xor_si128(decipher_1(_mm_loadu_si128(q), keys, Nr), prev));
+    }
+
+    if( count )
+        _mm_storeu_si128(p, decipher_1(_mm_loadu_si128(p), keys, Nr));
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("ssse3,sse2")
+static inline
+__m128i counter_block(uint64_t hi, uint64_t lo, uint64_t index, bool inc32)
+{
+    const __m128i order = _mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+
+    if( inc32 )
+    {
+        lo = ( lo & 0xFFFFFFFF00000000ULL ) | (uint32_t)( lo + index );
+    }
+    else
+    {
+        uint64_t sum = lo + index;
+        hi += sum < lo;
+        lo  = sum;
+    }
+
+    return _mm_shuffle_epi8(_mm_set_epi64x(hi, lo), order);
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("aes,ssse3,sse2")
+void aes_ni_ctr_xor(byte_t            /*out*/ *out,
+                    const byte_t      /*in */ *in,
+                    size_t            /*in */  count,
+                    const aes_state_t /*in */ *counter,
+                    uint64_t          /*in */  index,
+                    bool              /*in */  inc32,
+                    const aes_state_t /*in */ *rndkeys,
+                    size_t            /*in */  rndkeys_cnt)
+{
+    __m128i  keys[15];
+    size_t   Nr = load_enc_keys(keys, rndkeys, rndkeys_cnt);
+    uint64_t hi = 0, lo = 0;
+
+    for(size_t i=0; i<8; ++i)
+    {
+        hi = ( hi << 8 ) | counter->byte[i];
+        lo = ( lo << 8 ) | counter->byte[i+8];
+    }
+
+    const __m128i *src  = (const __m128i*) in;
+    __m128i       *dest = (__m128i*) out;
+
+    for(; count >= WAYS; count -= WAYS, src += WAYS, dest += WAYS, index += WAYS)
+    {
+        __m128i b[WAYS];
+        EACH_WAY( b[j] = counter_block(hi, lo, index + j, inc32) );
+        encipher_8(b, keys, Nr);
+        EACH_WAY( _mm_storeu_si128(dest + j, _mm_xor_si128(b[j], _mm_loadu_si128(src + j))) );
+    }
+
+    for(; count; --count, ++src, ++dest, ++index)
+    {
+        __m128i b = encipher_1(counter_block(hi, lo, index, inc32), keys, Nr);
+        _mm_storeu_si128(dest, _mm_xor_si128(b, _mm_loadu_si128(src)));
+    }
+}
+//------------------------------------------------------------------------------
+
+#endif  // AES_NI_AVAILABLE
@@ -0,0 +1,74 @@
+/*
+ * PRIVATE USAGE
+ */
+/******************************************************************************
+ * Name      : AES-NI
+ * Purpose   : AES block functions accelerated by the x86 AES new instructions.
+ * Author    : 王文佑
+ * Created   : 2026.10.17
+ * Licence   : ZLib Licence
+ * Reference : http://www.openfoundry.org/of/projects/2419
+ ******************************************************************************/
+#ifndef _GEN_AES_NI_H_
+#define _GEN_AES_NI_H_
+
+#include "../cpufeat.h"
+#include "aes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CPUFEAT_X86
+
+// Defined if the AES-NI block functions are available.
+#define AES_NI_AVAILABLE
+
+// Features needed by the block functions.
+#define AES_NI_FEATURES ( CPUFEAT_AESNI | CPUFEAT_SSE2 )
+
+/*
+ * All functions below work in place,
+ * and the round keys are the same as the output of aes_key_expand.
+ */
+
+void aes_ni_encipher(aes_state_t       /*inout*/ *blocks,
+                     size_t            /*in   */  count,
+                     const aes_state_t /*in   */ *rndkeys,
+                     size_t            /*in   */  rndkeys_cnt);
+void aes_ni_decipher(aes_state_t       /*inout*/ *blocks,
+                     size_t            /*in   */  count,
+                     const aes_state_t /*in   */ *rndkeys,
+                     size_t            /*in   */  rndkeys_cnt);
+
+void aes_ni_cbc_encipher(aes_state_t       /*inout*/ *blocks,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *iv,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt);
+void aes_ni_cbc_decipher(aes_state_t       /*inout*/ *blocks,
+                         size_t            /*in   */  count,
+                         const aes_state_t /*in   */ *rndkeys,
+                         size_t            /*in   */  rndkeys_cnt);
+
+/*
+ * Combine full blocks with the CTR key stream,
+ * the counter block of each block is the initial counter plus the block index,
+ * as a 128 bits big-endian integer, or only the lowest 32 bits of it if inc32 is set.
+ */
+void aes_ni_ctr_xor(byte_t            /*out*/ *out,
+                    const byte_t      /*in */ *in,
+                    size_t            /*in */  count,
+                    const aes_state_t /*in */ *counter,
+                    uint64_t          /*in */  index,
+                    bool              /*in */  inc32,
+                    const aes_state_t /*in */ *rndkeys,
+                    size_t            /*in */  rndkeys_cnt);
+
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
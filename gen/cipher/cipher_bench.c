@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "../cpufeat.h"
+#include "../systime.h"
+#include "aes.h"
+#include "aes_ctr.h"
+#include "des.h"
+#include "rsa.h"
+
+#define BENCH_DATA_SIZE ( 1024 * 1024 )
+#define BENCH_DURATION  500 // Milliseconds.
+#define BENCH_RSA_BATCH 64
+
+typedef size_t(*bench_func_t)(void *out, const void *in, size_t insz, const void *key, size_t keysz);
+typedef size_t(*bench_rsa_func_t)(const rsa_key_t *key, const rsa_ctx_t *ctx, byte_t *out, const byte_t *in, size_t statesz);
+
+static const byte_t bench_key[32] =
+{
+    0x00,0x01,0x02,0x03, 0x04,0x05,0x06,0x07, 0x08,0x09,0x0A,0x0B, 0x0C,0x0D,0x0E,0x0F,
+    0x10,0x11,0x12,0x13, 0x14,0x15,0x16,0x17, 0x18,0x19,0x1A,0x1B, 0x1C,0x1D,0x1E,0x1F
+};
+
+static const byte_t bench_iv[16] =
+{
+    0x0F,0x0E,0x0D,0x0C, 0x0B,0x0A,0x09,0x08, 0x07,0x06,0x05,0x04, 0x03,0x02,0x01,0x00
+};
+
+//------------------------------------------------------------------------------
+size_t bench_cbc_encipher(void *out, const void *in, size_t insz, const void *key, size_t keysz)
+{
+    return aes_cbc_encipher(out, in, insz, key, keysz, bench_iv);
+}
+//------------------------------------------------------------------------------
+size_t bench_cbc_decipher(void *out, const void *in, size_t insz, const void *key, size_t keysz)
+{
+    return aes_cbc_decipher(out, in, insz, key, keysz, bench_iv);
+}
+//------------------------------------------------------------------------------
+size_t bench_ctr_crypt(void *out, const void *in, size_t insz, const void *key, size_t keysz)
+{
+    return aes_ctr_crypt(out, in, insz, key, keysz, bench_iv, 1) ? insz : 0;
+}
+//------------------------------------------------------------------------------
+size_t bench_ctr_crypt_mt(void *out, const void *in, size_t insz, const void *key, size_t keysz)
+{
+    return aes_ctr_crypt(out, in, insz, key, keysz, bench_iv, 0) ? insz : 0;
+}
+//------------------------------------------------------------------------------
+size_t bench_gcm_encipher(void *out, const void *in, size_t insz, const void *key, size_t keysz)
+{
+    byte_t tag[AES_GCM_TAG_SIZE];
+    return aes_gcm_encipher(out, tag, in, insz, NULL, 0, key, keysz, bench_iv, 12, 1) ? insz : 0;
+}
+//------------------------------------------------------------------------------
+size_t bench_gcm_encipher_mt(void *out, const void *in, size_t insz, const void *key, size_t keysz)
+{
+    byte_t tag[AES_GCM_TAG_SIZE];
+    return aes_gcm_encipher(out, tag, in, insz, NULL, 0, key, keysz, bench_iv, 12, 0) ? insz : 0;
+}
+//------------------------------------------------------------------------------
+size_t bench_tdea_cbc_encipher(void *out, const void *in, size_t insz, const void *key, size_t keysz)
+{
+    return tdea_cbc_encipher(out, in, insz, key, keysz, bench_iv);
+}
+//------------------------------------------------------------------------------
+size_t bench_tdea_cbc_decipher(void *out, const void *in, size_t insz, const void *key, size_t keysz)
+{
+    return tdea_cbc_decipher(out, in, insz, key, keysz, bench_iv);
+}
+//------------------------------------------------------------------------------
+double bench_throughput(bench_func_t func, void *out, const void *in, size_t size, size_t keysz)
+{
+    // Run the function repeatedly in a period of time, and return the throughput in MB/s.
+    unsigned rounds = 0;
+
+    func(out, in, size, bench_key, keysz);  // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(out, in, size, bench_key, keysz);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    return (double) size * rounds / ( 1024 * 1024 ) / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_print(const char *name, bench_func_t func, void *out, const void *in, size_t size, size_t keysz)
+{
+    cpufeat_set_mask(0);
+    double speed_base = bench_throughput(func, out, in, size, keysz);
+
+    cpufeat_set_mask(CPUFEAT_ALL);
+    double speed_fast = bench_throughput(func, out, in, size, keysz);
+
+    printf("AES-%u %-12s portable: %8.1f MB/s, accelerated: %8.1f MB/s (x%.2f)\n",
+           (unsigned) keysz * 8,
+           name,
+           speed_base,
+           speed_fast,
+           speed_fast / speed_base);
+}
+//------------------------------------------------------------------------------
+void bench_print_tdea(const char *name, bench_func_t func, void *out, const void *in, size_t size)
+{
+    // No accelerated path for TDEA, so only the portable speed is printed.
+    printf("TDEA %-12s portable: %8.1f MB/s\n", name, bench_throughput(func, out, in, size, 24));
+}
+//------------------------------------------------------------------------------
+size_t bench_rsa_encipher(const rsa_key_t *key, const rsa_ctx_t *ctx, byte_t *out, const byte_t *in, size_t statesz)
+{
+    for(size_t i=0; i<BENCH_RSA_BATCH; ++i)
+        rsa_state_encipher(out + i * statesz, statesz, in + i * statesz, statesz - 1, key);
+    return BENCH_RSA_BATCH;
+}
+//------------------------------------------------------------------------------
+size_t bench_rsa_decipher(const rsa_key_t *key, const rsa_ctx_t *ctx, byte_t *out, const byte_t *in, size_t statesz)
+{
+    for(size_t i=0; i<BENCH_RSA_BATCH; ++i)
+        rsa_state_decipher(out + i * statesz, statesz, in + i * statesz, statesz, key);
+    return BENCH_RSA_BATCH;
+}
+//------------------------------------------------------------------------------
+size_t bench_rsa_batch_encipher(const rsa_key_t *key, const rsa_ctx_t *ctx, byte_t *out, const byte_t *in, size_t statesz)
+{
+    return rsa_batch_encipher(ctx, out, statesz, in, statesz - 1, BENCH_RSA_BATCH);
+}
+//------------------------------------------------------------------------------
+size_t bench_rsa_batch_decipher(const rsa_key_t *key, const rsa_ctx_t *ctx, byte_t *out, const byte_t *in, size_t statesz)
+{
+    return rsa_batch_decipher(ctx, out, statesz, in, statesz, BENCH_RSA_BATCH);
+}
+//------------------------------------------------------------------------------
+double bench_rsa_ops(bench_rsa_func_t func, const rsa_key_t *key, byte_t *out, const byte_t *in, size_t statesz)
+{
+    // Run the function repeatedly in a period of time, and return the states processed per second.
+    rsa_ctx_t ctx;
+    unsigned  states = 0;
+
+    rsa_ctx_init(&ctx, key);
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        states += func(key, &ctx, out, in, statesz);
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    rsa_ctx_clear(&ctx);
+
+    return states / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_print_rsa(rsa_type_t type, byte_t *out, const byte_t *in)
+{
+    rsa_key_t publickey, privatekey, plainkey;
+    size_t    statesz = rsa_get_state_size(type);
+
+    rsa_generate_keys(&publickey, &privatekey, type, NULL);
+
+    // The private key without the CRT parameters
+    plainkey = privatekey;
+    memset(plainkey.prime1, 0, sizeof(plainkey.prime1));
+    memset(plainkey.prime2, 0, sizeof(plainkey.prime2));
+
+    double enc       = bench_rsa_ops(bench_rsa_encipher      , &publickey , out, in, statesz);
+    double enc_batch = bench_rsa_ops(bench_rsa_batch_encipher, &publickey , out, in, statesz);
+    double dec       = bench_rsa_ops(bench_rsa_decipher      , &plainkey  , out, in, statesz);
+    double dec_crt   = bench_rsa_ops(bench_rsa_decipher      , &privatekey, out, in, statesz);
+    double dec_batch = bench_rsa_ops(bench_rsa_batch_decipher, &privatekey, out, in, statesz);
+
+    printf("RSA-%-4u encipher: %7.1f ops/s, batch: %7.1f ops/s (x%.2f)\n",
+           (unsigned) statesz * 8,
+           enc,
+           enc_batch,
+           enc_batch / enc);
+    printf("RSA-%-4u decipher: %7.1f ops/s, CRT: %7.1f ops/s (x%.2f), CRT batch: %7.1f ops/s (x%.2f)\n",
+           (unsigned) statesz * 8,
+           dec,
+           dec_crt,
+           dec_crt / dec,
+           dec_batch,
+           dec_batch / dec);
+}
+//------------------------------------------------------------------------------
+int main(void)
+{
+    byte_t *in  = malloc(BENCH_DATA_SIZE);
+    byte_t *out = malloc(BENCH_DATA_SIZE);
+    if( !in || !out ) return 1;
+
+    for(size_t i=0; i<BENCH_DATA_SIZE; ++i)
+        in[i] = i * 13 + ( i >> 11 );
+
+    static const size_t keysizes[] = { 16, 32 };
+    for(size_t i=0; i<sizeof(keysizes)/sizeof(keysizes[0]); ++i)
+    {
+        bench_print("ECB encipher", aes_ecb_encipher  , out, in, BENCH_DATA_SIZE, keysizes[i]);
+        bench_print("ECB decipher", aes_ecb_decipher  , out, in, BENCH_DATA_SIZE, keysizes[i]);
+        bench_print("CBC encipher", bench_cbc_encipher, out, in, BENCH_DATA_SIZE, keysizes[i]);
+        bench_print("CBC decipher", bench_cbc_decipher, out, in, BENCH_DATA_SIZE, keysizes[i]);
+        bench_print("CTR"         , bench_ctr_crypt   , out, in, BENCH_DATA_SIZE, keysizes[i]);
+        bench_print("CTR threads" , bench_ctr_crypt_mt, out, in, BENCH_DATA_SIZE, keysizes[i]);
+        bench_print("GCM encipher", bench_gcm_encipher, out, in, BENCH_DATA_SIZE, keysizes[i]);
+        bench_print("GCM threads" , bench_gcm_encipher_mt, out, in, BENCH_DATA_SIZE, keysizes[i]);
+    }
+
+    bench_print_tdea("ECB encipher", tdea_ecb_encipher      , out, in, BENCH_DATA_SIZE);
+    bench_print_tdea("ECB decipher", tdea_ecb_decipher      , out, in, BENCH_DATA_SIZE);
+    bench_print_tdea("CBC encipher", bench_tdea_cbc_encipher, out, in, BENCH_DATA_SIZE);
+    bench_print_tdea("CBC decipher", bench_tdea_cbc_decipher, out, in, BENCH_DATA_SIZE);
+
+    static const rsa_type_t rsatypes[] = { rsa_type_512, rsa_type_1024 };
+    for(size_t i=0; i<sizeof(rsatypes)/sizeof(rsatypes[0]); ++i)
+        bench_print_rsa(rsatypes[i], out, in);
+
+    free(out);
+    free(in);
+
+    return 0;
+}
+//------------------------------------------------------------------------------
@@ -1,11 +1,14 @@
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 
 #ifdef __BORLANDC__
 #pragma hdrstop
 #endif
 
+#include "../cpufeat.h"
 #include "aes.h"
+#include "aes_ctr.h"
 #include "des_bit.h"
 #include "des.h"
 
@@ -214,6 +217,406 @@ void aes_multiblock_cipher_test(void)
     assert( 0 == memcmp(databuf, datatext, sizeof(datatext)) );
 }
 //------------------------------------------------------------------------------
+void aes_mode_vector_test(void)
+{
+    /*
+     * Known answers of NIST SP 800-38A (F.1.1, F.1.5, F.2.1, F.2.5),
+     * checked on both the portable and the accelerated routines,
+     * and the portable ones are the bitsliced routines if AES_CONST_TIME defined.
+     */
+    static const byte_t key128[] =
+    {
+        0x2B,0x7E,0x15,0x16, 0x28,0xAE,0xD2,0xA6, 0xAB,0xF7,0x15,0x88, 0x09,0xCF,0x4F,0x3C
+    };
+    static const byte_t key256[] =
+    {
+        0x60,0x3D,0xEB,0x10, 0x15,0xCA,0x71,0xBE, 0x2B,0x73,0xAE,0xF0, 0x85,0x7D,0x77,0x81,
+        0x1F,0x35,0x2C,0x07, 0x3B,0x61,0x08,0xD7, 0x2D,0x98,0x10,0xA3, 0x09,0x14,0xDF,0xF4
+    };
+    static const byte_t text[] =
+    {
+        0x6B,0xC1,0xBE,0xE2, 0x2E,0x40,0x9F,0x96, 0xE9,0x3D,0x7E,0x11, 0x73,0x93,0x17,0x2A,
+        0xAE,0x2D,0x8A,0x57, 0x1E,0x03,0xAC,0x9C, 0x9E,0xB7,0x6F,0xAC, 0x45,0xAF,0x8E,0x51,
+        0x30,0xC8,0x1C,0x46, 0xA3,0x5C,0xE4,0x11, 0xE5,0xFB,0xC1,0x19, 0x1A,0x0A,0x52,0xEF,
+        0xF6,0x9F,0x24,0x45, 0xDF,0x4F,0x9B,0x17, 0xAD,0x2B,0x41,0x7B, 0xE6,0x6C,0x37,0x10
+    };
+    static const byte_t ecb128[] =
+    {
+        0x3A,0xD7,0x7B,0xB4, 0x0D,0x7A,0x36,0x60, 0xA8,0x9E,0xCA,0xF3, 0x24,0x66,0xEF,0x97,
+        0xF5,0xD3,0xD5,0x85, 0x03,0xB9,0x69,0x9D, 0xE7,0x85,0x89,0x5A, 0x96,0xFD,0xBA,0xAF,
+        0x43,0xB1,0xCD,0x7F, 0x59,0x8E,0xCE,0x23, 0x88,0x1B,0x00,0xE3, 0xED,0x03,0x06,0x88,
+        0x7B,0x0C,0x78,0x5E, 0x27,0xE8,0xAD,0x3F, 0x82,0x23,0x20,0x71, 0x04,0x72,0x5D,0xD4
+    };
+    static const byte_t cbc128[] =
+    {
+        0x76,0x49,0xAB,0xAC, 0x81,0x19,0xB2,0x46, 0xCE,0xE9,0x8E,0x9B, 0x12,0xE9,0x19,0x7D,
+        0x50,0x86,0xCB,0x9B, 0x50,0x72,0x19,0xEE, 0x95,0xDB,0x11,0x3A, 0x91,0x76,0x78,0xB2,
+        0x73,0xBE,0xD6,0xB8, 0xE3,0xC1,0x74,0x3B, 0x71,0x16,0xE6,0x9E, 0x22,0x22,0x95,0x16,
+        0x3F,0xF1,0xCA,0xA1, 0x68,0x1F,0xAC,0x09, 0x12,0x0E,0xCA,0x30, 0x75,0x86,0xE1,0xA7
+    };
+    static const byte_t ecb256[] =
+    {
+        0xF3,0xEE,0xD1,0xBD, 0xB5,0xD2,0xA0,0x3C, 0x06,0x4B,0x5A,0x7E, 0x3D,0xB1,0x81,0xF8,
+        0x59,0x1C,0xCB,0x10, 0xD4,0x10,0xED,0x26, 0xDC,0x5B,0xA7,0x4A, 0x31,0x36,0x28,0x70,
+        0xB6,0xED,0x21,0xB9, 0x9C,0xA6,0xF4,0xF9, 0xF1,0x53,0xE7,0xB1, 0xBE,0xAF,0xED,0x1D,
+        0x23,0x30,0x4B,0x7A, 0x39,0xF9,0xF3,0xFF, 0x06,0x7D,0x8D,0x8F, 0x9E,0x24,0xEC,0xC7
+    };
+    static const byte_t cbc256[] =
+    {
+        0xF5,0x8C,0x4C,0x04, 0xD6,0xE5,0xF1,0xBA, 0x77,0x9E,0xAB,0xFB, 0x5F,0x7B,0xFB,0xD6,
+        0x9C,0xFC,0x4E,0x96, 0x7E,0xDB,0x80,0x8D, 0x67,0x9F,0x77,0x7B, 0xC6,0x70,0x2C,0x7D,
+        0x39,0xF2,0x33,0x69, 0xA9,0xD9,0xBA,0xCF, 0xA5,0x30,0xE2,0x63, 0x04,0x23,0x14,0x61,
+        0xB2,0xEB,0x05,0xE2, 0xC3,0x9B,0xE9,0xFC, 0xDA,0x6C,0x19,0x07, 0x8C,0x6A,0x9D,0x1B
+    };
+    static const aes_state_t iv = {{{ 0x00,0x01,0x02,0x03, 0x04,0x05,0x06,0x07, 0x08,0x09,0x0A,0x0B, 0x0C,0x0D,0x0E,0x0F }}};
+    static const unsigned masks[] = { 0, CPUFEAT_ALL };
+    byte_t buf[sizeof(text)];
+
+    for(size_t i=0; i<sizeof(masks)/sizeof(masks[0]); ++i)
+    {
+        cpufeat_set_mask(masks[i]);
+
+        // ECB mode
+        assert( sizeof(buf) == aes_ecb_encipher(buf, text, sizeof(text), key128, sizeof(key128)) );
+        assert( 0 == memcmp(buf, ecb128, sizeof(ecb128)) );
+        assert( sizeof(buf) == aes_ecb_decipher(buf, buf, sizeof(buf), key128, sizeof(key128)) );
+        assert( 0 == memcmp(buf, text, sizeof(text)) );
+
+        assert( sizeof(buf) == aes_ecb_encipher(buf, text, sizeof(text), key256, sizeof(key256)) );
+        assert( 0 == memcmp(buf, ecb256, sizeof(ecb256)) );
+        assert( sizeof(buf) == aes_ecb_decipher(buf, buf, sizeof(buf), key256, sizeof(key256)) );
+        assert( 0 == memcmp(buf, text, sizeof(text)) );
+
+        // CBC mode
+        assert( sizeof(buf) == aes_cbc_encipher(buf, text, sizeof(text), key128, sizeof(key128), &iv) );
+        assert( 0 == memcmp(buf, cbc128, sizeof(cbc128)) );
+        assert( sizeof(buf) == aes_cbc_decipher(buf, buf, sizeof(buf), key128, sizeof(key128), &iv) );
+        assert( 0 == memcmp(buf, text, sizeof(text)) );
+
+        assert( sizeof(buf) == aes_cbc_encipher(buf, text, sizeof(text), key256, sizeof(key256), &iv) );
+        assert( 0 == memcmp(buf, cbc256, sizeof(cbc256)) );
+        assert( sizeof(buf) == aes_cbc_decipher(buf, buf, sizeof(buf), key256, sizeof(key256), &iv) );
+        assert( 0 == memcmp(buf, text, sizeof(text)) );
+    }
+
+    cpufeat_set_mask(CPUFEAT_ALL);
+}
+//------------------------------------------------------------------------------
+void aes_accel_test(void)
+{
+    /*
+     * Compare the results of the accelerated routines with the portable ones,
+     * sizes are selected to cover both the interleaved groups and the rest blocks.
+     */
+    static const byte_t key[32] =
+    {
+        0x60,0x3D,0xEB,0x10, 0x15,0xCA,0x71,0xBE, 0x2B,0x73,0xAE,0xF0, 0x85,0x7D,0x77,0x81,
+        0x1F,0x35,0x2C,0x07, 0x3B,0x61,0x08,0xD7, 0x2D,0x98,0x10,0xA3, 0x09,0x14,0xDF,0xF4
+    };
+    static const aes_state_t iv = {{{ 0x00,0x01,0x02,0x03, 0x04,0x05,0x06,0x07, 0x08,0x09,0x0A,0x0B, 0x0C,0x0D,0x0E,0x0F }}};
+    static const size_t sizes[] = { 16, 100, 128, 144, 256, 1000, 4096 };
+    static const size_t keysizes[] = { 16, 24, 32 };
+
+    static byte_t text[4096];
+    static byte_t code_fast[4096], code_base[4096];
+    static byte_t back_fast[4096], back_base[4096];
+    size_t i, k, n;
+
+    for(i=0; i<sizeof(text); ++i)
+        text[i] = i * 7 + ( i >> 8 );
+
+    for(k=0; k<sizeof(keysizes)/sizeof(keysizes[0]); ++k)
+    for(n=0; n<sizeof(sizes)/sizeof(sizes[0]); ++n)
+    {
+        size_t keysz = keysizes[k];
+        size_t size  = sizes[n];
+        size_t outsz = aes_ecb_encipher(NULL, text, size, key, keysz);
+
+        // ECB mode
+        cpufeat_set_mask(0);
+        assert( outsz == aes_ecb_encipher(code_base, text, size, key, keysz) );
+        assert( outsz == aes_ecb_decipher(back_base, code_base, outsz, key, keysz) );
+        cpufeat_set_mask(CPUFEAT_ALL);
+        assert( outsz == aes_ecb_encipher(code_fast, text, size, key, keysz) );
+        assert( outsz == aes_ecb_decipher(back_fast, code_fast, outsz, key, keysz) );
+        assert( 0 == memcmp(code_fast, code_base, outsz) );
+        assert( 0 == memcmp(back_fast, back_base, outsz) );
+        assert( 0 == memcmp(back_fast, text, size) );
+
+        // CBC mode
+        cpufeat_set_mask(0);
+        assert( outsz == aes_cbc_encipher(code_base, text, size, key, keysz, &iv) );
+        assert( outsz == aes_cbc_decipher(back_base, code_base, outsz, key, keysz, &iv) );
+        cpufeat_set_mask(CPUFEAT_ALL);
+        assert( outsz == aes_cbc_encipher(code_fast, text, size, key, keysz, &iv) );
+        assert( outsz == aes_cbc_decipher(back_fast, code_fast, outsz, key, keysz, &iv) );
+        assert( 0 == memcmp(code_fast, code_base, outsz) );
+        assert( 0 == memcmp(back_fast, back_base, outsz) );
+        assert( 0 == memcmp(back_fast, text, size) );
+
+        // CBC mode in place, with the automatic IV
+        memcpy(back_fast, code_fast, outsz);
+        assert( outsz == aes_cbc_encipher(back_fast, text, size, key, keysz, NULL) );
+        assert( outsz == aes_cbc_decipher(back_fast, back_fast, outsz, key, keysz, NULL) );
+        assert( 0 == memcmp(back_fast, text, size) );
+    }
+}
+//------------------------------------------------------------------------------
+void aes_ctr_test(void)
+{
+    // Test vectors from NIST SP 800-38A, F.5.1 CTR-AES128.Encrypt.
+    static const byte_t key[16] =
+    {
+        0x2B,0x7E,0x15,0x16, 0x28,0xAE,0xD2,0xA6, 0xAB,0xF7,0x15,0x88, 0x09,0xCF,0x4F,0x3C
+    };
+    static const byte_t counter[16] =
+    {
+        0xF0,0xF1,0xF2,0xF3, 0xF4,0xF5,0xF6,0xF7, 0xF8,0xF9,0xFA,0xFB, 0xFC,0xFD,0xFE,0xFF
+    };
+    static const byte_t text[64] =
+    {
+        0x6B,0xC1,0xBE,0xE2, 0x2E,0x40,0x9F,0x96, 0xE9,0x3D,0x7E,0x11, 0x73,0x93,0x17,0x2A,
+        0xAE,0x2D,0x8A,0x57, 0x1E,0x03,0xAC,0x9C, 0x9E,0xB7,0x6F,0xAC, 0x45,0xAF,0x8E,0x51,
+        0x30,0xC8,0x1C,0x46, 0xA3,0x5C,0xE4,0x11, 0xE5,0xFB,0xC1,0x19, 0x1A,0x0A,0x52,0xEF,
+        0xF6,0x9F,0x24,0x45, 0xDF,0x4F,0x9B,0x17, 0xAD,0x2B,0x41,0x7B, 0xE6,0x6C,0x37,0x10
+    };
+    static const byte_t code[64] =
+    {
+        0x87,0x4D,0x61,0x91, 0xB6,0x20,0xE3,0x26, 0x1B,0xEF,0x68,0x64, 0x99,0x0D,0xB6,0xCE,
+        0x98,0x06,0xF6,0x6B, 0x79,0x70,0xFD,0xFF, 0x86,0x17,0x18,0x7B, 0xB9,0xFF,0xFD,0xFF,
+        0x5A,0xE4,0xDF,0x3E, 0xDB,0xD5,0xD3,0x5E, 0x5B,0x4F,0x09,0x02, 0x0D,0xB0,0x3E,0xAB,
+        0x1E,0x03,0x1D,0xDA, 0x2F,0xBE,0x03,0xD1, 0x79,0x21,0x70,0xA0, 0xF3,0x00,0x9C,0xEE
+    };
+
+    byte_t    data[64];
+    aes_ctr_t ctx;
+
+    // One-shot
+
+    assert( aes_ctr_crypt(data, text, sizeof(text), key, sizeof(key), counter, 1) );
+    assert( 0 == memcmp(data, code, sizeof(code)) );
+
+    assert( aes_ctr_crypt(data, data, sizeof(data), key, sizeof(key), counter, 1) );
+    assert( 0 == memcmp(data, text, sizeof(text)) );
+
+    assert( !aes_ctr_crypt(data, text, sizeof(text), key, 8, counter, 1) );
+
+    // Streaming with irregular pieces
+
+    assert( aes_ctr_init(&ctx, key, sizeof(key), counter) );
+    aes_ctr_update(&ctx, data     , text     ,  5);
+    aes_ctr_update(&ctx, data +  5, text +  5, 20);
+    aes_ctr_update(&ctx, data + 25, text + 25,  0);
+    aes_ctr_update(&ctx, data + 25, text + 25, 39);
+    aes_ctr_final(&ctx);
+    assert( 0 == memcmp(data, code, sizeof(code)) );
+
+    // Random access
+
+    assert( aes_ctr_init(&ctx, key, sizeof(key), counter) );
+    aes_ctr_seek(&ctx, 37);
+    aes_ctr_update(&ctx, data, code + 37, 20);
+    aes_ctr_final(&ctx);
+    assert( 0 == memcmp(data, text + 37, 20) );
+}
+//------------------------------------------------------------------------------
+void aes_gcm_test(void)
+{
+    // Test cases 2, 4, and 6 from the GCM specification of McGrew and Viega.
+    static const byte_t key_zero[16] = {0};
+    static const byte_t iv_zero [12] = {0};
+    static const byte_t text_zero[16] = {0};
+    static const byte_t code_2[16] =
+    {
+        0x03,0x88,0xDA,0xCE, 0x60,0xB6,0xA3,0x92, 0xF3,0x28,0xC2,0xB9, 0x71,0xB2,0xFE,0x78
+    };
+    static const byte_t tag_2[16] =
+    {
+        0xAB,0x6E,0x47,0xD4, 0x2C,0xEC,0x13,0xBD, 0xF5,0x3A,0x67,0xB2, 0x12,0x57,0xBD,0xDF
+    };
+
+    static const byte_t key[16] =
+    {
+        0xFE,0xFF,0xE9,0x92, 0x86,0x65,0x73,0x1C, 0x6D,0x6A,0x8F,0x94, 0x67,0x30,0x83,0x08
+    };
+    static const byte_t iv_4[12] =
+    {
+        0xCA,0xFE,0xBA,0xBE, 0xFA,0xCE,0xDB,0xAD, 0xDE,0xCA,0xF8,0x88
+    };
+    static const byte_t iv_6[60] =
+    {
+        0x93,0x13,0x22,0x5D, 0xF8,0x84,0x06,0xE5, 0x55,0x90,0x9C,0x5A, 0xFF,0x52,0x69,0xAA,
+        0x6A,0x7A,0x95,0x38, 0x53,0x4F,0x7D,0xA1, 0xE4,0xC3,0x03,0xD2, 0xA3,0x18,0xA7,0x28,
+        0xC3,0xC0,0xC9,0x51, 0x56,0x80,0x95,0x39, 0xFC,0xF0,0xE2,0x42, 0x9A,0x6B,0x52,0x54,
+        0x16,0xAE,0xDB,0xF5, 0xA0,0xDE,0x6A,0x57, 0xA6,0x37,0xB3,0x9B
+    };
+    static const byte_t aad[20] =
+    {
+        0xFE,0xED,0xFA,0xCE, 0xDE,0xAD,0xBE,0xEF, 0xFE,0xED,0xFA,0xCE, 0xDE,0xAD,0xBE,0xEF,
+        0xAB,0xAD,0xDA,0xD2
+    };
+    static const byte_t text[60] =
+    {
+        0xD9,0x31,0x32,0x25, 0xF8,0x84,0x06,0xE5, 0xA5,0x59,0x09,0xC5, 0xAF,0xF5,0x26,0x9A,
+        0x86,0xA7,0xA9,0x53, 0x15,0x34,0xF7,0xDA, 0x2E,0x4C,0x30,0x3D, 0x8A,0x31,0x8A,0x72,
+        0x1C,0x3C,0x0C,0x95, 0x95,0x68,0x09,0x53, 0x2F,0xCF,0x0E,0x24, 0x49,0xA6,0xB5,0x25,
+        0xB1,0x6A,0xED,0xF5, 0xAA,0x0D,0xE6,0x57, 0xBA,0x63,0x7B,0x39
+    };
+    static const byte_t code_4[60] =
+    {
+        0x42,0x83,0x1E,0xC2, 0x21,0x77,0x74,0x24, 0x4B,0x72,0x21,0xB7, 0x84,0xD0,0xD4,0x9C,
+        0xE3,0xAA,0x21,0x2F, 0x2C,0x02,0xA4,0xE0, 0x35,0xC1,0x7E,0x23, 0x29,0xAC,0xA1,0x2E,
+        0x21,0xD5,0x14,0xB2, 0x54,0x66,0x93,0x1C, 0x7D,0x8F,0x6A,0x5A, 0xAC,0x84,0xAA,0x05,
+        0x1B,0xA3,0x0B,0x39, 0x6A,0x0A,0xAC,0x97, 0x3D,0x58,0xE0,0x91
+    };
+    static const byte_t tag_4[16] =
+    {
+        0x5B,0xC9,0x4F,0xBC, 0x32,0x21,0xA5,0xDB, 0x94,0xFA,0xE9,0x5A, 0xE7,0x12,0x1A,0x47
+    };
+    static const byte_t code_6[60] =
+    {
+        0x8C,0xE2,0x49,0x98, 0x62,0x56,0x15,0xB6, 0x03,0xA0,0x33,0xAC, 0xA1,0x3F,0xB8,0x94,
+        0xBE,0x91,0x12,0xA5, 0xC3,0xA2,0x11,0xA8, 0xBA,0x26,0x2A,0x3C, 0xCA,0x7E,0x2C,0xA7,
+        0x01,0xE4,0xA9,0xA4, 0xFB,0xA4,0x3C,0x90, 0xCC,0xDC,0xB2,0x81, 0xD4,0x8C,0x7C,0x6F,
+        0xD6,0x28,0x75,0xD2, 0xAC,0xA4,0x17,0x03, 0x4C,0x34,0xAE,0xE5
+    };
+    static const byte_t tag_6[16] =
+    {
+        0x61,0x9C,0xC5,0xAE, 0xFF,0xFE,0x0B,0xFA, 0x46,0x2A,0xF4,0x3C, 0x16,0x99,0xD0,0x50
+    };
+
+    static const unsigned masks[] = { 0, CPUFEAT_ALL };
+
+    byte_t    data[60];
+    byte_t    tag[AES_GCM_TAG_SIZE];
+    aes_gcm_t ctx;
+
+    for(size_t m=0; m<sizeof(masks)/sizeof(masks[0]); ++m)
+    {
+        cpufeat_set_mask(masks[m]);
+
+        // Case 2: no additional data.
+
+        assert( aes_gcm_encipher(data, tag, text_zero, sizeof(text_zero), NULL, 0, key_zero, sizeof(key_zero), iv_zero, sizeof(iv_zero), 1) );
+        assert( 0 == memcmp(data, code_2, sizeof(code_2)) );
+        assert( 0 == memcmp(tag , tag_2 , sizeof(tag_2)) );
+
+        // Case 4: 96 bits IV.
+
+        assert( aes_gcm_encipher(data, tag, text, sizeof(text), aad, sizeof(aad), key, sizeof(key), iv_4, sizeof(iv_4), 1) );
+        assert( 0 == memcmp(data, code_4, sizeof(code_4)) );
+        assert( 0 == memcmp(tag , tag_4 , sizeof(tag_4)) );
+
+        assert( aes_gcm_decipher(data, data, sizeof(data), tag_4, sizeof(tag_4), aad, sizeof(aad), key, sizeof(key), iv_4, sizeof(iv_4), 1) );
+        assert( 0 == memcmp(data, text, sizeof(text)) );
+
+        assert( aes_gcm_decipher(data, code_4, sizeof(code_4), tag_4, 12, aad, sizeof(aad), key, sizeof(key), iv_4, sizeof(iv_4), 1) );
+        assert( 0 == memcmp(data, text, sizeof(text)) );
+
+        // Case 6: long IV.
+
+        assert( aes_gcm_encipher(data, tag, text, sizeof(text), aad, sizeof(aad), key, sizeof(key), iv_6, sizeof(iv_6), 1) );
+        assert( 0 == memcmp(data, code_6, sizeof(code_6)) );
+        assert( 0 == memcmp(tag , tag_6 , sizeof(tag_6)) );
+
+        // Streaming with irregular pieces.
+
+        assert( aes_gcm_init(&ctx, key, sizeof(key), iv_4, sizeof(iv_4), true) );
+        aes_gcm_update_aad(&ctx, aad, 3);
+        aes_gcm_update_aad(&ctx, aad + 3, sizeof(aad) - 3);
+        aes_gcm_update(&ctx, data     , text     ,  7);
+        aes_gcm_update(&ctx, data +  7, text +  7, 33);
+        aes_gcm_update(&ctx, data + 40, text + 40, 20);
+        aes_gcm_final(&ctx, tag);
+        assert( 0 == memcmp(data, code_4, sizeof(code_4)) );
+        assert( 0 == memcmp(tag , tag_4 , sizeof(tag_4)) );
+
+        assert( aes_gcm_init(&ctx, key, sizeof(key), iv_4, sizeof(iv_4), false) );
+        aes_gcm_update_aad(&ctx, aad, sizeof(aad));
+        aes_gcm_update(&ctx, data     , data     , 17);
+        aes_gcm_update(&ctx, data + 17, data + 17, 43);
+        assert( aes_gcm_final_verify(&ctx, tag_4, sizeof(tag_4)) );
+        assert( 0 == memcmp(data, text, sizeof(text)) );
+
+        // Authentication failures.
+
+        memcpy(data, code_4, sizeof(code_4));
+        data[59] ^= 0x01;
+        assert( !aes_gcm_decipher(data, data, sizeof(data), tag_4, sizeof(tag_4), aad, sizeof(aad), key, sizeof(key), iv_4, sizeof(iv_4), 1) );
+        assert( data[0] == 0 && data[59] == 0 );
+
+        assert( !aes_gcm_decipher(data, code_4, sizeof(code_4), tag_4, sizeof(tag_4), aad, sizeof(aad) - 1, key, sizeof(key), iv_4, sizeof(iv_4), 1) );
+        assert( !aes_gcm_decipher(data, code_4, sizeof(code_4), tag_4, 3, aad, sizeof(aad), key, sizeof(key), iv_4, sizeof(iv_4), 1) );
+    }
+
+    cpufeat_set_mask(CPUFEAT_ALL);
+}
+//------------------------------------------------------------------------------
+void aes_ctr_parallel_test(void)
+{
+    /*
+     * The multi-threaded one-shot functions must have the same results as the streaming ones,
+     * the size is selected to have an incomplete segment and an incomplete block at the end.
+     */
+    static const byte_t key[32] =
+    {
+        0x60,0x3D,0xEB,0x10, 0x15,0xCA,0x71,0xBE, 0x2B,0x73,0xAE,0xF0, 0x85,0x7D,0x77,0x81,
+        0x1F,0x35,0x2C,0x07, 0x3B,0x61,0x08,0xD7, 0x2D,0x98,0x10,0xA3, 0x09,0x14,0xDF,0xF4
+    };
+    static const byte_t iv[16] =
+    {
+        0x00,0x01,0x02,0x03, 0x04,0x05,0x06,0x07, 0x08,0x09,0x0A,0x0B, 0xFF,0xFF,0xFF,0xF0
+    };
+    static const size_t size = 1000 * 1000 + 7;
+
+    byte_t *text = malloc(size);
+    byte_t *code = malloc(size);
+    byte_t *back = malloc(size);
+    assert( text && code && back );
+
+    byte_t    tag[AES_GCM_TAG_SIZE], tag_par[AES_GCM_TAG_SIZE];
+    aes_ctr_t ctr;
+    aes_gcm_t gcm;
+
+    for(size_t i=0; i<size; ++i)
+        text[i] = i * 7 + ( i >> 8 );
+
+    // CTR mode, the counter will carry over the lowest 32 bits.
+
+    assert( aes_ctr_init(&ctr, key, sizeof(key), iv) );
+    aes_ctr_update(&ctr, code, text, size);
+    aes_ctr_final(&ctr);
+
+    assert( aes_ctr_crypt(back, text, size, key, sizeof(key), iv, 4) );
+    assert( 0 == memcmp(back, code, size) );
+    assert( aes_ctr_crypt(back, back, size, key, sizeof(key), iv, 3) );
+    assert( 0 == memcmp(back, text, size) );
+
+    // GCM mode, with a long IV and some additional data.
+
+    assert( aes_gcm_init(&gcm, key, sizeof(key), iv, sizeof(iv), true) );
+    aes_gcm_update_aad(&gcm, iv, 5);
+    aes_gcm_update(&gcm, code, text, size);
+    aes_gcm_final(&gcm, tag);
+
+    cpufeat_set_mask(0);
+    assert( aes_gcm_encipher(back, tag_par, text, size, iv, 5, key, sizeof(key), iv, sizeof(iv), 4) );
+    assert( 0 == memcmp(back, code, size) );
+    assert( 0 == memcmp(tag_par, tag, sizeof(tag)) );
+
+    cpufeat_set_mask(CPUFEAT_ALL);
+    assert( aes_gcm_encipher(back, tag_par, text, size, iv, 5, key, sizeof(key), iv, sizeof(iv), 4) );
+    assert( 0 == memcmp(back, code, size) );
+    assert( 0 == memcmp(tag_par, tag, sizeof(tag)) );
+
+    assert( aes_gcm_decipher(back, back, size, tag, sizeof(tag), iv, 5, key, sizeof(key), iv, sizeof(iv), 3) );
+    assert( 0 == memcmp(back, text, size) );
+
+    free(back);
+    free(code);
+    free(text);
+}
+//------------------------------------------------------------------------------
 //---- DES Test Functions ------------------------------------------------------
 //------------------------------------------------------------------------------
 void des_bit_test(void)
@@ -440,6 +843,45 @@ void des_multiblock_cipher_test(void)
     assert( 0 == memcmp(data, source, sizeof(source)) );
 }
 //------------------------------------------------------------------------------
+void des_prepared_cipher_test(void)
+{
+    /*
+     * The prepared round keys must give the same results as the block functions,
+     * and the double key mode must be the same as the three keys K1, K2, K1.
+     */
+    static const byte_t key[24] = { 0x13, 0x34, 0x57, 0x79, 0x9B, 0xBC, 0xDF, 0xF1,
+                                    0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF,
+                                    0x13, 0x34, 0x57, 0x79, 0x9B, 0xBC, 0xDF, 0xF1 };
+    static const byte_t iv [ 8] = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88 };
+
+    byte_t     text[64], data[64], code[64];
+    tdea_ctx_t ctx;
+    size_t     i;
+
+    for(i=0; i<sizeof(text); ++i)
+        text[i] = i * 37 + 11;
+
+    memcpy(code, text, sizeof(text));
+    for(i=0; i<sizeof(code); i+=8)
+        tdea_block_encipher(code + i, key);
+
+    tdea_prepare(&ctx, key, 16);
+    memcpy(data, text, sizeof(text));
+    tdea_blocks_encipher(&ctx, data, sizeof(data)/8);
+    assert( 0 == memcmp(data, code, sizeof(code)) );
+    tdea_blocks_decipher(&ctx, data, sizeof(data)/8);
+    assert( 0 == memcmp(data, text, sizeof(text)) );
+
+    assert( sizeof(code) == tdea_ecb_encipher(data, text, sizeof(text), key, 16) );
+    assert( 0 == memcmp(data, code, sizeof(code)) );
+
+    assert( sizeof(code) == tdea_cbc_encipher(code, text, sizeof(text), key, 24, iv) );
+    assert( sizeof(data) == tdea_cbc_encipher(data, text, sizeof(text), key, 16, iv) );
+    assert( 0 == memcmp(data, code, sizeof(code)) );
+    assert( sizeof(data) == tdea_cbc_decipher(data, data, sizeof(data), key, 16, iv) );
+    assert( 0 == memcmp(data, text, sizeof(text)) );
+}
+//------------------------------------------------------------------------------
 //---- Main Test Function ------------------------------------------------------
 //------------------------------------------------------------------------------
 int main(int argc, char *argv[])
@@ -448,6 +890,11 @@ int main(int argc, char *argv[])
     aes_private_debug_test();
     aes_state_cipher_test();
     aes_multiblock_cipher_test();
+    aes_mode_vector_test();
+    aes_accel_test();
+    aes_ctr_test();
+    aes_gcm_test();
+    aes_ctr_parallel_test();
 
     des_bit_test();
     des_key_expansion_test();
@@ -455,6 +902,7 @@ int main(int argc, char *argv[])
     des_block_cipher_test();
     des_iv_test();
     des_multiblock_cipher_test();
+    des_prepared_cipher_test();
 
     return 0;
 }
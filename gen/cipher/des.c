@@ -1,71 +1,106 @@
 #include <assert.h>
 #include <string.h>
-#include "./des_bit.h"
 #include "./des_table.h"
 #include "./des.h"
 
 //------------------------------------------------------------------------------
-typedef union des_key_permuted_t
+static
+uint64_t bits_permute(uint64_t src, unsigned srcbits, const int table[], unsigned count)
 {
-    sbit_t bits[56];
+    /*
+     * Permute bits by a table of the DES specification,
+     * bits are numbered from the most significant bit of the source value.
+     */
+    uint64_t dest = 0;
+    unsigned i;
 
-    struct des_key_permuted_part_t
-    {
-        sbit_t c[28];
-        sbit_t d[28];
-    } part;
+    for(i=0; i<count; ++i)
+        dest = ( dest << 1 ) | ( ( src >> ( srcbits - 1 - table[i] ) ) & 1 );
 
-} des_key_permuted_t;
+    return dest;
+}
 //------------------------------------------------------------------------------
-static
-void mainkey_separate(sbit_t bits[64], const byte_t key[8])
+INLINE
+uint32_t load_be32(const byte_t *src)
 {
-    unsigned i;
-    for(i=0; i<8; ++i)
-        sbit_separate(&bits[i<<3], key[i]);
+    return ( (uint32_t) src[0] << 24 ) | ( (uint32_t) src[1] << 16 ) | ( (uint32_t) src[2] << 8 ) | src[3];
 }
 //------------------------------------------------------------------------------
-static
-void subkey_separate(sbit_t bits[48], const des_subkey_t *subkey)
+INLINE
+void store_be32(byte_t *dest, uint32_t val)
 {
-    unsigned i;
-    for(i=0; i<6; ++i)
-        sbit_separate(&bits[i<<3], subkey->data[i]);
+    dest[0] = val >> 24;
+    dest[1] = val >> 16;
+    dest[2] = val >>  8;
+    dest[3] = val;
 }
 //------------------------------------------------------------------------------
-static
-void subkey_combine(des_subkey_t *subkey, const sbit_t bits[48])
+INLINE
+uint32_t rotl32(uint32_t val, unsigned n)
 {
-    unsigned i;
-    for(i=0; i<6; ++i)
-        subkey->data[i] = sbit_combine(&bits[i<<3]);
+    return ( val << n ) | ( val >> ( 32 - n ) );
+}
+//------------------------------------------------------------------------------
+INLINE
+uint32_t rotr32(uint32_t val, unsigned n)
+{
+    return ( val >> n ) | ( val << ( 32 - n ) );
 }
 //------------------------------------------------------------------------------
 void des_key_expand(des_subkey_t /*out*/ subkeys[16], const byte_t /*in*/ mainkey[8])
 {
+    uint64_t key = ( (uint64_t) load_be32(mainkey) << 32 ) | load_be32(mainkey + 4);
+    uint64_t cd  = bits_permute(key, 64, des_table_pc_1, 56);
+    uint32_t c   = cd >> 28;
+    uint32_t d   = cd & 0x0FFFFFFF;
+    unsigned i, j;
+
+    for(i=0; i<16; ++i)
+    {
+        unsigned n = des_table_shift_left[i];
+        c = ( ( c << n ) | ( c >> ( 28 - n ) ) ) & 0x0FFFFFFF;
+        d = ( ( d << n ) | ( d >> ( 28 - n ) ) ) & 0x0FFFFFFF;
 
-    sbit_t             mkey_bits  [64];
-    sbit_t             subkey_bits[48];
-    des_key_permuted_t permuted;
-    unsigned           i;
+        uint64_t k = bits_permute(( (uint64_t) c << 28 ) | d, 56, des_table_pc_2, 48);
+        for(j=0; j<6; ++j)
+            subkeys[i].data[j] = k >> ( 40 - 8*j );
+    }
 
-    mainkey_separate(mkey_bits, mainkey);
+    // Erase key data
+    key = cd = c = d = 0;
+}
+//------------------------------------------------------------------------------
+static
+void roundkeys_make(uint32_t roundkeys[32], const byte_t mainkey[8], bool reverse)
+{
+    /*
+     * Convert the subkeys to the form of the 32 bits routine:
+     * six bits groups 1, 3, 5, 7 are in the bytes of the first word,
+     * and groups 2, 4, 6, 8 are in the bytes of the second word,
+     * to be combined with the rotated half block directly.
+     */
+    des_subkey_t subkeys[16];
+    unsigned     i, j;
 
-    sbit_permute(permuted.bits, 56, mkey_bits, des_table_pc_1);
+    des_key_expand(subkeys, mainkey);
 
     for(i=0; i<16; ++i)
     {
-        sbit_shift_left_n(permuted.part.c, 28, des_table_shift_left[i]);
-        sbit_shift_left_n(permuted.part.d, 28, des_table_shift_left[i]);
+        const byte_t *k = subkeys[ reverse ? 15 - i : i ].data;
+        uint64_t      v = 0;
+        byte_t        g[8];
 
-        sbit_permute(subkey_bits, 48, permuted.bits, des_table_pc_2);
-        subkey_combine(&subkeys[i], subkey_bits);
+        for(j=0; j<6; ++j)
+            v = ( v << 8 ) | k[j];
+        for(j=0; j<8; ++j)
+            g[j] = ( v >> ( 42 - 6*j ) ) & 0x3F;
+
+        roundkeys[2*i  ] = ( (uint32_t) g[0] << 24 ) | ( (uint32_t) g[2] << 16 ) | ( (uint32_t) g[4] << 8 ) | g[6];
+        roundkeys[2*i+1] = ( (uint32_t) g[1] << 24 ) | ( (uint32_t) g[3] << 16 ) | ( (uint32_t) g[5] << 8 ) | g[7];
     }
 
     // Erase key data
-    memset(mkey_bits  , 0, sizeof(mkey_bits)  );
-    memset(subkey_bits, 0, sizeof(subkey_bits));
-    memset(&permuted  , 0, sizeof(permuted)   );
+    memset(subkeys, 0, sizeof(subkeys));
 }
 //------------------------------------------------------------------------------
 void tdea_key_expand(byte_t /*out*/ keys[3*8], const byte_t /*in*/ *mainkey, size_t /*in*/ mainkey_size)
@@ -101,194 +136,266 @@ void tdea_key_expand(byte_t /*out*/ keys[3*8], const byte_t /*in*/ *mainkey, siz
 //------------------------------------------------------------------------------
 //---- Private Cipher Routines -------------------------------------------------
 //------------------------------------------------------------------------------
-typedef union des_f48_t
+/*
+ * The half blocks are kept rotated left by one bit during the rounds,
+ * so that the expansion E becomes two words with four six bits groups in each of them,
+ * and the S-boxes and the permutation P are combined into the SP tables.
+ */
+//------------------------------------------------------------------------------
+INLINE
+uint32_t func_f(uint32_t r, const uint32_t key[2])
 {
-    sbit_t bits[48];
-    sbit_t s[8][6];
-} des_f48_t;
-typedef union des_f32_t
+    // The f function with the rotated half block, and the result is rotated too.
+    uint32_t a = rotr32(r, 4) ^ key[0];
+    uint32_t b = r            ^ key[1];
+
+    return des_table_sp[0][ ( a >> 24 ) & 0x3F ] ^
+           des_table_sp[2][ ( a >> 16 ) & 0x3F ] ^
+           des_table_sp[4][ ( a >>  8 ) & 0x3F ] ^
+           des_table_sp[6][   a         & 0x3F ] ^
+           des_table_sp[1][ ( b >> 24 ) & 0x3F ] ^
+           des_table_sp[3][ ( b >> 16 ) & 0x3F ] ^
+           des_table_sp[5][ ( b >>  8 ) & 0x3F ] ^
+           des_table_sp[7][   b         & 0x3F ];
+}
+//------------------------------------------------------------------------------
+INLINE
+void perm_initial(uint32_t *l, uint32_t *r)
 {
-    sbit_t bits[32];
-    sbit_t s[8][4];
-} des_f32_t;
+    // The initial permutation IP by bit swaps, and rotate the halves.
+    uint32_t work;
+
+    work = ( ( *l >>  4 ) ^ *r ) & 0x0F0F0F0F;  *r ^= work;  *l ^= work <<  4;
+    work = ( ( *l >> 16 ) ^ *r ) & 0x0000FFFF;  *r ^= work;  *l ^= work << 16;
+    work = ( ( *r >>  2 ) ^ *l ) & 0x33333333;  *l ^= work;  *r ^= work <<  2;
+    work = ( ( *r >>  8 ) ^ *l ) & 0x00FF00FF;  *l ^= work;  *r ^= work <<  8;
+    *r   = rotl32(*r, 1);
+    work = ( *l ^ *r ) & 0xAAAAAAAA;            *l ^= work;  *r ^= work;
+    *l   = rotl32(*l, 1);
+}
 //------------------------------------------------------------------------------
-static
-void func_s(sbit_t dest[4], const sbit_t src[6], unsigned sind)
+INLINE
+void perm_final(uint32_t *l, uint32_t *r)
 {
-    unsigned row, col, val;
+    // Rotate the halves back, and the final permutation IP^-1 by bit swaps.
+    uint32_t work;
+
+    *l   = rotr32(*l, 1);
+    work = ( *l ^ *r ) & 0xAAAAAAAA;            *l ^= work;  *r ^= work;
+    *r   = rotr32(*r, 1);
+    work = ( ( *r >>  8 ) ^ *l ) & 0x00FF00FF;  *l ^= work;  *r ^= work <<  8;
+    work = ( ( *r >>  2 ) ^ *l ) & 0x33333333;  *l ^= work;  *r ^= work <<  2;
+    work = ( ( *l >> 16 ) ^ *r ) & 0x0000FFFF;  *r ^= work;  *l ^= work << 16;
+    work = ( ( *l >>  4 ) ^ *r ) & 0x0F0F0F0F;  *r ^= work;  *l ^= work <<  4;
+}
+//------------------------------------------------------------------------------
+INLINE
+void cipher_rounds(uint32_t *l, uint32_t *r, const uint32_t roundkeys[32])
+{
+    /*
+     * The sixteen rounds, and the halves are swapped at the end,
+     * so that the output can be the input of another DES directly,
+     * as the final permutation and the initial permutation between them cancel each other.
+     */
+    uint32_t left = *l, right = *r;
+    unsigned i;
+
+    for(i=0; i<16; i+=2)
+    {
+        left  ^= func_f(right, &roundkeys[2*i  ]);
+        right ^= func_f(left , &roundkeys[2*i+2]);
+    }
 
-    row     = ( src[0] <<1 ) | src[5];
-    col     = ( src[1] <<3 ) | ( src[2] << 2 ) | ( src[3] << 1 ) | src[4];
-    val     = des_table_s[sind][row][col];
-    dest[0] = ( val >> 3 ) & 0x01;
-    dest[1] = ( val >> 2 ) & 0x01;
-    dest[2] = ( val >> 1 ) & 0x01;
-    dest[3] =   val        & 0x01;
+    *l = right;
+    *r = left;
 }
 //------------------------------------------------------------------------------
+#ifdef DES_DEBUG_TEST
 static
-void func_f(sbit_t /*in,out*/ data[32], const sbit_t /*in*/ subkey[48])
+void func_sp_test(void)
 {
-    des_f32_t unit32;
-    des_f48_t unit48;
-    unsigned  i;
+    // Check the SP tables with the S-boxes and the permutation P of the specification.
+    unsigned i, v;
 
-    memcpy(unit32.bits, data, sizeof(unit32.bits));
-    sbit_permute(unit48.bits, 48, unit32.bits, des_table_e);
-    sbit_xor(unit48.bits, unit48.bits, subkey, 48);
     for(i=0; i<8; ++i)
-        func_s(unit32.s[i], unit48.s[i], i);
-    sbit_permute(data, 32, unit32.bits, des_table_p);
+    for(v=0; v<64; ++v)
+    {
+        unsigned row = ( ( v >> 4 ) & 0x02 ) | ( v & 0x01 );
+        unsigned col = ( v >> 1 ) & 0x0F;
+        uint32_t val = (uint32_t) des_table_s[i][row][col] << ( 28 - 4*i );
+
+        val = bits_permute(val, 32, des_table_p, 32);
+        assert( des_table_sp[i][v] == rotl32(val, 1) );
+    }
 }
 //------------------------------------------------------------------------------
-#ifdef DES_DEBUG_TEST
 static
-void func_s_test(void)
-{
-    static const sbit_t bits_in1 [6] = { 0,1,1,0,0,0 };
-    static const sbit_t bits_in2 [6] = { 0,1,0,0,0,1 };
-    static const sbit_t bits_in3 [6] = { 0,1,1,1,1,0 };
-    static const sbit_t bits_in4 [6] = { 1,1,1,0,1,0 };
-    static const sbit_t bits_in5 [6] = { 1,0,0,0,0,1 };
-    static const sbit_t bits_in6 [6] = { 1,0,0,1,1,0 };
-    static const sbit_t bits_in7 [6] = { 0,1,0,1,0,0 };
-    static const sbit_t bits_in8 [6] = { 1,0,0,1,1,1 };
-    static const sbit_t bits_out1[4] = { 0,1,0,1 };
-    static const sbit_t bits_out2[4] = { 1,1,0,0 };
-    static const sbit_t bits_out3[4] = { 1,0,0,0 };
-    static const sbit_t bits_out4[4] = { 0,0,1,0 };
-    static const sbit_t bits_out5[4] = { 1,0,1,1 };
-    static const sbit_t bits_out6[4] = { 0,1,0,1 };
-    static const sbit_t bits_out7[4] = { 1,0,0,1 };
-    static const sbit_t bits_out8[4] = { 0,1,1,1 };
-
-    sbit_t bits[4];
-
-    func_s(bits, bits_in1, 1-1);  assert( 0 == memcmp(bits, bits_out1, 4*sizeof(sbit_t)) );
-    func_s(bits, bits_in2, 2-1);  assert( 0 == memcmp(bits, bits_out2, 4*sizeof(sbit_t)) );
-    func_s(bits, bits_in3, 3-1);  assert( 0 == memcmp(bits, bits_out3, 4*sizeof(sbit_t)) );
-    func_s(bits, bits_in4, 4-1);  assert( 0 == memcmp(bits, bits_out4, 4*sizeof(sbit_t)) );
-    func_s(bits, bits_in5, 5-1);  assert( 0 == memcmp(bits, bits_out5, 4*sizeof(sbit_t)) );
-    func_s(bits, bits_in6, 6-1);  assert( 0 == memcmp(bits, bits_out6, 4*sizeof(sbit_t)) );
-    func_s(bits, bits_in7, 7-1);  assert( 0 == memcmp(bits, bits_out7, 4*sizeof(sbit_t)) );
-    func_s(bits, bits_in8, 8-1);  assert( 0 == memcmp(bits, bits_out8, 4*sizeof(sbit_t)) );
+void func_f_test(void)
+{
+    // The first round of the example in the specification.
+    static const byte_t   key[8]   = { 0x13, 0x34, 0x57, 0x79, 0x9B, 0xBC, 0xDF, 0xF1 };
+    static const byte_t   k1[6]    = { 0x1B, 0x02, 0xEF, 0xFC, 0x70, 0x72 };
+    static const uint32_t data_in  = 0xF0AAF0AA;
+    static const uint32_t data_out = 0x234AA9BB;
+
+    des_subkey_t subkeys[16];
+    uint32_t     roundkeys[32];
+
+    des_key_expand(subkeys, key);
+    assert( 0 == memcmp(subkeys[0].data, k1, sizeof(k1)) );
+
+    roundkeys_make(roundkeys, key, false);
+    assert( data_out == rotr32(func_f(rotl32(data_in, 1), roundkeys), 1) );
 }
 //------------------------------------------------------------------------------
 static
-void func_f_test(void)
+void perm_test(void)
 {
-    static const sbit_t k1[48] =
-    {
-        0,0,0,1,1,0,
-        1,1,0,0,0,0,
-        0,0,1,0,1,1,
-        1,0,1,1,1,1,
-        1,1,1,1,1,1,
-        0,0,0,1,1,1,
-        0,0,0,0,0,1,
-        1,1,0,0,1,0,
-    };
-
-    static const sbit_t data_in[32] =
-    {
-        1,1,1,1,0,0,0,0,
-        1,0,1,0,1,0,1,0,
-        1,1,1,1,0,0,0,0,
-        1,0,1,0,1,0,1,0
-    };
+    // Check the bit swaps version permutations with the tables of the specification.
+    uint64_t x = 0x0123456789ABCDEFULL;
+    unsigned n;
 
-    static const sbit_t data_out[32] =
+    for(n=0; n<64; ++n)
     {
-        0,0,1,0,0,0,1,1,
-        0,1,0,0,1,0,1,0,
-        1,0,1,0,1,0,0,1,
-        1,0,1,1,1,0,1,1
-    };
+        uint32_t l = x >> 32, r = x;
+        uint64_t ip;
 
-    sbit_t data[32];
+        perm_initial(&l, &r);
+        ip = bits_permute(x, 64, des_table_ip, 64);
+        assert( rotr32(l, 1) == (uint32_t)( ip >> 32 ) );
+        assert( rotr32(r, 1) == (uint32_t)  ip         );
 
-    memcpy(data, data_in, sizeof(data_in));
-    func_f(data, k1);
-    assert( 0 == memcmp(data, data_out, sizeof(data_out)) );
+        perm_final(&l, &r);
+        assert( l == (uint32_t)( x >> 32 ) && r == (uint32_t) x );
+        assert( bits_permute(ip, 64, des_table_iip, 64) == x );
+
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
 }
 //------------------------------------------------------------------------------
 void des_private_debug_test(void)
 {
-    func_s_test();
+    func_sp_test();
     func_f_test();
+    perm_test();
 }
 #endif
 //------------------------------------------------------------------------------
 //---- Block Unit Cipher Routine -----------------------------------------------
 //------------------------------------------------------------------------------
-typedef union des_permuted_t
+void des_block_cipher(byte_t /*in,out*/ block[8], const byte_t /*in*/ key[8], bool /*in*/ reverse_subkeys)
 {
-    sbit_t bits[64];
+    uint32_t roundkeys[32];
+    uint32_t l = load_be32(block);
+    uint32_t r = load_be32(block + 4);
 
-    struct des_permuted_part_t
-    {
-        sbit_t l[32];
-        sbit_t r[32];
-    } part;
+    roundkeys_make(roundkeys, key, reverse_subkeys);
+
+    perm_initial(&l, &r);
+    cipher_rounds(&l, &r, roundkeys);
+    perm_final(&l, &r);
+
+    store_be32(block    , l);
+    store_be32(block + 4, r);
 
-} des_permuted_t;
+    // Erase key data
+    memset(roundkeys, 0, sizeof(roundkeys));
+}
 //------------------------------------------------------------------------------
-static
-void cipher_step(des_permuted_t /*in,out*/ *block, const sbit_t /*in*/ subkey[48])
+void tdea_prepare(tdea_ctx_t /*out*/ *ctx, const void /*in*/ *key, size_t /*in*/ keysz)
 {
-    sbit_t temp[32];
+    /**
+     * 預先計算 Triple-DES 的回合密鑰
+     * @ctx   : 傳回回合密鑰，使用完畢後應以 memset 清除。
+     * @key   : 密鑰資料。
+     * @keysz : 密鑰長度，請參閱 tdea_key_expand 的說明。
+     */
+    byte_t keys[3*8];
+
+    assert( ctx && key );
 
-    // Backup part R
-    memcpy(temp, block->part.r, 32*sizeof(sbit_t));
+    tdea_key_expand(keys, key, keysz);
 
-    // Calculate the new part R
-    func_f  (block->part.r, subkey);
-    sbit_xor(block->part.r, block->part.r, block->part.l, 32);
+    // Encipher: E(K1), D(K2), E(K3)
+    roundkeys_make(ctx->enkeys[0], keys +  0, false);
+    roundkeys_make(ctx->enkeys[1], keys +  8, true );
+    roundkeys_make(ctx->enkeys[2], keys + 16, false);
+    // Decipher: D(K3), E(K2), D(K1)
+    roundkeys_make(ctx->dekeys[0], keys + 16, true );
+    roundkeys_make(ctx->dekeys[1], keys +  8, false);
+    roundkeys_make(ctx->dekeys[2], keys +  0, true );
 
-    // The new part L is the old part R
-    memcpy(block->part.l, temp, 32*sizeof(sbit_t));
+    // Erase key data
+    memset(keys, 0, sizeof(keys));
 }
 //------------------------------------------------------------------------------
 static
-void swap_block_parts(des_permuted_t /*in,out*/ *block)
+void tdea_blocks_process(const uint32_t roundkeys[3][32], byte_t *blocks, size_t count)
 {
-    sbit_t temp[32];
+    for(; count; --count, blocks += 8)
+    {
+        uint32_t l = load_be32(blocks);
+        uint32_t r = load_be32(blocks + 4);
+
+        perm_initial(&l, &r);
+        cipher_rounds(&l, &r, roundkeys[0]);
+        cipher_rounds(&l, &r, roundkeys[1]);
+        cipher_rounds(&l, &r, roundkeys[2]);
+        perm_final(&l, &r);
 
-    memcpy(temp         , block->part.l, 32*sizeof(sbit_t));
-    memcpy(block->part.l, block->part.r, 32*sizeof(sbit_t));
-    memcpy(block->part.r, temp         , 32*sizeof(sbit_t));
+        store_be32(blocks    , l);
+        store_be32(blocks + 4, r);
+    }
 }
 //------------------------------------------------------------------------------
-void des_block_cipher(byte_t /*in,out*/ block[8], const byte_t /*in*/ key[8], bool /*in*/ reverse_subkeys)
+void tdea_blocks_encipher(const tdea_ctx_t /*in*/     *ctx,
+                          void             /*in,out*/ *blocks,
+                          size_t           /*in*/      count)
 {
-    des_subkey_t   subkeys    [16];
-    sbit_t         subkey_bits[48];
-    sbit_t         block_bits [64];
-    des_permuted_t permuted;
-    unsigned       i;
-
-    des_key_expand(subkeys, key);
-
-    for(i=0; i<8; ++i) sbit_separate(&block_bits[i<<3], block[i]);
-
-    sbit_permute(permuted.bits, 64, block_bits, des_table_ip);
-
-    for(i=0; i<16; ++i)
-    {
-        unsigned keyindex = ( reverse_subkeys )?( 16 - 1 - i ):( i );
+    /**
+     * 以預先計算的回合密鑰加密多個區塊(各區塊獨立運算)
+     * @ctx    : 由 tdea_prepare 計算的回合密鑰。
+     * @blocks : 輸入欲加密的資料，並傳回加密後的資料。
+     * @count  : 區塊數量。
+     */
+    assert( ctx && ( blocks || !count ) );
+    tdea_blocks_process(ctx->enkeys, blocks, count);
+}
+//------------------------------------------------------------------------------
+void tdea_blocks_decipher(const tdea_ctx_t /*in*/     *ctx,
+                          void             /*in,out*/ *blocks,
+                          size_t           /*in*/      count)
+{
+    /**
+     * 以預先計算的回合密鑰解密多個區塊(各區塊獨立運算)
+     * @ctx    : 由 tdea_prepare 計算的回合密鑰。
+     * @blocks : 輸入欲解密的資料，並傳回解密後的資料。
+     * @count  : 區塊數量。
+     */
+    assert( ctx && ( blocks || !count ) );
+    tdea_blocks_process(ctx->dekeys, blocks, count);
+}
+//------------------------------------------------------------------------------
+void tdea_block_encipher(byte_t /*in,out*/ block[8], const byte_t /*in*/ key[24])
+{
+    tdea_ctx_t ctx;
 
-        subkey_separate(subkey_bits, &subkeys[keyindex]);
-        cipher_step(&permuted, subkey_bits);
-    }
-    swap_block_parts(&permuted);
+    tdea_prepare(&ctx, key, 24);
+    tdea_blocks_encipher(&ctx, block, 1);
 
-    sbit_permute(block_bits, 64, permuted.bits, des_table_iip);
+    // Erase key data
+    memset(&ctx, 0, sizeof(ctx));
+}
+//------------------------------------------------------------------------------
+void tdea_block_decipher(byte_t /*in,out*/ block[8], const byte_t /*in*/ key[24])
+{
+    tdea_ctx_t ctx;
 
-    for(i=0; i<8; ++i) block[i] = sbit_combine(&block_bits[i<<3]);
+    tdea_prepare(&ctx, key, 24);
+    tdea_blocks_decipher(&ctx, block, 1);
 
     // Erase key data
-    memset(subkeys    , 0, sizeof(subkeys)    );
-    memset(subkey_bits, 0, sizeof(subkey_bits));
+    memset(&ctx, 0, sizeof(ctx));
 }
 //------------------------------------------------------------------------------
 //---- Multi Block Cipher ------------------------------------------------------
@@ -319,7 +426,7 @@ size_t tdea_ecb_encipher(void       /*out*//*opt*/ *out,
     size_t       outsz    = get_encipher_buffer_size(insz);
     des_block_t *block    = out;
     size_t       blockcnt = outsz/sizeof(des_block_t);
-    byte_t       tdeakey[24];
+    tdea_ctx_t   ctx;
 
     assert( outsz >= insz );
     if( !in  || !insz  ) return 0;
@@ -330,17 +437,11 @@ size_t tdea_ecb_encipher(void       /*out*//*opt*/ *out,
     memcpy(out, in, insz);
     memset(out+insz, 0, outsz-insz);
 
-    tdea_key_expand(tdeakey, key, keysz);
-    while( blockcnt )
-    {
-        tdea_block_encipher(block->data, tdeakey);
-
-        ++block;
-        --blockcnt;
-    }
+    tdea_prepare(&ctx, key, keysz);
+    tdea_blocks_encipher(&ctx, block, blockcnt);
 
     // Erase key data
-    memset(tdeakey, 0, sizeof(tdeakey));
+    memset(&ctx, 0, sizeof(ctx));
 
     return outsz;
 }
@@ -354,7 +455,7 @@ size_t tdea_ecb_decipher(void       /*out*//*opt*/ *out,
     size_t       outsz    = get_decipher_buffer_size(insz);
     des_block_t *block    = out;
     size_t       blockcnt = outsz/sizeof(des_block_t);
-    byte_t       tdeakey[24];
+    tdea_ctx_t   ctx;
 
     assert( outsz <= insz );
     if( !in  || !insz  ) return 0;
@@ -364,17 +465,11 @@ size_t tdea_ecb_decipher(void       /*out*//*opt*/ *out,
 
     memcpy(out, in, outsz);
 
-    tdea_key_expand(tdeakey, key, keysz);
-    while( blockcnt )
-    {
-        tdea_block_decipher(block->data, tdeakey);
-
-        ++block;
-        --blockcnt;
-    }
+    tdea_prepare(&ctx, key, keysz);
+    tdea_blocks_decipher(&ctx, block, blockcnt);
 
     // Erase key data
-    memset(tdeakey, 0, sizeof(tdeakey));
+    memset(&ctx, 0, sizeof(ctx));
 
     return outsz;
 }
@@ -442,7 +537,7 @@ size_t tdea_cbc_encipher(void         /*out*//*opt*/ *out,
                          size_t       /*in*/          keysz,
                          const byte_t /*in*//*opt*/   _iv[8])
 {
-    byte_t       tdeakey[24];
+    tdea_ctx_t   ctx;
     des_block_t  iv;
     size_t       outsz    = get_encipher_buffer_size(insz);
     size_t       blockcnt = outsz >> 3;
@@ -454,7 +549,7 @@ size_t tdea_cbc_encipher(void         /*out*//*opt*/ *out,
     if( !blockcnt ) return 0;
 
     // Expand key
-    tdea_key_expand(tdeakey, key, keysz);
+    tdea_prepare(&ctx, key, keysz);
     // Select IV
     if( _iv ) memcpy(&iv, _iv, sizeof(des_block_t));
     else      tdea_cbc_get_initvec(iv.data, in, insz);
@@ -463,14 +558,14 @@ size_t tdea_cbc_encipher(void         /*out*//*opt*/ *out,
     memset(out+insz, 0, outsz-insz);
     // Encipher block by block
     des_block_xor(&block[0], &block[0], &iv);
-    tdea_block_encipher(block[0].data, key);
+    tdea_blocks_encipher(&ctx, &block[0], 1);
     for(i=1; i<blockcnt; ++i)
     {
         des_block_xor(&block[i], &block[i], &block[i-1]);
-        tdea_block_encipher(block[i].data, tdeakey);
+        tdea_blocks_encipher(&ctx, &block[i], 1);
     }
     // Erase key data
-    memset(tdeakey, 0, sizeof(tdeakey));
+    memset(&ctx, 0, sizeof(ctx));
 
     return outsz;
 }
@@ -482,7 +577,7 @@ size_t tdea_cbc_decipher(void         /*out*//*opt*/ *out,
                          size_t       /*in*/          keysz,
                          const byte_t /*in*//*opt*/   _iv[8])
 {
-    byte_t       tdeakey[24];
+    tdea_ctx_t   ctx;
     des_block_t  iv;
     size_t       outsz    = get_decipher_buffer_size(insz);
     size_t       blockcnt = outsz >> 3;
@@ -494,23 +589,23 @@ size_t tdea_cbc_decipher(void         /*out*//*opt*/ *out,
     if( !blockcnt ) return 0;
 
     // Expand key
-    tdea_key_expand(tdeakey, key, keysz);
+    tdea_prepare(&ctx, key, keysz);
     // Copy data to out buffer
     memcpy(out, in, outsz);
     // Decipher block by block, exclude the first block.
     for(i=blockcnt-1; i>0; --i)
     {
-        tdea_block_decipher(block[i].data, tdeakey);
+        tdea_blocks_decipher(&ctx, &block[i], 1);
         des_block_xor(&block[i], &block[i], &block[i-1]);
     }
     // Select IV
     if( _iv ) memcpy(&iv, _iv, sizeof(des_block_t));
     else      tdea_cbc_get_initvec(iv.data, out, outsz);
     // Decipher the first block
-    tdea_block_decipher(block[0].data, tdeakey);
+    tdea_blocks_decipher(&ctx, &block[0], 1);
     des_block_xor(&block[0], &block[0], &iv);
     // Erase key data
-    memset(tdeakey, 0, sizeof(tdeakey));
+    memset(&ctx, 0, sizeof(ctx));
 
     return outsz;
 }
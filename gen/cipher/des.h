@@ -36,19 +36,25 @@ INLINE void des_block_decipher(byte_t /*in,out*/ block[8], const byte_t /*in*/ k
 
 // Triple-DES (TDEA) Block Cipher
 
-INLINE void tdea_block_encipher(byte_t /*in,out*/ block[8], const byte_t /*in*/ key[24])
-{
-    des_block_encipher(block, key +  0);
-    des_block_decipher(block, key +  8);
-    des_block_encipher(block, key + 16);
-}
+void tdea_block_encipher(byte_t /*in,out*/ block[8], const byte_t /*in*/ key[24]);
+void tdea_block_decipher(byte_t /*in,out*/ block[8], const byte_t /*in*/ key[24]);
+
+// Triple-DES (TDEA) with precomputed round keys
 
-INLINE void tdea_block_decipher(byte_t /*in,out*/ block[8], const byte_t /*in*/ key[24])
+typedef struct tdea_ctx_t
 {
-    des_block_decipher(block, key + 16);
-    des_block_encipher(block, key +  8);
-    des_block_decipher(block, key +  0);
-}
+    uint32_t enkeys[3][32];  // Round keys of the three DES in the order of enciphering.
+    uint32_t dekeys[3][32];  // Round keys of the three DES in the order of deciphering.
+} tdea_ctx_t;
+
+void tdea_prepare(tdea_ctx_t /*out*/ *ctx, const void /*in*/ *key, size_t /*in*/ keysz);
+
+void tdea_blocks_encipher(const tdea_ctx_t /*in*/     *ctx,
+                          void             /*in,out*/ *blocks,
+                          size_t           /*in*/      count);
+void tdea_blocks_decipher(const tdea_ctx_t /*in*/     *ctx,
+                          void             /*in,out*/ *blocks,
+                          size_t           /*in*/      count);
 
 /**
  * DES 任意長度資料加解密參數共同說明
@@ -0,0 +1,124 @@
+#include "ghash_ni.h"
+
+#ifdef GHASH_NI_AVAILABLE
+
+#include <immintrin.h>
+
+/*
+ * The field elements are byte reversed to be loaded into registers,
+ * so that the bits in the registers are in the reflected order of GCM,
+ * and the product of two elements needs one more bit shift left before reduction.
+ * Four blocks are aggregated with the powers of the hash key,
+ * and share one reduction.
+ */
+
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("ssse3,sse2")
+static inline
+__m128i load_reversed(const void *src)
+{
+    const __m128i order = _mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+    return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) src), order);
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("ssse3,sse2")
+static inline
+void store_reversed(void *dest, __m128i value)
+{
+    const __m128i order = _mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+    _mm_storeu_si128((__m128i*) dest, _mm_shuffle_epi8(value, order));
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("pclmul,sse2")
+static inline
+void clmul_wide(__m128i a, __m128i b, __m128i *lo, __m128i *hi)
+{
+    // 256 bits carry-less product of two 128 bits values.
+    __m128i l = _mm_clmulepi64_si128(a, b, 0x00);
+    __m128i h = _mm_clmulepi64_si128(a, b, 0x11);
+    __m128i m = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10),
+                              _mm_clmulepi64_si128(a, b, 0x01));
+
+    *lo = _mm_xor_si128(l, _mm_slli_si128(m, 8));
+    *hi = _mm_xor_si128(h, _mm_srli_si128(m, 8));
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("sse2")
+static inline
+__m128i reduce(__m128i lo, __m128i hi)
+{
+    // Shift the product one bit left, and then reduce it by x^128 + x^7 + x^2 + x + 1.
+    __m128i carry_lo = _mm_srli_epi32(lo, 31);
+    __m128i carry_hi = _mm_srli_epi32(hi, 31);
+    __m128i carry_mid = _mm_srli_si128(carry_lo, 12);
+
+    lo = _mm_or_si128(_mm_slli_epi32(lo, 1), _mm_slli_si128(carry_lo, 4));
+    hi = _mm_or_si128(_mm_slli_epi32(hi, 1), _mm_slli_si128(carry_hi, 4));
+    hi = _mm_or_si128(hi, carry_mid);
+
+    __m128i t = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31),
+                                            _mm_slli_epi32(lo, 30)),
+                                            _mm_slli_epi32(lo, 25));
+    __m128i t_hi = _mm_srli_si128(t, 4);
+    lo = _mm_xor_si128(lo, _mm_slli_si128(t, 12));
+
+    __m128i u = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1),
+                                            _mm_srli_epi32(lo, 2)),
+                                            _mm_srli_epi32(lo, 7));
+    u = _mm_xor_si128(u, t_hi);
+
+    return _mm_xor_si128(hi, _mm_xor_si128(lo, u));
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("pclmul,sse2")
+static inline
+__m128i gf_mul(__m128i a, __m128i b)
+{
+    __m128i lo, hi;
+    clmul_wide(a, b, &lo, &hi);
+    return reduce(lo, hi);
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("pclmul,ssse3,sse2")
+void ghash_ni_update(aes_state_t       /*inout*/ *hash,
+                     const aes_state_t /*in   */ *hkey,
+                     const void        /*in   */ *blocks,
+                     size_t            /*in   */  count)
+{
+    const byte_t *pos = blocks;
+    __m128i x  = load_reversed(hash);
+    __m128i h1 = load_reversed(hkey);
+
+    if( count >= 4 )
+    {
+        __m128i h2 = gf_mul(h1, h1);
+        __m128i h3 = gf_mul(h2, h1);
+        __m128i h4 = gf_mul(h2, h2);
+
+        for(; count >= 4; count -= 4, pos += 64)
+        {
+            __m128i lo, hi, l, h;
+
+            clmul_wide(_mm_xor_si128(x, load_reversed(pos)), h4, &lo, &hi);
+            clmul_wide(load_reversed(pos + 16), h3, &l, &h);
+            lo = _mm_xor_si128(lo, l);
+            hi = _mm_xor_si128(hi, h);
+            clmul_wide(load_reversed(pos + 32), h2, &l, &h);
+            lo = _mm_xor_si128(lo, l);
+            hi = _mm_xor_si128(hi, h);
+            clmul_wide(load_reversed(pos + 48), h1, &l, &h);
+            lo = _mm_xor_si128(lo, l);
+            hi = _mm_xor_si128(hi, h);
+
+            x = reduce(lo, hi);
+        }
+    }
+
+    for(; count; --count, pos += 16)
+        x = gf_mul(_mm_xor_si128(x, load_reversed(pos)), h1);
+
+    store_reversed(hash, x);
+}
+//------------------------------------------------------------------------------
+
+#endif  // GHASH_NI_AVAILABLE
@@ -0,0 +1,45 @@
+/*
+ * PRIVATE USAGE
+ */
+/******************************************************************************
+ * Name      : GHASH-NI
+ * Purpose   : GHASH of GCM accelerated by the x86 carry-less multiplication instruction.
+ * Author    : 王文佑
+ * Created   : 2026.10.17
+ * Licence   : ZLib Licence
+ * Reference : http://www.openfoundry.org/of/projects/2419
+ ******************************************************************************/
+#ifndef _GEN_GHASH_NI_H_
+#define _GEN_GHASH_NI_H_
+
+#include "../cpufeat.h"
+#include "aes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CPUFEAT_X86
+
+// Defined if the GHASH function is available.
+#define GHASH_NI_AVAILABLE
+
+// Features needed by the GHASH function.
+#define GHASH_NI_FEATURES ( CPUFEAT_PCLMUL | CPUFEAT_SSSE3 | CPUFEAT_SSE2 )
+
+/*
+ * Update the hash value with full blocks,
+ * and the hash value and the hash key are in the byte order of GCM specification.
+ */
+void ghash_ni_update(aes_state_t       /*inout*/ *hash,
+                     const aes_state_t /*in   */ *hkey,
+                     const void        /*in   */ *blocks,
+                     size_t            /*in   */  count);
+
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
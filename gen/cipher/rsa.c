@@ -9,28 +9,16 @@
 #include "../bignum/const.h"
 #include "../bignum/io.h"
 #include "../bignum/math.h"
+#include "../bignum/mont.h"
+#include "../bignum/prime.h"
 #include "rsa.h"
 
-#if BIGNUM_DIGSZ < 2*RSA_KEY_PARAMSZ
-#error BIGNUM_DIGSZ must be great equal to 2*RSA_KEY_PARAMSZ
-#endif
-
 //------------------------------------------------------------------------------
 static
-uintbig_t make_rand_prime(unsigned int ndig, mt_rand64_t *rndobj)
+uintbig_t make_rand_prime(unsigned int ndig, mt_rand64_t *rndobj, unsigned threads)
 {
     static const unsigned int testtimes = 8;
-    uintbig_t ret;
-
-    do
-    {
-        ndig = MAX( 1 , MIN( ndig , BIGNUM_DIGSZ ) );
-        ret  = uintbig_rand_ndig(ndig, rndobj);
-        ret.digit[     0] |= 0x01;
-        ret.digit[ndig-1] |= 0xC0;
-    } while( !uintbig_prime_test(&ret, testtimes, rndobj) );
-
-    return ret;
+    return uintbig_prime_search(ndig, testtimes, rndobj, threads);
 }
 //------------------------------------------------------------------------------
 static
@@ -64,10 +52,24 @@ void rsa_generate_keys(rsa_key_t   /*out*/         *publickey,
     /**
      * Generate a pare of random keys
      */
+    rsa_generate_keys_mt(publickey, privatekey, type, rndobj, 1);
+}
+//------------------------------------------------------------------------------
+void rsa_generate_keys_mt(rsa_key_t   /*out*/         *publickey,
+                          rsa_key_t   /*out*/         *privatekey,
+                          rsa_type_t  /*in */          type,
+                          mt_rand64_t /*in,optional*/ *rndobj,
+                          unsigned    /*in */          threads)
+{
+    /**
+     * Generate a pare of random keys, and search the prime numbers by multiple threads.
+     * @threads : The maximum number of threads (including the caller) to search prime numbers,
+     *            and zero to use the number of processors.
+     */
     unsigned int rndndig;
     uintbig_t    n, m, e, d;
-    uintbig_t   *p = &e;
-    uintbig_t   *q = &d;
+    uintbig_t    p, q, p_sub_1, q_sub_1;
+    uintbig_t    dp, dq, qinv;
     uintbig_t    e_min;
     uintbig_t    em_gcd;
 
@@ -80,14 +82,16 @@ void rsa_generate_keys(rsa_key_t   /*out*/         *publickey,
     do
     {
         // Select prime number P and Q
-        *p = make_rand_prime(rndndig+1, rndobj);
-        *q = make_rand_prime(rndndig-1, rndobj);
+        p = make_rand_prime(rndndig+1, rndobj, threads);
+        q = make_rand_prime(rndndig-1, rndobj, threads);
 
         // Calculate N=P*Q and M=(P-1)*(Q-1)
-        n = uintbig_mul(p, q);
-        uintbig_minusminus(p);
-        uintbig_minusminus(q);
-        m = uintbig_mul(p, q);
+        n       = uintbig_mul(&p, &q);
+        p_sub_1 = p;
+        q_sub_1 = q;
+        uintbig_minusminus(&p_sub_1);
+        uintbig_minusminus(&q_sub_1);
+        m = uintbig_mul(&p_sub_1, &q_sub_1);
 
         // Select E, and GCS(E,M)=1, E < M.
         // Calculate D, and D*E mod M=1.
@@ -99,23 +103,40 @@ void rsa_generate_keys(rsa_key_t   /*out*/         *publickey,
             em_gcd = uintbig_gcd(&e, &m);
         } while( !uintbig_is_equal(&em_gcd, &uintbig_const_one) ||
                  !uintbig_modmulinv(&e, &m, &d)                 );
-    } while( !rsa_test_keys(&n, &e, &d, rndobj) );
+    } while( !uintbig_modmulinv(&q, &p, &qinv) ||
+             !rsa_test_keys(&n, &e, &d, rndobj) );
+
+    // Parameters for the Chinese Remainder Theorem
+    dp = uintbig_mod(&d, &p_sub_1);
+    dq = uintbig_mod(&d, &q_sub_1);
 
     // The public key is (N,E), and the private key is (N,D)
     memset(publickey , 0, sizeof(rsa_key_t));
     memset(privatekey, 0, sizeof(rsa_key_t));
-    memcpy(publickey ->modulus , n.digit, n.ndig);
-    memcpy(publickey ->exponent, e.digit, e.ndig);
-    memcpy(privatekey->modulus , n.digit, n.ndig);
-    memcpy(privatekey->exponent, d.digit, d.ndig);
+    memcpy(publickey ->modulus    , n.digit   , n.ndig);
+    memcpy(publickey ->exponent   , e.digit   , e.ndig);
+    memcpy(privatekey->modulus    , n.digit   , n.ndig);
+    memcpy(privatekey->exponent   , d.digit   , d.ndig);
+    memcpy(privatekey->prime1     , p.digit   , p.ndig);
+    memcpy(privatekey->prime2     , q.digit   , q.ndig);
+    memcpy(privatekey->exponent1  , dp.digit  , dp.ndig);
+    memcpy(privatekey->exponent2  , dq.digit  , dq.ndig);
+    memcpy(privatekey->coefficient, qinv.digit, qinv.ndig);
 
     // Erase data
-    memset(&n     , 0, sizeof(uintbig_t));
-    memset(&m     , 0, sizeof(uintbig_t));
-    memset(&e     , 0, sizeof(uintbig_t));
-    memset(&d     , 0, sizeof(uintbig_t));
-    memset(&e_min , 0, sizeof(uintbig_t));
-    memset(&em_gcd, 0, sizeof(uintbig_t));
+    memset(&n      , 0, sizeof(uintbig_t));
+    memset(&m      , 0, sizeof(uintbig_t));
+    memset(&e      , 0, sizeof(uintbig_t));
+    memset(&d      , 0, sizeof(uintbig_t));
+    memset(&p      , 0, sizeof(uintbig_t));
+    memset(&q      , 0, sizeof(uintbig_t));
+    memset(&p_sub_1, 0, sizeof(uintbig_t));
+    memset(&q_sub_1, 0, sizeof(uintbig_t));
+    memset(&dp     , 0, sizeof(uintbig_t));
+    memset(&dq     , 0, sizeof(uintbig_t));
+    memset(&qinv   , 0, sizeof(uintbig_t));
+    memset(&e_min  , 0, sizeof(uintbig_t));
+    memset(&em_gcd , 0, sizeof(uintbig_t));
 }
 //------------------------------------------------------------------------------
 size_t rsa_get_state_size(rsa_type_t type)
@@ -156,25 +177,14 @@ size_t rsa_state_encipher(void            /*out*/ *out,
      *           當 out 為 NULL 時傳回 out 所需的緩衝區大小；
      *           其他失敗情況傳回零。
      */
-    uintbig_t n, e;
-    uintbig_t text, code;
+    rsa_ctx_t ctx;
+    size_t    ret;
 
-    if( !key ) return 0;
-    n = uintbig_from_bin(key->modulus , RSA_KEY_PARAMSZ);
-    e = uintbig_from_bin(key->exponent, RSA_KEY_PARAMSZ);
+    if( !rsa_ctx_init(&ctx, key) ) return 0;
+    ret = rsa_ctx_encipher(&ctx, out, outsz, in, insz);
+    rsa_ctx_clear(&ctx);
 
-    if( !out ) return n.ndig;
-    if( outsz < (size_t)n.ndig || !in || !insz ) return 0;
-
-    text = uintbig_from_bin(in, insz);
-    code = uintbig_powermod(&text, &e, &n);
-    memcpy(out, code.digit, n.ndig);
-
-    memset(&e   , 0, sizeof(uintbig_t));
-    memset(&text, 0, sizeof(uintbig_t));
-    memset(&code, 0, sizeof(uintbig_t));
-
-    return n.ndig;
+    return ret;
 }
 //------------------------------------------------------------------------------
 size_t rsa_state_decipher(void            /*out*/ *out,
@@ -200,25 +210,234 @@ size_t rsa_state_decipher(void            /*out*/ *out,
      *           當 out 為 NULL 時傳回 out 可能需要的最大大小；
      *           其他失敗情況傳回零。
      */
-    uintbig_t n, e;
+    rsa_ctx_t ctx;
+    size_t    ret;
+
+    if( !rsa_ctx_init(&ctx, key) ) return 0;
+    ret = rsa_ctx_decipher(&ctx, out, outsz, in, insz);
+    rsa_ctx_clear(&ctx);
+
+    return ret;
+}
+//------------------------------------------------------------------------------
+//---- Context -----------------------------------------------------------------
+//------------------------------------------------------------------------------
+bool rsa_ctx_init(rsa_ctx_t /*out*/ *ctx, const rsa_key_t /*in*/ *key)
+{
+    /**
+     * 由密鑰建立加解密環境
+     * @ctx    : 加解密環境物件，使用完畢後應以 rsa_ctx_clear 清除。
+     * @key    : 加解密密鑰；若私鑰含有中國剩餘定理(CRT)參數，將使用該參數加速運算。
+     * @return : 成功時傳回 TRUE；密鑰不合法時傳回 FALSE。
+     */
+    uintbig_t n, p, q;
+    bool      res;
+
+    assert( ctx );
+
+    memset(ctx, 0, sizeof(rsa_ctx_t));
+    if( !key ) return false;
+
+    n             = uintbig_from_bin(key->modulus , RSA_KEY_PARAMSZ);
+    ctx->exponent = uintbig_from_bin(key->exponent, RSA_KEY_PARAMSZ);
+    res           = uintbig_mont_init(&ctx->mont, &n);
+
+    p = uintbig_from_bin(key->prime1, RSA_KEY_CRTSZ);
+    q = uintbig_from_bin(key->prime2, RSA_KEY_CRTSZ);
+    if( res && !uintbig_is_zero(&p) && !uintbig_is_zero(&q) )
+    {
+        ctx->exponent1   = uintbig_from_bin(key->exponent1  , RSA_KEY_CRTSZ);
+        ctx->exponent2   = uintbig_from_bin(key->exponent2  , RSA_KEY_CRTSZ);
+        ctx->coefficient = uintbig_from_bin(key->coefficient, RSA_KEY_CRTSZ);
+        ctx->crt         = uintbig_mont_init(&ctx->mont_p, &p) &&
+                           uintbig_mont_init(&ctx->mont_q, &q);
+    }
+
+    memset(&n, 0, sizeof(uintbig_t));
+    memset(&p, 0, sizeof(uintbig_t));
+    memset(&q, 0, sizeof(uintbig_t));
+    if( !res ) rsa_ctx_clear(ctx);
+
+    return res;
+}
+//------------------------------------------------------------------------------
+void rsa_ctx_clear(rsa_ctx_t /*out*/ *ctx)
+{
+    /**
+     * 清除加解密環境中的密鑰資料
+     */
+    assert( ctx );
+    memset(ctx, 0, sizeof(rsa_ctx_t));
+}
+//------------------------------------------------------------------------------
+size_t rsa_ctx_get_state_size(const rsa_ctx_t *ctx)
+{
+    /**
+     * 查詢加解密環境的密文區塊大小
+     */
+    assert( ctx );
+    return ctx->mont.modulus.ndig;
+}
+//------------------------------------------------------------------------------
+static
+uintbig_t crypt_state(const rsa_ctx_t *ctx, const uintbig_t *x)
+{
+    /*
+     * Calculate x^e mod n.
+     * With the CRT parameters, the power is calculated by modulus 'p' and 'q' separately,
+     * both operands are only half of the size, and then combined by Garner's formula:
+     *   m1 = x^dP mod p, m2 = x^dQ mod q,
+     *   h  = qInv * (m1-m2) mod p,
+     *   m  = m2 + h*q.
+     * The recombination is not in the constant time,
+     * so the constant time mode always calculates by the full modulus and private exponent.
+     */
+    uintbig_t m1, m2, h, ret;
+
+    if( ctx->consttime )
+        return uintbig_mont_powermod_ct(&ctx->mont, x, &ctx->exponent);
+    if( !ctx->crt )
+        return uintbig_mont_powermod(&ctx->mont, x, &ctx->exponent);
+
+    m1 = uintbig_mont_powermod(&ctx->mont_p, x, &ctx->exponent1);
+    m2 = uintbig_mont_powermod(&ctx->mont_q, x, &ctx->exponent2);
+
+    // h = qInv * (m1-m2) mod p, where 'm2' is reduced by 'p' first if q > p,
+    // and 'p' is added to 'm1' if m1 < h.
+    h = uintbig_mod(&m2, &ctx->mont_p.modulus);
+    if( uintbig_is_lessthen(&m1, &h) )
+        m1 = uintbig_add(&m1, &ctx->mont_p.modulus);
+    h = uintbig_sub(&m1, &h);
+    h = uintbig_mont_mulmod(&ctx->mont_p, &ctx->coefficient, &h);
+
+    ret = uintbig_mul(&h, &ctx->mont_q.modulus);
+    ret = uintbig_add(&ret, &m2);
+
+    memset(&m1, 0, sizeof(uintbig_t));
+    memset(&m2, 0, sizeof(uintbig_t));
+    memset(&h , 0, sizeof(uintbig_t));
+
+    return ret;
+}
+//------------------------------------------------------------------------------
+size_t rsa_ctx_encipher(const rsa_ctx_t /*in */ *ctx,
+                        void            /*out*/ *out,
+                        size_t          /*in */  outsz,
+                        const void      /*in */ *in,
+                        size_t          /*in */  insz)
+{
+    /**
+     * 以加解密環境加密區塊資料，參數與傳回值同 rsa_state_encipher。
+     */
+    size_t    statesz;
+    uintbig_t text, code;
+
+    assert( ctx );
+
+    statesz = rsa_ctx_get_state_size(ctx);
+    if( !out ) return statesz;
+    if( outsz < statesz || !in || !insz ) return 0;
+
+    text = uintbig_from_bin(in, insz);
+    code = crypt_state(ctx, &text);
+    memcpy(out, code.digit, statesz);
+
+    memset(&text, 0, sizeof(uintbig_t));
+    memset(&code, 0, sizeof(uintbig_t));
+
+    return statesz;
+}
+//------------------------------------------------------------------------------
+size_t rsa_ctx_decipher(const rsa_ctx_t /*in */ *ctx,
+                        void            /*out*/ *out,
+                        size_t          /*in */  outsz,
+                        const void      /*in */ *in,
+                        size_t          /*in */  insz)
+{
+    /**
+     * 以加解密環境解密區塊資料，參數與傳回值同 rsa_state_decipher。
+     */
+    size_t    statesz;
     uintbig_t code, text;
 
-    if( !key ) return 0;
-    n = uintbig_from_bin(key->modulus , RSA_KEY_PARAMSZ);
-    e = uintbig_from_bin(key->exponent, RSA_KEY_PARAMSZ);
+    assert( ctx );
 
-    if( !out ) return n.ndig;
+    statesz = rsa_ctx_get_state_size(ctx);
+    if( !out ) return statesz;
     if( !in || !insz ) return 0;
 
     code  = uintbig_from_bin(in, insz);
-    text  = uintbig_powermod(&code, &e, &n);
-    outsz = MIN( outsz, (size_t)n.ndig );
+    text  = crypt_state(ctx, &code);
+    outsz = MIN( outsz, statesz );
     memcpy(out, text.digit, outsz);
 
-    memset(&e   , 0, sizeof(uintbig_t));
     memset(&code, 0, sizeof(uintbig_t));
     memset(&text, 0, sizeof(uintbig_t));
 
     return outsz;
 }
 //------------------------------------------------------------------------------
+size_t rsa_batch_encipher(const rsa_ctx_t /*in */ *ctx,
+                          void            /*out*/ *out,
+                          size_t          /*in */  outsz,
+                          const void      /*in */ *in,
+                          size_t          /*in */  insz,
+                          size_t          /*in */  count)
+{
+    /**
+     * 以加解密環境加密多個區塊資料
+     * @out    : 用來接收加密後資料的緩衝區，其中連續存放 count 個大小為 outsz 的區塊。
+     * @outsz  : 每個輸出區塊的大小，需大於等於 rsa_ctx_get_state_size 的傳回值。
+     * @in     : 加密前資料輸入，其中連續存放 count 個大小為 insz 的區塊。
+     * @insz   : 每個輸入區塊的大小，規則同 rsa_state_encipher。
+     * @count  : 區塊數量。
+     * @return : 成功處理的區塊數量。
+     */
+    byte_t       *dest = out;
+    const byte_t *src  = in;
+    size_t        i;
+
+    assert( ctx );
+
+    if( !out || !in ) return 0;
+
+    for(i=0; i<count; ++i)
+    {
+        if( !rsa_ctx_encipher(ctx, dest + i * outsz, outsz, src + i * insz, insz) ) break;
+    }
+
+    return i;
+}
+//------------------------------------------------------------------------------
+size_t rsa_batch_decipher(const rsa_ctx_t /*in */ *ctx,
+                          void            /*out*/ *out,
+                          size_t          /*in */  outsz,
+                          const void      /*in */ *in,
+                          size_t          /*in */  insz,
+                          size_t          /*in */  count)
+{
+    /**
+     * 以加解密環境解密多個區塊資料
+     * @out    : 用來接收解密後資料的緩衝區，其中連續存放 count 個大小為 outsz 的區塊。
+     * @outsz  : 每個輸出區塊的大小，規則同 rsa_state_decipher。
+     * @in     : 解密前資料輸入，其中連續存放 count 個大小為 insz 的區塊。
+     * @insz   : 每個輸入區塊的大小，規則同 rsa_state_decipher。
+     * @count  : 區塊數量。
+     * @return : 成功處理的區塊數量。
+     */
+    byte_t       *dest = out;
+    const byte_t *src  = in;
+    size_t        i;
+
+    assert( ctx );
+
+    if( !out || !in ) return 0;
+
+    for(i=0; i<count; ++i)
+    {
+        if( !rsa_ctx_decipher(ctx, dest + i * outsz, outsz, src + i * insz, insz) ) break;
+    }
+
+    return i;
+}
+//------------------------------------------------------------------------------
@@ -12,12 +12,22 @@
 #include "../type.h"
 #include "../inline.h"
 #include "../mtrand.h"
+#include "../bignum/mont.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-#define RSA_KEY_PARAMSZ 128  // Size of each RSA key parameter
+#define RSA_KEY_PARAMSZ 128                        // Size of each RSA key parameter
+#define RSA_KEY_CRTSZ   ( RSA_KEY_PARAMSZ / 2 + 1 )  // Size of each RSA private key CRT parameter
+
+/*
+ * The layout of rsa_ctx_t depends on BIGNUM_DIGSZ,
+ * so every module including this file must be built with the same BIGNUM_DIGSZ as rsa.c.
+ */
+#if BIGNUM_DIGSZ < 2*RSA_KEY_PARAMSZ
+#error BIGNUM_DIGSZ must be great equal to 2*RSA_KEY_PARAMSZ
+#endif
 
 typedef enum rsa_type_t
 {
@@ -32,13 +42,47 @@ typedef struct rsa_key_t
 {
     byte_t modulus [RSA_KEY_PARAMSZ];  // The binary data of an integer with Little-Endian format
     byte_t exponent[RSA_KEY_PARAMSZ];  // The binary data of an integer with Little-Endian format
+
+    // Parameters for the Chinese Remainder Theorem of a private key,
+    // they are all zero for a public key, or a private key without them.
+    byte_t prime1     [RSA_KEY_CRTSZ];  // p
+    byte_t prime2     [RSA_KEY_CRTSZ];  // q
+    byte_t exponent1  [RSA_KEY_CRTSZ];  // d mod (p-1)
+    byte_t exponent2  [RSA_KEY_CRTSZ];  // d mod (q-1)
+    byte_t coefficient[RSA_KEY_CRTSZ];  // q^(-1) mod p
 } rsa_key_t;
 
+/*
+ * The context holds the values derived from a key,
+ * so that the key need not to be prepared again for every state.
+ * The context can be shared by threads after it is initialized.
+ * The member 'consttime' can be set after the initialization to calculate in the constant time mode,
+ * it protects the private exponent from the timing attacks, but is slower than the default mode.
+ * The CRT parameters are not used in the constant time mode, since their recombination is not in the constant time.
+ */
+typedef struct rsa_ctx_t
+{
+    uintbig_mont_t mont;        // Context of the modulus
+    uintbig_t      exponent;
+    bool           consttime;   // Use the constant time exponentiation
+    bool           crt;         // Use the CRT parameters below
+    uintbig_mont_t mont_p;
+    uintbig_mont_t mont_q;
+    uintbig_t      exponent1;
+    uintbig_t      exponent2;
+    uintbig_t      coefficient;
+} rsa_ctx_t;
+
 INLINE void rsa_generator_init(mt_rand64_t *rndobj, uint64_t seed){ mt_srand64(rndobj, seed); }
 void rsa_generate_keys(rsa_key_t   /*out*/         *publickey,
                        rsa_key_t   /*out*/         *privatekey,
                        rsa_type_t  /*in */          type,
                        mt_rand64_t /*in,optional*/ *rndobj);
+void rsa_generate_keys_mt(rsa_key_t   /*out*/         *publickey,
+                          rsa_key_t   /*out*/         *privatekey,
+                          rsa_type_t  /*in */          type,
+                          mt_rand64_t /*in,optional*/ *rndobj,
+                          unsigned    /*in */          threads);
 
 size_t rsa_get_state_size(rsa_type_t type);
 
@@ -53,6 +97,34 @@ size_t rsa_state_decipher(void            /*out*/ *out,
                           size_t          /*in */  insz,
                           const rsa_key_t /*in */ *key);
 
+bool   rsa_ctx_init (rsa_ctx_t /*out*/ *ctx, const rsa_key_t /*in*/ *key);
+void   rsa_ctx_clear(rsa_ctx_t /*out*/ *ctx);
+size_t rsa_ctx_get_state_size(const rsa_ctx_t *ctx);
+
+size_t rsa_ctx_encipher(const rsa_ctx_t /*in */ *ctx,
+                        void            /*out*/ *out,
+                        size_t          /*in */  outsz,
+                        const void      /*in */ *in,
+                        size_t          /*in */  insz);
+size_t rsa_ctx_decipher(const rsa_ctx_t /*in */ *ctx,
+                        void            /*out*/ *out,
+                        size_t          /*in */  outsz,
+                        const void      /*in */ *in,
+                        size_t          /*in */  insz);
+
+size_t rsa_batch_encipher(const rsa_ctx_t /*in */ *ctx,
+                          void            /*out*/ *out,
+                          size_t          /*in */  outsz,
+                          const void      /*in */ *in,
+                          size_t          /*in */  insz,
+                          size_t          /*in */  count);
+size_t rsa_batch_decipher(const rsa_ctx_t /*in */ *ctx,
+                          void            /*out*/ *out,
+                          size_t          /*in */  outsz,
+                          const void      /*in */ *in,
+                          size_t          /*in */  insz,
+                          size_t          /*in */  count);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
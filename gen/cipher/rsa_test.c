@@ -16,6 +16,8 @@
     #error This test program must work with macro "ASSERT" enabled!
 #endif
 
+#define BATCH_COUNT 8
+
 void print_key(const char *label, const rsa_key_t *key)
 {
     uintbig_t modulus, exponent;
@@ -39,7 +41,12 @@ int main(void)
     size_t     ncode;
     size_t     ntext1;
     int        i;
-    rsa_key_t  publickey, privatekey;
+    rsa_key_t  publickey, privatekey, plainkey;
+    rsa_ctx_t  ctxpub, ctxpri;
+    byte_t     batch0[BATCH_COUNT*128];
+    byte_t     batchc[BATCH_COUNT*128];
+    byte_t     batch1[BATCH_COUNT*128];
+    size_t     nstate;
     rsa_type_t rsatype;
     rsa_type_t rsatype_table[] = {
                                    rsa_type_128,
@@ -57,14 +64,52 @@ int main(void)
         ntext0  = rsa_get_state_size(rsatype) - 1;
         mt_randbin(NULL, text0, ntext0);
 
-        rsa_generate_keys(&publickey, &privatekey, rsatype, NULL);
+        if( i & 1 )
+            rsa_generate_keys_mt(&publickey, &privatekey, rsatype, NULL, 0);
+        else
+            rsa_generate_keys(&publickey, &privatekey, rsatype, NULL);
         print_key("public ", &publickey);
         print_key("private", &privatekey);
 
-        assert( ncode  = rsa_state_encipher(code , sizeof(code), text0, ntext0, &publickey ) );
-        assert( ntext1 = rsa_state_decipher(text1, ntext0      , code , ncode , &privatekey) );
+        ncode  = rsa_state_encipher(code , sizeof(code), text0, ntext0, &publickey );
+        ntext1 = rsa_state_decipher(text1, ntext0      , code , ncode , &privatekey);
+        assert( ncode );
+        assert( ntext1 == ntext0 );
+        assert( 0 == memcmp(text1, text0, ntext0) );
+
+        // Private key without the CRT parameters
+        plainkey = privatekey;
+        memset(plainkey.prime1     , 0, sizeof(plainkey.prime1     ));
+        memset(plainkey.prime2     , 0, sizeof(plainkey.prime2     ));
+        memset(plainkey.exponent1  , 0, sizeof(plainkey.exponent1  ));
+        memset(plainkey.exponent2  , 0, sizeof(plainkey.exponent2  ));
+        memset(plainkey.coefficient, 0, sizeof(plainkey.coefficient));
+        memset(text1, 0, sizeof(text1));
+        ntext1 = rsa_state_decipher(text1, ntext0, code, ncode, &plainkey);
         assert( ntext1 == ntext0 );
         assert( 0 == memcmp(text1, text0, ntext0) );
+
+        // Batch operations with contexts
+        assert( rsa_ctx_init(&ctxpub, &publickey ) );
+        assert( rsa_ctx_init(&ctxpri, &privatekey) );
+        nstate = rsa_ctx_get_state_size(&ctxpub);
+        assert( nstate == ncode );
+
+        memcpy(batch0, text0, ntext0);
+        mt_randbin(NULL, batch0 + ntext0, ( BATCH_COUNT - 1 ) * ntext0);
+        assert( BATCH_COUNT == rsa_batch_encipher(&ctxpub, batchc, nstate, batch0, ntext0, BATCH_COUNT) );
+        assert( 0 == memcmp(batchc, code, ncode) );
+        assert( BATCH_COUNT == rsa_batch_decipher(&ctxpri, batch1, ntext0, batchc, nstate, BATCH_COUNT) );
+        assert( 0 == memcmp(batch1, batch0, BATCH_COUNT * ntext0) );
+
+        // The constant time mode gives the same results.
+        ctxpri.consttime = true;
+        memset(batch1, 0, sizeof(batch1));
+        assert( BATCH_COUNT == rsa_batch_decipher(&ctxpri, batch1, ntext0, batchc, nstate, BATCH_COUNT) );
+        assert( 0 == memcmp(batch1, batch0, BATCH_COUNT * ntext0) );
+
+        rsa_ctx_clear(&ctxpub);
+        rsa_ctx_clear(&ctxpri);
     }
 
     return 0;
@@ -8,9 +8,9 @@
 typedef glist_node_t node_t;
 //------------------------------------------------------------------------------
 static
-node_t* node_create(void *value)
+node_t* node_create(slab_t *slab, void *value)
 {
-    node_t *node = malloc(sizeof(node_t));
+    node_t *node = slab ? slab_allocate(slab) : malloc(sizeof(node_t));
     assert( node );
 
     node->prev  = NULL;
@@ -21,9 +21,12 @@ node_t* node_create(void *value)
 }
 //------------------------------------------------------------------------------
 static
-void node_release(node_t *node)
+void node_release(slab_t *slab, node_t *node)
 {
-    free(node);
+    if( slab )
+        slab_deallocate(slab, node);
+    else
+        free(node);
 }
 //------------------------------------------------------------------------------
 static
@@ -258,6 +261,28 @@ void glist_init(glist_t *list, glist_itemfree_t itemfree)
     list->last     = NULL;
     list->count    = 0;
     list->itemfree = itemfree ? itemfree : glist_itemfree_default;
+    list->slab     = NULL;
+}
+//------------------------------------------------------------------------------
+void glist_init_slab(glist_t *list, glist_itemfree_t itemfree, slab_t *slab)
+{
+    /**
+     * @memberof glist_t
+     * @brief Constructor with a slab allocator for nodes.
+     *
+     * @param list     Object instance.
+     * @param itemfree The function used to release an item.
+     *                 This parameter can be NULL if not needed.
+     * @param slab     The allocator of nodes, its object size must be
+     *                 at least the size of ::glist_node_t.
+     *                 It can be shared by many containers,
+     *                 and must be valid until the container destroyed.
+     */
+    assert( list && slab );
+    assert( slab_get_object_size(slab) >= sizeof(node_t) );
+
+    glist_init(list, itemfree);
+    list->slab = slab;
 }
 //------------------------------------------------------------------------------
 void glist_init_movefrom(glist_t *list, glist_t *src)
@@ -371,7 +396,7 @@ void glist_push_front(glist_t *list, void *item)
      */
     assert( list );
 
-    node_t *node = node_create(item);
+    node_t *node = node_create(list->slab, item);
     node_link_head(list->first, node);
     list->first = node;
     if( !list->last ) list->last = node;
@@ -397,7 +422,7 @@ void glist_pop_front(glist_t *list)
     node_unlink(node);
 
     list->itemfree(node_get_value(node));
-    node_release(node);
+    node_release(list->slab, node);
 
     --list->count;
 }
@@ -413,7 +438,7 @@ void glist_push_back(glist_t *list, void *item)
      */
     assert( list );
 
-    node_t *node = node_create(item);
+    node_t *node = node_create(list->slab, item);
     node_link_rear(list->last, node);
     list->last = node;
     if( !list->first ) list->first = node;
@@ -439,7 +464,7 @@ void glist_pop_back(glist_t *list)
     node_unlink(node);
 
     list->itemfree(node_get_value(node));
-    node_release(node);
+    node_release(list->slab, node);
 
     --list->count;
 }
@@ -457,7 +482,7 @@ void glist_insert(glist_t *list, glist_iter_t *pos, void *item)
     assert( list && pos );
     assert( pos->container == list );
 
-    node_t *node = node_create(item);
+    node_t *node = node_create(list->slab, item);
     node_link_head(pos->node, node);
     if( list->first == pos->node ) list->first = node;
     if( !list->last ) list->last = node;
@@ -485,7 +510,7 @@ void glist_erase(glist_t *list, glist_iter_t *pos)
     node_unlink(node);
 
     list->itemfree(node_get_value(node));
-    node_release(node);
+    node_release(list->slab, node);
 
     --list->count;
 }
@@ -507,7 +532,7 @@ void glist_clear(glist_t *list)
         node = node_get_next(node);
 
         list->itemfree(node_get_value(temp));
-        node_release(temp);
+        node_release(list->slab, temp);
     }
 
     list->first = NULL;
@@ -532,6 +557,7 @@ void glist_movefrom(glist_t *list, glist_t *src)
 
     glist_clear(list);
     list->itemfree = src->itemfree;
+    list->slab     = src->slab;
 
     list->first = src->first;
     list->last  = src->last;
@@ -55,10 +55,20 @@ bool verify_list_values(const glist_t *list, const int *target_arr, size_t count
     return true;
 }
 
-int main(int argc, char *argv[])
+slab_t *test_slab = NULL;  // The node allocator to be tested, or NULL to use the system allocator.
+
+void list_init(glist_t *list, glist_itemfree_t itemfree)
+{
+    if( test_slab )
+        glist_init_slab(list, itemfree, test_slab);
+    else
+        glist_init(list, itemfree);
+}
+
+void run_tests(void)
 {
     glist_t list;
-    glist_init(&list, (glist_itemfree_t)testobj_release);
+    list_init(&list, (glist_itemfree_t)testobj_release);
 
     assert( glist_get_count(&list) == 0 );
     assert( testobj_refcnt == 0 );
@@ -242,7 +252,7 @@ int main(int argc, char *argv[])
 
         {
             glist_t list2;
-            glist_init(&list2, (glist_itemfree_t)testobj_release);
+            list_init(&list2, (glist_itemfree_t)testobj_release);
 
             glist_push_back(&list2, testobj_create(1));
             glist_push_back(&list2, testobj_create(3));
@@ -300,6 +310,19 @@ int main(int argc, char *argv[])
 
     glist_deinit(&list);
     assert( testobj_refcnt == 0 );
+}
+
+int main(int argc, char *argv[])
+{
+    slab_t slab;
+
+    run_tests();
+
+    slab_init(&slab, sizeof(glist_node_t), 0);
+    test_slab = &slab;
+    run_tests();
+    assert( 0 == slab_get_count(&slab) );
+    slab_deinit(&slab);
 
     return 0;
 }
@@ -12,12 +12,14 @@ typedef struct gmap_events_t
     gmap_tagcmp_t   tagcmp;
     gmap_tagfree_t  tagfree;
     gmap_itemfree_t itemfree;
+    slab_t         *slab;
 } gmap_events_t;
 //------------------------------------------------------------------------------
 static
 gmap_events_t* gmap_events_create(gmap_tagcmp_t   tagcmp,
                                   gmap_tagfree_t  tagfree,
-                                  gmap_itemfree_t itemfree)
+                                  gmap_itemfree_t itemfree,
+                                  slab_t         *slab)
 {
     gmap_events_t *tbl = malloc(sizeof(gmap_events_t));
     assert( tbl );
@@ -25,6 +27,7 @@ gmap_events_t* gmap_events_create(gmap_tagcmp_t   tagcmp,
     tbl->tagcmp   = tagcmp;
     tbl->tagfree  = tagfree;
     tbl->itemfree = itemfree;
+    tbl->slab     = slab;
 
     return tbl;
 }
@@ -47,7 +50,7 @@ node_t* node_create(void *tag, void *value, const gmap_events_t *events)
 {
     assert( events );
 
-    node_t *node = malloc(sizeof(node_t));
+    node_t *node = events->slab ? slab_allocate(events->slab) : malloc(sizeof(node_t));
     assert( node );
 
     node->parent = NULL;
@@ -69,7 +72,10 @@ void node_release(node_t *node)
     node->events->tagfree (node->tag);
     node->events->itemfree(node->value);
 
-    free(node);
+    if( node->events->slab )
+        slab_deallocate(node->events->slab, node);
+    else
+        free(node);
 }
 //------------------------------------------------------------------------------
 static
@@ -960,7 +966,35 @@ void gmap_init(gmap_t *map, gmap_tagcmp_t   tagcmp,
 
     map->root   = NULL;
     map->count  = 0;
-    map->events = gmap_events_create(tagcmp, tagfree, itemfree);
+    map->events = gmap_events_create(tagcmp, tagfree, itemfree, NULL);
+}
+//------------------------------------------------------------------------------
+void gmap_init_slab(gmap_t *map, gmap_tagcmp_t   tagcmp,
+                                 gmap_tagfree_t  tagfree,
+                                 gmap_itemfree_t itemfree,
+                                 slab_t         *slab)
+{
+    /**
+     * @memberof gmap_t
+     * @brief Constructor with a slab allocator for nodes.
+     *
+     * @param map      Object instance.
+     * @param tagcmp   The function to compare two tags.
+     *                 The tags will be compared as they are integral type if this parameter is NULL.
+     * @param tagfree  The function used to release a tag.
+     *                 This parameter can be NULL if not needed.
+     * @param itemfree The function used to release an item (value).
+     *                 This parameter can be NULL if not needed.
+     * @param slab     The allocator of nodes, its object size must be
+     *                 at least the size of ::gmap_node_t.
+     *                 It can be shared by many containers,
+     *                 and must be valid until the container destroyed.
+     */
+    assert( map && slab );
+    assert( slab_get_object_size(slab) >= sizeof(node_t) );
+
+    gmap_init(map, tagcmp, tagfree, itemfree);
+    map->events->slab = slab;
 }
 //------------------------------------------------------------------------------
 void gmap_init_movefrom(gmap_t *map, gmap_t *src)
@@ -176,12 +176,22 @@ bool gmap_totalchk(gmap_t *map)
 //------------------------------------------------------------------------------
 //---- Main Test Process -------------------------------------------------------
 //------------------------------------------------------------------------------
+slab_t *test_slab = NULL;  // The node allocator to be tested, or NULL to use the system allocator.
+//------------------------------------------------------------------------------
+void map_init(gmap_t *map, gmap_itemfree_t itemfree)
+{
+    if( test_slab )
+        gmap_init_slab(map, NULL, NULL, itemfree, test_slab);
+    else
+        gmap_init(map, NULL, NULL, itemfree);
+}
+//------------------------------------------------------------------------------
 bool map_insert_and_erase_test(const int *tags_insert, const int *tags_erase, unsigned tags_count)
 {
     assert( tags_insert && tags_erase );
 
     gmap_t map;
-    gmap_init(&map, NULL, NULL, (gmap_itemfree_t)testobj_release);
+    map_init(&map, (gmap_itemfree_t)testobj_release);
 
     assert( gmap_get_count(&map) == 0 );
     assert( testobj_refcnt == 0 );
@@ -208,7 +218,7 @@ bool map_insert_and_erase_test(const int *tags_insert, const int *tags_erase, un
     return true;
 }
 //------------------------------------------------------------------------------
-int main(int argc, char *argv[])
+void run_tests(void)
 {
     // Insert and erase test
 
@@ -270,7 +280,7 @@ int main(int argc, char *argv[])
 
     {
         gmap_t map;
-        gmap_init(&map, NULL, NULL, (gmap_itemfree_t)testobj_release);
+        map_init(&map, (gmap_itemfree_t)testobj_release);
 
         int tags[] = {15,   6,   27,   32,   11,  8,   17,   16,   4,   28,  10,  5,   14,   2,   12,   7,
                       15,26,6,23,27,18,32,31,11,3,8,24,17,13,16,25,4,19,28,1,10,9,5,30,14,29,2,22,12,20,7,21};
@@ -302,7 +312,7 @@ int main(int argc, char *argv[])
 
     {
         gmap_t map;
-        gmap_init(&map, NULL, NULL, (gmap_itemfree_t)testobj_release);
+        map_init(&map, (gmap_itemfree_t)testobj_release);
 
         int tags_insert[] = {31,32,21,12,25,16,9,13,11,27,26,7,5,6,28,18,17,22,19,29,30,2,23,15,20,3,1,10,14,8,24,4};
         int tags_count = sizeof(tags_insert)/sizeof(tags_insert[0]);
@@ -321,7 +331,7 @@ int main(int argc, char *argv[])
 
     {
         gmap_t map;
-        gmap_init(&map, NULL, NULL, (gmap_itemfree_t)testobj_release);
+        map_init(&map, (gmap_itemfree_t)testobj_release);
 
         // Build data
         int tags_insert[] = {31,32,21,12,25,16,9,13,11,27,26,7,5,6,28,18,17,22,19,29,30,2,23,15,20,3,1,10,14,8,24,4};
@@ -353,7 +363,7 @@ int main(int argc, char *argv[])
 
     {
         gmap_t map;
-        gmap_init(&map, NULL, NULL, (gmap_itemfree_t)testobj_release);
+        map_init(&map, (gmap_itemfree_t)testobj_release);
 
         // Build data
         int tags_insert[] = {31,32,21,12,25,16,9,13,11,27,26,7,5,6,28,18,17,22,19,29,30,2,23,15,20,3,1,10,14,8,24,4};
@@ -382,6 +392,19 @@ int main(int argc, char *argv[])
         gmap_deinit(&map);
         assert( testobj_refcnt == 0 );
     }
+}
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    slab_t slab;
+
+    run_tests();
+
+    slab_init(&slab, sizeof(gmap_node_t), 0);
+    test_slab = &slab;
+    run_tests();
+    assert( 0 == slab_get_count(&slab) );
+    slab_deinit(&slab);
 
     return 0;
 }
@@ -8,9 +8,9 @@
 typedef gqueue_node_t node_t;
 //------------------------------------------------------------------------------
 static
-node_t* node_create(bool have_value, void *value)
+node_t* node_create(slab_t *slab, bool have_value, void *value)
 {
-    node_t *node = malloc(sizeof(node_t));
+    node_t *node = slab ? slab_allocate(slab) : malloc(sizeof(node_t));
     assert( node );
 
     node->next       = NULL;
@@ -21,14 +21,17 @@ node_t* node_create(bool have_value, void *value)
 }
 //------------------------------------------------------------------------------
 static
-void node_release(node_t *node, gqueue_itemfree_t itemfree)
+void node_release(slab_t *slab, node_t *node, gqueue_itemfree_t itemfree)
 {
     assert( node && itemfree );
 
     if( node->have_value )
         itemfree(node->value);
 
-    free(node);
+    if( slab )
+        slab_deallocate(slab, node);
+    else
+        free(node);
 }
 //------------------------------------------------------------------------------
 static
@@ -58,7 +61,20 @@ void pop_one_node(gqueue_t *queue)
     node_t *node = queue->first;
     queue->first = node->next;
 
-    node_release(node, queue->itemfree);
+    node_release(queue->slab, node, queue->itemfree);
+}
+//------------------------------------------------------------------------------
+static
+void init_with_slab(gqueue_t *queue, gqueue_itemfree_t itemfree, slab_t *slab)
+{
+    node_t *node_empty = node_create(slab, false, NULL);
+
+    queue->first    = node_empty;
+    queue->last     = node_empty;
+    queue->pushcnt  = 0;
+    queue->popcnt   = 0;
+    queue->itemfree = itemfree ? itemfree : gqueue_itemfree_default;
+    queue->slab     = slab;
 }
 //------------------------------------------------------------------------------
 void gqueue_init(gqueue_t *queue, gqueue_itemfree_t itemfree)
@@ -73,13 +89,30 @@ void gqueue_init(gqueue_t *queue, gqueue_itemfree_t itemfree)
      */
     assert( queue );
 
-    node_t *node_empty = node_create(false, NULL);
+    init_with_slab(queue, itemfree, NULL);
+}
+//------------------------------------------------------------------------------
+void gqueue_init_slab(gqueue_t *queue, gqueue_itemfree_t itemfree, slab_t *slab)
+{
+    /**
+     * @memberof gqueue_t
+     * @brief Initialize a queue object with a slab allocator for nodes.
+     *
+     * @param queue    Object instance.
+     * @param itemfree The function used to release an item.
+     *                 This parameter can be NULL if not needed.
+     * @param slab     The allocator of nodes, its object size must be
+     *                 at least the size of ::gqueue_node_t.
+     *                 It can be shared by many containers,
+     *                 and must be valid until the container destroyed.
+     *
+     * @remarks The slab must be initialized by ::slab_init_concurrent
+     *          if items will be pushed and popped in different threads.
+     */
+    assert( queue && slab );
+    assert( slab_get_object_size(slab) >= sizeof(node_t) );
 
-    queue->first    = node_empty;
-    queue->last     = node_empty;
-    queue->pushcnt  = 0;
-    queue->popcnt   = 0;
-    queue->itemfree = itemfree ? itemfree : gqueue_itemfree_default;
+    init_with_slab(queue, itemfree, slab);
 }
 //------------------------------------------------------------------------------
 void gqueue_deinit(gqueue_t *queue)
@@ -153,7 +186,7 @@ void gqueue_push(gqueue_t *queue, void *item)
      */
     assert( queue );
 
-    node_t *node = node_create(true, item);
+    node_t *node = node_create(queue->slab, true, item);
     queue->last->next = node;
     queue->last       = node;
 
@@ -34,14 +34,24 @@ void testobj_release(testobj_t *obj)
     free(obj);
 }
 
-int main(int argc, char *argv[])
+slab_t *test_slab = NULL;  // The node allocator to be tested, or NULL to use the system allocator.
+
+void queue_init(gqueue_t *queue, gqueue_itemfree_t itemfree)
+{
+    if( test_slab )
+        gqueue_init_slab(queue, itemfree, test_slab);
+    else
+        gqueue_init(queue, itemfree);
+}
+
+void run_tests(void)
 {
     // Push and pop test
     {
         testobj_t *item;
 
         gqueue_t queue;
-        gqueue_init(&queue, (gqueue_itemfree_t)testobj_release);
+        queue_init(&queue, (gqueue_itemfree_t)testobj_release);
         assert( 0 == gqueue_get_count(&queue) );
 
         // Push - part 1
@@ -109,7 +119,7 @@ int main(int argc, char *argv[])
     // Clear test
     {
         gqueue_t queue;
-        gqueue_init(&queue, (gqueue_itemfree_t)testobj_release);
+        queue_init(&queue, (gqueue_itemfree_t)testobj_release);
         assert( 0 == gqueue_get_count(&queue) );
 
         gqueue_push(&queue, testobj_create(1));
@@ -125,6 +135,20 @@ int main(int argc, char *argv[])
         gqueue_deinit(&queue);
         assert( testobj_refcnt == 0 );
     }
+}
+
+int main(int argc, char *argv[])
+{
+    slab_t slab;
+
+    run_tests();
+
+    slab_init_concurrent(&slab, sizeof(gqueue_node_t), 0);
+    test_slab = &slab;
+    run_tests();
+    slab_flush_cache(&slab);
+    assert( 0 == slab_get_count(&slab) );
+    slab_deinit(&slab);
 
     return 0;
 }
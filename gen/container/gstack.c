@@ -8,9 +8,9 @@
 typedef gstack_node_t node_t;
 //------------------------------------------------------------------------------
 static
-node_t* node_create(node_t *prev, void *value)
+node_t* node_create(slab_t *slab, node_t *prev, void *value)
 {
-    node_t *node = malloc(sizeof(node_t));
+    node_t *node = slab ? slab_allocate(slab) : malloc(sizeof(node_t));
     assert( node );
 
     node->prev  = prev;
@@ -20,9 +20,12 @@ node_t* node_create(node_t *prev, void *value)
 }
 //------------------------------------------------------------------------------
 static
-void node_release(node_t *node)
+void node_release(slab_t *slab, node_t *node)
 {
-    free(node);
+    if( slab )
+        slab_deallocate(slab, node);
+    else
+        free(node);
 }
 //------------------------------------------------------------------------------
 //---- Stack Class -------------------------------------------------------------
@@ -48,6 +51,28 @@ void gstack_init(gstack_t *stack, gstack_itemfree_t itemfree)
     stack->top      = NULL;
     stack->count    = 0;
     stack->itemfree = itemfree ? itemfree : gstack_itemfree_default;
+    stack->slab     = NULL;
+}
+//------------------------------------------------------------------------------
+void gstack_init_slab(gstack_t *stack, gstack_itemfree_t itemfree, slab_t *slab)
+{
+    /**
+     * @memberof gstack_t
+     * @brief Constructor with a slab allocator for nodes.
+     *
+     * @param stack    Object instance.
+     * @param itemfree The function used to release an item.
+     *                 This parameter can be NULL if not needed.
+     * @param slab     The allocator of nodes, its object size must be
+     *                 at least the size of ::gstack_node_t.
+     *                 It can be shared by many containers,
+     *                 and must be valid until the container destroyed.
+     */
+    assert( stack && slab );
+    assert( slab_get_object_size(slab) >= sizeof(node_t) );
+
+    gstack_init(stack, itemfree);
+    stack->slab = slab;
 }
 //------------------------------------------------------------------------------
 void gstack_init_movefrom(gstack_t *stack, gstack_t *src)
@@ -89,7 +114,7 @@ void gstack_push(gstack_t *stack, void *item)
      */
     assert( stack );
 
-    node_t *node = node_create(stack->top, item);
+    node_t *node = node_create(stack->slab, stack->top, item);
 
     stack->top = node;
     ++ stack->count;
@@ -112,7 +137,7 @@ void gstack_pop(gstack_t *stack)
     -- stack->count;
 
     stack->itemfree(node->value);
-    node_release(node);
+    node_release(stack->slab, node);
 }
 //------------------------------------------------------------------------------
 void* gstack_get_top(gstack_t *stack)
@@ -148,7 +173,7 @@ void gstack_clear(gstack_t *stack)
         node = node->prev;
 
         stack->itemfree(nodedel->value);
-        node_release(nodedel);
+        node_release(stack->slab, nodedel);
     }
 
     stack->top   = NULL;
@@ -172,6 +197,7 @@ void gstack_movefrom(gstack_t *stack, gstack_t *src)
 
     gstack_clear(stack);
     stack->itemfree = src->itemfree;
+    stack->slab     = src->slab;
 
     stack->top   = src->top;
     stack->count = src->count;
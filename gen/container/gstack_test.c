@@ -35,10 +35,20 @@ void testobj_release(testobj_t *obj)
     free(obj);
 }
 
-int main(int argc, char *argv[])
+slab_t *test_slab = NULL;  // The node allocator to be tested, or NULL to use the system allocator.
+
+void stack_init(gstack_t *stack, gstack_itemfree_t itemfree)
+{
+    if( test_slab )
+        gstack_init_slab(stack, itemfree, test_slab);
+    else
+        gstack_init(stack, itemfree);
+}
+
+void run_tests(void)
 {
     gstack_t stack;
-    gstack_init(&stack, (gstack_itemfree_t)testobj_release);
+    stack_init(&stack, (gstack_itemfree_t)testobj_release);
 
     assert( gstack_get_count(&stack) == 0 );
     assert( testobj_refcnt == 0 );
@@ -94,6 +104,19 @@ int main(int argc, char *argv[])
 
     gstack_deinit(&stack);
     assert( testobj_refcnt == 0 );
+}
+
+int main(int argc, char *argv[])
+{
+    slab_t slab;
+
+    run_tests();
+
+    slab_init(&slab, sizeof(gstack_node_t), 0);
+    test_slab = &slab;
+    run_tests();
+    assert( 0 == slab_get_count(&slab) );
+    slab_deinit(&slab);
 
     return 0;
 }
@@ -13,6 +13,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include "../inline.h"
+#include "../slab.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -103,10 +104,13 @@ typedef struct glist_t
 
     glist_itemfree_t itemfree;
 
+    slab_t *slab;  // The allocator of nodes, or NULL to use the system allocator.
+
 } glist_t;
 
 // constructor and destructor
 void glist_init         (glist_t *list, glist_itemfree_t itemfree);
+void glist_init_slab    (glist_t *list, glist_itemfree_t itemfree, slab_t *slab);
 void glist_init_movefrom(glist_t *list, glist_t *src);
 void glist_deinit       (glist_t *list);
 
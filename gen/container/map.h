@@ -13,6 +13,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include "../inline.h"
+#include "../slab.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -136,6 +137,10 @@ typedef struct gmap_t
 void gmap_init         (gmap_t *map, gmap_tagcmp_t   tagcmp,
                                      gmap_tagfree_t  tagfree,
                                      gmap_itemfree_t itemfree);
+void gmap_init_slab    (gmap_t *map, gmap_tagcmp_t   tagcmp,
+                                     gmap_tagfree_t  tagfree,
+                                     gmap_itemfree_t itemfree,
+                                     slab_t         *slab);
 void gmap_init_movefrom(gmap_t *map, gmap_t *src);
 void gmap_deinit       (gmap_t *map);
 
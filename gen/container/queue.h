@@ -13,6 +13,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include "../inline.h"
+#include "../slab.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -66,11 +67,14 @@ typedef struct gqueue_t
 
     gqueue_itemfree_t itemfree;
 
+    slab_t *slab;  // The allocator of nodes, or NULL to use the system allocator.
+
 } gqueue_t;
 
 // constructor and destructor
-void gqueue_init  (gqueue_t *queue, gqueue_itemfree_t itemfree);
-void gqueue_deinit(gqueue_t *queue);
+void gqueue_init     (gqueue_t *queue, gqueue_itemfree_t itemfree);
+void gqueue_init_slab(gqueue_t *queue, gqueue_itemfree_t itemfree, slab_t *slab);
+void gqueue_deinit   (gqueue_t *queue);
 
 // capacity
 /// @memberof gqueue_t @brief Get items count.
@@ -13,6 +13,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include "../inline.h"
+#include "../slab.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -60,10 +61,13 @@ typedef struct gstack_t
 
     gstack_itemfree_t itemfree;
 
+    slab_t *slab;  // The allocator of nodes, or NULL to use the system allocator.
+
 } gstack_t;
 
 // constructor and destructor
 void gstack_init         (gstack_t *stack, gstack_itemfree_t itemfree);
+void gstack_init_slab    (gstack_t *stack, gstack_itemfree_t itemfree, slab_t *slab);
 void gstack_init_movefrom(gstack_t *stack, gstack_t *src);
 void gstack_deinit       (gstack_t *stack);
 
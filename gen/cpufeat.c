@@ -0,0 +1,149 @@
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__GNUC__) && ( defined(__i386__) || defined(__x86_64__) )
+#include <cpuid.h>
+#endif
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "cpufeat.h"
+
+static volatile unsigned detected_flags = 0;
+static volatile bool     detected       = false;
+static volatile unsigned usable_mask    = CPUFEAT_ALL;
+
+#ifdef CPUFEAT_X86
+//------------------------------------------------------------------------------
+static
+void cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4])
+{
+#if defined(_MSC_VER)
+    int res[4];
+    __cpuidex(res, leaf, subleaf);
+    for(int i=0; i<4; ++i)
+        regs[i] = res[i];
+#else
+    if( !__get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3]) )
+        regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#endif
+}
+//------------------------------------------------------------------------------
+static
+unsigned long long xgetbv0(void)
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ( (unsigned long long) edx << 32 ) | eax;
+#endif
+}
+#endif
+//------------------------------------------------------------------------------
+static
+unsigned detect_flags(void)
+{
+    unsigned flags = 0;
+
+#ifdef CPUFEAT_X86
+    unsigned regs[4];
+
+    cpuid(0, 0, regs);
+    unsigned max_leaf = regs[0];
+    if( max_leaf < 1 ) return 0;
+
+    cpuid(1, 0, regs);
+    unsigned ecx1 = regs[2];
+    unsigned edx1 = regs[3];
+
+    if( edx1 & ( 1 << 26 ) ) flags |= CPUFEAT_SSE2;
+    if( ecx1 & ( 1 <<  9 ) ) flags |= CPUFEAT_SSSE3;
+    if( ecx1 & ( 1 << 19 ) ) flags |= CPUFEAT_SSE41;
+    if( ecx1 & ( 1 << 20 ) ) flags |= CPUFEAT_SSE42;
+    if( ecx1 & ( 1 <<  1 ) ) flags |= CPUFEAT_PCLMUL;
+    if( ecx1 & ( 1 << 25 ) ) flags |= CPUFEAT_AESNI;
+
+    // AVX is usable only if the operating system saves the YMM registers.
+    bool os_ymm = ( ecx1 & ( 1 << 27 ) ) && ( ( xgetbv0() & 0x06 ) == 0x06 );
+    if( os_ymm && ( ecx1 & ( 1 << 28 ) ) ) flags |= CPUFEAT_AVX;
+
+    if( max_leaf >= 7 )
+    {
+        cpuid(7, 0, regs);
+        unsigned ebx7 = regs[1];
+
+        if( os_ymm && ( ebx7 & ( 1 << 5 ) ) ) flags |= CPUFEAT_AVX2;
+        if( ebx7 & ( 1 <<  8 ) ) flags |= CPUFEAT_BMI2;
+        if( ebx7 & ( 1 << 19 ) ) flags |= CPUFEAT_ADX;
+        if( ebx7 & ( 1 << 29 ) ) flags |= CPUFEAT_SHA;
+    }
+#endif
+
+    return flags;
+}
+//------------------------------------------------------------------------------
+unsigned cpufeat_get_flags(void)
+{
+    /**
+     * @brief Get features of the current processor.
+     *
+     * @return A combination of ::cpufeat_flags_t that are supported by the processor
+     *         and not masked out by ::cpufeat_set_mask.
+     *
+     * @remarks The detection runs only once,
+     *          and the result will be cached for the subsequent calls.
+     */
+    if( !detected )
+    {
+        detected_flags = detect_flags();
+        detected       = true;
+    }
+
+    return detected_flags & usable_mask;
+}
+//------------------------------------------------------------------------------
+void cpufeat_set_mask(unsigned mask)
+{
+    /**
+     * @brief Limit the features that can be used.
+     *
+     * @param mask A combination of ::cpufeat_flags_t that are allowed to be used,
+     *             and CPUFEAT_ALL to allow all features detected (the default).
+     *
+     * @remarks This function is designed for test and benchmark,
+     *          to compare an accelerated implementation with its fallback.
+     *          It should be called while no other thread using the accelerated modules.
+     */
+    usable_mask = mask;
+}
+//------------------------------------------------------------------------------
+unsigned cpufeat_get_cpu_count(void)
+{
+    /**
+     * @brief Get number of processors currently online.
+     *
+     * @return Number of processors, and will be one if it cannot be detected.
+     */
+#if defined(__linux__)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? count : 1;
+#elif defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? info.dwNumberOfProcessors : 1;
+#else
+    return 1;
+#endif
+}
+//------------------------------------------------------------------------------
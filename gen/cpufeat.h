@@ -0,0 +1,70 @@
+/**
+ * @file
+ * @brief     CPU features.
+ * @details   Run time detection of processor instruction set extensions
+ *            and the number of processors,
+ *            to help modules to select an accelerated implementation.
+ * @author    王文佑
+ * @date      2026.10.17
+ * @copyright ZLib Licence
+ * @see       http://www.openfoundry.org/of/projects/2419
+ */
+#ifndef _GEN_CPUFEAT_H_
+#define _GEN_CPUFEAT_H_
+
+#include <stdbool.h>
+#include "inline.h"
+
+/// Defined if the target is a x86 or x86-64 processor.
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+    #define CPUFEAT_X86
+#endif
+
+/// Enable an instruction set for a single function.
+#if defined(__GNUC__) && defined(CPUFEAT_X86)
+    #define CPUFEAT_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define CPUFEAT_TARGET(isa)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief CPU feature flags.
+ */
+enum cpufeat_flags_t
+{
+    CPUFEAT_SSE2   = 1<<0,  ///< SSE2.
+    CPUFEAT_SSSE3  = 1<<1,  ///< Supplemental SSE3.
+    CPUFEAT_SSE41  = 1<<2,  ///< SSE4.1.
+    CPUFEAT_SSE42  = 1<<3,  ///< SSE4.2 (includes the CRC32C instruction).
+    CPUFEAT_PCLMUL = 1<<4,  ///< Carry-less multiplication.
+    CPUFEAT_AESNI  = 1<<5,  ///< AES new instructions.
+    CPUFEAT_AVX    = 1<<6,  ///< AVX, and the operating system saves YMM registers.
+    CPUFEAT_AVX2   = 1<<7,  ///< AVX2.
+    CPUFEAT_BMI2   = 1<<8,  ///< BMI2.
+    CPUFEAT_ADX    = 1<<9,  ///< Multi-precision add-carry.
+    CPUFEAT_SHA    = 1<<10, ///< SHA extensions.
+
+    CPUFEAT_ALL    = ~0u,   ///< All features.
+};
+
+unsigned cpufeat_get_flags(void);
+void     cpufeat_set_mask(unsigned mask);
+
+unsigned cpufeat_get_cpu_count(void);
+
+INLINE
+bool cpufeat_has(unsigned flags)
+{
+    /// Check if all of the specified features (::cpufeat_flags_t) are usable.
+    return ( cpufeat_get_flags() & flags ) == flags;
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
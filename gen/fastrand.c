@@ -0,0 +1,307 @@
+#include <stdbool.h>
+#include <threads.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "fastrand.h"
+
+// Constants
+
+#define DEFSEED_XS   5489
+#define DEFSEED_PCG  5489
+
+#define PCG_MULT     0x5851F42D4C957F2D
+#define PCG_DEFINC   0x14057B7EF767814F
+
+// Default objects of each thread
+
+static thread_local xoshiro_rand64_t shrd_xs;
+static thread_local bool             shrd_xs_inited;
+static thread_local pcg_rand32_t     shrd_pcg;
+
+//------------------------------------------------------------------------------
+static xoshiro_rand64_t* xoshiro_default(void)
+{
+    if( !shrd_xs_inited )
+    {
+        xoshiro_srand64(&shrd_xs, DEFSEED_XS);
+        shrd_xs_inited = true;
+    }
+
+    return &shrd_xs;
+}
+//------------------------------------------------------------------------------
+static pcg_rand32_t* pcg_default(void)
+{
+    if( !shrd_pcg.inc )  // The increment of a seeded object is always an odd number
+        pcg_srand32(&shrd_pcg, DEFSEED_PCG);
+
+    return &shrd_pcg;
+}
+//------------------------------------------------------------------------------
+static uint64_t splitmix64(uint64_t *x)
+{
+    uint64_t z = ( *x += 0x9E3779B97F4A7C15 );
+    z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9;
+    z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EB;
+    return z ^ ( z >> 31 );
+}
+//------------------------------------------------------------------------------
+static uint64_t rotl64(uint64_t x, int k)
+{
+    return ( x << k ) | ( x >> ( 64 - k ) );
+}
+//------------------------------------------------------------------------------
+static uint64_t xoshiro_next(uint64_t s[4])
+{
+    uint64_t r = rotl64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3]  = rotl64(s[3], 45);
+
+    return r;
+}
+//------------------------------------------------------------------------------
+void xoshiro_srand64(xoshiro_rand64_t* /*optional*/ RESTRICT obj, uint64_t seed)
+{
+    /**
+     * @brief Set random seed for xoshiro256** random number generator.
+     * @param obj  Generator object.
+     *             This parameter can be NULL if no generator object assigned,
+     *             and the default object of the calling thread will be used.
+     * @param seed The random seed to initialize the generator.
+     *
+     * @remarks The state is filled by the SplitMix64 generator from the seed,
+     *          so it will never be all zero.
+     */
+    if( !obj )
+    {
+        obj            = &shrd_xs;  // 若使用者不傳入指定的物件則使用執行緒的預設物件
+        shrd_xs_inited = true;
+    }
+
+    for(int i=0; i<4; ++i)
+        obj->state[i] = splitmix64(&seed);
+}
+//------------------------------------------------------------------------------
+uint64_t xoshiro_rand64(xoshiro_rand64_t* /*optional*/ RESTRICT obj)
+{
+    /**
+     * @brief Generate 64-bits random number.
+     * @param obj Generator object.
+     *            This parameter can be NULL if no generator object assigned,
+     *            and the default object of the calling thread will be used.
+     * @return The random number generated.
+     */
+    if( !obj ) obj = xoshiro_default();
+    return xoshiro_next(obj->state);
+}
+//------------------------------------------------------------------------------
+void xoshiro_randfill64(xoshiro_rand64_t* /*optional*/ RESTRICT obj, uint64_t* RESTRICT dest, size_t count)
+{
+    /**
+     * @brief Generate a set of 64-bits random numbers.
+     * @param obj   Generator object.
+     *              This parameter can be NULL if no generator object assigned,
+     *              and the default object of the calling thread will be used.
+     * @param dest  A buffer to receive the random numbers.
+     * @param count Number of random numbers to generate.
+     */
+    uint64_t s[4];
+
+    if( !obj ) obj = xoshiro_default();
+    if( !dest ) return;
+
+    // Work on a local copy to keep the state in registers
+
+    for(int i=0; i<4; ++i) s[i] = obj->state[i];
+    while( count-- )
+        *dest++ = xoshiro_next(s);
+    for(int i=0; i<4; ++i) obj->state[i] = s[i];
+}
+//------------------------------------------------------------------------------
+static void xoshiro_jump_poly(uint64_t state[4], const uint64_t poly[4])
+{
+    /*
+     * Sum the states of the later steps selected by the jump polynomial,
+     * that is x^steps modulo the characteristic polynomial of the generator.
+     */
+    uint64_t s[4]   = { state[0], state[1], state[2], state[3] };
+    uint64_t acc[4] = { 0 };
+
+    for(int i=0; i<4; ++i)
+    {
+        for(int b=0; b<64; ++b)
+        {
+            if( poly[i] >> b & 1 )
+            {
+                acc[0] ^= s[0];
+                acc[1] ^= s[1];
+                acc[2] ^= s[2];
+                acc[3] ^= s[3];
+            }
+
+            xoshiro_next(s);
+        }
+    }
+
+    for(int i=0; i<4; ++i) state[i] = acc[i];
+}
+//------------------------------------------------------------------------------
+void xoshiro_jump64(xoshiro_rand64_t* /*optional*/ RESTRICT obj)
+{
+    /**
+     * @brief Jump ahead the xoshiro256** generator for 2^128 steps.
+     * @param obj Generator object.
+     *            This parameter can be NULL if no generator object assigned,
+     *            and the default object of the calling thread will be used.
+     *
+     * @remarks It can derive 2^128 streams, each has 2^128 numbers, for parallel computations.
+     */
+    static const uint64_t poly[4] =
+    {
+        0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C
+    };
+
+    if( !obj ) obj = xoshiro_default();
+    xoshiro_jump_poly(obj->state, poly);
+}
+//------------------------------------------------------------------------------
+void xoshiro_longjump64(xoshiro_rand64_t* /*optional*/ RESTRICT obj)
+{
+    /**
+     * @brief Jump ahead the xoshiro256** generator for 2^192 steps.
+     * @param obj Generator object.
+     *            This parameter can be NULL if no generator object assigned,
+     *            and the default object of the calling thread will be used.
+     *
+     * @remarks It can derive 2^64 starting points, and each of them can derive
+     *          more streams by ::xoshiro_jump64, for distributed computations.
+     */
+    static const uint64_t poly[4] =
+    {
+        0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635
+    };
+
+    if( !obj ) obj = xoshiro_default();
+    xoshiro_jump_poly(obj->state, poly);
+}
+//------------------------------------------------------------------------------
+static uint32_t pcg_next(uint64_t *state, uint64_t inc)
+{
+    uint64_t old = *state;
+    uint32_t x   = ( ( old >> 18 ) ^ old ) >> 27;
+    unsigned rot = old >> 59;
+
+    *state = old * PCG_MULT + inc;
+    return ( x >> rot ) | ( x << ( ( 0 - rot ) & 31 ) );
+}
+//------------------------------------------------------------------------------
+void pcg_srand32(pcg_rand32_t* /*optional*/ RESTRICT obj, uint64_t seed)
+{
+    /**
+     * @brief Set random seed for PCG32 random number generator, on the default stream.
+     * @param obj  Generator object.
+     *             This parameter can be NULL if no generator object assigned,
+     *             and the default object of the calling thread will be used.
+     * @param seed The random seed to initialize the generator.
+     */
+    pcg_srand32_stream(obj, seed, PCG_DEFINC >> 1);
+}
+//------------------------------------------------------------------------------
+void pcg_srand32_stream(pcg_rand32_t* /*optional*/ RESTRICT obj, uint64_t seed, uint64_t stream)
+{
+    /**
+     * @brief Set random seed for PCG32 random number generator, and select a stream.
+     * @param obj    Generator object.
+     *               This parameter can be NULL if no generator object assigned,
+     *               and the default object of the calling thread will be used.
+     * @param seed   The random seed to initialize the generator.
+     * @param stream The stream to use, generators on different streams give different sequences
+     *               even with the same seed, and only the lower 63 bits are used.
+     */
+    if( !obj ) obj = &shrd_pcg;  // 若使用者不傳入指定的物件則使用執行緒的預設物件
+
+    obj->state = 0;
+    obj->inc   = ( stream << 1 ) | 1;
+    pcg_next(&obj->state, obj->inc);
+    obj->state += seed;
+    pcg_next(&obj->state, obj->inc);
+}
+//------------------------------------------------------------------------------
+uint32_t pcg_rand32(pcg_rand32_t* /*optional*/ RESTRICT obj)
+{
+    /**
+     * @brief Generate 32-bits random number.
+     * @param obj Generator object.
+     *            This parameter can be NULL if no generator object assigned,
+     *            and the default object of the calling thread will be used.
+     * @return The random number generated.
+     */
+    if( !obj ) obj = pcg_default();
+    return pcg_next(&obj->state, obj->inc);
+}
+//------------------------------------------------------------------------------
+void pcg_randfill32(pcg_rand32_t* /*optional*/ RESTRICT obj, uint32_t* RESTRICT dest, size_t count)
+{
+    /**
+     * @brief Generate a set of 32-bits random numbers.
+     * @param obj   Generator object.
+     *              This parameter can be NULL if no generator object assigned,
+     *              and the default object of the calling thread will be used.
+     * @param dest  A buffer to receive the random numbers.
+     * @param count Number of random numbers to generate.
+     */
+    uint64_t state;
+
+    if( !obj ) obj = pcg_default();
+    if( !dest ) return;
+
+    state = obj->state;
+    while( count-- )
+        *dest++ = pcg_next(&state, obj->inc);
+    obj->state = state;
+}
+//------------------------------------------------------------------------------
+void pcg_jump32(pcg_rand32_t* /*optional*/ RESTRICT obj, uint64_t steps)
+{
+    /**
+     * @brief Jump ahead the PCG32 generator.
+     * @param obj   Generator object.
+     *              This parameter can be NULL if no generator object assigned,
+     *              and the default object of the calling thread will be used.
+     * @param steps Number of random numbers to skip,
+     *              and it can be (2^64 - n) to jump back n steps.
+     *
+     * @remarks The cost is proportional to the bits of the steps,
+     *          by composing the LCG steps of powers of two.
+     */
+    uint64_t mult = PCG_MULT;
+    uint64_t inc;
+    uint64_t acc_mult = 1;
+    uint64_t acc_inc  = 0;
+
+    if( !obj ) obj = pcg_default();
+
+    for(inc = obj->inc; steps; steps >>= 1)
+    {
+        if( steps & 1 )
+        {
+            acc_mult *= mult;
+            acc_inc   = acc_inc * mult + inc;
+        }
+
+        inc  = ( mult + 1 ) * inc;
+        mult = mult * mult;
+    }
+
+    obj->state = acc_mult * obj->state + acc_inc;
+}
+//------------------------------------------------------------------------------
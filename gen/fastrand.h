@@ -0,0 +1,66 @@
+/**
+ * @file
+ * @brief     Fast random number.
+ * @details   Small state random number generators : xoshiro256** and PCG32.
+ * @author    王文佑
+ * @date      2026.10.17
+ * @copyright ZLib Licence
+ * @see       http://www.openfoundry.org/of/projects/2419
+ */
+#ifndef _GEN_FASTRAND_H_
+#define _GEN_FASTRAND_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "restrict.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * When to use these generators ?
+ *
+ *     These generators are not for cryptography, but they are much faster than
+ * the Mersenne Twister (see mtrand.h), and have only 32 or 16 bytes of state,
+ * so one object can be given to each thread or each connection.
+ *
+ *     The usage is the same as the Mersenne Twister generators, a NULL pointer
+ * can be passed for the object, but here the default object is owned by
+ * each thread, so it is safe for multi-thread usage.
+ * And the sequences are reproducible with the same seed.
+ *
+ *     Independent streams can be derived by jumps : seed a generator,
+ * copy it for each thread, and jump the copy of the n-th thread n times.
+ */
+
+/// xoshiro256** random object - 64 bits output
+typedef struct xoshiro_rand64_t
+{
+    uint64_t state[4];
+} xoshiro_rand64_t;
+
+void     xoshiro_srand64   (xoshiro_rand64_t* RESTRICT obj, uint64_t seed);
+uint64_t xoshiro_rand64    (xoshiro_rand64_t* RESTRICT obj);
+void     xoshiro_randfill64(xoshiro_rand64_t* RESTRICT obj, uint64_t* RESTRICT dest, size_t count);
+void     xoshiro_jump64    (xoshiro_rand64_t* RESTRICT obj);
+void     xoshiro_longjump64(xoshiro_rand64_t* RESTRICT obj);
+
+/// PCG32 (XSH RR) random object - 32 bits output
+typedef struct pcg_rand32_t
+{
+    uint64_t state;
+    uint64_t inc;    ///< Increment of the LCG, it selects the stream and must be an odd number.
+} pcg_rand32_t;
+
+void     pcg_srand32       (pcg_rand32_t* RESTRICT obj, uint64_t seed);
+void     pcg_srand32_stream(pcg_rand32_t* RESTRICT obj, uint64_t seed, uint64_t stream);
+uint32_t pcg_rand32        (pcg_rand32_t* RESTRICT obj);
+void     pcg_randfill32    (pcg_rand32_t* RESTRICT obj, uint32_t* RESTRICT dest, size_t count);
+void     pcg_jump32        (pcg_rand32_t* RESTRICT obj, uint64_t steps);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "cpufeat.h"
+#include "fastrand.h"
+#include "mtrand.h"
+#include "systime.h"
+
+#define BENCH_COUNT    ( 64 * 1024 )  // Numbers generated in each round.
+#define BENCH_DURATION 500 // Milliseconds.
+
+typedef void(*bench_func_t)(void *dest, size_t count);
+
+static mt_rand64_t      gen_mt;
+static xoshiro_rand64_t gen_xs;
+static pcg_rand32_t     gen_pcg;
+
+//------------------------------------------------------------------------------
+void bench_mt_single(void *dest, size_t count)
+{
+    uint64_t *buf = dest;
+    for(size_t i=0; i<count; ++i)
+        buf[i] = mt_rand64(&gen_mt);
+}
+//------------------------------------------------------------------------------
+void bench_mt_fill(void *dest, size_t count)
+{
+    mt_randfill64(&gen_mt, dest, count);
+}
+//------------------------------------------------------------------------------
+void bench_xs_single(void *dest, size_t count)
+{
+    uint64_t *buf = dest;
+    for(size_t i=0; i<count; ++i)
+        buf[i] = xoshiro_rand64(&gen_xs);
+}
+//------------------------------------------------------------------------------
+void bench_xs_fill(void *dest, size_t count)
+{
+    xoshiro_randfill64(&gen_xs, dest, count);
+}
+//------------------------------------------------------------------------------
+void bench_pcg_single(void *dest, size_t count)
+{
+    uint32_t *buf = dest;
+    for(size_t i=0; i<count; ++i)
+        buf[i] = pcg_rand32(&gen_pcg);
+}
+//------------------------------------------------------------------------------
+void bench_pcg_fill(void *dest, size_t count)
+{
+    pcg_randfill32(&gen_pcg, dest, count);
+}
+//------------------------------------------------------------------------------
+double bench_throughput(bench_func_t func, void *dest, size_t size)
+{
+    // Run the function repeatedly in a period of time, and return the throughput in MB/s.
+    unsigned rounds = 0;
+
+    func(dest, BENCH_COUNT);  // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(dest, BENCH_COUNT);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    return (double) size * BENCH_COUNT * rounds / ( 1024 * 1024 ) / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_print(const char *name, bench_func_t func, void *dest, size_t size, double speed_base)
+{
+    double speed = bench_throughput(func, dest, size);
+
+    printf("%-18s %8.1f MB/s (x%.2f)\n", name, speed, speed / speed_base);
+}
+//------------------------------------------------------------------------------
+int main(void)
+{
+    uint64_t *buf = malloc(BENCH_COUNT * sizeof(uint64_t));
+    if( !buf ) return 1;
+
+    mt_srand64(&gen_mt, 1);
+    xoshiro_srand64(&gen_xs, 1);
+    pcg_srand32(&gen_pcg, 1);
+
+    printf("CPU features : 0x%X\n", cpufeat_get_flags());
+    printf("Object size  : MT19937-64 %u bytes, xoshiro256** %u bytes, PCG32 %u bytes\n",
+           (unsigned) sizeof(gen_mt),
+           (unsigned) sizeof(gen_xs),
+           (unsigned) sizeof(gen_pcg));
+
+    double speed_base = bench_throughput(bench_mt_single, buf, sizeof(uint64_t));
+    printf("%-18s %8.1f MB/s\n", "MT19937-64", speed_base);
+
+    bench_print("MT19937-64/fill"  , bench_mt_fill   , buf, sizeof(uint64_t), speed_base);
+    bench_print("xoshiro256**"     , bench_xs_single , buf, sizeof(uint64_t), speed_base);
+    bench_print("xoshiro256**/fill", bench_xs_fill   , buf, sizeof(uint64_t), speed_base);
+    bench_print("PCG32"            , bench_pcg_single, buf, sizeof(uint32_t), speed_base);
+    bench_print("PCG32/fill"       , bench_pcg_fill  , buf, sizeof(uint32_t), speed_base);
+
+    free(buf);
+    return 0;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,156 @@
+/*
+ * Fast Random Number Generators (fastrand) 測試程式
+ */
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "fastrand.h"
+
+#ifdef NDEBUG
+    #error This test program must work with macro "ASSERT" enabled!
+#endif
+
+// Test resources for xoshiro256** random number generator
+
+const uint64_t test_state_xs[4] = { 1, 2, 3, 4 };
+
+const uint64_t test_res_xs[] =
+{
+    0x0000000000002D00,
+    0x0000000000000000,
+    0x000000005A007080,
+    0x10E0000000009D80,
+    0x10E0B61CE1009D80,
+    0x0870021CE143AD00
+};
+
+const int test_cnt_xs = sizeof(test_res_xs)/sizeof(test_res_xs[0]);
+
+const uint64_t test_res_xs_jump[] =
+{
+    0xBBD2F312298443D8,
+    0x62E57DB2D5706577,
+    0x34D1890374A6D72B
+};
+
+const uint64_t test_res_xs_longjump[] =
+{
+    0x527752A1D792704D,
+    0xD8D8BDEC57599E64,
+    0x601CB926727EB003
+};
+
+// Test resources for PCG32 random number generator
+
+const uint64_t test_seed_pcg   = 42;
+const uint64_t test_stream_pcg = 54;
+
+const uint32_t test_res_pcg[] =
+{
+    0xA15C02B7,
+    0x7B47F409,
+    0xBA1D3330,
+    0x83D2F293,
+    0xBFA4784B,
+    0xCBED606E
+};
+
+const int test_cnt_pcg = sizeof(test_res_pcg)/sizeof(test_res_pcg[0]);
+
+// Main test process
+
+void test_xoshiro(void)
+{
+    xoshiro_rand64_t gen1, gen2;
+    uint64_t         buf[100];
+    int              i;
+
+    memcpy(gen1.state, test_state_xs, sizeof(gen1.state));
+    for(i=0; i<test_cnt_xs; ++i)
+        assert( xoshiro_rand64(&gen1) == test_res_xs[i] );
+
+    memcpy(gen1.state, test_state_xs, sizeof(gen1.state));
+    xoshiro_jump64(&gen1);
+    for(i=0; i<3; ++i)
+        assert( xoshiro_rand64(&gen1) == test_res_xs_jump[i] );
+
+    memcpy(gen1.state, test_state_xs, sizeof(gen1.state));
+    xoshiro_longjump64(&gen1);
+    for(i=0; i<3; ++i)
+        assert( xoshiro_rand64(&gen1) == test_res_xs_longjump[i] );
+
+    // Seeds and the default object
+
+    xoshiro_srand64(&gen1, 5489);
+    assert( xoshiro_rand64(NULL) == xoshiro_rand64(&gen1) );
+    xoshiro_srand64(NULL, 1234);
+    xoshiro_srand64(&gen2, 1234);
+    assert( xoshiro_rand64(NULL) == xoshiro_rand64(&gen2) );
+
+    // Block generation
+
+    xoshiro_srand64(&gen1, 1234);
+    xoshiro_srand64(&gen2, 1234);
+    xoshiro_randfill64(&gen2, buf, 100);
+    for(i=0; i<100; ++i)
+        assert( buf[i] == xoshiro_rand64(&gen1) );
+    assert( xoshiro_rand64(&gen1) == xoshiro_rand64(&gen2) );
+}
+
+void test_pcg(void)
+{
+    pcg_rand32_t gen1, gen2;
+    uint32_t     buf[100];
+    int          i;
+
+    pcg_srand32_stream(&gen1, test_seed_pcg, test_stream_pcg);
+    for(i=0; i<test_cnt_pcg; ++i)
+        assert( pcg_rand32(&gen1) == test_res_pcg[i] );
+
+    // Seeds, streams and the default object
+
+    pcg_srand32(&gen1, 5489);
+    assert( pcg_rand32(NULL) == pcg_rand32(&gen1) );
+    pcg_srand32(NULL, 1234);
+    pcg_srand32(&gen2, 1234);
+    assert( pcg_rand32(NULL) == pcg_rand32(&gen2) );
+
+    pcg_srand32_stream(&gen1, 1234, 1);
+    pcg_srand32_stream(&gen2, 1234, 2);
+    assert( pcg_rand32(&gen1) != pcg_rand32(&gen2) );
+
+    // Block generation
+
+    pcg_srand32(&gen1, 1234);
+    pcg_srand32(&gen2, 1234);
+    pcg_randfill32(&gen2, buf, 100);
+    for(i=0; i<100; ++i)
+        assert( buf[i] == pcg_rand32(&gen1) );
+    assert( pcg_rand32(&gen1) == pcg_rand32(&gen2) );
+
+    // Jumps, forward and backward
+
+    pcg_srand32(&gen1, 1234);
+    pcg_srand32(&gen2, 1234);
+    pcg_jump32(&gen2, 1000);
+    for(i=0; i<1000; ++i)
+        pcg_rand32(&gen1);
+    assert( pcg_rand32(&gen1) == pcg_rand32(&gen2) );
+
+    pcg_jump32(&gen2, (uint64_t)0 - 1001);
+    pcg_srand32(&gen1, 1234);
+    assert( pcg_rand32(&gen1) == pcg_rand32(&gen2) );
+}
+
+int main(void)
+{
+    test_xoshiro();
+    test_pcg();
+
+    return 0;
+}
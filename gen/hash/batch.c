@@ -0,0 +1,363 @@
+#include <assert.h>
+#include <string.h>
+#include "../cpufeat.h"
+#include "../endian.h"
+#include "md5.h"
+#include "sha.h"
+#include "sha_ni.h"
+#include "batch.h"
+
+#ifdef CPUFEAT_X86
+#include <immintrin.h>
+#endif
+
+#define BLOCK_SIZE 64
+#define LANES_MAX  8
+#define LANE_IDLE  ((size_t)-1)
+
+static const uint32_t md5_k[64] =
+{
+    0xD76AA478, 0xE8C7B756, 0x242070DB, 0xC1BDCEEE, 0xF57C0FAF, 0x4787C62A, 0xA8304613, 0xFD469501,
+    0x698098D8, 0x8B44F7AF, 0xFFFF5BB1, 0x895CD7BE, 0x6B901122, 0xFD987193, 0xA679438E, 0x49B40821,
+    0xF61E2562, 0xC040B340, 0x265E5A51, 0xE9B6C7AA, 0xD62F105D, 0x02441453, 0xD8A1E681, 0xE7D3FBC8,
+    0x21E1CDE6, 0xC33707D6, 0xF4D50D87, 0x455A14ED, 0xA9E3E905, 0xFCEFA3F8, 0x676F02D9, 0x8D2A4C8A,
+    0xFFFA3942, 0x8771F681, 0x6D9D6122, 0xFDE5380C, 0xA4BEEA44, 0x4BDECFA9, 0xF6BB4B60, 0xBEBFBC70,
+    0x289B7EC6, 0xEAA127FA, 0xD4EF3085, 0x04881D05, 0xD9D4D039, 0xE6DB99E5, 0x1FA27CF8, 0xC4AC5665,
+    0xF4292244, 0x432AFF97, 0xAB9423A7, 0xFC93A039, 0x655B59C3, 0x8F0CCC92, 0xFFEFF47D, 0x85845DD1,
+    0x6FA87E4F, 0xFE2CE6E0, 0xA3014314, 0x4E0811A1, 0xF7537E82, 0xBD3AF235, 0x2AD7D2BB, 0xEB86D391
+};
+
+static const uint32_t sha_256_k[64] =
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+#ifdef CPUFEAT_X86
+
+// SSE2 kernels, 4 lanes.
+#define LANES           4
+#define VEC             __m128i
+#define KERNEL(name)    name##_x4
+#define KERNEL_TARGET   CPUFEAT_TARGET("sse2")
+#define VLOAD(p)        _mm_loadu_si128((const __m128i*)(p))
+#define VSTORE(p,v)     _mm_storeu_si128((__m128i*)(p), v)
+#define VSET1(x)        _mm_set1_epi32(x)
+#define VSETW(w)        _mm_loadu_si128((const __m128i*)(w))
+#define VADD(a,b)       _mm_add_epi32(a, b)
+#define VAND(a,b)       _mm_and_si128(a, b)
+#define VOR(a,b)        _mm_or_si128(a, b)
+#define VXOR(a,b)       _mm_xor_si128(a, b)
+#define VANDNOT(a,b)    _mm_andnot_si128(a, b)
+#define VSHL(a,n)       _mm_slli_epi32(a, n)
+#define VSHR(a,n)       _mm_srli_epi32(a, n)
+#include "batch_kernel.h"
+#undef LANES
+#undef VEC
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VSETW
+#undef VADD
+#undef VAND
+#undef VOR
+#undef VXOR
+#undef VANDNOT
+#undef VSHL
+#undef VSHR
+
+// AVX2 kernels, 8 lanes.
+#define LANES           8
+#define VEC             __m256i
+#define KERNEL(name)    name##_x8
+#define KERNEL_TARGET   CPUFEAT_TARGET("avx2")
+#define VLOAD(p)        _mm256_loadu_si256((const __m256i*)(p))
+#define VSTORE(p,v)     _mm256_storeu_si256((__m256i*)(p), v)
+#define VSET1(x)        _mm256_set1_epi32(x)
+#define VSETW(w)        _mm256_loadu_si256((const __m256i*)(w))
+#define VADD(a,b)       _mm256_add_epi32(a, b)
+#define VAND(a,b)       _mm256_and_si256(a, b)
+#define VOR(a,b)        _mm256_or_si256(a, b)
+#define VXOR(a,b)       _mm256_xor_si256(a, b)
+#define VANDNOT(a,b)    _mm256_andnot_si256(a, b)
+#define VSHL(a,n)       _mm256_slli_epi32(a, n)
+#define VSHR(a,n)       _mm256_srli_epi32(a, n)
+#include "batch_kernel.h"
+#undef LANES
+#undef VEC
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef VLOAD
+#undef VSTORE
+#undef VSET1
+#undef VSETW
+#undef VADD
+#undef VAND
+#undef VOR
+#undef VXOR
+#undef VANDNOT
+#undef VSHL
+#undef VSHR
+
+#endif  // CPUFEAT_X86
+
+/// Kernel to process one block of each lane.
+typedef void(*lanes_kernel_t)(uint32_t *state, const uint8_t *const blocks[]);
+
+typedef struct algo_t
+{
+    const uint32_t *state0;
+    unsigned        state_words;
+    unsigned        digest_size;
+    bool            big_endian;
+} algo_t;
+
+static const uint32_t md5_state0[4] =
+{
+    0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476
+};
+
+static const uint32_t sha_256_state0[8] =
+{
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+static const algo_t algo_md5     = { md5_state0    , 4, 16, false };
+static const algo_t algo_sha_256 = { sha_256_state0, 8, 32, true  };
+
+typedef struct lane_t
+{
+    size_t         index;                   // Index of the message, or LANE_IDLE.
+    const uint8_t *pos;                     // The next whole block of the message.
+    size_t         blocks;                  // Number of whole blocks remained.
+    unsigned       tailpos;                 // Offset of the next block in the tail buffer.
+    unsigned       tailsize;                // Size of the tail blocks.
+    uint8_t        tail[ 2 * BLOCK_SIZE ];  // The last partial block and the padding.
+} lane_t;
+
+//------------------------------------------------------------------------------
+static
+void lane_assign(lane_t           *lane,
+                 const algo_t     *algo,
+                 uint32_t         *state,
+                 unsigned          lanes,
+                 unsigned          id,
+                 const hash_msg_t *msg,
+                 size_t            index)
+{
+    lane->index = index;
+    if( index == LANE_IDLE ) return;
+
+    for(unsigned i=0; i<algo->state_words; ++i)
+        state[ i*lanes + id ] = algo->state0[i];
+
+    size_t   size = msg->size;
+    unsigned rest = size % BLOCK_SIZE;
+
+    lane->pos     = msg->data;
+    lane->blocks  = size / BLOCK_SIZE;
+    lane->tailpos = 0;
+
+    // Build the tail blocks with the padding bit, zeros, and the message size in bits.
+    lane->tailsize = ( rest + 1 + sizeof(uint64_t) <= BLOCK_SIZE )?( BLOCK_SIZE ):( 2 * BLOCK_SIZE );
+    memset(lane->tail, 0, lane->tailsize);
+    if( rest )
+        memcpy(lane->tail, lane->pos + lane->blocks * BLOCK_SIZE, rest);
+    lane->tail[rest] = 0x80;
+
+    uint64_t bitsize = (uint64_t) size << 3;
+    bitsize = algo->big_endian ? endian_local_to_be_64(bitsize) : endian_local_to_le_64(bitsize);
+    memcpy(lane->tail + lane->tailsize - sizeof(bitsize), &bitsize, sizeof(bitsize));
+}
+//------------------------------------------------------------------------------
+static
+const uint8_t* lane_next_block(lane_t *lane)
+{
+    static const uint8_t idle_block[BLOCK_SIZE] = {0};
+
+    if( lane->index == LANE_IDLE )
+        return idle_block;
+
+    if( lane->blocks )
+    {
+        const uint8_t *block = lane->pos;
+        lane->pos += BLOCK_SIZE;
+        --lane->blocks;
+
+        return block;
+    }
+
+    const uint8_t *block = lane->tail + lane->tailpos;
+    lane->tailpos += BLOCK_SIZE;
+
+    return block;
+}
+//------------------------------------------------------------------------------
+static
+bool lane_is_finished(const lane_t *lane)
+{
+    return lane->index != LANE_IDLE && !lane->blocks && lane->tailpos >= lane->tailsize;
+}
+//------------------------------------------------------------------------------
+static
+void lane_output(const lane_t   *lane,
+                 const algo_t   *algo,
+                 const uint32_t *state,
+                 unsigned        lanes,
+                 unsigned        id,
+                 uint8_t        *dests)
+{
+    uint8_t *dest = dests + lane->index * algo->digest_size;
+    for(unsigned i=0; i<algo->state_words; ++i)
+    {
+        uint32_t value = state[ i*lanes + id ];
+        value = algo->big_endian ? endian_local_to_be_32(value) : endian_local_to_le_32(value);
+        memcpy(dest + i*sizeof(value), &value, sizeof(value));
+    }
+}
+//------------------------------------------------------------------------------
+static
+void batch_run(const algo_t     *algo,
+               lanes_kernel_t    kernel,
+               unsigned          lanes,
+               uint8_t          *dests,
+               const hash_msg_t *msgs,
+               size_t            count)
+{
+    /*
+     * Each lane processes one message, and will be assigned a new message
+     * as soon as its current message finished,
+     * so that messages with different sizes can still fill all lanes.
+     */
+    assert( lanes <= LANES_MAX );
+
+    lane_t         lane[LANES_MAX];
+    uint32_t       state[ 8 * LANES_MAX ];
+    const uint8_t *blocks[LANES_MAX];
+
+    size_t   next   = 0;
+    unsigned active = 0;
+    for(unsigned id=0; id<lanes; ++id)
+    {
+        if( next < count )
+        {
+            lane_assign(&lane[id], algo, state, lanes, id, &msgs[next], next);
+            ++next;
+            ++active;
+        }
+        else
+        {
+            lane_assign(&lane[id], algo, state, lanes, id, NULL, LANE_IDLE);
+        }
+    }
+
+    while( active )
+    {
+        for(unsigned id=0; id<lanes; ++id)
+            blocks[id] = lane_next_block(&lane[id]);
+
+        kernel(state, blocks);
+
+        for(unsigned id=0; id<lanes; ++id)
+        {
+            if( !lane_is_finished(&lane[id]) ) continue;
+
+            lane_output(&lane[id], algo, state, lanes, id, dests);
+            if( next < count )
+            {
+                lane_assign(&lane[id], algo, state, lanes, id, &msgs[next], next);
+                ++next;
+            }
+            else
+            {
+                lane_assign(&lane[id], algo, state, lanes, id, NULL, LANE_IDLE);
+                --active;
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------
+void md5_batch(void *dests, const hash_msg_t *msgs, size_t count)
+{
+    /**
+     * MD5 hashing of many messages.
+     *
+     * @param dests A buffer to receive the 16-bytes hash data of each message,
+     *              and its size must be at least 16 * @a count bytes.
+     * @param msgs  The messages to calculate.
+     * @param count Number of messages.
+     *
+     * @remarks Messages will be processed in AVX2 or SSE2 lanes if they are available.
+     *          The lanes will be used most efficiently when messages have similar sizes.
+     */
+    assert( dests && ( msgs || !count ) );
+
+#ifdef CPUFEAT_X86
+    if( count > 1 && cpufeat_has(CPUFEAT_AVX2) )
+    {
+        batch_run(&algo_md5, md5_lanes_x8, 8, dests, msgs, count);
+        return;
+    }
+    if( count > 1 && cpufeat_has(CPUFEAT_SSE2) )
+    {
+        batch_run(&algo_md5, md5_lanes_x4, 4, dests, msgs, count);
+        return;
+    }
+#endif
+
+    for(size_t i=0; i<count; ++i)
+    {
+        md5_t ctx;
+        md5_init(&ctx);
+        md5_update(&ctx, msgs[i].data, msgs[i].size);
+        md5_final(&ctx, (uint8_t*) dests + 16*i);
+    }
+}
+//------------------------------------------------------------------------------
+void sha_256_batch(void *dests, const hash_msg_t *msgs, size_t count)
+{
+    /**
+     * SHA 256-bits hashing of many messages.
+     *
+     * @param dests A buffer to receive the 32-bytes hash data of each message,
+     *              and its size must be at least 32 * @a count bytes.
+     * @param msgs  The messages to calculate.
+     * @param count Number of messages.
+     *
+     * @remarks Messages will be processed in AVX2 or SSE2 lanes if they are available.
+     *          The lanes will be used most efficiently when messages have similar sizes.
+     *          But if the SHA extensions are available, messages will be processed one by one,
+     *          because that is faster than the lanes.
+     */
+    assert( dests && ( msgs || !count ) );
+
+#ifdef CPUFEAT_X86
+    if( count > 1 && cpufeat_has(CPUFEAT_AVX2) && !cpufeat_has(SHA_NI_FEATURES) )
+    {
+        batch_run(&algo_sha_256, sha_256_lanes_x8, 8, dests, msgs, count);
+        return;
+    }
+    if( count > 1 && cpufeat_has(CPUFEAT_SSE2) && !cpufeat_has(SHA_NI_FEATURES) )
+    {
+        batch_run(&algo_sha_256, sha_256_lanes_x4, 4, dests, msgs, count);
+        return;
+    }
+#endif
+
+    for(size_t i=0; i<count; ++i)
+    {
+        sha_256_t ctx;
+        sha_256_init(&ctx);
+        sha_256_update(&ctx, msgs[i].data, msgs[i].size);
+        sha_256_final(&ctx, (uint8_t*) dests + 32*i);
+    }
+}
+//------------------------------------------------------------------------------
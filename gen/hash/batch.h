@@ -0,0 +1,36 @@
+/**
+ * @file
+ * @brief     Batch hashing.
+ * @details   Hash many independent messages at once,
+ *            and messages will be processed in SIMD lanes if it is possible.
+ * @author    王文佑
+ * @date      2026.10.17
+ * @copyright ZLib Licence
+ * @see       http://www.openfoundry.org/of/projects/2419
+ */
+#ifndef _GEN_HASH_BATCH_H_
+#define _GEN_HASH_BATCH_H_
+
+#include "../type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief A message to be hashed in batch.
+ */
+typedef struct hash_msg_t
+{
+    const void *data;  ///< Data to calculate.
+    size_t      size;  ///< Size of input data.
+} hash_msg_t;
+
+void md5_batch    (void *dests, const hash_msg_t *msgs, size_t count);
+void sha_256_batch(void *dests, const hash_msg_t *msgs, size_t count);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
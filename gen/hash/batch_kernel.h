@@ -0,0 +1,165 @@
+/*
+ * PRIVATE USAGE
+ *
+ * Multi-buffer hashing kernels template.
+ *
+ * This file will be included by the batch hashing module with the vector operation macros
+ * defined for a specific instruction set, to generate kernels that process
+ * one block of each lane at once.
+ *
+ * Macros need to be defined before include :
+ *   LANES           Number of lanes.
+ *   VEC             The vector type.
+ *   KERNEL(name)    Decorate the kernel name.
+ *   KERNEL_TARGET   Instruction set decoration of the kernels.
+ *   VLOAD(p)        Load a vector from memory.
+ *   VSTORE(p,v)     Store a vector to memory.
+ *   VSET1(x)        Broadcast a 32-bits value.
+ *   VSETW(w)        Create a vector from the array @a w of LANES 32-bits values.
+ *   VADD(a,b)       Addition of 32-bits elements.
+ *   VAND(a,b)       Bitwise AND.
+ *   VOR(a,b)        Bitwise OR.
+ *   VXOR(a,b)       Bitwise XOR.
+ *   VANDNOT(a,b)    Bitwise (~a)&b.
+ *   VSHL(a,n)       Shift 32-bits elements left by a constant.
+ *   VSHR(a,n)       Shift 32-bits elements right by a constant.
+ */
+
+#define VROTL(a,n) VOR( VSHL(a,n), VSHR(a,32-(n)) )
+#define VROTR(a,n) VOR( VSHR(a,n), VSHL(a,32-(n)) )
+
+//------------------------------------------------------------------------------
+KERNEL_TARGET
+static inline
+VEC KERNEL(load_words)(const uint8_t *const blocks[], unsigned index, bool big_endian)
+{
+    uint32_t words[LANES];
+    for(unsigned i=0; i<LANES; ++i)
+    {
+        uint32_t value;
+        memcpy(&value, blocks[i] + 4*index, sizeof(value));
+        words[i] = big_endian ? endian_be_to_local_32(value) : endian_le_to_local_32(value);
+    }
+
+    return VSETW(words);
+}
+//------------------------------------------------------------------------------
+#define MD5_F(b,c,d) VOR( VAND(b,c), VANDNOT(b,d) )
+#define MD5_G(b,c,d) VOR( VAND(d,b), VANDNOT(d,c) )
+#define MD5_H(b,c,d) VXOR( VXOR(b,c), d )
+#define MD5_I(b,c,d) VXOR( c, VOR(b, VXOR(d, VSET1(0xFFFFFFFF))) )
+
+#define MD5_ROUND(func, a, b, c, d, g, i, s)                                        \
+    a = VADD( b, VROTL( VADD( VADD(a, func(b,c,d)), VADD(VSET1(md5_k[i]), w[g]) ), s ) );
+
+//------------------------------------------------------------------------------
+KERNEL_TARGET
+static
+void KERNEL(md5_lanes)(uint32_t *state, const uint8_t *const blocks[])
+{
+    VEC w[16];
+    for(unsigned i=0; i<16; ++i)
+        w[i] = KERNEL(load_words)(blocks, i, false);
+
+    VEC a = VLOAD(state + 0*LANES);
+    VEC b = VLOAD(state + 1*LANES);
+    VEC c = VLOAD(state + 2*LANES);
+    VEC d = VLOAD(state + 3*LANES);
+
+    VEC a0 = a, b0 = b, c0 = c, d0 = d;
+
+    for(int i=0; i<16; i+=4)
+    {
+        MD5_ROUND(MD5_F, a, b, c, d,   i+0             , i+0,  7);
+        MD5_ROUND(MD5_F, d, a, b, c,   i+1             , i+1, 12);
+        MD5_ROUND(MD5_F, c, d, a, b,   i+2             , i+2, 17);
+        MD5_ROUND(MD5_F, b, c, d, a,   i+3             , i+3, 22);
+    }
+    for(int i=16; i<32; i+=4)
+    {
+        MD5_ROUND(MD5_G, a, b, c, d, ( 5*(i+0) + 1 ) & 0x0F, i+0,  5);
+        MD5_ROUND(MD5_G, d, a, b, c, ( 5*(i+1) + 1 ) & 0x0F, i+1,  9);
+        MD5_ROUND(MD5_G, c, d, a, b, ( 5*(i+2) + 1 ) & 0x0F, i+2, 14);
+        MD5_ROUND(MD5_G, b, c, d, a, ( 5*(i+3) + 1 ) & 0x0F, i+3, 20);
+    }
+    for(int i=32; i<48; i+=4)
+    {
+        MD5_ROUND(MD5_H, a, b, c, d, ( 3*(i+0) + 5 ) & 0x0F, i+0,  4);
+        MD5_ROUND(MD5_H, d, a, b, c, ( 3*(i+1) + 5 ) & 0x0F, i+1, 11);
+        MD5_ROUND(MD5_H, c, d, a, b, ( 3*(i+2) + 5 ) & 0x0F, i+2, 16);
+        MD5_ROUND(MD5_H, b, c, d, a, ( 3*(i+3) + 5 ) & 0x0F, i+3, 23);
+    }
+    for(int i=48; i<64; i+=4)
+    {
+        MD5_ROUND(MD5_I, a, b, c, d, ( 7*(i+0)     ) & 0x0F, i+0,  6);
+        MD5_ROUND(MD5_I, d, a, b, c, ( 7*(i+1)     ) & 0x0F, i+1, 10);
+        MD5_ROUND(MD5_I, c, d, a, b, ( 7*(i+2)     ) & 0x0F, i+2, 15);
+        MD5_ROUND(MD5_I, b, c, d, a, ( 7*(i+3)     ) & 0x0F, i+3, 21);
+    }
+
+    VSTORE(state + 0*LANES, VADD(a, a0));
+    VSTORE(state + 1*LANES, VADD(b, b0));
+    VSTORE(state + 2*LANES, VADD(c, c0));
+    VSTORE(state + 3*LANES, VADD(d, d0));
+}
+//------------------------------------------------------------------------------
+KERNEL_TARGET
+static
+void KERNEL(sha_256_lanes)(uint32_t *state, const uint8_t *const blocks[])
+{
+    VEC w[64];
+    for(unsigned i=0; i<16; ++i)
+        w[i] = KERNEL(load_words)(blocks, i, true);
+    for(unsigned i=16; i<64; ++i)
+    {
+        VEC s0 = VXOR( VXOR( VROTR(w[i-15],  7), VROTR(w[i-15], 18) ), VSHR(w[i-15],  3) );
+        VEC s1 = VXOR( VXOR( VROTR(w[i- 2], 17), VROTR(w[i- 2], 19) ), VSHR(w[i- 2], 10) );
+        w[i] = VADD( VADD(w[i-16], s0), VADD(w[i-7], s1) );
+    }
+
+    VEC a = VLOAD(state + 0*LANES);
+    VEC b = VLOAD(state + 1*LANES);
+    VEC c = VLOAD(state + 2*LANES);
+    VEC d = VLOAD(state + 3*LANES);
+    VEC e = VLOAD(state + 4*LANES);
+    VEC f = VLOAD(state + 5*LANES);
+    VEC g = VLOAD(state + 6*LANES);
+    VEC h = VLOAD(state + 7*LANES);
+
+    for(unsigned i=0; i<64; ++i)
+    {
+        VEC s1    = VXOR( VXOR( VROTR(e, 6), VROTR(e, 11) ), VROTR(e, 25) );
+        VEC ch    = VXOR( VAND(e, f), VANDNOT(e, g) );
+        VEC temp1 = VADD( VADD(h, s1), VADD( ch, VADD(VSET1(sha_256_k[i]), w[i]) ) );
+        VEC s0    = VXOR( VXOR( VROTR(a, 2), VROTR(a, 13) ), VROTR(a, 22) );
+        VEC maj   = VXOR( VXOR( VAND(a, b), VAND(a, c) ), VAND(b, c) );
+        VEC temp2 = VADD(s0, maj);
+
+        h = g;
+        g = f;
+        f = e;
+        e = VADD(d, temp1);
+        d = c;
+        c = b;
+        b = a;
+        a = VADD(temp1, temp2);
+    }
+
+    VSTORE(state + 0*LANES, VADD(a, VLOAD(state + 0*LANES)));
+    VSTORE(state + 1*LANES, VADD(b, VLOAD(state + 1*LANES)));
+    VSTORE(state + 2*LANES, VADD(c, VLOAD(state + 2*LANES)));
+    VSTORE(state + 3*LANES, VADD(d, VLOAD(state + 3*LANES)));
+    VSTORE(state + 4*LANES, VADD(e, VLOAD(state + 4*LANES)));
+    VSTORE(state + 5*LANES, VADD(f, VLOAD(state + 5*LANES)));
+    VSTORE(state + 6*LANES, VADD(g, VLOAD(state + 6*LANES)));
+    VSTORE(state + 7*LANES, VADD(h, VLOAD(state + 7*LANES)));
+}
+//------------------------------------------------------------------------------
+
+#undef VROTL
+#undef VROTR
+#undef MD5_F
+#undef MD5_G
+#undef MD5_H
+#undef MD5_I
+#undef MD5_ROUND
@@ -0,0 +1,1112 @@
+/*
+ * CRC Slicing Table
+ *
+ * Table [k][i] is the CRC register value of byte i followed by k zero bytes,
+ * which is used to process 8 bytes at once (slicing-by-8).
+ */
+#ifndef _GEN_CRC_TABLE_H_
+#define _GEN_CRC_TABLE_H_
+
+#include "../type.h"
+
+// CRC-16-CCITT, polynomial 0x1021, tables of 1 to 7 bytes look ahead.
+static const uint16_t hash_crc16_ccitt_slice_table[7][256] =
+{
+    {
+        0x0000, 0x0759, 0x0EB2, 0x09EB, 0x1D64, 0x1A3D, 0x13D6, 0x148F,
+        0x1A8B, 0x1DD2, 0x1439, 0x1360, 0x07EF, 0x00B6, 0x095D, 0x0E04,
+        0x1555, 0x120C, 0x1BE7, 0x1CBE, 0x0831, 0x0F68, 0x0683, 0x01DA,
+        0x0FDE, 0x0887, 0x016C, 0x0635, 0x12BA, 0x15E3, 0x1C08, 0x1B51,
+        0x0AE9, 0x0DB0, 0x045B, 0x0302, 0x178D, 0x10D4, 0x193F, 0x1E66,
+        0x1062, 0x173B, 0x1ED0, 0x1989, 0x0D06, 0x0A5F, 0x03B4, 0x04ED,
+        0x1FBC, 0x18E5, 0x110E, 0x1657, 0x02D8, 0x0581, 0x0C6A, 0x0B33,
+        0x0537, 0x026E, 0x0B85, 0x0CDC, 0x1853, 0x1F0A, 0x16E1, 0x11B8,
+
+        0x15D2, 0x128B, 0x1B60, 0x1C39, 0x08B6, 0x0FEF, 0x0604, 0x015D,
+        0x0F59, 0x0800, 0x01EB, 0x06B2, 0x123D, 0x1564, 0x1C8F, 0x1BD6,
+        0x0087, 0x07DE, 0x0E35, 0x096C, 0x1DE3, 0x1ABA, 0x1351, 0x1408,
+        0x1A0C, 0x1D55, 0x14BE, 0x13E7, 0x0768, 0x0031, 0x09DA, 0x0E83,
+        0x1F3B, 0x1862, 0x1189, 0x16D0, 0x025F, 0x0506, 0x0CED, 0x0BB4,
+        0x05B0, 0x02E9, 0x0B02, 0x0C5B, 0x18D4, 0x1F8D, 0x1666, 0x113F,
+        0x0A6E, 0x0D37, 0x04DC, 0x0385, 0x170A, 0x1053, 0x19B8, 0x1EE1,
+        0x10E5, 0x17BC, 0x1E57, 0x190E, 0x0D81, 0x0AD8, 0x0333, 0x046A,
+
+        0x0BE7, 0x0CBE, 0x0555, 0x020C, 0x1683, 0x11DA, 0x1831, 0x1F68,
+        0x116C, 0x1635, 0x1FDE, 0x1887, 0x0C08, 0x0B51, 0x02BA, 0x05E3,
+        0x1EB2, 0x19EB, 0x1000, 0x1759, 0x03D6, 0x048F, 0x0D64, 0x0A3D,
+        0x0439, 0x0360, 0x0A8B, 0x0DD2, 0x195D, 0x1E04, 0x17EF, 0x10B6,
+        0x010E, 0x0657, 0x0FBC, 0x08E5, 0x1C6A, 0x1B33, 0x12D8, 0x1581,
+        0x1B85, 0x1CDC, 0x1537, 0x126E, 0x06E1, 0x01B8, 0x0853, 0x0F0A,
+        0x145B, 0x1302, 0x1AE9, 0x1DB0, 0x093F, 0x0E66, 0x078D, 0x00D4,
+        0x0ED0, 0x0989, 0x0062, 0x073B, 0x13B4, 0x14ED, 0x1D06, 0x1A5F,
+
+        0x1E35, 0x196C, 0x1087, 0x17DE, 0x0351, 0x0408, 0x0DE3, 0x0ABA,
+        0x04BE, 0x03E7, 0x0A0C, 0x0D55, 0x19DA, 0x1E83, 0x1768, 0x1031,
+        0x0B60, 0x0C39, 0x05D2, 0x028B, 0x1604, 0x115D, 0x18B6, 0x1FEF,
+        0x11EB, 0x16B2, 0x1F59, 0x1800, 0x0C8F, 0x0BD6, 0x023D, 0x0564,
+        0x14DC, 0x1385, 0x1A6E, 0x1D37, 0x09B8, 0x0EE1, 0x070A, 0x0053,
+        0x0E57, 0x090E, 0x00E5, 0x07BC, 0x1333, 0x146A, 0x1D81, 0x1AD8,
+        0x0189, 0x06D0, 0x0F3B, 0x0862, 0x1CED, 0x1BB4, 0x125F, 0x1506,
+        0x1B02, 0x1C5B, 0x15B0, 0x12E9, 0x0666, 0x013F, 0x08D4, 0x0F8D
+    },
+    {
+        0x0000, 0x0EFA, 0x1DF4, 0x130E, 0x1BAB, 0x1551, 0x065F, 0x08A5,
+        0x1715, 0x19EF, 0x0AE1, 0x041B, 0x0CBE, 0x0244, 0x114A, 0x1FB0,
+        0x0E69, 0x0093, 0x139D, 0x1D67, 0x15C2, 0x1B38, 0x0836, 0x06CC,
+        0x197C, 0x1786, 0x0488, 0x0A72, 0x02D7, 0x0C2D, 0x1F23, 0x11D9,
+        0x1CD2, 0x1228, 0x0126, 0x0FDC, 0x0779, 0x0983, 0x1A8D, 0x1477,
+        0x0BC7, 0x053D, 0x1633, 0x18C9, 0x106C, 0x1E96, 0x0D98, 0x0362,
+        0x12BB, 0x1C41, 0x0F4F, 0x01B5, 0x0910, 0x07EA, 0x14E4, 0x1A1E,
+        0x05AE, 0x0B54, 0x185A, 0x16A0, 0x1E05, 0x10FF, 0x03F1, 0x0D0B,
+
+        0x19E7, 0x171D, 0x0413, 0x0AE9, 0x024C, 0x0CB6, 0x1FB8, 0x1142,
+        0x0EF2, 0x0008, 0x1306, 0x1DFC, 0x1559, 0x1BA3, 0x08AD, 0x0657,
+        0x178E, 0x1974, 0x0A7A, 0x0480, 0x0C25, 0x02DF, 0x11D1, 0x1F2B,
+        0x009B, 0x0E61, 0x1D6F, 0x1395, 0x1B30, 0x15CA, 0x06C4, 0x083E,
+        0x0535, 0x0BCF, 0x18C1, 0x163B, 0x1E9E, 0x1064, 0x036A, 0x0D90,
+        0x1220, 0x1CDA, 0x0FD4, 0x012E, 0x098B, 0x0771, 0x147F, 0x1A85,
+        0x0B5C, 0x05A6, 0x16A8, 0x1852, 0x10F7, 0x1E0D, 0x0D03, 0x03F9,
+        0x1C49, 0x12B3, 0x01BD, 0x0F47, 0x07E2, 0x0918, 0x1A16, 0x14EC,
+
+        0x138D, 0x1D77, 0x0E79, 0x0083, 0x0826, 0x06DC, 0x15D2, 0x1B28,
+        0x0498, 0x0A62, 0x196C, 0x1796, 0x1F33, 0x11C9, 0x02C7, 0x0C3D,
+        0x1DE4, 0x131E, 0x0010, 0x0EEA, 0x064F, 0x08B5, 0x1BBB, 0x1541,
+        0x0AF1, 0x040B, 0x1705, 0x19FF, 0x115A, 0x1FA0, 0x0CAE, 0x0254,
+        0x0F5F, 0x01A5, 0x12AB, 0x1C51, 0x14F4, 0x1A0E, 0x0900, 0x07FA,
+        0x184A, 0x16B0, 0x05BE, 0x0B44, 0x03E1, 0x0D1B, 0x1E15, 0x10EF,
+        0x0136, 0x0FCC, 0x1CC2, 0x1238, 0x1A9D, 0x1467, 0x0769, 0x0993,
+        0x1623, 0x18D9, 0x0BD7, 0x052D, 0x0D88, 0x0372, 0x107C, 0x1E86,
+
+        0x0A6A, 0x0490, 0x179E, 0x1964, 0x11C1, 0x1F3B, 0x0C35, 0x02CF,
+        0x1D7F, 0x1385, 0x008B, 0x0E71, 0x06D4, 0x082E, 0x1B20, 0x15DA,
+        0x0403, 0x0AF9, 0x19F7, 0x170D, 0x1FA8, 0x1152, 0x025C, 0x0CA6,
+        0x1316, 0x1DEC, 0x0EE2, 0x0018, 0x08BD, 0x0647, 0x1549, 0x1BB3,
+        0x16B8, 0x1842, 0x0B4C, 0x05B6, 0x0D13, 0x03E9, 0x10E7, 0x1E1D,
+        0x01AD, 0x0F57, 0x1C59, 0x12A3, 0x1A06, 0x14FC, 0x07F2, 0x0908,
+        0x18D1, 0x162B, 0x0525, 0x0BDF, 0x037A, 0x0D80, 0x1E8E, 0x1074,
+        0x0FC4, 0x013E, 0x1230, 0x1CCA, 0x146F, 0x1A95, 0x099B, 0x0761
+    },
+    {
+        0x0000, 0x1AFA, 0x15B7, 0x0F4D, 0x0B2D, 0x11D7, 0x1E9A, 0x0460,
+        0x165A, 0x0CA0, 0x03ED, 0x1917, 0x1D77, 0x078D, 0x08C0, 0x123A,
+        0x0CF7, 0x160D, 0x1940, 0x03BA, 0x07DA, 0x1D20, 0x126D, 0x0897,
+        0x1AAD, 0x0057, 0x0F1A, 0x15E0, 0x1180, 0x0B7A, 0x0437, 0x1ECD,
+        0x19EE, 0x0314, 0x0C59, 0x16A3, 0x12C3, 0x0839, 0x0774, 0x1D8E,
+        0x0FB4, 0x154E, 0x1A03, 0x00F9, 0x0499, 0x1E63, 0x112E, 0x0BD4,
+        0x1519, 0x0FE3, 0x00AE, 0x1A54, 0x1E34, 0x04CE, 0x0B83, 0x1179,
+        0x0343, 0x19B9, 0x16F4, 0x0C0E, 0x086E, 0x1294, 0x1DD9, 0x0723,
+
+        0x139F, 0x0965, 0x0628, 0x1CD2, 0x18B2, 0x0248, 0x0D05, 0x17FF,
+        0x05C5, 0x1F3F, 0x1072, 0x0A88, 0x0EE8, 0x1412, 0x1B5F, 0x01A5,
+        0x1F68, 0x0592, 0x0ADF, 0x1025, 0x1445, 0x0EBF, 0x01F2, 0x1B08,
+        0x0932, 0x13C8, 0x1C85, 0x067F, 0x021F, 0x18E5, 0x17A8, 0x0D52,
+        0x0A71, 0x108B, 0x1FC6, 0x053C, 0x015C, 0x1BA6, 0x14EB, 0x0E11,
+        0x1C2B, 0x06D1, 0x099C, 0x1366, 0x1706, 0x0DFC, 0x02B1, 0x184B,
+        0x0686, 0x1C7C, 0x1331, 0x09CB, 0x0DAB, 0x1751, 0x181C, 0x02E6,
+        0x10DC, 0x0A26, 0x056B, 0x1F91, 0x1BF1, 0x010B, 0x0E46, 0x14BC,
+
+        0x077D, 0x1D87, 0x12CA, 0x0830, 0x0C50, 0x16AA, 0x19E7, 0x031D,
+        0x1127, 0x0BDD, 0x0490, 0x1E6A, 0x1A0A, 0x00F0, 0x0FBD, 0x1547,
+        0x0B8A, 0x1170, 0x1E3D, 0x04C7, 0x00A7, 0x1A5D, 0x1510, 0x0FEA,
+        0x1DD0, 0x072A, 0x0867, 0x129D, 0x16FD, 0x0C07, 0x034A, 0x19B0,
+        0x1E93, 0x0469, 0x0B24, 0x11DE, 0x15BE, 0x0F44, 0x0009, 0x1AF3,
+        0x08C9, 0x1233, 0x1D7E, 0x0784, 0x03E4, 0x191E, 0x1653, 0x0CA9,
+        0x1264, 0x089E, 0x07D3, 0x1D29, 0x1949, 0x03B3, 0x0CFE, 0x1604,
+        0x043E, 0x1EC4, 0x1189, 0x0B73, 0x0F13, 0x15E9, 0x1AA4, 0x005E,
+
+        0x14E2, 0x0E18, 0x0155, 0x1BAF, 0x1FCF, 0x0535, 0x0A78, 0x1082,
+        0x02B8, 0x1842, 0x170F, 0x0DF5, 0x0995, 0x136F, 0x1C22, 0x06D8,
+        0x1815, 0x02EF, 0x0DA2, 0x1758, 0x1338, 0x09C2, 0x068F, 0x1C75,
+        0x0E4F, 0x14B5, 0x1BF8, 0x0102, 0x0562, 0x1F98, 0x10D5, 0x0A2F,
+        0x0D0C, 0x17F6, 0x18BB, 0x0241, 0x0621, 0x1CDB, 0x1396, 0x096C,
+        0x1B56, 0x01AC, 0x0EE1, 0x141B, 0x107B, 0x0A81, 0x05CC, 0x1F36,
+        0x01FB, 0x1B01, 0x144C, 0x0EB6, 0x0AD6, 0x102C, 0x1F61, 0x059B,
+        0x17A1, 0x0D5B, 0x0216, 0x18EC, 0x1C8C, 0x0676, 0x093B, 0x13C1
+    },
+    {
+        0x0000, 0x1AEE, 0x159F, 0x0F71, 0x0B7D, 0x1193, 0x1EE2, 0x040C,
+        0x16FA, 0x0C14, 0x0365, 0x198B, 0x1D87, 0x0769, 0x0818, 0x12F6,
+        0x0DB7, 0x1759, 0x1828, 0x02C6, 0x06CA, 0x1C24, 0x1355, 0x09BB,
+        0x1B4D, 0x01A3, 0x0ED2, 0x143C, 0x1030, 0x0ADE, 0x05AF, 0x1F41,
+        0x1B6E, 0x0180, 0x0EF1, 0x141F, 0x1013, 0x0AFD, 0x058C, 0x1F62,
+        0x0D94, 0x177A, 0x180B, 0x02E5, 0x06E9, 0x1C07, 0x1376, 0x0998,
+        0x16D9, 0x0C37, 0x0346, 0x19A8, 0x1DA4, 0x074A, 0x083B, 0x12D5,
+        0x0023, 0x1ACD, 0x15BC, 0x0F52, 0x0B5E, 0x11B0, 0x1EC1, 0x042F,
+
+        0x169F, 0x0C71, 0x0300, 0x19EE, 0x1DE2, 0x070C, 0x087D, 0x1293,
+        0x0065, 0x1A8B, 0x15FA, 0x0F14, 0x0B18, 0x11F6, 0x1E87, 0x0469,
+        0x1B28, 0x01C6, 0x0EB7, 0x1459, 0x1055, 0x0ABB, 0x05CA, 0x1F24,
+        0x0DD2, 0x173C, 0x184D, 0x02A3, 0x06AF, 0x1C41, 0x1330, 0x09DE,
+        0x0DF1, 0x171F, 0x186E, 0x0280, 0x068C, 0x1C62, 0x1313, 0x09FD,
+        0x1B0B, 0x01E5, 0x0E94, 0x147A, 0x1076, 0x0A98, 0x05E9, 0x1F07,
+        0x0046, 0x1AA8, 0x15D9, 0x0F37, 0x0B3B, 0x11D5, 0x1EA4, 0x044A,
+        0x16BC, 0x0C52, 0x0323, 0x19CD, 0x1DC1, 0x072F, 0x085E, 0x12B0,
+
+        0x0D7D, 0x1793, 0x18E2, 0x020C, 0x0600, 0x1CEE, 0x139F, 0x0971,
+        0x1B87, 0x0169, 0x0E18, 0x14F6, 0x10FA, 0x0A14, 0x0565, 0x1F8B,
+        0x00CA, 0x1A24, 0x1555, 0x0FBB, 0x0BB7, 0x1159, 0x1E28, 0x04C6,
+        0x1630, 0x0CDE, 0x03AF, 0x1941, 0x1D4D, 0x07A3, 0x08D2, 0x123C,
+        0x1613, 0x0CFD, 0x038C, 0x1962, 0x1D6E, 0x0780, 0x08F1, 0x121F,
+        0x00E9, 0x1A07, 0x1576, 0x0F98, 0x0B94, 0x117A, 0x1E0B, 0x04E5,
+        0x1BA4, 0x014A, 0x0E3B, 0x14D5, 0x10D9, 0x0A37, 0x0546, 0x1FA8,
+        0x0D5E, 0x17B0, 0x18C1, 0x022F, 0x0623, 0x1CCD, 0x13BC, 0x0952,
+
+        0x1BE2, 0x010C, 0x0E7D, 0x1493, 0x109F, 0x0A71, 0x0500, 0x1FEE,
+        0x0D18, 0x17F6, 0x1887, 0x0269, 0x0665, 0x1C8B, 0x13FA, 0x0914,
+        0x1655, 0x0CBB, 0x03CA, 0x1924, 0x1D28, 0x07C6, 0x08B7, 0x1259,
+        0x00AF, 0x1A41, 0x1530, 0x0FDE, 0x0BD2, 0x113C, 0x1E4D, 0x04A3,
+        0x008C, 0x1A62, 0x1513, 0x0FFD, 0x0BF1, 0x111F, 0x1E6E, 0x0480,
+        0x1676, 0x0C98, 0x03E9, 0x1907, 0x1D0B, 0x07E5, 0x0894, 0x127A,
+        0x0D3B, 0x17D5, 0x18A4, 0x024A, 0x0646, 0x1CA8, 0x13D9, 0x0937,
+        0x1BC1, 0x012F, 0x0E5E, 0x14B0, 0x10BC, 0x0A52, 0x0523, 0x1FCD
+    },
+    {
+        0x0000, 0x1B6D, 0x1699, 0x0DF4, 0x0D71, 0x161C, 0x1BE8, 0x0085,
+        0x1AE2, 0x018F, 0x0C7B, 0x1716, 0x1793, 0x0CFE, 0x010A, 0x1A67,
+        0x1587, 0x0EEA, 0x031E, 0x1873, 0x18F6, 0x039B, 0x0E6F, 0x1502,
+        0x0F65, 0x1408, 0x19FC, 0x0291, 0x0214, 0x1979, 0x148D, 0x0FE0,
+        0x0B4D, 0x1020, 0x1DD4, 0x06B9, 0x063C, 0x1D51, 0x10A5, 0x0BC8,
+        0x11AF, 0x0AC2, 0x0736, 0x1C5B, 0x1CDE, 0x07B3, 0x0A47, 0x112A,
+        0x1ECA, 0x05A7, 0x0853, 0x133E, 0x13BB, 0x08D6, 0x0522, 0x1E4F,
+        0x0428, 0x1F45, 0x12B1, 0x09DC, 0x0959, 0x1234, 0x1FC0, 0x04AD,
+
+        0x169A, 0x0DF7, 0x0003, 0x1B6E, 0x1BEB, 0x0086, 0x0D72, 0x161F,
+        0x0C78, 0x1715, 0x1AE1, 0x018C, 0x0109, 0x1A64, 0x1790, 0x0CFD,
+        0x031D, 0x1870, 0x1584, 0x0EE9, 0x0E6C, 0x1501, 0x18F5, 0x0398,
+        0x19FF, 0x0292, 0x0F66, 0x140B, 0x148E, 0x0FE3, 0x0217, 0x197A,
+        0x1DD7, 0x06BA, 0x0B4E, 0x1023, 0x10A6, 0x0BCB, 0x063F, 0x1D52,
+        0x0735, 0x1C58, 0x11AC, 0x0AC1, 0x0A44, 0x1129, 0x1CDD, 0x07B0,
+        0x0850, 0x133D, 0x1EC9, 0x05A4, 0x0521, 0x1E4C, 0x13B8, 0x08D5,
+        0x12B2, 0x09DF, 0x042B, 0x1F46, 0x1FC3, 0x04AE, 0x095A, 0x1237,
+
+        0x0D77, 0x161A, 0x1BEE, 0x0083, 0x0006, 0x1B6B, 0x169F, 0x0DF2,
+        0x1795, 0x0CF8, 0x010C, 0x1A61, 0x1AE4, 0x0189, 0x0C7D, 0x1710,
+        0x18F0, 0x039D, 0x0E69, 0x1504, 0x1581, 0x0EEC, 0x0318, 0x1875,
+        0x0212, 0x197F, 0x148B, 0x0FE6, 0x0F63, 0x140E, 0x19FA, 0x0297,
+        0x063A, 0x1D57, 0x10A3, 0x0BCE, 0x0B4B, 0x1026, 0x1DD2, 0x06BF,
+        0x1CD8, 0x07B5, 0x0A41, 0x112C, 0x11A9, 0x0AC4, 0x0730, 0x1C5D,
+        0x13BD, 0x08D0, 0x0524, 0x1E49, 0x1ECC, 0x05A1, 0x0855, 0x1338,
+        0x095F, 0x1232, 0x1FC6, 0x04AB, 0x042E, 0x1F43, 0x12B7, 0x09DA,
+
+        0x1BED, 0x0080, 0x0D74, 0x1619, 0x169C, 0x0DF1, 0x0005, 0x1B68,
+        0x010F, 0x1A62, 0x1796, 0x0CFB, 0x0C7E, 0x1713, 0x1AE7, 0x018A,
+        0x0E6A, 0x1507, 0x18F3, 0x039E, 0x031B, 0x1876, 0x1582, 0x0EEF,
+        0x1488, 0x0FE5, 0x0211, 0x197C, 0x19F9, 0x0294, 0x0F60, 0x140D,
+        0x10A0, 0x0BCD, 0x0639, 0x1D54, 0x1DD1, 0x06BC, 0x0B48, 0x1025,
+        0x0A42, 0x112F, 0x1CDB, 0x07B6, 0x0733, 0x1C5E, 0x11AA, 0x0AC7,
+        0x0527, 0x1E4A, 0x13BE, 0x08D3, 0x0856, 0x133B, 0x1ECF, 0x05A2,
+        0x1FC5, 0x04A8, 0x095C, 0x1231, 0x12B4, 0x09D9, 0x042D, 0x1F40
+    },
+    {
+        0x0000, 0x135C, 0x06FB, 0x15A7, 0x0DF6, 0x1EAA, 0x0B0D, 0x1851,
+        0x1BEC, 0x08B0, 0x1D17, 0x0E4B, 0x161A, 0x0546, 0x10E1, 0x03BD,
+        0x179B, 0x04C7, 0x1160, 0x023C, 0x1A6D, 0x0931, 0x1C96, 0x0FCA,
+        0x0C77, 0x1F2B, 0x0A8C, 0x19D0, 0x0181, 0x12DD, 0x077A, 0x1426,
+        0x0F75, 0x1C29, 0x098E, 0x1AD2, 0x0283, 0x11DF, 0x0478, 0x1724,
+        0x1499, 0x07C5, 0x1262, 0x013E, 0x196F, 0x0A33, 0x1F94, 0x0CC8,
+        0x18EE, 0x0BB2, 0x1E15, 0x0D49, 0x1518, 0x0644, 0x13E3, 0x00BF,
+        0x0302, 0x105E, 0x05F9, 0x16A5, 0x0EF4, 0x1DA8, 0x080F, 0x1B53,
+
+        0x1EEA, 0x0DB6, 0x1811, 0x0B4D, 0x131C, 0x0040, 0x15E7, 0x06BB,
+        0x0506, 0x165A, 0x03FD, 0x10A1, 0x08F0, 0x1BAC, 0x0E0B, 0x1D57,
+        0x0971, 0x1A2D, 0x0F8A, 0x1CD6, 0x0487, 0x17DB, 0x027C, 0x1120,
+        0x129D, 0x01C1, 0x1466, 0x073A, 0x1F6B, 0x0C37, 0x1990, 0x0ACC,
+        0x119F, 0x02C3, 0x1764, 0x0438, 0x1C69, 0x0F35, 0x1A92, 0x09CE,
+        0x0A73, 0x192F, 0x0C88, 0x1FD4, 0x0785, 0x14D9, 0x017E, 0x1222,
+        0x0604, 0x1558, 0x00FF, 0x13A3, 0x0BF2, 0x18AE, 0x0D09, 0x1E55,
+        0x1DE8, 0x0EB4, 0x1B13, 0x084F, 0x101E, 0x0342, 0x16E5, 0x05B9,
+
+        0x1D97, 0x0ECB, 0x1B6C, 0x0830, 0x1061, 0x033D, 0x169A, 0x05C6,
+        0x067B, 0x1527, 0x0080, 0x13DC, 0x0B8D, 0x18D1, 0x0D76, 0x1E2A,
+        0x0A0C, 0x1950, 0x0CF7, 0x1FAB, 0x07FA, 0x14A6, 0x0101, 0x125D,
+        0x11E0, 0x02BC, 0x171B, 0x0447, 0x1C16, 0x0F4A, 0x1AED, 0x09B1,
+        0x12E2, 0x01BE, 0x1419, 0x0745, 0x1F14, 0x0C48, 0x19EF, 0x0AB3,
+        0x090E, 0x1A52, 0x0FF5, 0x1CA9, 0x04F8, 0x17A4, 0x0203, 0x115F,
+        0x0579, 0x1625, 0x0382, 0x10DE, 0x088F, 0x1BD3, 0x0E74, 0x1D28,
+        0x1E95, 0x0DC9, 0x186E, 0x0B32, 0x1363, 0x003F, 0x1598, 0x06C4,
+
+        0x037D, 0x1021, 0x0586, 0x16DA, 0x0E8B, 0x1DD7, 0x0870, 0x1B2C,
+        0x1891, 0x0BCD, 0x1E6A, 0x0D36, 0x1567, 0x063B, 0x139C, 0x00C0,
+        0x14E6, 0x07BA, 0x121D, 0x0141, 0x1910, 0x0A4C, 0x1FEB, 0x0CB7,
+        0x0F0A, 0x1C56, 0x09F1, 0x1AAD, 0x02FC, 0x11A0, 0x0407, 0x175B,
+        0x0C08, 0x1F54, 0x0AF3, 0x19AF, 0x01FE, 0x12A2, 0x0705, 0x1459,
+        0x17E4, 0x04B8, 0x111F, 0x0243, 0x1A12, 0x094E, 0x1CE9, 0x0FB5,
+        0x1B93, 0x08CF, 0x1D68, 0x0E34, 0x1665, 0x0539, 0x109E, 0x03C2,
+        0x007F, 0x1323, 0x0684, 0x15D8, 0x0D89, 0x1ED5, 0x0B72, 0x182E
+    },
+    {
+        0x0000, 0x069E, 0x0D3C, 0x0BA2, 0x1A78, 0x1CE6, 0x1744, 0x11DA,
+        0x14B3, 0x122D, 0x198F, 0x1F11, 0x0ECB, 0x0855, 0x03F7, 0x0569,
+        0x0925, 0x0FBB, 0x0419, 0x0287, 0x135D, 0x15C3, 0x1E61, 0x18FF,
+        0x1D96, 0x1B08, 0x10AA, 0x1634, 0x07EE, 0x0170, 0x0AD2, 0x0C4C,
+        0x124A, 0x14D4, 0x1F76, 0x19E8, 0x0832, 0x0EAC, 0x050E, 0x0390,
+        0x06F9, 0x0067, 0x0BC5, 0x0D5B, 0x1C81, 0x1A1F, 0x11BD, 0x1723,
+        0x1B6F, 0x1DF1, 0x1653, 0x10CD, 0x0117, 0x0789, 0x0C2B, 0x0AB5,
+        0x0FDC, 0x0942, 0x02E0, 0x047E, 0x15A4, 0x133A, 0x1898, 0x1E06,
+
+        0x04D7, 0x0249, 0x09EB, 0x0F75, 0x1EAF, 0x1831, 0x1393, 0x150D,
+        0x1064, 0x16FA, 0x1D58, 0x1BC6, 0x0A1C, 0x0C82, 0x0720, 0x01BE,
+        0x0DF2, 0x0B6C, 0x00CE, 0x0650, 0x178A, 0x1114, 0x1AB6, 0x1C28,
+        0x1941, 0x1FDF, 0x147D, 0x12E3, 0x0339, 0x05A7, 0x0E05, 0x089B,
+        0x169D, 0x1003, 0x1BA1, 0x1D3F, 0x0CE5, 0x0A7B, 0x01D9, 0x0747,
+        0x022E, 0x04B0, 0x0F12, 0x098C, 0x1856, 0x1EC8, 0x156A, 0x13F4,
+        0x1FB8, 0x1926, 0x1284, 0x141A, 0x05C0, 0x035E, 0x08FC, 0x0E62,
+        0x0B0B, 0x0D95, 0x0637, 0x00A9, 0x1173, 0x17ED, 0x1C4F, 0x1AD1,
+
+        0x09AE, 0x0F30, 0x0492, 0x020C, 0x13D6, 0x1548, 0x1EEA, 0x1874,
+        0x1D1D, 0x1B83, 0x1021, 0x16BF, 0x0765, 0x01FB, 0x0A59, 0x0CC7,
+        0x008B, 0x0615, 0x0DB7, 0x0B29, 0x1AF3, 0x1C6D, 0x17CF, 0x1151,
+        0x1438, 0x12A6, 0x1904, 0x1F9A, 0x0E40, 0x08DE, 0x037C, 0x05E2,
+        0x1BE4, 0x1D7A, 0x16D8, 0x1046, 0x019C, 0x0702, 0x0CA0, 0x0A3E,
+        0x0F57, 0x09C9, 0x026B, 0x04F5, 0x152F, 0x13B1, 0x1813, 0x1E8D,
+        0x12C1, 0x145F, 0x1FFD, 0x1963, 0x08B9, 0x0E27, 0x0585, 0x031B,
+        0x0672, 0x00EC, 0x0B4E, 0x0DD0, 0x1C0A, 0x1A94, 0x1136, 0x17A8,
+
+        0x0D79, 0x0BE7, 0x0045, 0x06DB, 0x1701, 0x119F, 0x1A3D, 0x1CA3,
+        0x19CA, 0x1F54, 0x14F6, 0x1268, 0x03B2, 0x052C, 0x0E8E, 0x0810,
+        0x045C, 0x02C2, 0x0960, 0x0FFE, 0x1E24, 0x18BA, 0x1318, 0x1586,
+        0x10EF, 0x1671, 0x1DD3, 0x1B4D, 0x0A97, 0x0C09, 0x07AB, 0x0135,
+        0x1F33, 0x19AD, 0x120F, 0x1491, 0x054B, 0x03D5, 0x0877, 0x0EE9,
+        0x0B80, 0x0D1E, 0x06BC, 0x0022, 0x11F8, 0x1766, 0x1CC4, 0x1A5A,
+        0x1616, 0x1088, 0x1B2A, 0x1DB4, 0x0C6E, 0x0AF0, 0x0152, 0x07CC,
+        0x02A5, 0x043B, 0x0F99, 0x0907, 0x18DD, 0x1E43, 0x15E1, 0x137F
+    }
+};
+
+// CRC-16-IBM, polynomial 0x8005, tables of 1 to 7 bytes look ahead.
+static const uint16_t hash_crc16_ibm_slice_table[7][256] =
+{
+    {
+        0x0000, 0xCB90, 0x972B, 0x5CBB, 0x2E5D, 0xE5CD, 0xB976, 0x72E6,
+        0x5CBA, 0x972A, 0xCB91, 0x0001, 0x72E7, 0xB977, 0xE5CC, 0x2E5C,
+        0xB974, 0x72E4, 0x2E5F, 0xE5CF, 0x9729, 0x5CB9, 0x0002, 0xCB92,
+        0xE5CE, 0x2E5E, 0x72E5, 0xB975, 0xCB93, 0x0003, 0x5CB8, 0x9728,
+        0x72E3, 0xB973, 0xE5C8, 0x2E58, 0x5CBE, 0x972E, 0xCB95, 0x0005,
+        0x2E59, 0xE5C9, 0xB972, 0x72E2, 0x0004, 0xCB94, 0x972F, 0x5CBF,
+        0xCB97, 0x0007, 0x5CBC, 0x972C, 0xE5CA, 0x2E5A, 0x72E1, 0xB971,
+        0x972D, 0x5CBD, 0x0006, 0xCB96, 0xB970, 0x72E0, 0x2E5B, 0xE5CB,
+
+        0xE5C6, 0x2E56, 0x72ED, 0xB97D, 0xCB9B, 0x000B, 0x5CB0, 0x9720,
+        0xB97C, 0x72EC, 0x2E57, 0xE5C7, 0x9721, 0x5CB1, 0x000A, 0xCB9A,
+        0x5CB2, 0x9722, 0xCB99, 0x0009, 0x72EF, 0xB97F, 0xE5C4, 0x2E54,
+        0x0008, 0xCB98, 0x9723, 0x5CB3, 0x2E55, 0xE5C5, 0xB97E, 0x72EE,
+        0x9725, 0x5CB5, 0x000E, 0xCB9E, 0xB978, 0x72E8, 0x2E53, 0xE5C3,
+        0xCB9F, 0x000F, 0x5CB4, 0x9724, 0xE5C2, 0x2E52, 0x72E9, 0xB979,
+        0x2E51, 0xE5C1, 0xB97A, 0x72EA, 0x000C, 0xCB9C, 0x9727, 0x5CB7,
+        0x72EB, 0xB97B, 0xE5C0, 0x2E50, 0x5CB6, 0x9726, 0xCB9D, 0x000D,
+
+        0xCB87, 0x0017, 0x5CAC, 0x973C, 0xE5DA, 0x2E4A, 0x72F1, 0xB961,
+        0x973D, 0x5CAD, 0x0016, 0xCB86, 0xB960, 0x72F0, 0x2E4B, 0xE5DB,
+        0x72F3, 0xB963, 0xE5D8, 0x2E48, 0x5CAE, 0x973E, 0xCB85, 0x0015,
+        0x2E49, 0xE5D9, 0xB962, 0x72F2, 0x0014, 0xCB84, 0x973F, 0x5CAF,
+        0xB964, 0x72F4, 0x2E4F, 0xE5DF, 0x9739, 0x5CA9, 0x0012, 0xCB82,
+        0xE5DE, 0x2E4E, 0x72F5, 0xB965, 0xCB83, 0x0013, 0x5CA8, 0x9738,
+        0x0010, 0xCB80, 0x973B, 0x5CAB, 0x2E4D, 0xE5DD, 0xB966, 0x72F6,
+        0x5CAA, 0x973A, 0xCB81, 0x0011, 0x72F7, 0xB967, 0xE5DC, 0x2E4C,
+
+        0x2E41, 0xE5D1, 0xB96A, 0x72FA, 0x001C, 0xCB8C, 0x9737, 0x5CA7,
+        0x72FB, 0xB96B, 0xE5D0, 0x2E40, 0x5CA6, 0x9736, 0xCB8D, 0x001D,
+        0x9735, 0x5CA5, 0x001E, 0xCB8E, 0xB968, 0x72F8, 0x2E43, 0xE5D3,
+        0xCB8F, 0x001F, 0x5CA4, 0x9734, 0xE5D2, 0x2E42, 0x72F9, 0xB969,
+        0x5CA2, 0x9732, 0xCB89, 0x0019, 0x72FF, 0xB96F, 0xE5D4, 0x2E44,
+        0x0018, 0xCB88, 0x9733, 0x5CA3, 0x2E45, 0xE5D5, 0xB96E, 0x72FE,
+        0xE5D6, 0x2E46, 0x72FD, 0xB96D, 0xCB8B, 0x001B, 0x5CA0, 0x9730,
+        0xB96C, 0x72FC, 0x2E47, 0xE5D7, 0x9731, 0x5CA1, 0x001A, 0xCB8A
+    },
+    {
+        0x0000, 0xF0CD, 0xE191, 0x115C, 0xC329, 0x33E4, 0x22B8, 0xD275,
+        0x8659, 0x7694, 0x67C8, 0x9705, 0x4570, 0xB5BD, 0xA4E1, 0x542C,
+        0x0CB9, 0xFC74, 0xED28, 0x1DE5, 0xCF90, 0x3F5D, 0x2E01, 0xDECC,
+        0x8AE0, 0x7A2D, 0x6B71, 0x9BBC, 0x49C9, 0xB904, 0xA858, 0x5895,
+        0x1972, 0xE9BF, 0xF8E3, 0x082E, 0xDA5B, 0x2A96, 0x3BCA, 0xCB07,
+        0x9F2B, 0x6FE6, 0x7EBA, 0x8E77, 0x5C02, 0xACCF, 0xBD93, 0x4D5E,
+        0x15CB, 0xE506, 0xF45A, 0x0497, 0xD6E2, 0x262F, 0x3773, 0xC7BE,
+        0x9392, 0x635F, 0x7203, 0x82CE, 0x50BB, 0xA076, 0xB12A, 0x41E7,
+
+        0x32E4, 0xC229, 0xD375, 0x23B8, 0xF1CD, 0x0100, 0x105C, 0xE091,
+        0xB4BD, 0x4470, 0x552C, 0xA5E1, 0x7794, 0x8759, 0x9605, 0x66C8,
+        0x3E5D, 0xCE90, 0xDFCC, 0x2F01, 0xFD74, 0x0DB9, 0x1CE5, 0xEC28,
+        0xB804, 0x48C9, 0x5995, 0xA958, 0x7B2D, 0x8BE0, 0x9ABC, 0x6A71,
+        0x2B96, 0xDB5B, 0xCA07, 0x3ACA, 0xE8BF, 0x1872, 0x092E, 0xF9E3,
+        0xADCF, 0x5D02, 0x4C5E, 0xBC93, 0x6EE6, 0x9E2B, 0x8F77, 0x7FBA,
+        0x272F, 0xD7E2, 0xC6BE, 0x3673, 0xE406, 0x14CB, 0x0597, 0xF55A,
+        0xA176, 0x51BB, 0x40E7, 0xB02A, 0x625F, 0x9292, 0x83CE, 0x7303,
+
+        0x65C8, 0x9505, 0x8459, 0x7494, 0xA6E1, 0x562C, 0x4770, 0xB7BD,
+        0xE391, 0x135C, 0x0200, 0xF2CD, 0x20B8, 0xD075, 0xC129, 0x31E4,
+        0x6971, 0x99BC, 0x88E0, 0x782D, 0xAA58, 0x5A95, 0x4BC9, 0xBB04,
+        0xEF28, 0x1FE5, 0x0EB9, 0xFE74, 0x2C01, 0xDCCC, 0xCD90, 0x3D5D,
+        0x7CBA, 0x8C77, 0x9D2B, 0x6DE6, 0xBF93, 0x4F5E, 0x5E02, 0xAECF,
+        0xFAE3, 0x0A2E, 0x1B72, 0xEBBF, 0x39CA, 0xC907, 0xD85B, 0x2896,
+        0x7003, 0x80CE, 0x9192, 0x615F, 0xB32A, 0x43E7, 0x52BB, 0xA276,
+        0xF65A, 0x0697, 0x17CB, 0xE706, 0x3573, 0xC5BE, 0xD4E2, 0x242F,
+
+        0x572C, 0xA7E1, 0xB6BD, 0x4670, 0x9405, 0x64C8, 0x7594, 0x8559,
+        0xD175, 0x21B8, 0x30E4, 0xC029, 0x125C, 0xE291, 0xF3CD, 0x0300,
+        0x5B95, 0xAB58, 0xBA04, 0x4AC9, 0x98BC, 0x6871, 0x792D, 0x89E0,
+        0xDDCC, 0x2D01, 0x3C5D, 0xCC90, 0x1EE5, 0xEE28, 0xFF74, 0x0FB9,
+        0x4E5E, 0xBE93, 0xAFCF, 0x5F02, 0x8D77, 0x7DBA, 0x6CE6, 0x9C2B,
+        0xC807, 0x38CA, 0x2996, 0xD95B, 0x0B2E, 0xFBE3, 0xEABF, 0x1A72,
+        0x42E7, 0xB22A, 0xA376, 0x53BB, 0x81CE, 0x7103, 0x605F, 0x9092,
+        0xC4BE, 0x3473, 0x252F, 0xD5E2, 0x0797, 0xF75A, 0xE606, 0x16CB
+    },
+    {
+        0x0000, 0x33F1, 0x67E2, 0x5413, 0xCFC4, 0xFC35, 0xA826, 0x9BD7,
+        0x9F83, 0xAC72, 0xF861, 0xCB90, 0x5047, 0x63B6, 0x37A5, 0x0454,
+        0x3F0D, 0x0CFC, 0x58EF, 0x6B1E, 0xF0C9, 0xC338, 0x972B, 0xA4DA,
+        0xA08E, 0x937F, 0xC76C, 0xF49D, 0x6F4A, 0x5CBB, 0x08A8, 0x3B59,
+        0x7E1A, 0x4DEB, 0x19F8, 0x2A09, 0xB1DE, 0x822F, 0xD63C, 0xE5CD,
+        0xE199, 0xD268, 0x867B, 0xB58A, 0x2E5D, 0x1DAC, 0x49BF, 0x7A4E,
+        0x4117, 0x72E6, 0x26F5, 0x1504, 0x8ED3, 0xBD22, 0xE931, 0xDAC0,
+        0xDE94, 0xED65, 0xB976, 0x8A87, 0x1150, 0x22A1, 0x76B2, 0x4543,
+
+        0xFC34, 0xCFC5, 0x9BD6, 0xA827, 0x33F0, 0x0001, 0x5412, 0x67E3,
+        0x63B7, 0x5046, 0x0455, 0x37A4, 0xAC73, 0x9F82, 0xCB91, 0xF860,
+        0xC339, 0xF0C8, 0xA4DB, 0x972A, 0x0CFD, 0x3F0C, 0x6B1F, 0x58EE,
+        0x5CBA, 0x6F4B, 0x3B58, 0x08A9, 0x937E, 0xA08F, 0xF49C, 0xC76D,
+        0x822E, 0xB1DF, 0xE5CC, 0xD63D, 0x4DEA, 0x7E1B, 0x2A08, 0x19F9,
+        0x1DAD, 0x2E5C, 0x7A4F, 0x49BE, 0xD269, 0xE198, 0xB58B, 0x867A,
+        0xBD23, 0x8ED2, 0xDAC1, 0xE930, 0x72E7, 0x4116, 0x1505, 0x26F4,
+        0x22A0, 0x1151, 0x4542, 0x76B3, 0xED64, 0xDE95, 0x8A86, 0xB977,
+
+        0xF863, 0xCB92, 0x9F81, 0xAC70, 0x37A7, 0x0456, 0x5045, 0x63B4,
+        0x67E0, 0x5411, 0x0002, 0x33F3, 0xA824, 0x9BD5, 0xCFC6, 0xFC37,
+        0xC76E, 0xF49F, 0xA08C, 0x937D, 0x08AA, 0x3B5B, 0x6F48, 0x5CB9,
+        0x58ED, 0x6B1C, 0x3F0F, 0x0CFE, 0x9729, 0xA4D8, 0xF0CB, 0xC33A,
+        0x8679, 0xB588, 0xE19B, 0xD26A, 0x49BD, 0x7A4C, 0x2E5F, 0x1DAE,
+        0x19FA, 0x2A0B, 0x7E18, 0x4DE9, 0xD63E, 0xE5CF, 0xB1DC, 0x822D,
+        0xB974, 0x8A85, 0xDE96, 0xED67, 0x76B0, 0x4541, 0x1152, 0x22A3,
+        0x26F7, 0x1506, 0x4115, 0x72E4, 0xE933, 0xDAC2, 0x8ED1, 0xBD20,
+
+        0x0457, 0x37A6, 0x63B5, 0x5044, 0xCB93, 0xF862, 0xAC71, 0x9F80,
+        0x9BD4, 0xA825, 0xFC36, 0xCFC7, 0x5410, 0x67E1, 0x33F2, 0x0003,
+        0x3B5A, 0x08AB, 0x5CB8, 0x6F49, 0xF49E, 0xC76F, 0x937C, 0xA08D,
+        0xA4D9, 0x9728, 0xC33B, 0xF0CA, 0x6B1D, 0x58EC, 0x0CFF, 0x3F0E,
+        0x7A4D, 0x49BC, 0x1DAF, 0x2E5E, 0xB589, 0x8678, 0xD26B, 0xE19A,
+        0xE5CE, 0xD63F, 0x822C, 0xB1DD, 0x2A0A, 0x19FB, 0x4DE8, 0x7E19,
+        0x4540, 0x76B1, 0x22A2, 0x1153, 0x8A84, 0xB975, 0xED66, 0xDE97,
+        0xDAC3, 0xE932, 0xBD21, 0x8ED0, 0x1507, 0x26F6, 0x72E5, 0x4114
+    },
+    {
+        0x0000, 0x4731, 0x8E62, 0xC953, 0x1CCF, 0x5BFE, 0x92AD, 0xD59C,
+        0x399E, 0x7EAF, 0xB7FC, 0xF0CD, 0x2551, 0x6260, 0xAB33, 0xEC02,
+        0x733C, 0x340D, 0xFD5E, 0xBA6F, 0x6FF3, 0x28C2, 0xE191, 0xA6A0,
+        0x4AA2, 0x0D93, 0xC4C0, 0x83F1, 0x566D, 0x115C, 0xD80F, 0x9F3E,
+        0xE678, 0xA149, 0x681A, 0x2F2B, 0xFAB7, 0xBD86, 0x74D5, 0x33E4,
+        0xDFE6, 0x98D7, 0x5184, 0x16B5, 0xC329, 0x8418, 0x4D4B, 0x0A7A,
+        0x9544, 0xD275, 0x1B26, 0x5C17, 0x898B, 0xCEBA, 0x07E9, 0x40D8,
+        0xACDA, 0xEBEB, 0x22B8, 0x6589, 0xB015, 0xF724, 0x3E77, 0x7946,
+
+        0xCCFB, 0x8BCA, 0x4299, 0x05A8, 0xD034, 0x9705, 0x5E56, 0x1967,
+        0xF565, 0xB254, 0x7B07, 0x3C36, 0xE9AA, 0xAE9B, 0x67C8, 0x20F9,
+        0xBFC7, 0xF8F6, 0x31A5, 0x7694, 0xA308, 0xE439, 0x2D6A, 0x6A5B,
+        0x8659, 0xC168, 0x083B, 0x4F0A, 0x9A96, 0xDDA7, 0x14F4, 0x53C5,
+        0x2A83, 0x6DB2, 0xA4E1, 0xE3D0, 0x364C, 0x717D, 0xB82E, 0xFF1F,
+        0x131D, 0x542C, 0x9D7F, 0xDA4E, 0x0FD2, 0x48E3, 0x81B0, 0xC681,
+        0x59BF, 0x1E8E, 0xD7DD, 0x90EC, 0x4570, 0x0241, 0xCB12, 0x8C23,
+        0x6021, 0x2710, 0xEE43, 0xA972, 0x7CEE, 0x3BDF, 0xF28C, 0xB5BD,
+
+        0x99FD, 0xDECC, 0x179F, 0x50AE, 0x8532, 0xC203, 0x0B50, 0x4C61,
+        0xA063, 0xE752, 0x2E01, 0x6930, 0xBCAC, 0xFB9D, 0x32CE, 0x75FF,
+        0xEAC1, 0xADF0, 0x64A3, 0x2392, 0xF60E, 0xB13F, 0x786C, 0x3F5D,
+        0xD35F, 0x946E, 0x5D3D, 0x1A0C, 0xCF90, 0x88A1, 0x41F2, 0x06C3,
+        0x7F85, 0x38B4, 0xF1E7, 0xB6D6, 0x634A, 0x247B, 0xED28, 0xAA19,
+        0x461B, 0x012A, 0xC879, 0x8F48, 0x5AD4, 0x1DE5, 0xD4B6, 0x9387,
+        0x0CB9, 0x4B88, 0x82DB, 0xC5EA, 0x1076, 0x5747, 0x9E14, 0xD925,
+        0x3527, 0x7216, 0xBB45, 0xFC74, 0x29E8, 0x6ED9, 0xA78A, 0xE0BB,
+
+        0x5506, 0x1237, 0xDB64, 0x9C55, 0x49C9, 0x0EF8, 0xC7AB, 0x809A,
+        0x6C98, 0x2BA9, 0xE2FA, 0xA5CB, 0x7057, 0x3766, 0xFE35, 0xB904,
+        0x263A, 0x610B, 0xA858, 0xEF69, 0x3AF5, 0x7DC4, 0xB497, 0xF3A6,
+        0x1FA4, 0x5895, 0x91C6, 0xD6F7, 0x036B, 0x445A, 0x8D09, 0xCA38,
+        0xB37E, 0xF44F, 0x3D1C, 0x7A2D, 0xAFB1, 0xE880, 0x21D3, 0x66E2,
+        0x8AE0, 0xCDD1, 0x0482, 0x43B3, 0x962F, 0xD11E, 0x184D, 0x5F7C,
+        0xC042, 0x8773, 0x4E20, 0x0911, 0xDC8D, 0x9BBC, 0x52EF, 0x15DE,
+        0xF9DC, 0xBEED, 0x77BE, 0x308F, 0xE513, 0xA222, 0x6B71, 0x2C40
+    },
+    {
+        0x0000, 0x0747, 0x0E8E, 0x09C9, 0x1D1C, 0x1A5B, 0x1392, 0x14D5,
+        0x3A38, 0x3D7F, 0x34B6, 0x33F1, 0x2724, 0x2063, 0x29AA, 0x2EED,
+        0x7470, 0x7337, 0x7AFE, 0x7DB9, 0x696C, 0x6E2B, 0x67E2, 0x60A5,
+        0x4E48, 0x490F, 0x40C6, 0x4781, 0x5354, 0x5413, 0x5DDA, 0x5A9D,
+        0xE8E0, 0xEFA7, 0xE66E, 0xE129, 0xF5FC, 0xF2BB, 0xFB72, 0xFC35,
+        0xD2D8, 0xD59F, 0xDC56, 0xDB11, 0xCFC4, 0xC883, 0xC14A, 0xC60D,
+        0x9C90, 0x9BD7, 0x921E, 0x9559, 0x818C, 0x86CB, 0x8F02, 0x8845,
+        0xA6A8, 0xA1EF, 0xA826, 0xAF61, 0xBBB4, 0xBCF3, 0xB53A, 0xB27D,
+
+        0xD1CB, 0xD68C, 0xDF45, 0xD802, 0xCCD7, 0xCB90, 0xC259, 0xC51E,
+        0xEBF3, 0xECB4, 0xE57D, 0xE23A, 0xF6EF, 0xF1A8, 0xF861, 0xFF26,
+        0xA5BB, 0xA2FC, 0xAB35, 0xAC72, 0xB8A7, 0xBFE0, 0xB629, 0xB16E,
+        0x9F83, 0x98C4, 0x910D, 0x964A, 0x829F, 0x85D8, 0x8C11, 0x8B56,
+        0x392B, 0x3E6C, 0x37A5, 0x30E2, 0x2437, 0x2370, 0x2AB9, 0x2DFE,
+        0x0313, 0x0454, 0x0D9D, 0x0ADA, 0x1E0F, 0x1948, 0x1081, 0x17C6,
+        0x4D5B, 0x4A1C, 0x43D5, 0x4492, 0x5047, 0x5700, 0x5EC9, 0x598E,
+        0x7763, 0x7024, 0x79ED, 0x7EAA, 0x6A7F, 0x6D38, 0x64F1, 0x63B6,
+
+        0xA39D, 0xA4DA, 0xAD13, 0xAA54, 0xBE81, 0xB9C6, 0xB00F, 0xB748,
+        0x99A5, 0x9EE2, 0x972B, 0x906C, 0x84B9, 0x83FE, 0x8A37, 0x8D70,
+        0xD7ED, 0xD0AA, 0xD963, 0xDE24, 0xCAF1, 0xCDB6, 0xC47F, 0xC338,
+        0xEDD5, 0xEA92, 0xE35B, 0xE41C, 0xF0C9, 0xF78E, 0xFE47, 0xF900,
+        0x4B7D, 0x4C3A, 0x45F3, 0x42B4, 0x5661, 0x5126, 0x58EF, 0x5FA8,
+        0x7145, 0x7602, 0x7FCB, 0x788C, 0x6C59, 0x6B1E, 0x62D7, 0x6590,
+        0x3F0D, 0x384A, 0x3183, 0x36C4, 0x2211, 0x2556, 0x2C9F, 0x2BD8,
+        0x0535, 0x0272, 0x0BBB, 0x0CFC, 0x1829, 0x1F6E, 0x16A7, 0x11E0,
+
+        0x7256, 0x7511, 0x7CD8, 0x7B9F, 0x6F4A, 0x680D, 0x61C4, 0x6683,
+        0x486E, 0x4F29, 0x46E0, 0x41A7, 0x5572, 0x5235, 0x5BFC, 0x5CBB,
+        0x0626, 0x0161, 0x08A8, 0x0FEF, 0x1B3A, 0x1C7D, 0x15B4, 0x12F3,
+        0x3C1E, 0x3B59, 0x3290, 0x35D7, 0x2102, 0x2645, 0x2F8C, 0x28CB,
+        0x9AB6, 0x9DF1, 0x9438, 0x937F, 0x87AA, 0x80ED, 0x8924, 0x8E63,
+        0xA08E, 0xA7C9, 0xAE00, 0xA947, 0xBD92, 0xBAD5, 0xB31C, 0xB45B,
+        0xEEC6, 0xE981, 0xE048, 0xE70F, 0xF3DA, 0xF49D, 0xFD54, 0xFA13,
+        0xD4FE, 0xD3B9, 0xDA70, 0xDD37, 0xC9E2, 0xCEA5, 0xC76C, 0xC02B
+    },
+    {
+        0x0000, 0x2506, 0x4A0C, 0x6F0A, 0x9418, 0xB11E, 0xDE14, 0xFB12,
+        0x283B, 0x0D3D, 0x6237, 0x4731, 0xBC23, 0x9925, 0xF62F, 0xD329,
+        0x5076, 0x7570, 0x1A7A, 0x3F7C, 0xC46E, 0xE168, 0x8E62, 0xAB64,
+        0x784D, 0x5D4B, 0x3241, 0x1747, 0xEC55, 0xC953, 0xA659, 0x835F,
+        0xA0EC, 0x85EA, 0xEAE0, 0xCFE6, 0x34F4, 0x11F2, 0x7EF8, 0x5BFE,
+        0x88D7, 0xADD1, 0xC2DB, 0xE7DD, 0x1CCF, 0x39C9, 0x56C3, 0x73C5,
+        0xF09A, 0xD59C, 0xBA96, 0x9F90, 0x6482, 0x4184, 0x2E8E, 0x0B88,
+        0xD8A1, 0xFDA7, 0x92AD, 0xB7AB, 0x4CB9, 0x69BF, 0x06B5, 0x23B3,
+
+        0x41D3, 0x64D5, 0x0BDF, 0x2ED9, 0xD5CB, 0xF0CD, 0x9FC7, 0xBAC1,
+        0x69E8, 0x4CEE, 0x23E4, 0x06E2, 0xFDF0, 0xD8F6, 0xB7FC, 0x92FA,
+        0x11A5, 0x34A3, 0x5BA9, 0x7EAF, 0x85BD, 0xA0BB, 0xCFB1, 0xEAB7,
+        0x399E, 0x1C98, 0x7392, 0x5694, 0xAD86, 0x8880, 0xE78A, 0xC28C,
+        0xE13F, 0xC439, 0xAB33, 0x8E35, 0x7527, 0x5021, 0x3F2B, 0x1A2D,
+        0xC904, 0xEC02, 0x8308, 0xA60E, 0x5D1C, 0x781A, 0x1710, 0x3216,
+        0xB149, 0x944F, 0xFB45, 0xDE43, 0x2551, 0x0057, 0x6F5D, 0x4A5B,
+        0x9972, 0xBC74, 0xD37E, 0xF678, 0x0D6A, 0x286C, 0x4766, 0x6260,
+
+        0x83A6, 0xA6A0, 0xC9AA, 0xECAC, 0x17BE, 0x32B8, 0x5DB2, 0x78B4,
+        0xAB9D, 0x8E9B, 0xE191, 0xC497, 0x3F85, 0x1A83, 0x7589, 0x508F,
+        0xD3D0, 0xF6D6, 0x99DC, 0xBCDA, 0x47C8, 0x62CE, 0x0DC4, 0x28C2,
+        0xFBEB, 0xDEED, 0xB1E7, 0x94E1, 0x6FF3, 0x4AF5, 0x25FF, 0x00F9,
+        0x234A, 0x064C, 0x6946, 0x4C40, 0xB752, 0x9254, 0xFD5E, 0xD858,
+        0x0B71, 0x2E77, 0x417D, 0x647B, 0x9F69, 0xBA6F, 0xD565, 0xF063,
+        0x733C, 0x563A, 0x3930, 0x1C36, 0xE724, 0xC222, 0xAD28, 0x882E,
+        0x5B07, 0x7E01, 0x110B, 0x340D, 0xCF1F, 0xEA19, 0x8513, 0xA015,
+
+        0xC275, 0xE773, 0x8879, 0xAD7F, 0x566D, 0x736B, 0x1C61, 0x3967,
+        0xEA4E, 0xCF48, 0xA042, 0x8544, 0x7E56, 0x5B50, 0x345A, 0x115C,
+        0x9203, 0xB705, 0xD80F, 0xFD09, 0x061B, 0x231D, 0x4C17, 0x6911,
+        0xBA38, 0x9F3E, 0xF034, 0xD532, 0x2E20, 0x0B26, 0x642C, 0x412A,
+        0x6299, 0x479F, 0x2895, 0x0D93, 0xF681, 0xD387, 0xBC8D, 0x998B,
+        0x4AA2, 0x6FA4, 0x00AE, 0x25A8, 0xDEBA, 0xFBBC, 0x94B6, 0xB1B0,
+        0x32EF, 0x17E9, 0x78E3, 0x5DE5, 0xA6F7, 0x83F1, 0xECFB, 0xC9FD,
+        0x1AD4, 0x3FD2, 0x50D8, 0x75DE, 0x8ECC, 0xABCA, 0xC4C0, 0xE1C6
+    },
+    {
+        0x0000, 0x7226, 0xE44C, 0x966A, 0xC893, 0xBAB5, 0x2CDF, 0x5EF9,
+        0x912D, 0xE30B, 0x7561, 0x0747, 0x59BE, 0x2B98, 0xBDF2, 0xCFD4,
+        0x2251, 0x5077, 0xC61D, 0xB43B, 0xEAC2, 0x98E4, 0x0E8E, 0x7CA8,
+        0xB37C, 0xC15A, 0x5730, 0x2516, 0x7BEF, 0x09C9, 0x9FA3, 0xED85,
+        0x44A2, 0x3684, 0xA0EE, 0xD2C8, 0x8C31, 0xFE17, 0x687D, 0x1A5B,
+        0xD58F, 0xA7A9, 0x31C3, 0x43E5, 0x1D1C, 0x6F3A, 0xF950, 0x8B76,
+        0x66F3, 0x14D5, 0x82BF, 0xF099, 0xAE60, 0xDC46, 0x4A2C, 0x380A,
+        0xF7DE, 0x85F8, 0x1392, 0x61B4, 0x3F4D, 0x4D6B, 0xDB01, 0xA927,
+
+        0x8944, 0xFB62, 0x6D08, 0x1F2E, 0x41D7, 0x33F1, 0xA59B, 0xD7BD,
+        0x1869, 0x6A4F, 0xFC25, 0x8E03, 0xD0FA, 0xA2DC, 0x34B6, 0x4690,
+        0xAB15, 0xD933, 0x4F59, 0x3D7F, 0x6386, 0x11A0, 0x87CA, 0xF5EC,
+        0x3A38, 0x481E, 0xDE74, 0xAC52, 0xF2AB, 0x808D, 0x16E7, 0x64C1,
+        0xCDE6, 0xBFC0, 0x29AA, 0x5B8C, 0x0575, 0x7753, 0xE139, 0x931F,
+        0x5CCB, 0x2EED, 0xB887, 0xCAA1, 0x9458, 0xE67E, 0x7014, 0x0232,
+        0xEFB7, 0x9D91, 0x0BFB, 0x79DD, 0x2724, 0x5502, 0xC368, 0xB14E,
+        0x7E9A, 0x0CBC, 0x9AD6, 0xE8F0, 0xB609, 0xC42F, 0x5245, 0x2063,
+
+        0x1283, 0x60A5, 0xF6CF, 0x84E9, 0xDA10, 0xA836, 0x3E5C, 0x4C7A,
+        0x83AE, 0xF188, 0x67E2, 0x15C4, 0x4B3D, 0x391B, 0xAF71, 0xDD57,
+        0x30D2, 0x42F4, 0xD49E, 0xA6B8, 0xF841, 0x8A67, 0x1C0D, 0x6E2B,
+        0xA1FF, 0xD3D9, 0x45B3, 0x3795, 0x696C, 0x1B4A, 0x8D20, 0xFF06,
+        0x5621, 0x2407, 0xB26D, 0xC04B, 0x9EB2, 0xEC94, 0x7AFE, 0x08D8,
+        0xC70C, 0xB52A, 0x2340, 0x5166, 0x0F9F, 0x7DB9, 0xEBD3, 0x99F5,
+        0x7470, 0x0656, 0x903C, 0xE21A, 0xBCE3, 0xCEC5, 0x58AF, 0x2A89,
+        0xE55D, 0x977B, 0x0111, 0x7337, 0x2DCE, 0x5FE8, 0xC982, 0xBBA4,
+
+        0x9BC7, 0xE9E1, 0x7F8B, 0x0DAD, 0x5354, 0x2172, 0xB718, 0xC53E,
+        0x0AEA, 0x78CC, 0xEEA6, 0x9C80, 0xC279, 0xB05F, 0x2635, 0x5413,
+        0xB996, 0xCBB0, 0x5DDA, 0x2FFC, 0x7105, 0x0323, 0x9549, 0xE76F,
+        0x28BB, 0x5A9D, 0xCCF7, 0xBED1, 0xE028, 0x920E, 0x0464, 0x7642,
+        0xDF65, 0xAD43, 0x3B29, 0x490F, 0x17F6, 0x65D0, 0xF3BA, 0x819C,
+        0x4E48, 0x3C6E, 0xAA04, 0xD822, 0x86DB, 0xF4FD, 0x6297, 0x10B1,
+        0xFD34, 0x8F12, 0x1978, 0x6B5E, 0x35A7, 0x4781, 0xD1EB, 0xA3CD,
+        0x6C19, 0x1E3F, 0x8855, 0xFA73, 0xA48A, 0xD6AC, 0x40C6, 0x32E0
+    }
+};
+
+// CRC-32, polynomial 0x04C11DB7, tables of 1 to 7 bytes look ahead.
+static const uint32_t hash_crc32_slice_table[7][256] =
+{
+    {
+        0x00000000, 0x0482AD61, 0x008761AD, 0x0405CCCC, 0x010EC35A, 0x058C6E3B, 0x0189A2F7, 0x050B0F96,
+        0x021D86B4, 0x069F2BD5, 0x029AE719, 0x06184A78, 0x031345EE, 0x0791E88F, 0x03942443, 0x07168922,
+        0x043B0D68, 0x00B9A009, 0x04BC6CC5, 0x003EC1A4, 0x0535CE32, 0x01B76353, 0x05B2AF9F, 0x013002FE,
+        0x06268BDC, 0x02A426BD, 0x06A1EA71, 0x02234710, 0x07284886, 0x03AAE5E7, 0x07AF292B, 0x032D844A,
+        0x01F421BF, 0x05768CDE, 0x01734012, 0x05F1ED73, 0x00FAE2E5, 0x04784F84, 0x007D8348, 0x04FF2E29,
+        0x03E9A70B, 0x076B0A6A, 0x036EC6A6, 0x07EC6BC7, 0x02E76451, 0x0665C930, 0x026005FC, 0x06E2A89D,
+        0x05CF2CD7, 0x014D81B6, 0x05484D7A, 0x01CAE01B, 0x04C1EF8D, 0x004342EC, 0x04468E20, 0x00C42341,
+        0x07D2AA63, 0x03500702, 0x0755CBCE, 0x03D766AF, 0x06DC6939, 0x025EC458, 0x065B0894, 0x02D9A5F5,
+
+        0x03E8437E, 0x076AEE1F, 0x036F22D3, 0x07ED8FB2, 0x02E68024, 0x06642D45, 0x0261E189, 0x06E34CE8,
+        0x01F5C5CA, 0x057768AB, 0x0172A467, 0x05F00906, 0x00FB0690, 0x0479ABF1, 0x007C673D, 0x04FECA5C,
+        0x07D34E16, 0x0351E377, 0x07542FBB, 0x03D682DA, 0x06DD8D4C, 0x025F202D, 0x065AECE1, 0x02D84180,
+        0x05CEC8A2, 0x014C65C3, 0x0549A90F, 0x01CB046E, 0x04C00BF8, 0x0042A699, 0x04476A55, 0x00C5C734,
+        0x021C62C1, 0x069ECFA0, 0x029B036C, 0x0619AE0D, 0x0312A19B, 0x07900CFA, 0x0395C036, 0x07176D57,
+        0x0001E475, 0x04834914, 0x008685D8, 0x040428B9, 0x010F272F, 0x058D8A4E, 0x01884682, 0x050AEBE3,
+        0x06276FA9, 0x02A5C2C8, 0x06A00E04, 0x0222A365, 0x0729ACF3, 0x03AB0192, 0x07AECD5E, 0x032C603F,
+        0x043AE91D, 0x00B8447C, 0x04BD88B0, 0x003F25D1, 0x05342A47, 0x01B68726, 0x05B34BEA, 0x0131E68B,
+
+        0x07D086FC, 0x03522B9D, 0x0757E751, 0x03D54A30, 0x06DE45A6, 0x025CE8C7, 0x0659240B, 0x02DB896A,
+        0x05CD0048, 0x014FAD29, 0x054A61E5, 0x01C8CC84, 0x04C3C312, 0x00416E73, 0x0444A2BF, 0x00C60FDE,
+        0x03EB8B94, 0x076926F5, 0x036CEA39, 0x07EE4758, 0x02E548CE, 0x0667E5AF, 0x02622963, 0x06E08402,
+        0x01F60D20, 0x0574A041, 0x01716C8D, 0x05F3C1EC, 0x00F8CE7A, 0x047A631B, 0x007FAFD7, 0x04FD02B6,
+        0x0624A743, 0x02A60A22, 0x06A3C6EE, 0x02216B8F, 0x072A6419, 0x03A8C978, 0x07AD05B4, 0x032FA8D5,
+        0x043921F7, 0x00BB8C96, 0x04BE405A, 0x003CED3B, 0x0537E2AD, 0x01B54FCC, 0x05B08300, 0x01322E61,
+        0x021FAA2B, 0x069D074A, 0x0298CB86, 0x061A66E7, 0x03116971, 0x0793C410, 0x039608DC, 0x0714A5BD,
+        0x00022C9F, 0x048081FE, 0x00854D32, 0x0407E053, 0x010CEFC5, 0x058E42A4, 0x018B8E68, 0x05092309,
+
+        0x0438C582, 0x00BA68E3, 0x04BFA42F, 0x003D094E, 0x053606D8, 0x01B4ABB9, 0x05B16775, 0x0133CA14,
+        0x06254336, 0x02A7EE57, 0x06A2229B, 0x02208FFA, 0x072B806C, 0x03A92D0D, 0x07ACE1C1, 0x032E4CA0,
+        0x0003C8EA, 0x0481658B, 0x0084A947, 0x04060426, 0x010D0BB0, 0x058FA6D1, 0x018A6A1D, 0x0508C77C,
+        0x021E4E5E, 0x069CE33F, 0x02992FF3, 0x061B8292, 0x03108D04, 0x07922065, 0x0397ECA9, 0x071541C8,
+        0x05CCE43D, 0x014E495C, 0x054B8590, 0x01C928F1, 0x04C22767, 0x00408A06, 0x044546CA, 0x00C7EBAB,
+        0x07D16289, 0x0353CFE8, 0x07560324, 0x03D4AE45, 0x06DFA1D3, 0x025D0CB2, 0x0658C07E, 0x02DA6D1F,
+        0x01F7E955, 0x05754434, 0x017088F8, 0x05F22599, 0x00F92A0F, 0x047B876E, 0x007E4BA2, 0x04FCE6C3,
+        0x03EA6FE1, 0x0768C280, 0x036D0E4C, 0x07EFA32D, 0x02E4ACBB, 0x066601DA, 0x0263CD16, 0x06E16077
+    },
+    {
+        0x00000000, 0x03D6EEE0, 0x07ADDDC0, 0x047B3320, 0x06D980EF, 0x050F6E0F, 0x01745D2F, 0x02A2B3CF,
+        0x04313AB1, 0x07E7D451, 0x039CE771, 0x004A0991, 0x02E8BA5E, 0x013E54BE, 0x0545679E, 0x0693897E,
+        0x01E04E0D, 0x0236A0ED, 0x064D93CD, 0x059B7D2D, 0x0739CEE2, 0x04EF2002, 0x00941322, 0x0342FDC2,
+        0x05D174BC, 0x06079A5C, 0x027CA97C, 0x01AA479C, 0x0308F453, 0x00DE1AB3, 0x04A52993, 0x0773C773,
+        0x03C09C1A, 0x001672FA, 0x046D41DA, 0x07BBAF3A, 0x05191CF5, 0x06CFF215, 0x02B4C135, 0x01622FD5,
+        0x07F1A6AB, 0x0427484B, 0x005C7B6B, 0x038A958B, 0x01282644, 0x02FEC8A4, 0x0685FB84, 0x05531564,
+        0x0220D217, 0x01F63CF7, 0x058D0FD7, 0x065BE137, 0x04F952F8, 0x072FBC18, 0x03548F38, 0x008261D8,
+        0x0611E8A6, 0x05C70646, 0x01BC3566, 0x026ADB86, 0x00C86849, 0x031E86A9, 0x0765B589, 0x04B35B69,
+
+        0x07813834, 0x0457D6D4, 0x002CE5F4, 0x03FA0B14, 0x0158B8DB, 0x028E563B, 0x06F5651B, 0x05238BFB,
+        0x03B00285, 0x0066EC65, 0x041DDF45, 0x07CB31A5, 0x0569826A, 0x06BF6C8A, 0x02C45FAA, 0x0112B14A,
+        0x06617639, 0x05B798D9, 0x01CCABF9, 0x021A4519, 0x00B8F6D6, 0x036E1836, 0x07152B16, 0x04C3C5F6,
+        0x02504C88, 0x0186A268, 0x05FD9148, 0x062B7FA8, 0x0489CC67, 0x075F2287, 0x032411A7, 0x00F2FF47,
+        0x0441A42E, 0x07974ACE, 0x03EC79EE, 0x003A970E, 0x029824C1, 0x014ECA21, 0x0535F901, 0x06E317E1,
+        0x00709E9F, 0x03A6707F, 0x07DD435F, 0x040BADBF, 0x06A91E70, 0x057FF090, 0x0104C3B0, 0x02D22D50,
+        0x05A1EA23, 0x067704C3, 0x020C37E3, 0x01DAD903, 0x03786ACC, 0x00AE842C, 0x04D5B70C, 0x070359EC,
+        0x0190D092, 0x02463E72, 0x063D0D52, 0x05EBE3B2, 0x0749507D, 0x049FBE9D, 0x00E48DBD, 0x0332635D,
+
+        0x06804B07, 0x0556A5E7, 0x012D96C7, 0x02FB7827, 0x0059CBE8, 0x038F2508, 0x07F41628, 0x0422F8C8,
+        0x02B171B6, 0x01679F56, 0x051CAC76, 0x06CA4296, 0x0468F159, 0x07BE1FB9, 0x03C52C99, 0x0013C279,
+        0x0760050A, 0x04B6EBEA, 0x00CDD8CA, 0x031B362A, 0x01B985E5, 0x026F6B05, 0x06145825, 0x05C2B6C5,
+        0x03513FBB, 0x0087D15B, 0x04FCE27B, 0x072A0C9B, 0x0588BF54, 0x065E51B4, 0x02256294, 0x01F38C74,
+        0x0540D71D, 0x069639FD, 0x02ED0ADD, 0x013BE43D, 0x039957F2, 0x004FB912, 0x04348A32, 0x07E264D2,
+        0x0171EDAC, 0x02A7034C, 0x06DC306C, 0x050ADE8C, 0x07A86D43, 0x047E83A3, 0x0005B083, 0x03D35E63,
+        0x04A09910, 0x077677F0, 0x030D44D0, 0x00DBAA30, 0x027919FF, 0x01AFF71F, 0x05D4C43F, 0x06022ADF,
+        0x0091A3A1, 0x03474D41, 0x073C7E61, 0x04EA9081, 0x0648234E, 0x059ECDAE, 0x01E5FE8E, 0x0233106E,
+
+        0x01017333, 0x02D79DD3, 0x06ACAEF3, 0x057A4013, 0x07D8F3DC, 0x040E1D3C, 0x00752E1C, 0x03A3C0FC,
+        0x05304982, 0x06E6A762, 0x029D9442, 0x014B7AA2, 0x03E9C96D, 0x003F278D, 0x044414AD, 0x0792FA4D,
+        0x00E13D3E, 0x0337D3DE, 0x074CE0FE, 0x049A0E1E, 0x0638BDD1, 0x05EE5331, 0x01956011, 0x02438EF1,
+        0x04D0078F, 0x0706E96F, 0x037DDA4F, 0x00AB34AF, 0x02098760, 0x01DF6980, 0x05A45AA0, 0x0672B440,
+        0x02C1EF29, 0x011701C9, 0x056C32E9, 0x06BADC09, 0x04186FC6, 0x07CE8126, 0x03B5B206, 0x00635CE6,
+        0x06F0D598, 0x05263B78, 0x015D0858, 0x028BE6B8, 0x00295577, 0x03FFBB97, 0x078488B7, 0x04526657,
+        0x0321A124, 0x00F74FC4, 0x048C7CE4, 0x075A9204, 0x05F821CB, 0x062ECF2B, 0x0255FC0B, 0x018312EB,
+        0x07109B95, 0x04C67575, 0x00BD4655, 0x036BA8B5, 0x01C91B7A, 0x021FF59A, 0x0664C6BA, 0x05B2285A
+    },
+    {
+        0x00000000, 0x01339183, 0x02672306, 0x0354B285, 0x04CE460C, 0x05FDD78F, 0x06A9650A, 0x079AF489,
+        0x001EB777, 0x012D26F4, 0x02799471, 0x034A05F2, 0x04D0F17B, 0x05E360F8, 0x06B7D27D, 0x078443FE,
+        0x003D6EEE, 0x010EFF6D, 0x025A4DE8, 0x0369DC6B, 0x04F328E2, 0x05C0B961, 0x06940BE4, 0x07A79A67,
+        0x0023D999, 0x0110481A, 0x0244FA9F, 0x03776B1C, 0x04ED9F95, 0x05DE0E16, 0x068ABC93, 0x07B92D10,
+        0x007ADDDC, 0x01494C5F, 0x021DFEDA, 0x032E6F59, 0x04B49BD0, 0x05870A53, 0x06D3B8D6, 0x07E02955,
+        0x00646AAB, 0x0157FB28, 0x020349AD, 0x0330D82E, 0x04AA2CA7, 0x0599BD24, 0x06CD0FA1, 0x07FE9E22,
+        0x0047B332, 0x017422B1, 0x02209034, 0x031301B7, 0x0489F53E, 0x05BA64BD, 0x06EED638, 0x07DD47BB,
+        0x00590445, 0x016A95C6, 0x023E2743, 0x030DB6C0, 0x04974249, 0x05A4D3CA, 0x06F0614F, 0x07C3F0CC,
+
+        0x00F5BBB8, 0x01C62A3B, 0x029298BE, 0x03A1093D, 0x043BFDB4, 0x05086C37, 0x065CDEB2, 0x076F4F31,
+        0x00EB0CCF, 0x01D89D4C, 0x028C2FC9, 0x03BFBE4A, 0x04254AC3, 0x0516DB40, 0x064269C5, 0x0771F846,
+        0x00C8D556, 0x01FB44D5, 0x02AFF650, 0x039C67D3, 0x0406935A, 0x053502D9, 0x0661B05C, 0x075221DF,
+        0x00D66221, 0x01E5F3A2, 0x02B14127, 0x0382D0A4, 0x0418242D, 0x052BB5AE, 0x067F072B, 0x074C96A8,
+        0x008F6664, 0x01BCF7E7, 0x02E84562, 0x03DBD4E1, 0x04412068, 0x0572B1EB, 0x0626036E, 0x071592ED,
+        0x0091D113, 0x01A24090, 0x02F6F215, 0x03C56396, 0x045F971F, 0x056C069C, 0x0638B419, 0x070B259A,
+        0x00B2088A, 0x01819909, 0x02D52B8C, 0x03E6BA0F, 0x047C4E86, 0x054FDF05, 0x061B6D80, 0x0728FC03,
+        0x00ACBFFD, 0x019F2E7E, 0x02CB9CFB, 0x03F80D78, 0x0462F9F1, 0x05516872, 0x0605DAF7, 0x07364B74,
+
+        0x01EB7770, 0x00D8E6F3, 0x038C5476, 0x02BFC5F5, 0x0525317C, 0x0416A0FF, 0x0742127A, 0x067183F9,
+        0x01F5C007, 0x00C65184, 0x0392E301, 0x02A17282, 0x053B860B, 0x04081788, 0x075CA50D, 0x066F348E,
+        0x01D6199E, 0x00E5881D, 0x03B13A98, 0x0282AB1B, 0x05185F92, 0x042BCE11, 0x077F7C94, 0x064CED17,
+        0x01C8AEE9, 0x00FB3F6A, 0x03AF8DEF, 0x029C1C6C, 0x0506E8E5, 0x04357966, 0x0761CBE3, 0x06525A60,
+        0x0191AAAC, 0x00A23B2F, 0x03F689AA, 0x02C51829, 0x055FECA0, 0x046C7D23, 0x0738CFA6, 0x060B5E25,
+        0x018F1DDB, 0x00BC8C58, 0x03E83EDD, 0x02DBAF5E, 0x05415BD7, 0x0472CA54, 0x072678D1, 0x0615E952,
+        0x01ACC442, 0x009F55C1, 0x03CBE744, 0x02F876C7, 0x0562824E, 0x045113CD, 0x0705A148, 0x063630CB,
+        0x01B27335, 0x0081E2B6, 0x03D55033, 0x02E6C1B0, 0x057C3539, 0x044FA4BA, 0x071B163F, 0x062887BC,
+
+        0x011ECCC8, 0x002D5D4B, 0x0379EFCE, 0x024A7E4D, 0x05D08AC4, 0x04E31B47, 0x07B7A9C2, 0x06843841,
+        0x01007BBF, 0x0033EA3C, 0x036758B9, 0x0254C93A, 0x05CE3DB3, 0x04FDAC30, 0x07A91EB5, 0x069A8F36,
+        0x0123A226, 0x001033A5, 0x03448120, 0x027710A3, 0x05EDE42A, 0x04DE75A9, 0x078AC72C, 0x06B956AF,
+        0x013D1551, 0x000E84D2, 0x035A3657, 0x0269A7D4, 0x05F3535D, 0x04C0C2DE, 0x0794705B, 0x06A7E1D8,
+        0x01641114, 0x00578097, 0x03033212, 0x0230A391, 0x05AA5718, 0x0499C69B, 0x07CD741E, 0x06FEE59D,
+        0x017AA663, 0x004937E0, 0x031D8565, 0x022E14E6, 0x05B4E06F, 0x048771EC, 0x07D3C369, 0x06E052EA,
+        0x01597FFA, 0x006AEE79, 0x033E5CFC, 0x020DCD7F, 0x059739F6, 0x04A4A875, 0x07F01AF0, 0x06C38B73,
+        0x0147C88D, 0x0074590E, 0x0320EB8B, 0x02137A08, 0x05898E81, 0x04BA1F02, 0x07EEAD87, 0x06DD3C04
+    },
+    {
+        0x00000000, 0x07274EF0, 0x07CCA68F, 0x00EBE87F, 0x061B7671, 0x013C3881, 0x01D7D0FE, 0x06F09E0E,
+        0x05B4D78D, 0x0293997D, 0x02787102, 0x055F3FF2, 0x03AFA1FC, 0x0488EF0C, 0x04630773, 0x03444983,
+        0x02EB9475, 0x05CCDA85, 0x052732FA, 0x02007C0A, 0x04F0E204, 0x03D7ACF4, 0x033C448B, 0x041B0A7B,
+        0x075F43F8, 0x00780D08, 0x0093E577, 0x07B4AB87, 0x01443589, 0x06637B79, 0x06889306, 0x01AFDDF6,
+        0x05D728EA, 0x02F0661A, 0x021B8E65, 0x053CC095, 0x03CC5E9B, 0x04EB106B, 0x0400F814, 0x0327B6E4,
+        0x0063FF67, 0x0744B197, 0x07AF59E8, 0x00881718, 0x06788916, 0x015FC7E6, 0x01B42F99, 0x06936169,
+        0x073CBC9F, 0x001BF26F, 0x00F01A10, 0x07D754E0, 0x0127CAEE, 0x0600841E, 0x06EB6C61, 0x01CC2291,
+        0x02886B12, 0x05AF25E2, 0x0544CD9D, 0x0263836D, 0x04931D63, 0x03B45393, 0x035FBBEC, 0x0478F51C,
+
+        0x022C6ABB, 0x050B244B, 0x05E0CC34, 0x02C782C4, 0x04371CCA, 0x0310523A, 0x03FBBA45, 0x04DCF4B5,
+        0x0798BD36, 0x00BFF3C6, 0x00541BB9, 0x07735549, 0x0183CB47, 0x06A485B7, 0x064F6DC8, 0x01682338,
+        0x00C7FECE, 0x07E0B03E, 0x070B5841, 0x002C16B1, 0x06DC88BF, 0x01FBC64F, 0x01102E30, 0x063760C0,
+        0x05732943, 0x025467B3, 0x02BF8FCC, 0x0598C13C, 0x03685F32, 0x044F11C2, 0x04A4F9BD, 0x0383B74D,
+        0x07FB4251, 0x00DC0CA1, 0x0037E4DE, 0x0710AA2E, 0x01E03420, 0x06C77AD0, 0x062C92AF, 0x010BDC5F,
+        0x024F95DC, 0x0568DB2C, 0x05833353, 0x02A47DA3, 0x0454E3AD, 0x0373AD5D, 0x03984522, 0x04BF0BD2,
+        0x0510D624, 0x023798D4, 0x02DC70AB, 0x05FB3E5B, 0x030BA055, 0x042CEEA5, 0x04C706DA, 0x03E0482A,
+        0x00A401A9, 0x07834F59, 0x0768A726, 0x004FE9D6, 0x06BF77D8, 0x01983928, 0x0173D157, 0x06549FA7,
+
+        0x0458D576, 0x037F9B86, 0x039473F9, 0x04B33D09, 0x0243A307, 0x0564EDF7, 0x058F0588, 0x02A84B78,
+        0x01EC02FB, 0x06CB4C0B, 0x0620A474, 0x0107EA84, 0x07F7748A, 0x00D03A7A, 0x003BD205, 0x071C9CF5,
+        0x06B34103, 0x01940FF3, 0x017FE78C, 0x0658A97C, 0x00A83772, 0x078F7982, 0x076491FD, 0x0043DF0D,
+        0x0307968E, 0x0420D87E, 0x04CB3001, 0x03EC7EF1, 0x051CE0FF, 0x023BAE0F, 0x02D04670, 0x05F70880,
+        0x018FFD9C, 0x06A8B36C, 0x06435B13, 0x016415E3, 0x07948BED, 0x00B3C51D, 0x00582D62, 0x077F6392,
+        0x043B2A11, 0x031C64E1, 0x03F78C9E, 0x04D0C26E, 0x02205C60, 0x05071290, 0x05ECFAEF, 0x02CBB41F,
+        0x036469E9, 0x04432719, 0x04A8CF66, 0x038F8196, 0x057F1F98, 0x02585168, 0x02B3B917, 0x0594F7E7,
+        0x06D0BE64, 0x01F7F094, 0x011C18EB, 0x063B561B, 0x00CBC815, 0x07EC86E5, 0x07076E9A, 0x0020206A,
+
+        0x0674BFCD, 0x0153F13D, 0x01B81942, 0x069F57B2, 0x006FC9BC, 0x0748874C, 0x07A36F33, 0x008421C3,
+        0x03C06840, 0x04E726B0, 0x040CCECF, 0x032B803F, 0x05DB1E31, 0x02FC50C1, 0x0217B8BE, 0x0530F64E,
+        0x049F2BB8, 0x03B86548, 0x03538D37, 0x0474C3C7, 0x02845DC9, 0x05A31339, 0x0548FB46, 0x026FB5B6,
+        0x012BFC35, 0x060CB2C5, 0x06E75ABA, 0x01C0144A, 0x07308A44, 0x0017C4B4, 0x00FC2CCB, 0x07DB623B,
+        0x03A39727, 0x0484D9D7, 0x046F31A8, 0x03487F58, 0x05B8E156, 0x029FAFA6, 0x027447D9, 0x05530929,
+        0x061740AA, 0x01300E5A, 0x01DBE625, 0x06FCA8D5, 0x000C36DB, 0x072B782B, 0x07C09054, 0x00E7DEA4,
+        0x01480352, 0x066F4DA2, 0x0684A5DD, 0x01A3EB2D, 0x07537523, 0x00743BD3, 0x009FD3AC, 0x07B89D5C,
+        0x04FCD4DF, 0x03DB9A2F, 0x03307250, 0x04173CA0, 0x02E7A2AE, 0x05C0EC5E, 0x052B0421, 0x020C4AD1
+    },
+    {
+        0x00000000, 0x009F04F8, 0x013E09F0, 0x01A10D08, 0x027C13E0, 0x02E31718, 0x03421A10, 0x03DD1EE8,
+        0x04F827C0, 0x04672338, 0x05C62E30, 0x05592AC8, 0x06843420, 0x061B30D8, 0x07BA3DD0, 0x07253928,
+        0x007274EF, 0x00ED7017, 0x014C7D1F, 0x01D379E7, 0x020E670F, 0x029163F7, 0x03306EFF, 0x03AF6A07,
+        0x048A532F, 0x041557D7, 0x05B45ADF, 0x052B5E27, 0x06F640CF, 0x06694437, 0x07C8493F, 0x07574DC7,
+        0x00E4E9DE, 0x007BED26, 0x01DAE02E, 0x0145E4D6, 0x0298FA3E, 0x0207FEC6, 0x03A6F3CE, 0x0339F736,
+        0x041CCE1E, 0x0483CAE6, 0x0522C7EE, 0x05BDC316, 0x0660DDFE, 0x06FFD906, 0x075ED40E, 0x07C1D0F6,
+        0x00969D31, 0x000999C9, 0x01A894C1, 0x01379039, 0x02EA8ED1, 0x02758A29, 0x03D48721, 0x034B83D9,
+        0x046EBAF1, 0x04F1BE09, 0x0550B301, 0x05CFB7F9, 0x0612A911, 0x068DADE9, 0x072CA0E1, 0x07B3A419,
+
+        0x01C9D3BC, 0x0156D744, 0x00F7DA4C, 0x0068DEB4, 0x03B5C05C, 0x032AC4A4, 0x028BC9AC, 0x0214CD54,
+        0x0531F47C, 0x05AEF084, 0x040FFD8C, 0x0490F974, 0x074DE79C, 0x07D2E364, 0x0673EE6C, 0x06ECEA94,
+        0x01BBA753, 0x0124A3AB, 0x0085AEA3, 0x001AAA5B, 0x03C7B4B3, 0x0358B04B, 0x02F9BD43, 0x0266B9BB,
+        0x05438093, 0x05DC846B, 0x047D8963, 0x04E28D9B, 0x073F9373, 0x07A0978B, 0x06019A83, 0x069E9E7B,
+        0x012D3A62, 0x01B23E9A, 0x00133392, 0x008C376A, 0x03512982, 0x03CE2D7A, 0x026F2072, 0x02F0248A,
+        0x05D51DA2, 0x054A195A, 0x04EB1452, 0x047410AA, 0x07A90E42, 0x07360ABA, 0x069707B2, 0x0608034A,
+        0x015F4E8D, 0x01C04A75, 0x0061477D, 0x00FE4385, 0x03235D6D, 0x03BC5995, 0x021D549D, 0x02825065,
+        0x05A7694D, 0x05386DB5, 0x049960BD, 0x04066445, 0x07DB7AAD, 0x07447E55, 0x06E5735D, 0x067A77A5,
+
+        0x0393A778, 0x030CA380, 0x02ADAE88, 0x0232AA70, 0x01EFB498, 0x0170B060, 0x00D1BD68, 0x004EB990,
+        0x076B80B8, 0x07F48440, 0x06558948, 0x06CA8DB0, 0x05179358, 0x058897A0, 0x04299AA8, 0x04B69E50,
+        0x03E1D397, 0x037ED76F, 0x02DFDA67, 0x0240DE9F, 0x019DC077, 0x0102C48F, 0x00A3C987, 0x003CCD7F,
+        0x0719F457, 0x0786F0AF, 0x0627FDA7, 0x06B8F95F, 0x0565E7B7, 0x05FAE34F, 0x045BEE47, 0x04C4EABF,
+        0x03774EA6, 0x03E84A5E, 0x02494756, 0x02D643AE, 0x010B5D46, 0x019459BE, 0x003554B6, 0x00AA504E,
+        0x078F6966, 0x07106D9E, 0x06B16096, 0x062E646E, 0x05F37A86, 0x056C7E7E, 0x04CD7376, 0x0452778E,
+        0x03053A49, 0x039A3EB1, 0x023B33B9, 0x02A43741, 0x017929A9, 0x01E62D51, 0x00472059, 0x00D824A1,
+        0x07FD1D89, 0x07621971, 0x06C31479, 0x065C1081, 0x05810E69, 0x051E0A91, 0x04BF0799, 0x04200361,
+
+        0x025A74C4, 0x02C5703C, 0x03647D34, 0x03FB79CC, 0x00266724, 0x00B963DC, 0x01186ED4, 0x01876A2C,
+        0x06A25304, 0x063D57FC, 0x079C5AF4, 0x07035E0C, 0x04DE40E4, 0x0441441C, 0x05E04914, 0x057F4DEC,
+        0x0228002B, 0x02B704D3, 0x031609DB, 0x03890D23, 0x005413CB, 0x00CB1733, 0x016A1A3B, 0x01F51EC3,
+        0x06D027EB, 0x064F2313, 0x07EE2E1B, 0x07712AE3, 0x04AC340B, 0x043330F3, 0x05923DFB, 0x050D3903,
+        0x02BE9D1A, 0x022199E2, 0x038094EA, 0x031F9012, 0x00C28EFA, 0x005D8A02, 0x01FC870A, 0x016383F2,
+        0x0646BADA, 0x06D9BE22, 0x0778B32A, 0x07E7B7D2, 0x043AA93A, 0x04A5ADC2, 0x0504A0CA, 0x059BA432,
+        0x02CCE9F5, 0x0253ED0D, 0x03F2E005, 0x036DE4FD, 0x00B0FA15, 0x002FFEED, 0x018EF3E5, 0x0111F71D,
+        0x0634CE35, 0x06ABCACD, 0x070AC7C5, 0x0795C33D, 0x0448DDD5, 0x04D7D92D, 0x0576D425, 0x05E9D0DD
+    },
+    {
+        0x00000000, 0x048D9368, 0x00991DBF, 0x04148ED7, 0x01323B7E, 0x05BFA816, 0x01AB26C1, 0x0526B5A9,
+        0x026476FC, 0x06E9E594, 0x02FD6B43, 0x0670F82B, 0x03564D82, 0x07DBDEEA, 0x03CF503D, 0x0742C355,
+        0x04C8EDF8, 0x00457E90, 0x0451F047, 0x00DC632F, 0x05FAD686, 0x017745EE, 0x0563CB39, 0x01EE5851,
+        0x06AC9B04, 0x0221086C, 0x063586BB, 0x02B815D3, 0x079EA07A, 0x03133312, 0x0707BDC5, 0x038A2EAD,
+        0x0013E09F, 0x049E73F7, 0x008AFD20, 0x04076E48, 0x0121DBE1, 0x05AC4889, 0x01B8C65E, 0x05355536,
+        0x02779663, 0x06FA050B, 0x02EE8BDC, 0x066318B4, 0x0345AD1D, 0x07C83E75, 0x03DCB0A2, 0x075123CA,
+        0x04DB0D67, 0x00569E0F, 0x044210D8, 0x00CF83B0, 0x05E93619, 0x0164A571, 0x05702BA6, 0x01FDB8CE,
+        0x06BF7B9B, 0x0232E8F3, 0x06266624, 0x02ABF54C, 0x078D40E5, 0x0300D38D, 0x07145D5A, 0x0399CE32,
+
+        0x0027C13E, 0x04AA5256, 0x00BEDC81, 0x04334FE9, 0x0115FA40, 0x05986928, 0x018CE7FF, 0x05017497,
+        0x0243B7C2, 0x06CE24AA, 0x02DAAA7D, 0x06573915, 0x03718CBC, 0x07FC1FD4, 0x03E89103, 0x0765026B,
+        0x04EF2CC6, 0x0062BFAE, 0x04763179, 0x00FBA211, 0x05DD17B8, 0x015084D0, 0x05440A07, 0x01C9996F,
+        0x068B5A3A, 0x0206C952, 0x06124785, 0x029FD4ED, 0x07B96144, 0x0334F22C, 0x07207CFB, 0x03ADEF93,
+        0x003421A1, 0x04B9B2C9, 0x00AD3C1E, 0x0420AF76, 0x01061ADF, 0x058B89B7, 0x019F0760, 0x05129408,
+        0x0250575D, 0x06DDC435, 0x02C94AE2, 0x0644D98A, 0x03626C23, 0x07EFFF4B, 0x03FB719C, 0x0776E2F4,
+        0x04FCCC59, 0x00715F31, 0x0465D1E6, 0x00E8428E, 0x05CEF727, 0x0143644F, 0x0557EA98, 0x01DA79F0,
+        0x0698BAA5, 0x021529CD, 0x0601A71A, 0x028C3472, 0x07AA81DB, 0x032712B3, 0x07339C64, 0x03BE0F0C,
+
+        0x004F827C, 0x04C21114, 0x00D69FC3, 0x045B0CAB, 0x017DB902, 0x05F02A6A, 0x01E4A4BD, 0x056937D5,
+        0x022BF480, 0x06A667E8, 0x02B2E93F, 0x063F7A57, 0x0319CFFE, 0x07945C96, 0x0380D241, 0x070D4129,
+        0x04876F84, 0x000AFCEC, 0x041E723B, 0x0093E153, 0x05B554FA, 0x0138C792, 0x052C4945, 0x01A1DA2D,
+        0x06E31978, 0x026E8A10, 0x067A04C7, 0x02F797AF, 0x07D12206, 0x035CB16E, 0x07483FB9, 0x03C5ACD1,
+        0x005C62E3, 0x04D1F18B, 0x00C57F5C, 0x0448EC34, 0x016E599D, 0x05E3CAF5, 0x01F74422, 0x057AD74A,
+        0x0238141F, 0x06B58777, 0x02A109A0, 0x062C9AC8, 0x030A2F61, 0x0787BC09, 0x039332DE, 0x071EA1B6,
+        0x04948F1B, 0x00191C73, 0x040D92A4, 0x008001CC, 0x05A6B465, 0x012B270D, 0x053FA9DA, 0x01B23AB2,
+        0x06F0F9E7, 0x027D6A8F, 0x0669E458, 0x02E47730, 0x07C2C299, 0x034F51F1, 0x075BDF26, 0x03D64C4E,
+
+        0x00684342, 0x04E5D02A, 0x00F15EFD, 0x047CCD95, 0x015A783C, 0x05D7EB54, 0x01C36583, 0x054EF6EB,
+        0x020C35BE, 0x0681A6D6, 0x02952801, 0x0618BB69, 0x033E0EC0, 0x07B39DA8, 0x03A7137F, 0x072A8017,
+        0x04A0AEBA, 0x002D3DD2, 0x0439B305, 0x00B4206D, 0x059295C4, 0x011F06AC, 0x050B887B, 0x01861B13,
+        0x06C4D846, 0x02494B2E, 0x065DC5F9, 0x02D05691, 0x07F6E338, 0x037B7050, 0x076FFE87, 0x03E26DEF,
+        0x007BA3DD, 0x04F630B5, 0x00E2BE62, 0x046F2D0A, 0x014998A3, 0x05C40BCB, 0x01D0851C, 0x055D1674,
+        0x021FD521, 0x06924649, 0x0286C89E, 0x060B5BF6, 0x032DEE5F, 0x07A07D37, 0x03B4F3E0, 0x07396088,
+        0x04B34E25, 0x003EDD4D, 0x042A539A, 0x00A7C0F2, 0x0581755B, 0x010CE633, 0x051868E4, 0x0195FB8C,
+        0x06D738D9, 0x025AABB1, 0x064E2566, 0x02C3B60E, 0x07E503A7, 0x036890CF, 0x077C1E18, 0x03F18D70
+    },
+    {
+        0x00000000, 0x01E0F893, 0x03C1F126, 0x022109B5, 0x0783E24C, 0x06631ADF, 0x0442136A, 0x05A2EBF9,
+        0x0685FFF7, 0x07650764, 0x05440ED1, 0x04A4F642, 0x01061DBB, 0x00E6E528, 0x02C7EC9D, 0x0327140E,
+        0x0489C481, 0x05693C12, 0x074835A7, 0x06A8CD34, 0x030A26CD, 0x02EADE5E, 0x00CBD7EB, 0x012B2F78,
+        0x020C3B76, 0x03ECC3E5, 0x01CDCA50, 0x002D32C3, 0x058FD93A, 0x046F21A9, 0x064E281C, 0x07AED08F,
+        0x0091B26D, 0x01714AFE, 0x0350434B, 0x02B0BBD8, 0x07125021, 0x06F2A8B2, 0x04D3A107, 0x05335994,
+        0x06144D9A, 0x07F4B509, 0x05D5BCBC, 0x0435442F, 0x0197AFD6, 0x00775745, 0x02565EF0, 0x03B6A663,
+        0x041876EC, 0x05F88E7F, 0x07D987CA, 0x06397F59, 0x039B94A0, 0x027B6C33, 0x005A6586, 0x01BA9D15,
+        0x029D891B, 0x037D7188, 0x015C783D, 0x00BC80AE, 0x051E6B57, 0x04FE93C4, 0x06DF9A71, 0x073F62E2,
+
+        0x012364DA, 0x00C39C49, 0x02E295FC, 0x03026D6F, 0x06A08696, 0x07407E05, 0x056177B0, 0x04818F23,
+        0x07A69B2D, 0x064663BE, 0x04676A0B, 0x05879298, 0x00257961, 0x01C581F2, 0x03E48847, 0x020470D4,
+        0x05AAA05B, 0x044A58C8, 0x066B517D, 0x078BA9EE, 0x02294217, 0x03C9BA84, 0x01E8B331, 0x00084BA2,
+        0x032F5FAC, 0x02CFA73F, 0x00EEAE8A, 0x010E5619, 0x04ACBDE0, 0x054C4573, 0x076D4CC6, 0x068DB455,
+        0x01B2D6B7, 0x00522E24, 0x02732791, 0x0393DF02, 0x063134FB, 0x07D1CC68, 0x05F0C5DD, 0x04103D4E,
+        0x07372940, 0x06D7D1D3, 0x04F6D866, 0x051620F5, 0x00B4CB0C, 0x0154339F, 0x03753A2A, 0x0295C2B9,
+        0x053B1236, 0x04DBEAA5, 0x06FAE310, 0x071A1B83, 0x02B8F07A, 0x035808E9, 0x0179015C, 0x0099F9CF,
+        0x03BEEDC1, 0x025E1552, 0x007F1CE7, 0x019FE474, 0x043D0F8D, 0x05DDF71E, 0x07FCFEAB, 0x061C0638,
+
+        0x0246C9B4, 0x03A63127, 0x01873892, 0x0067C001, 0x05C52BF8, 0x0425D36B, 0x0604DADE, 0x07E4224D,
+        0x04C33643, 0x0523CED0, 0x0702C765, 0x06E23FF6, 0x0340D40F, 0x02A02C9C, 0x00812529, 0x0161DDBA,
+        0x06CF0D35, 0x072FF5A6, 0x050EFC13, 0x04EE0480, 0x014CEF79, 0x00AC17EA, 0x028D1E5F, 0x036DE6CC,
+        0x004AF2C2, 0x01AA0A51, 0x038B03E4, 0x026BFB77, 0x07C9108E, 0x0629E81D, 0x0408E1A8, 0x05E8193B,
+        0x02D77BD9, 0x0337834A, 0x01168AFF, 0x00F6726C, 0x05549995, 0x04B46106, 0x069568B3, 0x07759020,
+        0x0452842E, 0x05B27CBD, 0x07937508, 0x06738D9B, 0x03D16662, 0x02319EF1, 0x00109744, 0x01F06FD7,
+        0x065EBF58, 0x07BE47CB, 0x059F4E7E, 0x047FB6ED, 0x01DD5D14, 0x003DA587, 0x021CAC32, 0x03FC54A1,
+        0x00DB40AF, 0x013BB83C, 0x031AB189, 0x02FA491A, 0x0758A2E3, 0x06B85A70, 0x049953C5, 0x0579AB56,
+
+        0x0365AD6E, 0x028555FD, 0x00A45C48, 0x0144A4DB, 0x04E64F22, 0x0506B7B1, 0x0727BE04, 0x06C74697,
+        0x05E05299, 0x0400AA0A, 0x0621A3BF, 0x07C15B2C, 0x0263B0D5, 0x03834846, 0x01A241F3, 0x0042B960,
+        0x07EC69EF, 0x060C917C, 0x042D98C9, 0x05CD605A, 0x006F8BA3, 0x018F7330, 0x03AE7A85, 0x024E8216,
+        0x01699618, 0x00896E8B, 0x02A8673E, 0x03489FAD, 0x06EA7454, 0x070A8CC7, 0x052B8572, 0x04CB7DE1,
+        0x03F41F03, 0x0214E790, 0x0035EE25, 0x01D516B6, 0x0477FD4F, 0x059705DC, 0x07B60C69, 0x0656F4FA,
+        0x0571E0F4, 0x04911867, 0x06B011D2, 0x0750E941, 0x02F202B8, 0x0312FA2B, 0x0133F39E, 0x00D30B0D,
+        0x077DDB82, 0x069D2311, 0x04BC2AA4, 0x055CD237, 0x00FE39CE, 0x011EC15D, 0x033FC8E8, 0x02DF307B,
+        0x01F82475, 0x0018DCE6, 0x0239D553, 0x03D92DC0, 0x067BC639, 0x079B3EAA, 0x05BA371F, 0x045ACF8C
+    }
+};
+
+// CRC-32C, polynomial 0x82F63B78 (reversed), tables of 0 to 7 bytes look ahead.
+static const uint32_t hash_crc32c_slice_table[8][256] =
+{
+    {
+        0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+        0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+        0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+        0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+        0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+        0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+        0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+        0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+
+        0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+        0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+        0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+        0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+        0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+        0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+        0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+        0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+
+        0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+        0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+        0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+        0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+        0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+        0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+        0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+        0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+
+        0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+        0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+        0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+        0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+        0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+        0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+        0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+        0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351
+    },
+    {
+        0x00000000, 0x13A29877, 0x274530EE, 0x34E7A899, 0x4E8A61DC, 0x5D28F9AB, 0x69CF5132, 0x7A6DC945,
+        0x9D14C3B8, 0x8EB65BCF, 0xBA51F356, 0xA9F36B21, 0xD39EA264, 0xC03C3A13, 0xF4DB928A, 0xE7790AFD,
+        0x3FC5F181, 0x2C6769F6, 0x1880C16F, 0x0B225918, 0x714F905D, 0x62ED082A, 0x560AA0B3, 0x45A838C4,
+        0xA2D13239, 0xB173AA4E, 0x859402D7, 0x96369AA0, 0xEC5B53E5, 0xFFF9CB92, 0xCB1E630B, 0xD8BCFB7C,
+        0x7F8BE302, 0x6C297B75, 0x58CED3EC, 0x4B6C4B9B, 0x310182DE, 0x22A31AA9, 0x1644B230, 0x05E62A47,
+        0xE29F20BA, 0xF13DB8CD, 0xC5DA1054, 0xD6788823, 0xAC154166, 0xBFB7D911, 0x8B507188, 0x98F2E9FF,
+        0x404E1283, 0x53EC8AF4, 0x670B226D, 0x74A9BA1A, 0x0EC4735F, 0x1D66EB28, 0x298143B1, 0x3A23DBC6,
+        0xDD5AD13B, 0xCEF8494C, 0xFA1FE1D5, 0xE9BD79A2, 0x93D0B0E7, 0x80722890, 0xB4958009, 0xA737187E,
+
+        0xFF17C604, 0xECB55E73, 0xD852F6EA, 0xCBF06E9D, 0xB19DA7D8, 0xA23F3FAF, 0x96D89736, 0x857A0F41,
+        0x620305BC, 0x71A19DCB, 0x45463552, 0x56E4AD25, 0x2C896460, 0x3F2BFC17, 0x0BCC548E, 0x186ECCF9,
+        0xC0D23785, 0xD370AFF2, 0xE797076B, 0xF4359F1C, 0x8E585659, 0x9DFACE2E, 0xA91D66B7, 0xBABFFEC0,
+        0x5DC6F43D, 0x4E646C4A, 0x7A83C4D3, 0x69215CA4, 0x134C95E1, 0x00EE0D96, 0x3409A50F, 0x27AB3D78,
+        0x809C2506, 0x933EBD71, 0xA7D915E8, 0xB47B8D9F, 0xCE1644DA, 0xDDB4DCAD, 0xE9537434, 0xFAF1EC43,
+        0x1D88E6BE, 0x0E2A7EC9, 0x3ACDD650, 0x296F4E27, 0x53028762, 0x40A01F15, 0x7447B78C, 0x67E52FFB,
+        0xBF59D487, 0xACFB4CF0, 0x981CE469, 0x8BBE7C1E, 0xF1D3B55B, 0xE2712D2C, 0xD69685B5, 0xC5341DC2,
+        0x224D173F, 0x31EF8F48, 0x050827D1, 0x16AABFA6, 0x6CC776E3, 0x7F65EE94, 0x4B82460D, 0x5820DE7A,
+
+        0xFBC3FAF9, 0xE861628E, 0xDC86CA17, 0xCF245260, 0xB5499B25, 0xA6EB0352, 0x920CABCB, 0x81AE33BC,
+        0x66D73941, 0x7575A136, 0x419209AF, 0x523091D8, 0x285D589D, 0x3BFFC0EA, 0x0F186873, 0x1CBAF004,
+        0xC4060B78, 0xD7A4930F, 0xE3433B96, 0xF0E1A3E1, 0x8A8C6AA4, 0x992EF2D3, 0xADC95A4A, 0xBE6BC23D,
+        0x5912C8C0, 0x4AB050B7, 0x7E57F82E, 0x6DF56059, 0x1798A91C, 0x043A316B, 0x30DD99F2, 0x237F0185,
+        0x844819FB, 0x97EA818C, 0xA30D2915, 0xB0AFB162, 0xCAC27827, 0xD960E050, 0xED8748C9, 0xFE25D0BE,
+        0x195CDA43, 0x0AFE4234, 0x3E19EAAD, 0x2DBB72DA, 0x57D6BB9F, 0x447423E8, 0x70938B71, 0x63311306,
+        0xBB8DE87A, 0xA82F700D, 0x9CC8D894, 0x8F6A40E3, 0xF50789A6, 0xE6A511D1, 0xD242B948, 0xC1E0213F,
+        0x26992BC2, 0x353BB3B5, 0x01DC1B2C, 0x127E835B, 0x68134A1E, 0x7BB1D269, 0x4F567AF0, 0x5CF4E287,
+
+        0x04D43CFD, 0x1776A48A, 0x23910C13, 0x30339464, 0x4A5E5D21, 0x59FCC556, 0x6D1B6DCF, 0x7EB9F5B8,
+        0x99C0FF45, 0x8A626732, 0xBE85CFAB, 0xAD2757DC, 0xD74A9E99, 0xC4E806EE, 0xF00FAE77, 0xE3AD3600,
+        0x3B11CD7C, 0x28B3550B, 0x1C54FD92, 0x0FF665E5, 0x759BACA0, 0x663934D7, 0x52DE9C4E, 0x417C0439,
+        0xA6050EC4, 0xB5A796B3, 0x81403E2A, 0x92E2A65D, 0xE88F6F18, 0xFB2DF76F, 0xCFCA5FF6, 0xDC68C781,
+        0x7B5FDFFF, 0x68FD4788, 0x5C1AEF11, 0x4FB87766, 0x35D5BE23, 0x26772654, 0x12908ECD, 0x013216BA,
+        0xE64B1C47, 0xF5E98430, 0xC10E2CA9, 0xD2ACB4DE, 0xA8C17D9B, 0xBB63E5EC, 0x8F844D75, 0x9C26D502,
+        0x449A2E7E, 0x5738B609, 0x63DF1E90, 0x707D86E7, 0x0A104FA2, 0x19B2D7D5, 0x2D557F4C, 0x3EF7E73B,
+        0xD98EEDC6, 0xCA2C75B1, 0xFECBDD28, 0xED69455F, 0x97048C1A, 0x84A6146D, 0xB041BCF4, 0xA3E32483
+    },
+    {
+        0x00000000, 0xA541927E, 0x4F6F520D, 0xEA2EC073, 0x9EDEA41A, 0x3B9F3664, 0xD1B1F617, 0x74F06469,
+        0x38513EC5, 0x9D10ACBB, 0x773E6CC8, 0xD27FFEB6, 0xA68F9ADF, 0x03CE08A1, 0xE9E0C8D2, 0x4CA15AAC,
+        0x70A27D8A, 0xD5E3EFF4, 0x3FCD2F87, 0x9A8CBDF9, 0xEE7CD990, 0x4B3D4BEE, 0xA1138B9D, 0x045219E3,
+        0x48F3434F, 0xEDB2D131, 0x079C1142, 0xA2DD833C, 0xD62DE755, 0x736C752B, 0x9942B558, 0x3C032726,
+        0xE144FB14, 0x4405696A, 0xAE2BA919, 0x0B6A3B67, 0x7F9A5F0E, 0xDADBCD70, 0x30F50D03, 0x95B49F7D,
+        0xD915C5D1, 0x7C5457AF, 0x967A97DC, 0x333B05A2, 0x47CB61CB, 0xE28AF3B5, 0x08A433C6, 0xADE5A1B8,
+        0x91E6869E, 0x34A714E0, 0xDE89D493, 0x7BC846ED, 0x0F382284, 0xAA79B0FA, 0x40577089, 0xE516E2F7,
+        0xA9B7B85B, 0x0CF62A25, 0xE6D8EA56, 0x43997828, 0x37691C41, 0x92288E3F, 0x78064E4C, 0xDD47DC32,
+
+        0xC76580D9, 0x622412A7, 0x880AD2D4, 0x2D4B40AA, 0x59BB24C3, 0xFCFAB6BD, 0x16D476CE, 0xB395E4B0,
+        0xFF34BE1C, 0x5A752C62, 0xB05BEC11, 0x151A7E6F, 0x61EA1A06, 0xC4AB8878, 0x2E85480B, 0x8BC4DA75,
+        0xB7C7FD53, 0x12866F2D, 0xF8A8AF5E, 0x5DE93D20, 0x29195949, 0x8C58CB37, 0x66760B44, 0xC337993A,
+        0x8F96C396, 0x2AD751E8, 0xC0F9919B, 0x65B803E5, 0x1148678C, 0xB409F5F2, 0x5E273581, 0xFB66A7FF,
+        0x26217BCD, 0x8360E9B3, 0x694E29C0, 0xCC0FBBBE, 0xB8FFDFD7, 0x1DBE4DA9, 0xF7908DDA, 0x52D11FA4,
+        0x1E704508, 0xBB31D776, 0x511F1705, 0xF45E857B, 0x80AEE112, 0x25EF736C, 0xCFC1B31F, 0x6A802161,
+        0x56830647, 0xF3C29439, 0x19EC544A, 0xBCADC634, 0xC85DA25D, 0x6D1C3023, 0x8732F050, 0x2273622E,
+        0x6ED23882, 0xCB93AAFC, 0x21BD6A8F, 0x84FCF8F1, 0xF00C9C98, 0x554D0EE6, 0xBF63CE95, 0x1A225CEB,
+
+        0x8B277743, 0x2E66E53D, 0xC448254E, 0x6109B730, 0x15F9D359, 0xB0B84127, 0x5A968154, 0xFFD7132A,
+        0xB3764986, 0x1637DBF8, 0xFC191B8B, 0x595889F5, 0x2DA8ED9C, 0x88E97FE2, 0x62C7BF91, 0xC7862DEF,
+        0xFB850AC9, 0x5EC498B7, 0xB4EA58C4, 0x11ABCABA, 0x655BAED3, 0xC01A3CAD, 0x2A34FCDE, 0x8F756EA0,
+        0xC3D4340C, 0x6695A672, 0x8CBB6601, 0x29FAF47F, 0x5D0A9016, 0xF84B0268, 0x1265C21B, 0xB7245065,
+        0x6A638C57, 0xCF221E29, 0x250CDE5A, 0x804D4C24, 0xF4BD284D, 0x51FCBA33, 0xBBD27A40, 0x1E93E83E,
+        0x5232B292, 0xF77320EC, 0x1D5DE09F, 0xB81C72E1, 0xCCEC1688, 0x69AD84F6, 0x83834485, 0x26C2D6FB,
+        0x1AC1F1DD, 0xBF8063A3, 0x55AEA3D0, 0xF0EF31AE, 0x841F55C7, 0x215EC7B9, 0xCB7007CA, 0x6E3195B4,
+        0x2290CF18, 0x87D15D66, 0x6DFF9D15, 0xC8BE0F6B, 0xBC4E6B02, 0x190FF97C, 0xF321390F, 0x5660AB71,
+
+        0x4C42F79A, 0xE90365E4, 0x032DA597, 0xA66C37E9, 0xD29C5380, 0x77DDC1FE, 0x9DF3018D, 0x38B293F3,
+        0x7413C95F, 0xD1525B21, 0x3B7C9B52, 0x9E3D092C, 0xEACD6D45, 0x4F8CFF3B, 0xA5A23F48, 0x00E3AD36,
+        0x3CE08A10, 0x99A1186E, 0x738FD81D, 0xD6CE4A63, 0xA23E2E0A, 0x077FBC74, 0xED517C07, 0x4810EE79,
+        0x04B1B4D5, 0xA1F026AB, 0x4BDEE6D8, 0xEE9F74A6, 0x9A6F10CF, 0x3F2E82B1, 0xD50042C2, 0x7041D0BC,
+        0xAD060C8E, 0x08479EF0, 0xE2695E83, 0x4728CCFD, 0x33D8A894, 0x96993AEA, 0x7CB7FA99, 0xD9F668E7,
+        0x9557324B, 0x3016A035, 0xDA386046, 0x7F79F238, 0x0B899651, 0xAEC8042F, 0x44E6C45C, 0xE1A75622,
+        0xDDA47104, 0x78E5E37A, 0x92CB2309, 0x378AB177, 0x437AD51E, 0xE63B4760, 0x0C158713, 0xA954156D,
+        0xE5F54FC1, 0x40B4DDBF, 0xAA9A1DCC, 0x0FDB8FB2, 0x7B2BEBDB, 0xDE6A79A5, 0x3444B9D6, 0x91052BA8
+    },
+    {
+        0x00000000, 0xDD45AAB8, 0xBF672381, 0x62228939, 0x7B2231F3, 0xA6679B4B, 0xC4451272, 0x1900B8CA,
+        0xF64463E6, 0x2B01C95E, 0x49234067, 0x9466EADF, 0x8D665215, 0x5023F8AD, 0x32017194, 0xEF44DB2C,
+        0xE964B13D, 0x34211B85, 0x560392BC, 0x8B463804, 0x924680CE, 0x4F032A76, 0x2D21A34F, 0xF06409F7,
+        0x1F20D2DB, 0xC2657863, 0xA047F15A, 0x7D025BE2, 0x6402E328, 0xB9474990, 0xDB65C0A9, 0x06206A11,
+        0xD725148B, 0x0A60BE33, 0x6842370A, 0xB5079DB2, 0xAC072578, 0x71428FC0, 0x136006F9, 0xCE25AC41,
+        0x2161776D, 0xFC24DDD5, 0x9E0654EC, 0x4343FE54, 0x5A43469E, 0x8706EC26, 0xE524651F, 0x3861CFA7,
+        0x3E41A5B6, 0xE3040F0E, 0x81268637, 0x5C632C8F, 0x45639445, 0x98263EFD, 0xFA04B7C4, 0x27411D7C,
+        0xC805C650, 0x15406CE8, 0x7762E5D1, 0xAA274F69, 0xB327F7A3, 0x6E625D1B, 0x0C40D422, 0xD1057E9A,
+
+        0xABA65FE7, 0x76E3F55F, 0x14C17C66, 0xC984D6DE, 0xD0846E14, 0x0DC1C4AC, 0x6FE34D95, 0xB2A6E72D,
+        0x5DE23C01, 0x80A796B9, 0xE2851F80, 0x3FC0B538, 0x26C00DF2, 0xFB85A74A, 0x99A72E73, 0x44E284CB,
+        0x42C2EEDA, 0x9F874462, 0xFDA5CD5B, 0x20E067E3, 0x39E0DF29, 0xE4A57591, 0x8687FCA8, 0x5BC25610,
+        0xB4868D3C, 0x69C32784, 0x0BE1AEBD, 0xD6A40405, 0xCFA4BCCF, 0x12E11677, 0x70C39F4E, 0xAD8635F6,
+        0x7C834B6C, 0xA1C6E1D4, 0xC3E468ED, 0x1EA1C255, 0x07A17A9F, 0xDAE4D027, 0xB8C6591E, 0x6583F3A6,
+        0x8AC7288A, 0x57828232, 0x35A00B0B, 0xE8E5A1B3, 0xF1E51979, 0x2CA0B3C1, 0x4E823AF8, 0x93C79040,
+        0x95E7FA51, 0x48A250E9, 0x2A80D9D0, 0xF7C57368, 0xEEC5CBA2, 0x3380611A, 0x51A2E823, 0x8CE7429B,
+        0x63A399B7, 0xBEE6330F, 0xDCC4BA36, 0x0181108E, 0x1881A844, 0xC5C402FC, 0xA7E68BC5, 0x7AA3217D,
+
+        0x52A0C93F, 0x8FE56387, 0xEDC7EABE, 0x30824006, 0x2982F8CC, 0xF4C75274, 0x96E5DB4D, 0x4BA071F5,
+        0xA4E4AAD9, 0x79A10061, 0x1B838958, 0xC6C623E0, 0xDFC69B2A, 0x02833192, 0x60A1B8AB, 0xBDE41213,
+        0xBBC47802, 0x6681D2BA, 0x04A35B83, 0xD9E6F13B, 0xC0E649F1, 0x1DA3E349, 0x7F816A70, 0xA2C4C0C8,
+        0x4D801BE4, 0x90C5B15C, 0xF2E73865, 0x2FA292DD, 0x36A22A17, 0xEBE780AF, 0x89C50996, 0x5480A32E,
+        0x8585DDB4, 0x58C0770C, 0x3AE2FE35, 0xE7A7548D, 0xFEA7EC47, 0x23E246FF, 0x41C0CFC6, 0x9C85657E,
+        0x73C1BE52, 0xAE8414EA, 0xCCA69DD3, 0x11E3376B, 0x08E38FA1, 0xD5A62519, 0xB784AC20, 0x6AC10698,
+        0x6CE16C89, 0xB1A4C631, 0xD3864F08, 0x0EC3E5B0, 0x17C35D7A, 0xCA86F7C2, 0xA8A47EFB, 0x75E1D443,
+        0x9AA50F6F, 0x47E0A5D7, 0x25C22CEE, 0xF8878656, 0xE1873E9C, 0x3CC29424, 0x5EE01D1D, 0x83A5B7A5,
+
+        0xF90696D8, 0x24433C60, 0x4661B559, 0x9B241FE1, 0x8224A72B, 0x5F610D93, 0x3D4384AA, 0xE0062E12,
+        0x0F42F53E, 0xD2075F86, 0xB025D6BF, 0x6D607C07, 0x7460C4CD, 0xA9256E75, 0xCB07E74C, 0x16424DF4,
+        0x106227E5, 0xCD278D5D, 0xAF050464, 0x7240AEDC, 0x6B401616, 0xB605BCAE, 0xD4273597, 0x09629F2F,
+        0xE6264403, 0x3B63EEBB, 0x59416782, 0x8404CD3A, 0x9D0475F0, 0x4041DF48, 0x22635671, 0xFF26FCC9,
+        0x2E238253, 0xF36628EB, 0x9144A1D2, 0x4C010B6A, 0x5501B3A0, 0x88441918, 0xEA669021, 0x37233A99,
+        0xD867E1B5, 0x05224B0D, 0x6700C234, 0xBA45688C, 0xA345D046, 0x7E007AFE, 0x1C22F3C7, 0xC167597F,
+        0xC747336E, 0x1A0299D6, 0x782010EF, 0xA565BA57, 0xBC65029D, 0x6120A825, 0x0302211C, 0xDE478BA4,
+        0x31035088, 0xEC46FA30, 0x8E647309, 0x5321D9B1, 0x4A21617B, 0x9764CBC3, 0xF54642FA, 0x2803E842
+    },
+    {
+        0x00000000, 0x38116FAC, 0x7022DF58, 0x4833B0F4, 0xE045BEB0, 0xD854D11C, 0x906761E8, 0xA8760E44,
+        0xC5670B91, 0xFD76643D, 0xB545D4C9, 0x8D54BB65, 0x2522B521, 0x1D33DA8D, 0x55006A79, 0x6D1105D5,
+        0x8F2261D3, 0xB7330E7F, 0xFF00BE8B, 0xC711D127, 0x6F67DF63, 0x5776B0CF, 0x1F45003B, 0x27546F97,
+        0x4A456A42, 0x725405EE, 0x3A67B51A, 0x0276DAB6, 0xAA00D4F2, 0x9211BB5E, 0xDA220BAA, 0xE2336406,
+        0x1BA8B557, 0x23B9DAFB, 0x6B8A6A0F, 0x539B05A3, 0xFBED0BE7, 0xC3FC644B, 0x8BCFD4BF, 0xB3DEBB13,
+        0xDECFBEC6, 0xE6DED16A, 0xAEED619E, 0x96FC0E32, 0x3E8A0076, 0x069B6FDA, 0x4EA8DF2E, 0x76B9B082,
+        0x948AD484, 0xAC9BBB28, 0xE4A80BDC, 0xDCB96470, 0x74CF6A34, 0x4CDE0598, 0x04EDB56C, 0x3CFCDAC0,
+        0x51EDDF15, 0x69FCB0B9, 0x21CF004D, 0x19DE6FE1, 0xB1A861A5, 0x89B90E09, 0xC18ABEFD, 0xF99BD151,
+
+        0x37516AAE, 0x0F400502, 0x4773B5F6, 0x7F62DA5A, 0xD714D41E, 0xEF05BBB2, 0xA7360B46, 0x9F2764EA,
+        0xF236613F, 0xCA270E93, 0x8214BE67, 0xBA05D1CB, 0x1273DF8F, 0x2A62B023, 0x625100D7, 0x5A406F7B,
+        0xB8730B7D, 0x806264D1, 0xC851D425, 0xF040BB89, 0x5836B5CD, 0x6027DA61, 0x28146A95, 0x10050539,
+        0x7D1400EC, 0x45056F40, 0x0D36DFB4, 0x3527B018, 0x9D51BE5C, 0xA540D1F0, 0xED736104, 0xD5620EA8,
+        0x2CF9DFF9, 0x14E8B055, 0x5CDB00A1, 0x64CA6F0D, 0xCCBC6149, 0xF4AD0EE5, 0xBC9EBE11, 0x848FD1BD,
+        0xE99ED468, 0xD18FBBC4, 0x99BC0B30, 0xA1AD649C, 0x09DB6AD8, 0x31CA0574, 0x79F9B580, 0x41E8DA2C,
+        0xA3DBBE2A, 0x9BCAD186, 0xD3F96172, 0xEBE80EDE, 0x439E009A, 0x7B8F6F36, 0x33BCDFC2, 0x0BADB06E,
+        0x66BCB5BB, 0x5EADDA17, 0x169E6AE3, 0x2E8F054F, 0x86F90B0B, 0xBEE864A7, 0xF6DBD453, 0xCECABBFF,
+
+        0x6EA2D55C, 0x56B3BAF0, 0x1E800A04, 0x269165A8, 0x8EE76BEC, 0xB6F60440, 0xFEC5B4B4, 0xC6D4DB18,
+        0xABC5DECD, 0x93D4B161, 0xDBE70195, 0xE3F66E39, 0x4B80607D, 0x73910FD1, 0x3BA2BF25, 0x03B3D089,
+        0xE180B48F, 0xD991DB23, 0x91A26BD7, 0xA9B3047B, 0x01C50A3F, 0x39D46593, 0x71E7D567, 0x49F6BACB,
+        0x24E7BF1E, 0x1CF6D0B2, 0x54C56046, 0x6CD40FEA, 0xC4A201AE, 0xFCB36E02, 0xB480DEF6, 0x8C91B15A,
+        0x750A600B, 0x4D1B0FA7, 0x0528BF53, 0x3D39D0FF, 0x954FDEBB, 0xAD5EB117, 0xE56D01E3, 0xDD7C6E4F,
+        0xB06D6B9A, 0x887C0436, 0xC04FB4C2, 0xF85EDB6E, 0x5028D52A, 0x6839BA86, 0x200A0A72, 0x181B65DE,
+        0xFA2801D8, 0xC2396E74, 0x8A0ADE80, 0xB21BB12C, 0x1A6DBF68, 0x227CD0C4, 0x6A4F6030, 0x525E0F9C,
+        0x3F4F0A49, 0x075E65E5, 0x4F6DD511, 0x777CBABD, 0xDF0AB4F9, 0xE71BDB55, 0xAF286BA1, 0x9739040D,
+
+        0x59F3BFF2, 0x61E2D05E, 0x29D160AA, 0x11C00F06, 0xB9B60142, 0x81A76EEE, 0xC994DE1A, 0xF185B1B6,
+        0x9C94B463, 0xA485DBCF, 0xECB66B3B, 0xD4A70497, 0x7CD10AD3, 0x44C0657F, 0x0CF3D58B, 0x34E2BA27,
+        0xD6D1DE21, 0xEEC0B18D, 0xA6F30179, 0x9EE26ED5, 0x36946091, 0x0E850F3D, 0x46B6BFC9, 0x7EA7D065,
+        0x13B6D5B0, 0x2BA7BA1C, 0x63940AE8, 0x5B856544, 0xF3F36B00, 0xCBE204AC, 0x83D1B458, 0xBBC0DBF4,
+        0x425B0AA5, 0x7A4A6509, 0x3279D5FD, 0x0A68BA51, 0xA21EB415, 0x9A0FDBB9, 0xD23C6B4D, 0xEA2D04E1,
+        0x873C0134, 0xBF2D6E98, 0xF71EDE6C, 0xCF0FB1C0, 0x6779BF84, 0x5F68D028, 0x175B60DC, 0x2F4A0F70,
+        0xCD796B76, 0xF56804DA, 0xBD5BB42E, 0x854ADB82, 0x2D3CD5C6, 0x152DBA6A, 0x5D1E0A9E, 0x650F6532,
+        0x081E60E7, 0x300F0F4B, 0x783CBFBF, 0x402DD013, 0xE85BDE57, 0xD04AB1FB, 0x9879010F, 0xA0686EA3
+    },
+    {
+        0x00000000, 0xEF306B19, 0xDB8CA0C3, 0x34BCCBDA, 0xB2F53777, 0x5DC55C6E, 0x697997B4, 0x8649FCAD,
+        0x6006181F, 0x8F367306, 0xBB8AB8DC, 0x54BAD3C5, 0xD2F32F68, 0x3DC34471, 0x097F8FAB, 0xE64FE4B2,
+        0xC00C303E, 0x2F3C5B27, 0x1B8090FD, 0xF4B0FBE4, 0x72F90749, 0x9DC96C50, 0xA975A78A, 0x4645CC93,
+        0xA00A2821, 0x4F3A4338, 0x7B8688E2, 0x94B6E3FB, 0x12FF1F56, 0xFDCF744F, 0xC973BF95, 0x2643D48C,
+        0x85F4168D, 0x6AC47D94, 0x5E78B64E, 0xB148DD57, 0x370121FA, 0xD8314AE3, 0xEC8D8139, 0x03BDEA20,
+        0xE5F20E92, 0x0AC2658B, 0x3E7EAE51, 0xD14EC548, 0x570739E5, 0xB83752FC, 0x8C8B9926, 0x63BBF23F,
+        0x45F826B3, 0xAAC84DAA, 0x9E748670, 0x7144ED69, 0xF70D11C4, 0x183D7ADD, 0x2C81B107, 0xC3B1DA1E,
+        0x25FE3EAC, 0xCACE55B5, 0xFE729E6F, 0x1142F576, 0x970B09DB, 0x783B62C2, 0x4C87A918, 0xA3B7C201,
+
+        0x0E045BEB, 0xE13430F2, 0xD588FB28, 0x3AB89031, 0xBCF16C9C, 0x53C10785, 0x677DCC5F, 0x884DA746,
+        0x6E0243F4, 0x813228ED, 0xB58EE337, 0x5ABE882E, 0xDCF77483, 0x33C71F9A, 0x077BD440, 0xE84BBF59,
+        0xCE086BD5, 0x213800CC, 0x1584CB16, 0xFAB4A00F, 0x7CFD5CA2, 0x93CD37BB, 0xA771FC61, 0x48419778,
+        0xAE0E73CA, 0x413E18D3, 0x7582D309, 0x9AB2B810, 0x1CFB44BD, 0xF3CB2FA4, 0xC777E47E, 0x28478F67,
+        0x8BF04D66, 0x64C0267F, 0x507CEDA5, 0xBF4C86BC, 0x39057A11, 0xD6351108, 0xE289DAD2, 0x0DB9B1CB,
+        0xEBF65579, 0x04C63E60, 0x307AF5BA, 0xDF4A9EA3, 0x5903620E, 0xB6330917, 0x828FC2CD, 0x6DBFA9D4,
+        0x4BFC7D58, 0xA4CC1641, 0x9070DD9B, 0x7F40B682, 0xF9094A2F, 0x16392136, 0x2285EAEC, 0xCDB581F5,
+        0x2BFA6547, 0xC4CA0E5E, 0xF076C584, 0x1F46AE9D, 0x990F5230, 0x763F3929, 0x4283F2F3, 0xADB399EA,
+
+        0x1C08B7D6, 0xF338DCCF, 0xC7841715, 0x28B47C0C, 0xAEFD80A1, 0x41CDEBB8, 0x75712062, 0x9A414B7B,
+        0x7C0EAFC9, 0x933EC4D0, 0xA7820F0A, 0x48B26413, 0xCEFB98BE, 0x21CBF3A7, 0x1577387D, 0xFA475364,
+        0xDC0487E8, 0x3334ECF1, 0x0788272B, 0xE8B84C32, 0x6EF1B09F, 0x81C1DB86, 0xB57D105C, 0x5A4D7B45,
+        0xBC029FF7, 0x5332F4EE, 0x678E3F34, 0x88BE542D, 0x0EF7A880, 0xE1C7C399, 0xD57B0843, 0x3A4B635A,
+        0x99FCA15B, 0x76CCCA42, 0x42700198, 0xAD406A81, 0x2B09962C, 0xC439FD35, 0xF08536EF, 0x1FB55DF6,
+        0xF9FAB944, 0x16CAD25D, 0x22761987, 0xCD46729E, 0x4B0F8E33, 0xA43FE52A, 0x90832EF0, 0x7FB345E9,
+        0x59F09165, 0xB6C0FA7C, 0x827C31A6, 0x6D4C5ABF, 0xEB05A612, 0x0435CD0B, 0x308906D1, 0xDFB96DC8,
+        0x39F6897A, 0xD6C6E263, 0xE27A29B9, 0x0D4A42A0, 0x8B03BE0D, 0x6433D514, 0x508F1ECE, 0xBFBF75D7,
+
+        0x120CEC3D, 0xFD3C8724, 0xC9804CFE, 0x26B027E7, 0xA0F9DB4A, 0x4FC9B053, 0x7B757B89, 0x94451090,
+        0x720AF422, 0x9D3A9F3B, 0xA98654E1, 0x46B63FF8, 0xC0FFC355, 0x2FCFA84C, 0x1B736396, 0xF443088F,
+        0xD200DC03, 0x3D30B71A, 0x098C7CC0, 0xE6BC17D9, 0x60F5EB74, 0x8FC5806D, 0xBB794BB7, 0x544920AE,
+        0xB206C41C, 0x5D36AF05, 0x698A64DF, 0x86BA0FC6, 0x00F3F36B, 0xEFC39872, 0xDB7F53A8, 0x344F38B1,
+        0x97F8FAB0, 0x78C891A9, 0x4C745A73, 0xA344316A, 0x250DCDC7, 0xCA3DA6DE, 0xFE816D04, 0x11B1061D,
+        0xF7FEE2AF, 0x18CE89B6, 0x2C72426C, 0xC3422975, 0x450BD5D8, 0xAA3BBEC1, 0x9E87751B, 0x71B71E02,
+        0x57F4CA8E, 0xB8C4A197, 0x8C786A4D, 0x63480154, 0xE501FDF9, 0x0A3196E0, 0x3E8D5D3A, 0xD1BD3623,
+        0x37F2D291, 0xD8C2B988, 0xEC7E7252, 0x034E194B, 0x8507E5E6, 0x6A378EFF, 0x5E8B4525, 0xB1BB2E3C
+    },
+    {
+        0x00000000, 0x68032CC8, 0xD0065990, 0xB8057558, 0xA5E0C5D1, 0xCDE3E919, 0x75E69C41, 0x1DE5B089,
+        0x4E2DFD53, 0x262ED19B, 0x9E2BA4C3, 0xF628880B, 0xEBCD3882, 0x83CE144A, 0x3BCB6112, 0x53C84DDA,
+        0x9C5BFAA6, 0xF458D66E, 0x4C5DA336, 0x245E8FFE, 0x39BB3F77, 0x51B813BF, 0xE9BD66E7, 0x81BE4A2F,
+        0xD27607F5, 0xBA752B3D, 0x02705E65, 0x6A7372AD, 0x7796C224, 0x1F95EEEC, 0xA7909BB4, 0xCF93B77C,
+        0x3D5B83BD, 0x5558AF75, 0xED5DDA2D, 0x855EF6E5, 0x98BB466C, 0xF0B86AA4, 0x48BD1FFC, 0x20BE3334,
+        0x73767EEE, 0x1B755226, 0xA370277E, 0xCB730BB6, 0xD696BB3F, 0xBE9597F7, 0x0690E2AF, 0x6E93CE67,
+        0xA100791B, 0xC90355D3, 0x7106208B, 0x19050C43, 0x04E0BCCA, 0x6CE39002, 0xD4E6E55A, 0xBCE5C992,
+        0xEF2D8448, 0x872EA880, 0x3F2BDDD8, 0x5728F110, 0x4ACD4199, 0x22CE6D51, 0x9ACB1809, 0xF2C834C1,
+
+        0x7AB7077A, 0x12B42BB2, 0xAAB15EEA, 0xC2B27222, 0xDF57C2AB, 0xB754EE63, 0x0F519B3B, 0x6752B7F3,
+        0x349AFA29, 0x5C99D6E1, 0xE49CA3B9, 0x8C9F8F71, 0x917A3FF8, 0xF9791330, 0x417C6668, 0x297F4AA0,
+        0xE6ECFDDC, 0x8EEFD114, 0x36EAA44C, 0x5EE98884, 0x430C380D, 0x2B0F14C5, 0x930A619D, 0xFB094D55,
+        0xA8C1008F, 0xC0C22C47, 0x78C7591F, 0x10C475D7, 0x0D21C55E, 0x6522E996, 0xDD279CCE, 0xB524B006,
+        0x47EC84C7, 0x2FEFA80F, 0x97EADD57, 0xFFE9F19F, 0xE20C4116, 0x8A0F6DDE, 0x320A1886, 0x5A09344E,
+        0x09C17994, 0x61C2555C, 0xD9C72004, 0xB1C40CCC, 0xAC21BC45, 0xC422908D, 0x7C27E5D5, 0x1424C91D,
+        0xDBB77E61, 0xB3B452A9, 0x0BB127F1, 0x63B20B39, 0x7E57BBB0, 0x16549778, 0xAE51E220, 0xC652CEE8,
+        0x959A8332, 0xFD99AFFA, 0x459CDAA2, 0x2D9FF66A, 0x307A46E3, 0x58796A2B, 0xE07C1F73, 0x887F33BB,
+
+        0xF56E0EF4, 0x9D6D223C, 0x25685764, 0x4D6B7BAC, 0x508ECB25, 0x388DE7ED, 0x808892B5, 0xE88BBE7D,
+        0xBB43F3A7, 0xD340DF6F, 0x6B45AA37, 0x034686FF, 0x1EA33676, 0x76A01ABE, 0xCEA56FE6, 0xA6A6432E,
+        0x6935F452, 0x0136D89A, 0xB933ADC2, 0xD130810A, 0xCCD53183, 0xA4D61D4B, 0x1CD36813, 0x74D044DB,
+        0x27180901, 0x4F1B25C9, 0xF71E5091, 0x9F1D7C59, 0x82F8CCD0, 0xEAFBE018, 0x52FE9540, 0x3AFDB988,
+        0xC8358D49, 0xA036A181, 0x1833D4D9, 0x7030F811, 0x6DD54898, 0x05D66450, 0xBDD31108, 0xD5D03DC0,
+        0x8618701A, 0xEE1B5CD2, 0x561E298A, 0x3E1D0542, 0x23F8B5CB, 0x4BFB9903, 0xF3FEEC5B, 0x9BFDC093,
+        0x546E77EF, 0x3C6D5B27, 0x84682E7F, 0xEC6B02B7, 0xF18EB23E, 0x998D9EF6, 0x2188EBAE, 0x498BC766,
+        0x1A438ABC, 0x7240A674, 0xCA45D32C, 0xA246FFE4, 0xBFA34F6D, 0xD7A063A5, 0x6FA516FD, 0x07A63A35,
+
+        0x8FD9098E, 0xE7DA2546, 0x5FDF501E, 0x37DC7CD6, 0x2A39CC5F, 0x423AE097, 0xFA3F95CF, 0x923CB907,
+        0xC1F4F4DD, 0xA9F7D815, 0x11F2AD4D, 0x79F18185, 0x6414310C, 0x0C171DC4, 0xB412689C, 0xDC114454,
+        0x1382F328, 0x7B81DFE0, 0xC384AAB8, 0xAB878670, 0xB66236F9, 0xDE611A31, 0x66646F69, 0x0E6743A1,
+        0x5DAF0E7B, 0x35AC22B3, 0x8DA957EB, 0xE5AA7B23, 0xF84FCBAA, 0x904CE762, 0x2849923A, 0x404ABEF2,
+        0xB2828A33, 0xDA81A6FB, 0x6284D3A3, 0x0A87FF6B, 0x17624FE2, 0x7F61632A, 0xC7641672, 0xAF673ABA,
+        0xFCAF7760, 0x94AC5BA8, 0x2CA92EF0, 0x44AA0238, 0x594FB2B1, 0x314C9E79, 0x8949EB21, 0xE14AC7E9,
+        0x2ED97095, 0x46DA5C5D, 0xFEDF2905, 0x96DC05CD, 0x8B39B544, 0xE33A998C, 0x5B3FECD4, 0x333CC01C,
+        0x60F48DC6, 0x08F7A10E, 0xB0F2D456, 0xD8F1F89E, 0xC5144817, 0xAD1764DF, 0x15121187, 0x7D113D4F
+    },
+    {
+        0x00000000, 0x493C7D27, 0x9278FA4E, 0xDB448769, 0x211D826D, 0x6821FF4A, 0xB3657823, 0xFA590504,
+        0x423B04DA, 0x0B0779FD, 0xD043FE94, 0x997F83B3, 0x632686B7, 0x2A1AFB90, 0xF15E7CF9, 0xB86201DE,
+        0x847609B4, 0xCD4A7493, 0x160EF3FA, 0x5F328EDD, 0xA56B8BD9, 0xEC57F6FE, 0x37137197, 0x7E2F0CB0,
+        0xC64D0D6E, 0x8F717049, 0x5435F720, 0x1D098A07, 0xE7508F03, 0xAE6CF224, 0x7528754D, 0x3C14086A,
+        0x0D006599, 0x443C18BE, 0x9F789FD7, 0xD644E2F0, 0x2C1DE7F4, 0x65219AD3, 0xBE651DBA, 0xF759609D,
+        0x4F3B6143, 0x06071C64, 0xDD439B0D, 0x947FE62A, 0x6E26E32E, 0x271A9E09, 0xFC5E1960, 0xB5626447,
+        0x89766C2D, 0xC04A110A, 0x1B0E9663, 0x5232EB44, 0xA86BEE40, 0xE1579367, 0x3A13140E, 0x732F6929,
+        0xCB4D68F7, 0x827115D0, 0x593592B9, 0x1009EF9E, 0xEA50EA9A, 0xA36C97BD, 0x782810D4, 0x31146DF3,
+
+        0x1A00CB32, 0x533CB615, 0x8878317C, 0xC1444C5B, 0x3B1D495F, 0x72213478, 0xA965B311, 0xE059CE36,
+        0x583BCFE8, 0x1107B2CF, 0xCA4335A6, 0x837F4881, 0x79264D85, 0x301A30A2, 0xEB5EB7CB, 0xA262CAEC,
+        0x9E76C286, 0xD74ABFA1, 0x0C0E38C8, 0x453245EF, 0xBF6B40EB, 0xF6573DCC, 0x2D13BAA5, 0x642FC782,
+        0xDC4DC65C, 0x9571BB7B, 0x4E353C12, 0x07094135, 0xFD504431, 0xB46C3916, 0x6F28BE7F, 0x2614C358,
+        0x1700AEAB, 0x5E3CD38C, 0x857854E5, 0xCC4429C2, 0x361D2CC6, 0x7F2151E1, 0xA465D688, 0xED59ABAF,
+        0x553BAA71, 0x1C07D756, 0xC743503F, 0x8E7F2D18, 0x7426281C, 0x3D1A553B, 0xE65ED252, 0xAF62AF75,
+        0x9376A71F, 0xDA4ADA38, 0x010E5D51, 0x48322076, 0xB26B2572, 0xFB575855, 0x2013DF3C, 0x692FA21B,
+        0xD14DA3C5, 0x9871DEE2, 0x4335598B, 0x0A0924AC, 0xF05021A8, 0xB96C5C8F, 0x6228DBE6, 0x2B14A6C1,
+
+        0x34019664, 0x7D3DEB43, 0xA6796C2A, 0xEF45110D, 0x151C1409, 0x5C20692E, 0x8764EE47, 0xCE589360,
+        0x763A92BE, 0x3F06EF99, 0xE44268F0, 0xAD7E15D7, 0x572710D3, 0x1E1B6DF4, 0xC55FEA9D, 0x8C6397BA,
+        0xB0779FD0, 0xF94BE2F7, 0x220F659E, 0x6B3318B9, 0x916A1DBD, 0xD856609A, 0x0312E7F3, 0x4A2E9AD4,
+        0xF24C9B0A, 0xBB70E62D, 0x60346144, 0x29081C63, 0xD3511967, 0x9A6D6440, 0x4129E329, 0x08159E0E,
+        0x3901F3FD, 0x703D8EDA, 0xAB7909B3, 0xE2457494, 0x181C7190, 0x51200CB7, 0x8A648BDE, 0xC358F6F9,
+        0x7B3AF727, 0x32068A00, 0xE9420D69, 0xA07E704E, 0x5A27754A, 0x131B086D, 0xC85F8F04, 0x8163F223,
+        0xBD77FA49, 0xF44B876E, 0x2F0F0007, 0x66337D20, 0x9C6A7824, 0xD5560503, 0x0E12826A, 0x472EFF4D,
+        0xFF4CFE93, 0xB67083B4, 0x6D3404DD, 0x240879FA, 0xDE517CFE, 0x976D01D9, 0x4C2986B0, 0x0515FB97,
+
+        0x2E015D56, 0x673D2071, 0xBC79A718, 0xF545DA3F, 0x0F1CDF3B, 0x4620A21C, 0x9D642575, 0xD4585852,
+        0x6C3A598C, 0x250624AB, 0xFE42A3C2, 0xB77EDEE5, 0x4D27DBE1, 0x041BA6C6, 0xDF5F21AF, 0x96635C88,
+        0xAA7754E2, 0xE34B29C5, 0x380FAEAC, 0x7133D38B, 0x8B6AD68F, 0xC256ABA8, 0x19122CC1, 0x502E51E6,
+        0xE84C5038, 0xA1702D1F, 0x7A34AA76, 0x3308D751, 0xC951D255, 0x806DAF72, 0x5B29281B, 0x1215553C,
+        0x230138CF, 0x6A3D45E8, 0xB179C281, 0xF845BFA6, 0x021CBAA2, 0x4B20C785, 0x906440EC, 0xD9583DCB,
+        0x613A3C15, 0x28064132, 0xF342C65B, 0xBA7EBB7C, 0x4027BE78, 0x091BC35F, 0xD25F4436, 0x9B633911,
+        0xA777317B, 0xEE4B4C5C, 0x350FCB35, 0x7C33B612, 0x866AB316, 0xCF56CE31, 0x14124958, 0x5D2E347F,
+        0xE54C35A1, 0xAC704886, 0x7734CFEF, 0x3E08B2C8, 0xC451B7CC, 0x8D6DCAEB, 0x56294D82, 0x1F1530A5
+    }
+};
+
+// CRC-32 folding constants for carry-less multiplication:
+// x^575, x^511, x^191, and x^127 modulo the polynomial, in 64-bits reflected form.
+static const uint64_t hash_crc32_fold_consts[4] =
+{
+    0x013BCEDF00000000, 0x0651E48E00000000, 0x016340E800000000, 0x067DE22400000000
+};
+
+#endif
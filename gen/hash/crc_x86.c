@@ -0,0 +1,113 @@
+#include <assert.h>
+#include <string.h>
+#include "crc_x86.h"
+
+#ifdef CRC_X86_AVAILABLE
+
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("pclmul,sse2")
+static inline
+__m128i fold_128(__m128i value, __m128i consts)
+{
+    /*
+     * The lower half of the value is the higher polynomial degree part in reflected bits order,
+     * and be multiplied with the lower half of the constants; and vice versa.
+     */
+    __m128i hi = _mm_clmulepi64_si128(value, consts, 0x00);
+    __m128i lo = _mm_clmulepi64_si128(value, consts, 0x11);
+    return _mm_xor_si128(hi, lo);
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("pclmul,sse2")
+size_t crc_x86_fold(const uint64_t  consts[4],
+                    uint32_t        crc,
+                    const uint8_t  *src,
+                    size_t          size,
+                    uint8_t         rest[16])
+{
+    /*
+     * Fold the data by carry-less multiplication for a reflected 32-bits CRC.
+     *
+     * @param consts The folding constants, that are:
+     *               x^575, x^511, x^191, and x^127 modulo the polynomial,
+     *               and in 64-bits reflected form.
+     * @param crc    The current CRC register value.
+     * @param src    Data to calculate.
+     * @param size   Size of input data, and must not be less than ::CRC_X86_FOLD_MINSIZE.
+     * @param rest   A buffer to receive the folded 16 bytes data, and
+     *               the CRC of the input data is equal to the CRC of that
+     *               with a ZERO register initial value.
+     * @return Size of data that have been processed.
+     */
+    assert( size >= CRC_X86_FOLD_MINSIZE );
+
+    const __m128i k4 = _mm_set_epi64x(consts[1], consts[0]);  // For folding 4 blocks.
+    const __m128i k1 = _mm_set_epi64x(consts[3], consts[2]);  // For folding 1 block.
+    const uint8_t *pos = src;
+
+    __m128i x0 = _mm_loadu_si128((const __m128i*)( pos +  0 ));
+    __m128i x1 = _mm_loadu_si128((const __m128i*)( pos + 16 ));
+    __m128i x2 = _mm_loadu_si128((const __m128i*)( pos + 32 ));
+    __m128i x3 = _mm_loadu_si128((const __m128i*)( pos + 48 ));
+    x0 = _mm_xor_si128(x0, _mm_cvtsi32_si128(crc));
+    pos  += 64;
+    size -= 64;
+
+    for(; size >= 64; pos += 64, size -= 64)
+    {
+        x0 = _mm_xor_si128(fold_128(x0, k4), _mm_loadu_si128((const __m128i*)( pos +  0 )));
+        x1 = _mm_xor_si128(fold_128(x1, k4), _mm_loadu_si128((const __m128i*)( pos + 16 )));
+        x2 = _mm_xor_si128(fold_128(x2, k4), _mm_loadu_si128((const __m128i*)( pos + 32 )));
+        x3 = _mm_xor_si128(fold_128(x3, k4), _mm_loadu_si128((const __m128i*)( pos + 48 )));
+    }
+
+    x0 = _mm_xor_si128(fold_128(x0, k1), x1);
+    x0 = _mm_xor_si128(fold_128(x0, k1), x2);
+    x0 = _mm_xor_si128(fold_128(x0, k1), x3);
+
+    for(; size >= 16; pos += 16, size -= 16)
+        x0 = _mm_xor_si128(fold_128(x0, k1), _mm_loadu_si128((const __m128i*) pos));
+
+    _mm_storeu_si128((__m128i*) rest, x0);
+    return pos - src;
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("sse4.2")
+uint32_t crc_x86_crc32c(uint32_t crc, const uint8_t *src, size_t size)
+{
+    /*
+     * Calculate CRC-32C by the SSE4.2 CRC32 instruction.
+     *
+     * @param crc  The current CRC register value.
+     * @param src  Data to calculate.
+     * @param size Size of input data.
+     * @return The new CRC register value.
+     */
+#if defined(__x86_64__) || defined(_M_X64)
+    uint64_t res = crc;
+    for(; size >= 8; src += 8, size -= 8)
+    {
+        uint64_t value;
+        memcpy(&value, src, sizeof(value));
+        res = _mm_crc32_u64(res, value);
+    }
+    crc = res;
+#endif
+
+    for(; size >= 4; src += 4, size -= 4)
+    {
+        uint32_t value;
+        memcpy(&value, src, sizeof(value));
+        crc = _mm_crc32_u32(crc, value);
+    }
+
+    for(; size; ++src, --size)
+        crc = _mm_crc32_u8(crc, *src);
+
+    return crc;
+}
+//------------------------------------------------------------------------------
+
+#endif  // CRC_X86_AVAILABLE
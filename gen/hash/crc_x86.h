@@ -0,0 +1,49 @@
+/*
+ * PRIVATE USAGE
+ */
+/**
+ * @brief     CRC x86 acceleration.
+ * @details   CRC calculation accelerated by the carry-less multiplication and SSE4.2 instructions.
+ * @author    王文佑
+ * @date      2026.10.17
+ * @copyright ZLib Licence
+ * @see       http://www.openfoundry.org/of/projects/2419
+ */
+#ifndef _GEN_CRC_X86_H_
+#define _GEN_CRC_X86_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../cpufeat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CPUFEAT_X86
+
+/// Defined if the x86 CRC functions are available.
+#define CRC_X86_AVAILABLE
+
+/// Features needed by ::crc_x86_fold.
+#define CRC_X86_FOLD_FEATURES ( CPUFEAT_PCLMUL | CPUFEAT_SSE2 )
+/// Minimum data size could be processed by ::crc_x86_fold.
+#define CRC_X86_FOLD_MINSIZE 64
+
+/// Features needed by ::crc_x86_crc32c.
+#define CRC_X86_CRC32C_FEATURES CPUFEAT_SSE42
+
+size_t   crc_x86_fold  (const uint64_t  consts[4],
+                        uint32_t        crc,
+                        const uint8_t  *src,
+                        size_t          size,
+                        uint8_t         rest[16]);
+uint32_t crc_x86_crc32c(uint32_t crc, const uint8_t *src, size_t size);
+
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -7,8 +7,80 @@
 #include "../endian.h"
 #include "../inline.h"
 #include "bitrot.h"
+#include "crc_table.h"
+#include "crc_x86.h"
 #include "hash.h"
 
+//------------------------------------------------------------------------------
+//---- CRC Slicing -------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+uint32_t load_le_32(const byte_t *src)
+{
+    return ( (uint32_t) src[0]       ) |
+           ( (uint32_t) src[1] <<  8 ) |
+           ( (uint32_t) src[2] << 16 ) |
+           ( (uint32_t) src[3] << 24 );
+}
+//------------------------------------------------------------------------------
+static
+uint16_t crc16_slice8(const uint16_t  table[256],
+                      const uint16_t  slice_table[7][256],
+                      uint16_t        res,
+                      const byte_t   *buf,
+                      size_t          size)
+{
+    // Process 8 bytes per round by the slicing tables, and then the rest bytes one by one.
+    for(; size >= 8; buf += 8, size -= 8)
+    {
+        uint32_t lo = load_le_32(buf) ^ res;
+        uint32_t hi = load_le_32(buf + 4);
+
+        res = slice_table[6][   lo         & 0xFF ] ^
+              slice_table[5][ ( lo >>  8 ) & 0xFF ] ^
+              slice_table[4][ ( lo >> 16 ) & 0xFF ] ^
+              slice_table[3][   lo >> 24          ] ^
+              slice_table[2][   hi         & 0xFF ] ^
+              slice_table[1][ ( hi >>  8 ) & 0xFF ] ^
+              slice_table[0][ ( hi >> 16 ) & 0xFF ] ^
+              table         [   hi >> 24          ];
+    }
+
+    while( size-- )
+        res = table[ ( res & 0xFF ) ^ *buf++ ] ^ ( res >> 8 );
+
+    return res;
+}
+//------------------------------------------------------------------------------
+static
+uint32_t crc32_slice8(const uint32_t  table[256],
+                      const uint32_t  slice_table[7][256],
+                      uint32_t        res,
+                      const byte_t   *buf,
+                      size_t          size)
+{
+    // Process 8 bytes per round by the slicing tables, and then the rest bytes one by one.
+    for(; size >= 8; buf += 8, size -= 8)
+    {
+        uint32_t lo = load_le_32(buf) ^ res;
+        uint32_t hi = load_le_32(buf + 4);
+
+        res = slice_table[6][   lo         & 0xFF ] ^
+              slice_table[5][ ( lo >>  8 ) & 0xFF ] ^
+              slice_table[4][ ( lo >> 16 ) & 0xFF ] ^
+              slice_table[3][   lo >> 24          ] ^
+              slice_table[2][   hi         & 0xFF ] ^
+              slice_table[1][ ( hi >>  8 ) & 0xFF ] ^
+              slice_table[0][ ( hi >> 16 ) & 0xFF ] ^
+              table         [   hi >> 24          ];
+    }
+
+    while( size-- )
+        res = table[ ( res & 0xFF ) ^ *buf++ ] ^ ( res >> 8 );
+
+    return res;
+}
+
 //------------------------------------------------------------------------------
 //---- Pearson Hash ------------------------------------------------------------
 //------------------------------------------------------------------------------
@@ -149,13 +221,7 @@ uint16_t hash_crc16_ccitt(const void* RESTRICT src, size_t size)
      *
      * @see http://www.scadacore.com/field-applications/miscellaneous/online-checksum-calculator.html
      */
-    const byte_t *buf = src;
-    uint16_t      res = 0;
-
-    while( size-- )
-        res = hash_crc16_ccitt_table[ ( res & 0xFF ) ^ *buf++ ] ^ ( res >> 8 );
-
-    return res;
+    return crc16_slice8(hash_crc16_ccitt_table, hash_crc16_ccitt_slice_table, 0, src, size);
 }
 //------------------------------------------------------------------------------
 //---- CRC-16-IBM --------------------------------------------------------------
@@ -236,13 +302,7 @@ uint16_t hash_crc16_ibm(const void* RESTRICT src, size_t size)
      *
      * @see http://www.scadacore.com/field-applications/miscellaneous/online-checksum-calculator.html
      */
-    const byte_t *buf = src;
-    uint16_t      res = 0;
-
-    while( size-- )
-        res = hash_crc16_ibm_table[ ( res & 0xFF ) ^ *buf++ ] ^ ( res >> 8 );
-
-    return res;
+    return crc16_slice8(hash_crc16_ibm_table, hash_crc16_ibm_slice_table, 0, src, size);
 }
 //------------------------------------------------------------------------------
 //---- CRC-32 ------------------------------------------------------------------
@@ -325,8 +385,45 @@ uint32_t hash_crc32(const void* RESTRICT src, size_t size)
     const byte_t *buf = src;
     uint32_t      res = ~0;
 
-    while( size-- )
-        res = hash_crc32_table[ ( res & 0xFF ) ^ *buf++ ] ^ ( res >> 8 );
+#ifdef CRC_X86_AVAILABLE
+    if( size >= CRC_X86_FOLD_MINSIZE && cpufeat_has(CRC_X86_FOLD_FEATURES) )
+    {
+        byte_t rest[16];
+        size_t fillsize = crc_x86_fold(hash_crc32_fold_consts, res, buf, size, rest);
+
+        res   = crc32_slice8(hash_crc32_table, hash_crc32_slice_table, 0, rest, sizeof(rest));
+        buf  += fillsize;
+        size -= fillsize;
+    }
+#endif
+
+    res = crc32_slice8(hash_crc32_table, hash_crc32_slice_table, res, buf, size);
+    res ^= ~0;
+
+    return res;
+}
+//------------------------------------------------------------------------------
+//---- CRC-32C -----------------------------------------------------------------
+//------------------------------------------------------------------------------
+uint32_t hash_crc32c(const void* RESTRICT src, size_t size)
+{
+    /**
+     * CRC-32C (Castagnoli) hashing function.
+     *
+     * @param src  Data to calculate.
+     * @param size Size of input data.
+     * @return The hash number calculated.
+     *
+     * @remarks The SSE4.2 CRC32 instruction will be used if it is available.
+     */
+    uint32_t res = ~0;
+
+#ifdef CRC_X86_AVAILABLE
+    if( cpufeat_has(CRC_X86_CRC32C_FEATURES) )
+        res = crc_x86_crc32c(res, src, size);
+    else
+#endif
+        res = crc32_slice8(hash_crc32c_slice_table[0], hash_crc32c_slice_table + 1, res, src, size);
     res ^= ~0;
 
     return res;
@@ -21,6 +21,7 @@ uint8_t  hash_pearson    (const void* RESTRICT src, size_t size);
 uint16_t hash_crc16_ccitt(const void* RESTRICT src, size_t size);
 uint16_t hash_crc16_ibm  (const void* RESTRICT src, size_t size);
 uint32_t hash_crc32      (const void* RESTRICT src, size_t size);
+uint32_t hash_crc32c     (const void* RESTRICT src, size_t size);
 uint32_t hash_jenkins    (const void* RESTRICT src, size_t size);
 uint32_t hash_fnv32      (const void* RESTRICT src, size_t size);
 uint32_t hash_murmur3_32 (const void* RESTRICT src, size_t size, uint32_t seed);
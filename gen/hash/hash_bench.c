@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "../cpufeat.h"
+#include "../systime.h"
+#include "batch.h"
+#include "hash.h"
+#include "md5.h"
+#include "sha.h"
+#include "tree.h"
+
+#define BENCH_DATA_SIZE ( 1024 * 1024 )
+#define BENCH_DURATION  500 // Milliseconds.
+#define BENCH_TREE_SIZE ( 64 * 1024 * 1024 )
+
+typedef void(*bench_func_t)(void *dest, const void *src, size_t size);
+
+//------------------------------------------------------------------------------
+void bench_crc16_ccitt(void *dest, const void *src, size_t size)
+{
+    *(uint16_t*) dest = hash_crc16_ccitt(src, size);
+}
+//------------------------------------------------------------------------------
+void bench_crc32(void *dest, const void *src, size_t size)
+{
+    *(uint32_t*) dest = hash_crc32(src, size);
+}
+//------------------------------------------------------------------------------
+void bench_crc32c(void *dest, const void *src, size_t size)
+{
+    *(uint32_t*) dest = hash_crc32c(src, size);
+}
+//------------------------------------------------------------------------------
+double bench_throughput(bench_func_t func, const void *data, size_t size)
+{
+    // Run the function repeatedly in a period of time, and return the throughput in MB/s.
+    byte_t   res[64];
+    unsigned rounds = 0;
+
+    func(res, data, size);  // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(res, data, size);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    return (double) size * rounds / ( 1024 * 1024 ) / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_print(const char *name, bench_func_t func, const void *data, size_t size)
+{
+    cpufeat_set_mask(0);
+    double speed_base = bench_throughput(func, data, size);
+
+    cpufeat_set_mask(CPUFEAT_ALL);
+    double speed_fast = bench_throughput(func, data, size);
+
+    printf("%-12s portable: %8.1f MB/s, accelerated: %8.1f MB/s (x%.2f)\n",
+           name,
+           speed_base,
+           speed_fast,
+           speed_fast / speed_base);
+}
+//------------------------------------------------------------------------------
+double bench_batch_throughput(void(*func)(void*, const hash_msg_t*, size_t),
+                              byte_t           *dests,
+                              const hash_msg_t *msgs,
+                              size_t            count,
+                              size_t            size)
+{
+    // Run the batch function repeatedly in a period of time, and return the throughput in MB/s.
+    unsigned rounds = 0;
+
+    func(dests, msgs, count);   // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(dests, msgs, count);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    return (double) size * rounds / ( 1024 * 1024 ) / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_md5_loop(void *dests, const hash_msg_t *msgs, size_t count)
+{
+    for(size_t i=0; i<count; ++i)
+        md5((byte_t*) dests + 16*i, msgs[i].data, msgs[i].size);
+}
+//------------------------------------------------------------------------------
+void bench_sha_256_loop(void *dests, const hash_msg_t *msgs, size_t count)
+{
+    for(size_t i=0; i<count; ++i)
+        sha_256((byte_t*) dests + 32*i, msgs[i].data, msgs[i].size);
+}
+//------------------------------------------------------------------------------
+void bench_batch_print(const char *name,
+                       void(*func_loop)(void*, const hash_msg_t*, size_t),
+                       void(*func_batch)(void*, const hash_msg_t*, size_t),
+                       const byte_t *data,
+                       size_t        msgsize)
+{
+    size_t      count = BENCH_DATA_SIZE / msgsize;
+    hash_msg_t *msgs  = malloc(count * sizeof(hash_msg_t));
+    byte_t     *dests = malloc(count * 64);
+    if( !msgs || !dests ) goto END;
+
+    for(size_t i=0; i<count; ++i)
+    {
+        msgs[i].data = data + i * msgsize;
+        msgs[i].size = msgsize;
+    }
+
+    double speed_loop  = bench_batch_throughput(func_loop , dests, msgs, count, count * msgsize);
+    double speed_batch = bench_batch_throughput(func_batch, dests, msgs, count, count * msgsize);
+
+    printf("%-12s %4u bytes x %5u, loop: %8.1f MB/s, batch: %8.1f MB/s (x%.2f)\n",
+           name,
+           (unsigned) msgsize,
+           (unsigned) count,
+           speed_loop,
+           speed_batch,
+           speed_batch / speed_loop);
+
+END:
+    free(dests);
+    free(msgs);
+}
+//------------------------------------------------------------------------------
+double bench_tree_throughput(const byte_t *data, size_t size, unsigned threads)
+{
+    // Run the tree hash repeatedly in a period of time, and return the throughput in MB/s.
+    byte_t   res[32];
+    unsigned rounds = 0;
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        if( threads )
+            sha_256_tree(res, data, size, HASH_TREE_LEAFSIZE_DEFAULT, threads);
+        else
+            sha_256(res, data, size);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    return (double) size * rounds / ( 1024 * 1024 ) / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_tree_print(void)
+{
+    byte_t *data = calloc(1, BENCH_TREE_SIZE);
+    if( !data ) return;
+
+    double speed_plain = bench_tree_throughput(data, BENCH_TREE_SIZE, 0);
+    printf("%-12s plain: %8.1f MB/s\n", "SHA-256", speed_plain);
+
+    unsigned cpus = cpufeat_get_cpu_count();
+    for(unsigned threads = 1; threads <= 2 * cpus; threads *= 2)
+    {
+        double speed_tree = bench_tree_throughput(data, BENCH_TREE_SIZE, threads);
+        printf("%-12s tree, %2u threads: %8.1f MB/s (x%.2f)\n",
+               "SHA-256",
+               threads,
+               speed_tree,
+               speed_tree / speed_plain);
+    }
+
+    free(data);
+}
+//------------------------------------------------------------------------------
+int main(void)
+{
+    byte_t *data = malloc(BENCH_DATA_SIZE);
+    if( !data ) return 1;
+
+    for(size_t i=0; i<BENCH_DATA_SIZE; ++i)
+        data[i] = rand();
+
+    printf("CPU features : 0x%X\n", cpufeat_get_flags());
+    printf("Data size    : %u bytes\n", BENCH_DATA_SIZE);
+
+    bench_print("CRC-16-CCITT", bench_crc16_ccitt, data, BENCH_DATA_SIZE);
+    bench_print("CRC-32"      , bench_crc32      , data, BENCH_DATA_SIZE);
+    bench_print("CRC-32C"     , bench_crc32c     , data, BENCH_DATA_SIZE);
+    bench_print("MD5"         , md5              , data, BENCH_DATA_SIZE);
+    bench_print("SHA-1"       , sha_1            , data, BENCH_DATA_SIZE);
+    bench_print("SHA-256"     , sha_256          , data, BENCH_DATA_SIZE);
+    bench_print("SHA-512"     , sha_512          , data, BENCH_DATA_SIZE);
+
+    bench_batch_print("MD5"    , bench_md5_loop    , md5_batch    , data, 1024);
+    bench_batch_print("MD5"    , bench_md5_loop    , md5_batch    , data, 4096);
+    bench_batch_print("SHA-256", bench_sha_256_loop, sha_256_batch, data, 1024);
+    bench_batch_print("SHA-256", bench_sha_256_loop, sha_256_batch, data, 4096);
+
+    // The SHA-256 lanes will be used only if the SHA extensions are not available.
+    cpufeat_set_mask(~CPUFEAT_SHA);
+    bench_batch_print("SHA-256/lane", bench_sha_256_loop, sha_256_batch, data, 1024);
+    bench_batch_print("SHA-256/lane", bench_sha_256_loop, sha_256_batch, data, 4096);
+    cpufeat_set_mask(CPUFEAT_ALL);
+
+    bench_tree_print();
+
+    free(data);
+    return 0;
+}
+//------------------------------------------------------------------------------
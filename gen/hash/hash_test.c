@@ -6,9 +6,12 @@
 #pragma hdrstop
 #endif
 
+#include "../cpufeat.h"
+#include "batch.h"
 #include "hash.h"
 #include "md5.h"
 #include "sha.h"
+#include "tree.h"
 
 #ifdef NDEBUG
     #error This test program must work with macro "ASSERT" enabled!
@@ -88,6 +91,17 @@ bool hash_crc32_test(const char *str, const char *target)
     return check_result("CRC-32", str, strbuf, target);
 }
 //------------------------------------------------------------------------------
+bool hash_crc32c_test(const char *str, const char *target)
+{
+    uint32_t res;
+    char     strbuf[1024];
+
+    res = hash_crc32c(str, strlen(str));
+
+    sprintf(strbuf, "%8.8X", res);
+    return check_result("CRC-32C", str, strbuf, target);
+}
+//------------------------------------------------------------------------------
 bool hash_jenkins_test(const char *str, const char *target)
 {
     uint32_t res;
@@ -209,6 +223,344 @@ bool sha_512_test(const char *str, const char *target)
     return check_result("SHA-512", str, strbuf, target);
 }
 //------------------------------------------------------------------------------
+bool hash_stream_test(void)
+{
+    byte_t data[1000];
+    for(size_t i=0; i<sizeof(data); ++i)
+        data[i] = i * 7 + 3;
+
+    // Feed data in irregular pieces and compare with the one-shot result.
+    static const size_t piece_sizes[] = { 1, 3, 63, 64, 65, 127, 128, 129, 0, 17 };
+    static const size_t piece_count   = sizeof(piece_sizes)/sizeof(piece_sizes[0]);
+
+    byte_t res_oneshot[64], res_stream[64];
+    bool   succeed = true;
+
+    md5_t     ctx_md5;
+    sha_1_t   ctx_sha1;
+    sha_256_t ctx_sha256;
+    sha_512_t ctx_sha512;
+
+    md5_init(&ctx_md5);
+    sha_1_init(&ctx_sha1);
+    sha_256_init(&ctx_sha256);
+    sha_512_init(&ctx_sha512);
+
+    size_t offset = 0;
+    for(size_t i=0; offset < sizeof(data); i=(i+1)%piece_count)
+    {
+        size_t size = piece_sizes[i];
+        if( size > sizeof(data) - offset )
+            size = sizeof(data) - offset;
+
+        md5_update(&ctx_md5, data + offset, size);
+        sha_1_update(&ctx_sha1, data + offset, size);
+        sha_256_update(&ctx_sha256, data + offset, size);
+        sha_512_update(&ctx_sha512, data + offset, size);
+
+        offset += size;
+    }
+
+    md5(res_oneshot, data, sizeof(data));
+    md5_final(&ctx_md5, res_stream);
+    succeed = succeed && !memcmp(res_oneshot, res_stream, 16);
+
+    sha_1(res_oneshot, data, sizeof(data));
+    sha_1_final(&ctx_sha1, res_stream);
+    succeed = succeed && !memcmp(res_oneshot, res_stream, 20);
+
+    sha_256(res_oneshot, data, sizeof(data));
+    sha_256_final(&ctx_sha256, res_stream);
+    succeed = succeed && !memcmp(res_oneshot, res_stream, 32);
+
+    sha_512(res_oneshot, data, sizeof(data));
+    sha_512_final(&ctx_sha512, res_stream);
+    succeed = succeed && !memcmp(res_oneshot, res_stream, 64);
+
+    sha_256_t ctx_sha224;
+    sha_224_init(&ctx_sha224);
+    sha_224_update(&ctx_sha224, data, 100);
+    sha_224_update(&ctx_sha224, data + 100, sizeof(data) - 100);
+    sha_224(res_oneshot, data, sizeof(data));
+    sha_224_final(&ctx_sha224, res_stream);
+    succeed = succeed && !memcmp(res_oneshot, res_stream, 28);
+
+    byte_t    res384_oneshot[48], res384_stream[48];
+    sha_512_t ctx_sha384;
+    sha_384_init(&ctx_sha384);
+    sha_384_update(&ctx_sha384, data, 500);
+    sha_384_update(&ctx_sha384, data + 500, sizeof(data) - 500);
+    sha_384(res384_oneshot, data, sizeof(data));
+    sha_384_final(&ctx_sha384, res384_stream);
+    succeed = succeed && !memcmp(res384_oneshot, res384_stream, sizeof(res384_stream));
+
+    printf("%s : Streaming hash\n", (succeed?"OK":"Failed"));
+    return succeed;
+}
+//------------------------------------------------------------------------------
+bool hash_padding_test(void)
+{
+    // Messages that fill the last chunk exactly with the length field.
+    byte_t data[256];
+    for(size_t i=0; i<sizeof(data); ++i)
+        data[i] = i * 7 + 3;
+
+    byte_t res_md5[16], res_sha1[20], res_sha256[32], res_sha384[48], res_sha512[64];
+    char   strbuf[256];
+    bool   succeed = true;
+
+    md5(res_md5, data, 55);
+    bin_to_str(strbuf, sizeof(strbuf), res_md5, sizeof(res_md5));
+    succeed = succeed && check_result("MD5", "55 bytes", strbuf,
+                                      "52C0E574E1198DE5FE3F8F11440DCB1B");
+
+    md5(res_md5, data, 119);
+    bin_to_str(strbuf, sizeof(strbuf), res_md5, sizeof(res_md5));
+    succeed = succeed && check_result("MD5", "119 bytes", strbuf,
+                                      "E84905D4214F4D1CA56C2CDCC152B143");
+
+    sha_1(res_sha1, data, 55);
+    bin_to_str(strbuf, sizeof(strbuf), res_sha1, sizeof(res_sha1));
+    succeed = succeed && check_result("SHA-1", "55 bytes", strbuf,
+                                      "DDF57317EF34BFEE3B6DF83D359098930EB278BC");
+
+    sha_1(res_sha1, data, 119);
+    bin_to_str(strbuf, sizeof(strbuf), res_sha1, sizeof(res_sha1));
+    succeed = succeed && check_result("SHA-1", "119 bytes", strbuf,
+                                      "504E27376A6E0F0DBA8295B85CB25DC4DFA17D23");
+
+    sha_256(res_sha256, data, 55);
+    bin_to_str(strbuf, sizeof(strbuf), res_sha256, sizeof(res_sha256));
+    succeed = succeed && check_result("SHA-256", "55 bytes", strbuf,
+                                      "E7313D333C272E639F790978283F9EB392E843D0F29B7016828BB1DAA4AAC70B");
+
+    sha_256(res_sha256, data, 119);
+    bin_to_str(strbuf, sizeof(strbuf), res_sha256, sizeof(res_sha256));
+    succeed = succeed && check_result("SHA-256", "119 bytes", strbuf,
+                                      "9CE7368E4DAF32341631B492E80359DC9F594B48453CD0DD5BF0B19279CC177E");
+
+    sha_384(res_sha384, data, 111);
+    bin_to_str(strbuf, sizeof(strbuf), res_sha384, sizeof(res_sha384));
+    succeed = succeed && check_result("SHA-384", "111 bytes", strbuf,
+                                      "341388A9DC2275074E90CF394323761919761C805FD9E370977C9966A0E8C81A52135F02577670B0071638A4A26DBC31");
+
+    sha_384(res_sha384, data, 239);
+    bin_to_str(strbuf, sizeof(strbuf), res_sha384, sizeof(res_sha384));
+    succeed = succeed && check_result("SHA-384", "239 bytes", strbuf,
+                                      "FC75DED15C6080FF96AC03391FC1302CA180128E4B6A4A2F17782F2EC016FC3F79B48B5FED3305FB7FDFF9FD29434525");
+
+    sha_512(res_sha512, data, 111);
+    bin_to_str(strbuf, sizeof(strbuf), res_sha512, sizeof(res_sha512));
+    succeed = succeed && check_result("SHA-512", "111 bytes", strbuf,
+                                      "68CFFA6D0D76F309C9CE0D35280939F8E25990C43B7B086CCDF709BE35B07D4DDBA599541FF2B1C19D34EA49AEAFB9659ADB7AC3C0B078BB30A22D57FC6687EF");
+
+    sha_512(res_sha512, data, 239);
+    bin_to_str(strbuf, sizeof(strbuf), res_sha512, sizeof(res_sha512));
+    succeed = succeed && check_result("SHA-512", "239 bytes", strbuf,
+                                      "18EE83F30261C3C645D52AEE6A209105B25BBA39D33845EF48984CC238E4F21661FB7BD7DD4336F71C40FE87D95E5115D6C7BE52E0D3E7E7877D24500B5B58DF");
+
+    return succeed;
+}
+//------------------------------------------------------------------------------
+bool hash_accel_test(void)
+{
+    byte_t data[4096+77];
+    for(size_t i=0; i<sizeof(data); ++i)
+        data[i] = ( i * 131 ) ^ ( i >> 5 );
+
+    // Results of the accelerated implementations must be identical to the portable ones.
+    static const size_t sizes[] = { 0, 1, 15, 16, 55, 56, 63, 64, 65, 79, 80, 119, 120, 127, 128, 1000, sizeof(data) };
+    static const size_t count   = sizeof(sizes)/sizeof(sizes[0]);
+
+    bool succeed = true;
+    for(size_t i=0; i<count; ++i)
+    {
+        byte_t res_fast[2][32], res_base[2][32];
+
+        uint32_t crc_fast[2], crc_base[2];
+
+        cpufeat_set_mask(CPUFEAT_ALL);
+        sha_1  (res_fast[0], data, sizes[i]);
+        sha_256(res_fast[1], data, sizes[i]);
+        crc_fast[0] = hash_crc32 (data, sizes[i]);
+        crc_fast[1] = hash_crc32c(data, sizes[i]);
+
+        cpufeat_set_mask(0);
+        sha_1  (res_base[0], data, sizes[i]);
+        sha_256(res_base[1], data, sizes[i]);
+        crc_base[0] = hash_crc32 (data, sizes[i]);
+        crc_base[1] = hash_crc32c(data, sizes[i]);
+
+        succeed = succeed && !memcmp(res_fast[0], res_base[0], 20);
+        succeed = succeed && !memcmp(res_fast[1], res_base[1], 32);
+        succeed = succeed && crc_fast[0] == crc_base[0];
+        succeed = succeed && crc_fast[1] == crc_base[1];
+    }
+
+    cpufeat_set_mask(CPUFEAT_ALL);
+
+    printf("%s : Accelerated hash (features=0x%X)\n", (succeed?"OK":"Failed"), cpufeat_get_flags());
+    return succeed;
+}
+//------------------------------------------------------------------------------
+bool hash_batch_test(void)
+{
+    static byte_t data[8192];
+    for(size_t i=0; i<sizeof(data); ++i)
+        data[i] = ( i * 29 ) ^ ( i >> 7 );
+
+    // Messages with different sizes, to make lanes be refilled at different time.
+    enum { count = 37 };
+    hash_msg_t msgs[count];
+    for(size_t i=0; i<count; ++i)
+    {
+        msgs[i].data = data + i * 13;
+        msgs[i].size = ( i * 977 ) % 3000;
+    }
+    msgs[5].data = NULL;
+    msgs[5].size = 0;
+
+    // Sizes that leave no room for zeros in the padding.
+    msgs[7].size  = 55;
+    msgs[8].size  = 119;
+    msgs[9].size  = 111;
+    msgs[10].size = 10 * 128 + 111;
+    msgs[11].size = 20 * 64 + 55;
+    msgs[12].size = 64;
+
+    // SHA-256 of all digests in order, calculated by another implementation.
+    static const char md5_all[] = "680016363B93E5C29338EE907D4E11A3DCF0E5F625E5C4F962A22A7CFDF3A25B";
+    static const char sha_all[] = "6E74BA3FB2EC1520F8F190CF2CFB0DA9FFD4D94666AC43D8E94A8D4574851C10";
+
+    static const unsigned masks[] = { CPUFEAT_ALL, ~CPUFEAT_SHA, CPUFEAT_SSE2, 0 };
+
+    bool succeed = true;
+    for(size_t n=0; n<sizeof(masks)/sizeof(masks[0]); ++n)
+    {
+        byte_t res_md5[ count * 16 ];
+        byte_t res_sha[ count * 32 ];
+        byte_t res[32];
+        char   str[65];
+
+        cpufeat_set_mask(masks[n]);
+        md5_batch(res_md5, msgs, count);
+        sha_256_batch(res_sha, msgs, count);
+
+        // The single message path.
+        for(size_t i=0; i<count; ++i)
+        {
+            md5_batch(res, &msgs[i], 1);
+            succeed = succeed && !memcmp(res, res_md5 + 16*i, 16);
+
+            sha_256_batch(res, &msgs[i], 1);
+            succeed = succeed && !memcmp(res, res_sha + 32*i, 32);
+        }
+        cpufeat_set_mask(CPUFEAT_ALL);
+
+        sha_256(res, res_md5, sizeof(res_md5));
+        bin_to_str(str, sizeof(str), res, 32);
+        succeed = succeed && !strcmp(str, md5_all);
+
+        sha_256(res, res_sha, sizeof(res_sha));
+        bin_to_str(str, sizeof(str), res, 32);
+        succeed = succeed && !strcmp(str, sha_all);
+
+        for(size_t i=0; i<count; ++i)
+        {
+            md5_t ctx_md5;
+            md5_init(&ctx_md5);
+            md5_update(&ctx_md5, msgs[i].data, msgs[i].size);
+            md5_final(&ctx_md5, res);
+            succeed = succeed && !memcmp(res, res_md5 + 16*i, 16);
+
+            sha_256_t ctx_sha;
+            sha_256_init(&ctx_sha);
+            sha_256_update(&ctx_sha, msgs[i].data, msgs[i].size);
+            sha_256_final(&ctx_sha, res);
+            succeed = succeed && !memcmp(res, res_sha + 32*i, 32);
+        }
+    }
+
+    printf("%s : Batch hash\n", (succeed?"OK":"Failed"));
+    return succeed;
+}
+//------------------------------------------------------------------------------
+bool hash_tree_test(void)
+{
+    enum { size = 100000, leafsize = 4096 };
+
+    static byte_t data[size];
+    for(size_t i=0; i<size; ++i)
+        data[i] = ( i * 31 ) ^ ( i >> 9 );
+
+    // Build the expected root digest manually.
+    byte_t expected[32];
+    {
+        static const byte_t head[1+8+8] =
+        {
+            0x01,
+            0, 0, 0, 0, 0, ( size >> 16 ) & 0xFF, ( size >> 8 ) & 0xFF, size & 0xFF,
+            0, 0, 0, 0, 0, 0, ( leafsize >> 8 ) & 0xFF, leafsize & 0xFF,
+        };
+
+        sha_256_t root;
+        sha_256_init(&root);
+        sha_256_update(&root, head, sizeof(head));
+
+        for(size_t offset=0; offset<size; offset+=leafsize)
+        {
+            static const byte_t prefix = 0x00;
+            byte_t digest[32];
+
+            sha_256_t leaf;
+            sha_256_init(&leaf);
+            sha_256_update(&leaf, &prefix, 1);
+            sha_256_update(&leaf, data + offset, size - offset < leafsize ? size - offset : leafsize);
+            sha_256_final(&leaf, digest);
+
+            sha_256_update(&root, digest, sizeof(digest));
+        }
+
+        sha_256_final(&root, expected);
+    }
+
+    bool succeed = true;
+
+    // The result must be independent of the number of threads.
+    static const unsigned threads[] = { 0, 1, 2, 3, 8, 100 };
+    for(size_t i=0; i<sizeof(threads)/sizeof(threads[0]); ++i)
+    {
+        byte_t res[32];
+        sha_256_tree(res, data, size, leafsize, threads[i]);
+        succeed = succeed && !memcmp(res, expected, sizeof(res));
+    }
+
+    // The empty input and the input with only one leaf.
+    {
+        byte_t res1[32], res2[32];
+
+        sha_256_tree(res1, NULL, 0, 0, 1);
+        sha_256_tree(res2, NULL, 0, 0, 4);
+        succeed = succeed && !memcmp(res1, res2, sizeof(res1));
+
+        sha_256_tree(res1, data, 100, 0, 1);
+        sha_256_tree(res2, data, 100, 0, 4);
+        succeed = succeed && !memcmp(res1, res2, sizeof(res1));
+    }
+
+    // Tree digest is a different digest from the plain one.
+    {
+        byte_t res1[32], res2[32];
+
+        sha_256_tree(res1, data, size, leafsize, 0);
+        sha_256(res2, data, size);
+        succeed = succeed && memcmp(res1, res2, sizeof(res1));
+    }
+
+    printf("%s : Tree hash\n", (succeed?"OK":"Failed"));
+    return succeed;
+}
+//------------------------------------------------------------------------------
 int main(void)
 {
     assert( hash_pearson_test(""   ,"00") );
@@ -220,16 +572,24 @@ int main(void)
     assert( hash_crc16_ccitt_test("aaa", "006B") );
     assert( hash_crc16_ccitt_test("aab", "187A") );
     assert( hash_crc16_ccitt_test("aac", "0FB4") );
+    assert( hash_crc16_ccitt_test("0123456789012345678901234567890123456789012345678901234567890123456789", "0BA0") );
 
     assert( hash_crc16_ibm_test(""   , "0000") );
     assert( hash_crc16_ibm_test("aaa", "30EA") );
     assert( hash_crc16_ibm_test("aab", "89EE") );
     assert( hash_crc16_ibm_test("aac", "1EEB") );
+    assert( hash_crc16_ibm_test("0123456789012345678901234567890123456789012345678901234567890123456789", "789D") );
 
     assert( hash_crc32_test(""   , "00000000") );
     assert( hash_crc32_test("aaa", "FB17A559") );
     assert( hash_crc32_test("aab", "F8F0C58F") );
     assert( hash_crc32_test("aac", "FED3F318") );
+    assert( hash_crc32_test("0123456789012345678901234567890123456789012345678901234567890123456789", "FBEF4503") );
+
+    assert( hash_crc32c_test(""         , "00000000") );
+    assert( hash_crc32c_test("aaa"      , "E397E7D9") );
+    assert( hash_crc32c_test("123456789", "E3069283") );
+    assert( hash_crc32c_test("0123456789012345678901234567890123456789012345678901234567890123456789", "940CA88F") );
 
     assert( hash_jenkins_test(""   , "00000000") );
     assert( hash_jenkins_test("aaa", "AE4F22EC") );
@@ -400,6 +760,12 @@ int main(void)
     assert( sha_512_test("0123456789012345678901234567890123456789012345678901234567890123456789",
                          "BBB6610A951A5C7879961B47CF20052D155B88E05E4ACD9490E77496ECF8784F8F0A42707B10D743C06D5879F296047D6372EA344029E0830FF849202258815B") );
 
+    assert( hash_padding_test() );
+    assert( hash_stream_test() );
+    assert( hash_accel_test() );
+    assert( hash_batch_test() );
+    assert( hash_tree_test() );
+
     return 0;
 }
 //------------------------------------------------------------------------------
@@ -3,21 +3,9 @@
 #include "../endian.h"
 #include "../minmax.h"
 #include "bitrot.h"
-#include "sha.h"
+#include "md5.h"
 
-typedef union chunk_t
-{
-    uint8_t  bytes[64];
-    uint32_t words[16];
-} chunk_t;
-
-typedef struct md5stat_t
-{
-    chunk_t  chunk;
-    uint32_t state[4];
-    uint64_t accsize;
-    bool     use_short_version;
-} md5stat_t;
+#define CHUNK_SIZE 64
 
 static const int s[64] =
 {
@@ -79,7 +67,7 @@ void peek_loop_coeff(int       i,
 }
 //------------------------------------------------------------------------------
 static
-void md5_transform(uint32_t state[8], const chunk_t *chunk)
+void md5_transform(uint32_t state[4], const uint32_t words[16])
 {
     uint32_t a = state[0];
     uint32_t b = state[1];
@@ -94,7 +82,7 @@ void md5_transform(uint32_t state[8], const chunk_t *chunk)
         uint32_t temp = d;
         d = c;
         c = b;
-        b = b + bitrot32_left( a + f + k[i] + chunk->words[g], s[i] );
+        b = b + bitrot32_left( a + f + k[i] + words[g], s[i] );
         a = temp;
     }
 
@@ -117,17 +105,17 @@ unsigned modulo_chunk_size(size_t value)
 }
 //------------------------------------------------------------------------------
 static
-void md5stat_init(md5stat_t *stat)
+void md5stat_init(md5_t *stat)
 {
     memset(stat, 0, sizeof(*stat));
     memcpy(stat->state, state0, sizeof(state0));
 }
 //------------------------------------------------------------------------------
 static
-size_t md5stat_update(md5stat_t *stat, const void *data, size_t size)
+size_t md5stat_update(md5_t *stat, const void *data, size_t size)
 {
     unsigned offset   = modulo_chunk_size(stat->accsize);
-    unsigned bufsize  = sizeof(chunk_t) - offset;
+    unsigned bufsize  = CHUNK_SIZE - offset;
     unsigned fillsize = MIN( bufsize, size );
 
     memcpy( stat->chunk.bytes + offset, data, fillsize );
@@ -135,22 +123,22 @@ size_t md5stat_update(md5stat_t *stat, const void *data, size_t size)
 
     // Check if chunk full.
     if( 0 == modulo_chunk_size(stat->accsize) )
-        md5_transform(stat->state, &stat->chunk);
+        md5_transform(stat->state, stat->chunk.words);
 
     return fillsize;
 }
 //------------------------------------------------------------------------------
 static
-void md5stat_append_bit1(md5stat_t *stat)
+void md5stat_append_bit1(md5_t *stat)
 {
     md5stat_update(stat, "\x80", 1);
 }
 //------------------------------------------------------------------------------
 static
-void md5stat_append_zeros(md5stat_t *stat)
+void md5stat_append_zeros(md5_t *stat)
 {
-    static const uint8_t zeros[sizeof(chunk_t)] = {0};
-    unsigned count = sizeof(chunk_t) - modulo_chunk_size( stat->accsize + sizeof(uint64_t) );
+    static const uint8_t zeros[CHUNK_SIZE] = {0};
+    unsigned count = ( CHUNK_SIZE - modulo_chunk_size( stat->accsize + sizeof(uint64_t) ) ) % CHUNK_SIZE;
 
     while(count)
     {
@@ -162,7 +150,7 @@ void md5stat_append_zeros(md5stat_t *stat)
 }
 //------------------------------------------------------------------------------
 static
-void md5stat_append_accsize(md5stat_t *stat, uint64_t msgsize)
+void md5stat_append_accsize(md5_t *stat, uint64_t msgsize)
 {
     union
     {
@@ -177,7 +165,7 @@ void md5stat_append_accsize(md5stat_t *stat, uint64_t msgsize)
 }
 //------------------------------------------------------------------------------
 static
-void md5stat_get_hash_result(const md5stat_t *stat, void *hashval)
+void md5stat_get_hash_result(const md5_t *stat, void *hashval)
 {
     union
     {
@@ -192,7 +180,7 @@ void md5stat_get_hash_result(const md5stat_t *stat, void *hashval)
 }
 //------------------------------------------------------------------------------
 static
-void md5stat_final(md5stat_t *stat, void *hashval)
+void md5stat_final(md5_t *stat, void *hashval)
 {
     uint64_t msgsize = stat->accsize;
 
@@ -215,19 +203,62 @@ void md5(void *dest, const void *src, size_t size)
      */
     assert( dest && src );
 
-    md5stat_t stat;
-    md5stat_init(&stat);
+    md5_t stat;
+    md5_init(&stat);
+    md5_update(&stat, src, size);
+    md5_final(&stat, dest);
+}
+//------------------------------------------------------------------------------
+void md5_init(md5_t *self)
+{
+    /**
+     * @memberof md5_t
+     * @brief Initialise a hashing context.
+     *
+     * @param self Object instance.
+     */
+    assert( self );
+    md5stat_init(self);
+}
+//------------------------------------------------------------------------------
+void md5_update(md5_t *self, const void *data, size_t size)
+{
+    /**
+     * @memberof md5_t
+     * @brief Append data to the hashing context.
+     *
+     * @param self Object instance.
+     * @param data Data to calculate.
+     * @param size Size of input data.
+     *
+     * @remarks This function can be called many times to calculate
+     *          data that is separated into pieces.
+     */
+    assert( self && ( data || !size ) );
 
-    const uint8_t *pos = src;
+    const uint8_t *pos = data;
     while(size)
     {
-        unsigned fillsize = md5stat_update(&stat, pos, size);
+        unsigned fillsize = md5stat_update(self, pos, size);
         assert( fillsize <= size );
 
         pos  += fillsize;
         size -= fillsize;
     }
-
-    md5stat_final(&stat, dest);
+}
+//------------------------------------------------------------------------------
+void md5_final(md5_t *self, void *dest)
+{
+    /**
+     * @memberof md5_t
+     * @brief Finish the calculation and get the hash result.
+     *
+     * @param self Object instance.
+     * @param dest A buffer to receive the 16-bytes hash data.
+     *
+     * @remarks The context must be initialised again before it can be reused.
+     */
+    assert( self && dest );
+    md5stat_final(self, dest);
 }
 //------------------------------------------------------------------------------
@@ -10,12 +10,33 @@
 #ifndef _GEN_MD5_H_
 #define _GEN_MD5_H_
 
+#include "../type.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 void md5(void *dest, const void *src, size_t size);
 
+/**
+ * @class md5_t
+ * @brief MD5 hashing context for incremental calculation.
+ */
+typedef struct md5_t
+{
+    union
+    {
+        uint8_t  bytes[64];
+        uint32_t words[16];
+    } chunk;
+    uint32_t state[4];
+    uint64_t accsize;
+} md5_t;
+
+void md5_init  (md5_t *self);
+void md5_update(md5_t *self, const void *data, size_t size);
+void md5_final (md5_t *self, void *dest);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -10,6 +10,9 @@
 #ifndef _GEN_SHA_H_
 #define _GEN_SHA_H_
 
+#include "../type.h"
+#include "../inline.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -20,6 +23,81 @@ void sha_256(void *dest, const void *src, size_t size);
 void sha_384(void *dest, const void *src, size_t size);
 void sha_512(void *dest, const void *src, size_t size);
 
+/**
+ * @class sha_1_t
+ * @brief SHA-1 hashing context for incremental calculation.
+ */
+typedef struct sha_1_t
+{
+    union
+    {
+        uint8_t  bytes[64];
+        uint32_t words[16];
+    } chunk;
+    uint32_t state[5];
+    uint64_t accsize;
+} sha_1_t;
+
+void sha_1_init  (sha_1_t *self);
+void sha_1_update(sha_1_t *self, const void *data, size_t size);
+void sha_1_final (sha_1_t *self, void *dest);
+
+/**
+ * @class sha_256_t
+ * @brief SHA-224 and SHA-256 hashing context for incremental calculation.
+ */
+typedef struct sha_256_t
+{
+    union
+    {
+        uint8_t  bytes[64];
+        uint32_t words[16];
+    } chunk;
+    uint32_t state[8];
+    uint64_t accsize;
+    bool     use_short_version;
+} sha_256_t;
+
+void sha_224_init  (sha_256_t *self);
+void sha_256_init  (sha_256_t *self);
+void sha_256_update(sha_256_t *self, const void *data, size_t size);
+void sha_256_final (sha_256_t *self, void *dest);
+
+/// @memberof sha_256_t
+/// @brief Alias of ::sha_256_update for SHA-224 calculation.
+INLINE void sha_224_update(sha_256_t *self, const void *data, size_t size){ sha_256_update(self, data, size); }
+/// @memberof sha_256_t
+/// @brief Alias of ::sha_256_final for SHA-224 calculation.
+INLINE void sha_224_final(sha_256_t *self, void *dest){ sha_256_final(self, dest); }
+
+/**
+ * @class sha_512_t
+ * @brief SHA-384 and SHA-512 hashing context for incremental calculation.
+ */
+typedef struct sha_512_t
+{
+    union
+    {
+        uint8_t  bytes[128];
+        uint64_t words[16];
+    } chunk;
+    uint64_t state[8];
+    uint64_t accsize;
+    bool     use_short_version;
+} sha_512_t;
+
+void sha_384_init  (sha_512_t *self);
+void sha_512_init  (sha_512_t *self);
+void sha_512_update(sha_512_t *self, const void *data, size_t size);
+void sha_512_final (sha_512_t *self, void *dest);
+
+/// @memberof sha_512_t
+/// @brief Alias of ::sha_512_update for SHA-384 calculation.
+INLINE void sha_384_update(sha_512_t *self, const void *data, size_t size){ sha_512_update(self, data, size); }
+/// @memberof sha_512_t
+/// @brief Alias of ::sha_512_final for SHA-384 calculation.
+INLINE void sha_384_final(sha_512_t *self, void *dest){ sha_512_final(self, dest); }
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
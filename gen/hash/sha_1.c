@@ -4,19 +4,9 @@
 #include "../minmax.h"
 #include "bitrot.h"
 #include "sha.h"
+#include "sha_ni.h"
 
-typedef union chunk_t
-{
-    uint8_t  bytes[64];
-    uint32_t words[16];
-} chunk_t;
-
-typedef struct shastat_t
-{
-    chunk_t  chunk;
-    uint32_t state[5];
-    uint64_t accsize;
-} shastat_t;
+#define CHUNK_SIZE 64
 
 static const uint32_t state0[5] =
 {
@@ -25,45 +15,29 @@ static const uint32_t state0[5] =
 
 //------------------------------------------------------------------------------
 static
-void peek_loop_coeff(int       i,
-                     uint32_t  a,
-                     uint32_t  b,
-                     uint32_t  c,
-                     uint32_t  d,
-                     uint32_t  e,
-                     uint32_t *f,
-                     uint32_t *k)
-{
-    assert( 0 <= i && i < 80 );
-
-    if( i < 20 )
-    {
-        *f = ( b & c ) | ( ~b & d );
-        *k = 0x5A827999;
-    }
-    else if( i < 40 )
-    {
-        *f = b ^ c ^ d;
-        *k = 0x6ED9EBA1;
-    }
-    else if( i < 60 )
-    {
-        *f = ( b & c ) | ( b & d ) | ( c & d );
-        *k = 0x8F1BBCDC;
-    }
-    else if( i < 80 )
-    {
-        *f = b ^ c ^ d;
-        *k = 0xCA62C1D6;
-    }
+uint32_t load_be_32(const uint8_t *src)
+{
+    uint32_t value;
+    memcpy(&value, src, sizeof(value));
+    return endian_be_to_local_32(value);
+}
+//------------------------------------------------------------------------------
+#define SHA1_ROUND(f, k)                                        \
+{                                                               \
+    uint32_t temp = bitrot32_left(a, 5) + (f) + e + (k) + w[i]; \
+    e = d;                                                      \
+    d = c;                                                      \
+    c = bitrot32_left(b, 30);                                   \
+    b = a;                                                      \
+    a = temp;                                                   \
 }
 //------------------------------------------------------------------------------
 static
-void sha_transform(uint32_t state[5], const chunk_t *chunk)
+void sha_transform(uint32_t state[5], const uint8_t block[64])
 {
     uint32_t w[80];
     for(int i=0; i<16; ++i)
-        w[i] = endian_be_to_local_32(chunk->words[i]);
+        w[i] = load_be_32(block + 4*i);
     for(int i=16; i<80; ++i)
         w[i] = bitrot32_left( w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1 );
 
@@ -73,18 +47,11 @@ void sha_transform(uint32_t state[5], const chunk_t *chunk)
     uint32_t d = state[3];
     uint32_t e = state[4];
 
-    for(int i=0; i<80; ++i)
-    {
-        uint32_t f, k;
-        peek_loop_coeff(i, a, b, c, d, e, &f, &k);
-
-        uint32_t temp = bitrot32_left(a, 5) + f + e + k + w[i];
-        e = d;
-        d = c;
-        c = bitrot32_left(b, 30);
-        b = a;
-        a = temp;
-    }
+    int i;
+    for(i= 0; i<20; ++i) SHA1_ROUND( ( b & c ) | ( ~b & d )           , 0x5A827999 );
+    for(   ; i<40; ++i) SHA1_ROUND( b ^ c ^ d                         , 0x6ED9EBA1 );
+    for(   ; i<60; ++i) SHA1_ROUND( ( b & c ) | ( b & d ) | ( c & d ) , 0x8F1BBCDC );
+    for(   ; i<80; ++i) SHA1_ROUND( b ^ c ^ d                         , 0xCA62C1D6 );
 
     state[0] += a;
     state[1] += b;
@@ -94,6 +61,21 @@ void sha_transform(uint32_t state[5], const chunk_t *chunk)
 }
 //------------------------------------------------------------------------------
 static
+void sha_transform_blocks(uint32_t state[5], const uint8_t *blocks, size_t count)
+{
+#ifdef SHA_NI_AVAILABLE
+    if( cpufeat_has(SHA_NI_FEATURES) )
+    {
+        sha_ni_transform_1(state, blocks, count);
+        return;
+    }
+#endif
+
+    for(; count; --count, blocks += CHUNK_SIZE)
+        sha_transform(state, blocks);
+}
+//------------------------------------------------------------------------------
+static
 unsigned modulo64(size_t value)
 {
     return value & 0x3F;
@@ -106,17 +88,28 @@ unsigned modulo_chunk_size(size_t value)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_init(shastat_t *stat)
+void shastat_init(sha_1_t *stat)
 {
     memset(stat, 0, sizeof(*stat));
     memcpy(stat->state, state0, sizeof(state0));
 }
 //------------------------------------------------------------------------------
 static
-size_t shastat_update(shastat_t *stat, const void *data, size_t size)
+size_t shastat_update(sha_1_t *stat, const void *data, size_t size)
 {
     unsigned offset   = modulo_chunk_size(stat->accsize);
-    unsigned bufsize  = sizeof(chunk_t) - offset;
+    unsigned bufsize  = CHUNK_SIZE - offset;
+
+    // Transform whole chunks from the input directly if no data pending.
+    if( !offset && size >= CHUNK_SIZE )
+    {
+        size_t count = size / CHUNK_SIZE;
+        sha_transform_blocks(stat->state, data, count);
+        stat->accsize += count * CHUNK_SIZE;
+
+        return count * CHUNK_SIZE;
+    }
+
     unsigned fillsize = MIN( bufsize, size );
 
     memcpy( stat->chunk.bytes + offset, data, fillsize );
@@ -124,22 +117,22 @@ size_t shastat_update(shastat_t *stat, const void *data, size_t size)
 
     // Check if chunk full.
     if( 0 == modulo_chunk_size(stat->accsize) )
-        sha_transform(stat->state, &stat->chunk);
+        sha_transform_blocks(stat->state, stat->chunk.bytes, 1);
 
     return fillsize;
 }
 //------------------------------------------------------------------------------
 static
-void shastat_append_bit1(shastat_t *stat)
+void shastat_append_bit1(sha_1_t *stat)
 {
     shastat_update(stat, "\x80", 1);
 }
 //------------------------------------------------------------------------------
 static
-void shastat_append_zeros(shastat_t *stat)
+void shastat_append_zeros(sha_1_t *stat)
 {
-    static const uint8_t zeros[sizeof(chunk_t)] = {0};
-    unsigned count = sizeof(chunk_t) - modulo_chunk_size( stat->accsize + sizeof(uint64_t) );
+    static const uint8_t zeros[CHUNK_SIZE] = {0};
+    unsigned count = ( CHUNK_SIZE - modulo_chunk_size( stat->accsize + sizeof(uint64_t) ) ) % CHUNK_SIZE;
 
     while(count)
     {
@@ -151,7 +144,7 @@ void shastat_append_zeros(shastat_t *stat)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_append_accsize(shastat_t *stat, uint64_t msgsize)
+void shastat_append_accsize(sha_1_t *stat, uint64_t msgsize)
 {
     union
     {
@@ -166,7 +159,7 @@ void shastat_append_accsize(shastat_t *stat, uint64_t msgsize)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_get_hash_result(const shastat_t *stat, void *hashval)
+void shastat_get_hash_result(const sha_1_t *stat, void *hashval)
 {
     union
     {
@@ -180,7 +173,7 @@ void shastat_get_hash_result(const shastat_t *stat, void *hashval)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_final(shastat_t *stat, void *hashval)
+void shastat_final(sha_1_t *stat, void *hashval)
 {
     uint64_t msgsize = stat->accsize;
 
@@ -203,19 +196,62 @@ void sha_1(void *dest, const void *src, size_t size)
      */
     assert( dest && src );
 
-    shastat_t stat;
-    shastat_init(&stat);
+    sha_1_t stat;
+    sha_1_init(&stat);
+    sha_1_update(&stat, src, size);
+    sha_1_final(&stat, dest);
+}
+//------------------------------------------------------------------------------
+void sha_1_init(sha_1_t *self)
+{
+    /**
+     * @memberof sha_1_t
+     * @brief Initialise a hashing context for SHA-1 calculation.
+     *
+     * @param self Object instance.
+     */
+    assert( self );
+    shastat_init(self);
+}
+//------------------------------------------------------------------------------
+void sha_1_update(sha_1_t *self, const void *data, size_t size)
+{
+    /**
+     * @memberof sha_1_t
+     * @brief Append data to the hashing context.
+     *
+     * @param self Object instance.
+     * @param data Data to calculate.
+     * @param size Size of input data.
+     *
+     * @remarks This function can be called many times to calculate
+     *          data that is separated into pieces.
+     */
+    assert( self && ( data || !size ) );
 
-    const uint8_t *pos = src;
+    const uint8_t *pos = data;
     while(size)
     {
-        unsigned fillsize = shastat_update(&stat, pos, size);
+        size_t fillsize = shastat_update(self, pos, size);
         assert( fillsize <= size );
 
         pos  += fillsize;
         size -= fillsize;
     }
-
-    shastat_final(&stat, dest);
+}
+//------------------------------------------------------------------------------
+void sha_1_final(sha_1_t *self, void *dest)
+{
+    /**
+     * @memberof sha_1_t
+     * @brief Finish the calculation and get the hash result.
+     *
+     * @param self Object instance.
+     * @param dest A buffer to receive the 20-bytes hash data.
+     *
+     * @remarks The context must be initialised again before it can be reused.
+     */
+    assert( self && dest );
+    shastat_final(self, dest);
 }
 //------------------------------------------------------------------------------
@@ -4,20 +4,9 @@
 #include "../minmax.h"
 #include "bitrot.h"
 #include "sha.h"
+#include "sha_ni.h"
 
-typedef union chunk_t
-{
-    uint8_t  bytes[64];
-    uint32_t words[16];
-} chunk_t;
-
-typedef struct shastat_t
-{
-    chunk_t  chunk;
-    uint32_t state[8];
-    uint64_t accsize;
-    bool     use_short_version;
-} shastat_t;
+#define CHUNK_SIZE 64
 
 static const uint32_t k[64] =
 {
@@ -43,12 +32,20 @@ static const uint32_t state0_for_short[8] =
 
 //------------------------------------------------------------------------------
 static
-void sha_transform(uint32_t state[8], const chunk_t *chunk)
+uint32_t load_be_32(const uint8_t *src)
+{
+    uint32_t value;
+    memcpy(&value, src, sizeof(value));
+    return endian_be_to_local_32(value);
+}
+//------------------------------------------------------------------------------
+static
+void sha_transform(uint32_t state[8], const uint8_t block[64])
 {
     uint32_t w[64];
     for(int i=0; i<16; ++i)
     {
-        w[i] = endian_be_to_local_32(chunk->words[i]);
+        w[i] = load_be_32(block + 4*i);
     }
     for(int i=16; i<64; ++i)
     {
@@ -96,6 +93,21 @@ void sha_transform(uint32_t state[8], const chunk_t *chunk)
 }
 //------------------------------------------------------------------------------
 static
+void sha_transform_blocks(uint32_t state[8], const uint8_t *blocks, size_t count)
+{
+#ifdef SHA_NI_AVAILABLE
+    if( cpufeat_has(SHA_NI_FEATURES) )
+    {
+        sha_ni_transform_256(state, blocks, count);
+        return;
+    }
+#endif
+
+    for(; count; --count, blocks += CHUNK_SIZE)
+        sha_transform(state, blocks);
+}
+//------------------------------------------------------------------------------
+static
 unsigned modulo64(size_t value)
 {
     return value & 0x3F;
@@ -108,7 +120,7 @@ unsigned modulo_chunk_size(size_t value)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_init(shastat_t *stat, bool use_short_version)
+void shastat_init(sha_256_t *stat, bool use_short_version)
 {
     memset(stat, 0, sizeof(*stat));
 
@@ -120,10 +132,21 @@ void shastat_init(shastat_t *stat, bool use_short_version)
 }
 //------------------------------------------------------------------------------
 static
-size_t shastat_update(shastat_t *stat, const void *data, size_t size)
+size_t shastat_update(sha_256_t *stat, const void *data, size_t size)
 {
     unsigned offset   = modulo_chunk_size(stat->accsize);
-    unsigned bufsize  = sizeof(chunk_t) - offset;
+    unsigned bufsize  = CHUNK_SIZE - offset;
+
+    // Transform whole chunks from the input directly if no data pending.
+    if( !offset && size >= CHUNK_SIZE )
+    {
+        size_t count = size / CHUNK_SIZE;
+        sha_transform_blocks(stat->state, data, count);
+        stat->accsize += count * CHUNK_SIZE;
+
+        return count * CHUNK_SIZE;
+    }
+
     unsigned fillsize = MIN( bufsize, size );
 
     memcpy( stat->chunk.bytes + offset, data, fillsize );
@@ -131,22 +154,22 @@ size_t shastat_update(shastat_t *stat, const void *data, size_t size)
 
     // Check if chunk full.
     if( 0 == modulo_chunk_size(stat->accsize) )
-        sha_transform(stat->state, &stat->chunk);
+        sha_transform_blocks(stat->state, stat->chunk.bytes, 1);
 
     return fillsize;
 }
 //------------------------------------------------------------------------------
 static
-void shastat_append_bit1(shastat_t *stat)
+void shastat_append_bit1(sha_256_t *stat)
 {
     shastat_update(stat, "\x80", 1);
 }
 //------------------------------------------------------------------------------
 static
-void shastat_append_zeros(shastat_t *stat)
+void shastat_append_zeros(sha_256_t *stat)
 {
-    static const uint8_t zeros[sizeof(chunk_t)] = {0};
-    unsigned count = sizeof(chunk_t) - modulo_chunk_size( stat->accsize + sizeof(uint64_t) );
+    static const uint8_t zeros[CHUNK_SIZE] = {0};
+    unsigned count = ( CHUNK_SIZE - modulo_chunk_size( stat->accsize + sizeof(uint64_t) ) ) % CHUNK_SIZE;
 
     while(count)
     {
@@ -158,7 +181,7 @@ void shastat_append_zeros(shastat_t *stat)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_append_accsize(shastat_t *stat, uint64_t msgsize)
+void shastat_append_accsize(sha_256_t *stat, uint64_t msgsize)
 {
     union
     {
@@ -173,7 +196,7 @@ void shastat_append_accsize(shastat_t *stat, uint64_t msgsize)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_get_hash_result(const shastat_t *stat, byte_t *hashval)
+void shastat_get_hash_result(const sha_256_t *stat, byte_t *hashval)
 {
     union
     {
@@ -191,7 +214,7 @@ void shastat_get_hash_result(const shastat_t *stat, byte_t *hashval)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_final(shastat_t *stat, byte_t *hashval)
+void shastat_final(sha_256_t *stat, byte_t *hashval)
 {
     uint64_t msgsize = stat->accsize;
 
@@ -203,27 +226,6 @@ void shastat_final(shastat_t *stat, byte_t *hashval)
     shastat_get_hash_result(stat, hashval);
 }
 //------------------------------------------------------------------------------
-static
-void sha_256_private(void *dest, const void *src, size_t size, bool use_short_version)
-{
-    assert( dest && src );
-
-    shastat_t stat;
-    shastat_init(&stat, use_short_version);
-
-    const uint8_t *pos = src;
-    while(size)
-    {
-        unsigned fillsize = shastat_update(&stat, pos, size);
-        assert( fillsize <= size );
-
-        pos  += fillsize;
-        size -= fillsize;
-    }
-
-    shastat_final(&stat, dest);
-}
-//------------------------------------------------------------------------------
 void sha_224(void *dest, const void *src, size_t size)
 {
     /**
@@ -233,7 +235,12 @@ void sha_224(void *dest, const void *src, size_t size)
      * @param src  Data to calculate.
      * @param size Size of input data.
      */
-    sha_256_private(dest, src, size, true);
+    assert( dest && src );
+
+    sha_256_t stat;
+    sha_224_init(&stat);
+    sha_256_update(&stat, src, size);
+    sha_256_final(&stat, dest);
 }
 //------------------------------------------------------------------------------
 void sha_256(void *dest, const void *src, size_t size)
@@ -245,6 +252,76 @@ void sha_256(void *dest, const void *src, size_t size)
      * @param src  Data to calculate.
      * @param size Size of input data.
      */
-    sha_256_private(dest, src, size, false);
+    assert( dest && src );
+
+    sha_256_t stat;
+    sha_256_init(&stat);
+    sha_256_update(&stat, src, size);
+    sha_256_final(&stat, dest);
+}
+//------------------------------------------------------------------------------
+void sha_224_init(sha_256_t *self)
+{
+    /**
+     * @memberof sha_256_t
+     * @brief Initialise a hashing context for SHA-224 calculation.
+     *
+     * @param self Object instance.
+     */
+    assert( self );
+    shastat_init(self, true);
+}
+//------------------------------------------------------------------------------
+void sha_256_init(sha_256_t *self)
+{
+    /**
+     * @memberof sha_256_t
+     * @brief Initialise a hashing context for SHA-256 calculation.
+     *
+     * @param self Object instance.
+     */
+    assert( self );
+    shastat_init(self, false);
+}
+//------------------------------------------------------------------------------
+void sha_256_update(sha_256_t *self, const void *data, size_t size)
+{
+    /**
+     * @memberof sha_256_t
+     * @brief Append data to the hashing context.
+     *
+     * @param self Object instance.
+     * @param data Data to calculate.
+     * @param size Size of input data.
+     *
+     * @remarks This function can be called many times to calculate
+     *          data that is separated into pieces.
+     */
+    assert( self && ( data || !size ) );
+
+    const uint8_t *pos = data;
+    while(size)
+    {
+        size_t fillsize = shastat_update(self, pos, size);
+        assert( fillsize <= size );
+
+        pos  += fillsize;
+        size -= fillsize;
+    }
+}
+//------------------------------------------------------------------------------
+void sha_256_final(sha_256_t *self, void *dest)
+{
+    /**
+     * @memberof sha_256_t
+     * @brief Finish the calculation and get the hash result.
+     *
+     * @param self Object instance.
+     * @param dest A buffer to receive the 32-bytes (or 28-bytes for SHA-224) hash data.
+     *
+     * @remarks The context must be initialised again before it can be reused.
+     */
+    assert( self && dest );
+    shastat_final(self, dest);
 }
 //------------------------------------------------------------------------------
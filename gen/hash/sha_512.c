@@ -5,19 +5,7 @@
 #include "bitrot.h"
 #include "sha.h"
 
-typedef union chunk_t
-{
-    uint8_t  bytes[128];
-    uint64_t words[16];
-} chunk_t;
-
-typedef struct shastat_t
-{
-    chunk_t  chunk;
-    uint64_t state[8];
-    uint64_t accsize;
-    bool     use_short_version;
-} shastat_t;
+#define CHUNK_SIZE 128
 
 static const uint64_t k[80] =
 {
@@ -57,12 +45,12 @@ static const uint64_t state0_for_short[8] =
 
 //------------------------------------------------------------------------------
 static
-void sha_transform(uint64_t state[8], const chunk_t *chunk)
+void sha_transform(uint64_t state[8], const uint64_t words[16])
 {
     uint64_t w[80];
     for(int i=0; i<16; ++i)
     {
-        w[i] = endian_be_to_local_64(chunk->words[i]);
+        w[i] = endian_be_to_local_64(words[i]);
     }
     for(int i=16; i<80; ++i)
     {
@@ -122,7 +110,7 @@ unsigned modulo_chunk_size(size_t value)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_init(shastat_t *stat, bool use_short_version)
+void shastat_init(sha_512_t *stat, bool use_short_version)
 {
     memset(stat, 0, sizeof(*stat));
 
@@ -134,10 +122,10 @@ void shastat_init(shastat_t *stat, bool use_short_version)
 }
 //------------------------------------------------------------------------------
 static
-size_t shastat_update(shastat_t *stat, const void *data, size_t size)
+size_t shastat_update(sha_512_t *stat, const void *data, size_t size)
 {
     unsigned offset   = modulo_chunk_size(stat->accsize);
-    unsigned bufsize  = sizeof(chunk_t) - offset;
+    unsigned bufsize  = CHUNK_SIZE - offset;
     unsigned fillsize = MIN( bufsize, size );
 
     memcpy( stat->chunk.bytes + offset, data, fillsize );
@@ -145,22 +133,22 @@ size_t shastat_update(shastat_t *stat, const void *data, size_t size)
 
     // Check if chunk full.
     if( 0 == modulo_chunk_size(stat->accsize) )
-        sha_transform(stat->state, &stat->chunk);
+        sha_transform(stat->state, stat->chunk.words);
 
     return fillsize;
 }
 //------------------------------------------------------------------------------
 static
-void shastat_append_bit1(shastat_t *stat)
+void shastat_append_bit1(sha_512_t *stat)
 {
     shastat_update(stat, "\x80", 1);
 }
 //------------------------------------------------------------------------------
 static
-void shastat_append_zeros(shastat_t *stat)
+void shastat_append_zeros(sha_512_t *stat)
 {
-    static const uint8_t zeros[sizeof(chunk_t)] = {0};
-    unsigned count = sizeof(chunk_t) - modulo_chunk_size( stat->accsize + 2*sizeof(uint64_t) );
+    static const uint8_t zeros[CHUNK_SIZE] = {0};
+    unsigned count = ( CHUNK_SIZE - modulo_chunk_size( stat->accsize + 2*sizeof(uint64_t) ) ) % CHUNK_SIZE;
 
     while(count)
     {
@@ -172,7 +160,7 @@ void shastat_append_zeros(shastat_t *stat)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_append_accsize(shastat_t *stat, uint64_t msgsize)
+void shastat_append_accsize(sha_512_t *stat, uint64_t msgsize)
 {
     union
     {
@@ -191,7 +179,7 @@ void shastat_append_accsize(shastat_t *stat, uint64_t msgsize)
 }
 //------------------------------------------------------------------------------
 static
-void shastat_get_hash_result(const shastat_t *stat, byte_t *hashval)
+void shastat_get_hash_result(const sha_512_t *stat, byte_t *hashval)
 {
     union
     {
@@ -203,13 +191,13 @@ void shastat_get_hash_result(const shastat_t *stat, byte_t *hashval)
         exg.state[i] = endian_local_to_be_64(stat->state[i]);
 
     if( stat->use_short_version )
-        memcpy(hashval, exg.bytes, sizeof(exg.bytes)-sizeof(uint64_t));
+        memcpy(hashval, exg.bytes, 6*sizeof(uint64_t));
     else
         memcpy(hashval, exg.bytes, sizeof(exg.bytes));
 }
 //------------------------------------------------------------------------------
 static
-void shastat_final(shastat_t *stat, void *hashval)
+void shastat_final(sha_512_t *stat, void *hashval)
 {
     uint64_t msgsize = stat->accsize;
 
@@ -221,27 +209,6 @@ void shastat_final(shastat_t *stat, void *hashval)
     shastat_get_hash_result(stat, hashval);
 }
 //------------------------------------------------------------------------------
-static
-void sha_512_private(void *dest, const void *src, size_t size, bool use_short_version)
-{
-    assert( dest && src );
-
-    shastat_t stat;
-    shastat_init(&stat, use_short_version);
-
-    const uint8_t *pos = src;
-    while(size)
-    {
-        unsigned fillsize = shastat_update(&stat, pos, size);
-        assert( fillsize <= size );
-
-        pos  += fillsize;
-        size -= fillsize;
-    }
-
-    shastat_final(&stat, dest);
-}
-//------------------------------------------------------------------------------
 void sha_384(void *dest, const void *src, size_t size)
 {
     /**
@@ -251,7 +218,12 @@ void sha_384(void *dest, const void *src, size_t size)
      * @param src  Data to calculate.
      * @param size Size of input data.
      */
-    sha_512_private(dest, src, size, true);
+    assert( dest && src );
+
+    sha_512_t stat;
+    sha_384_init(&stat);
+    sha_512_update(&stat, src, size);
+    sha_512_final(&stat, dest);
 }
 //------------------------------------------------------------------------------
 void sha_512(void *dest, const void *src, size_t size)
@@ -263,6 +235,76 @@ void sha_512(void *dest, const void *src, size_t size)
      * @param src  Data to calculate.
      * @param size Size of input data.
      */
-    sha_512_private(dest, src, size, false);
+    assert( dest && src );
+
+    sha_512_t stat;
+    sha_512_init(&stat);
+    sha_512_update(&stat, src, size);
+    sha_512_final(&stat, dest);
+}
+//------------------------------------------------------------------------------
+void sha_384_init(sha_512_t *self)
+{
+    /**
+     * @memberof sha_512_t
+     * @brief Initialise a hashing context for SHA-384 calculation.
+     *
+     * @param self Object instance.
+     */
+    assert( self );
+    shastat_init(self, true);
+}
+//------------------------------------------------------------------------------
+void sha_512_init(sha_512_t *self)
+{
+    /**
+     * @memberof sha_512_t
+     * @brief Initialise a hashing context for SHA-512 calculation.
+     *
+     * @param self Object instance.
+     */
+    assert( self );
+    shastat_init(self, false);
+}
+//------------------------------------------------------------------------------
+void sha_512_update(sha_512_t *self, const void *data, size_t size)
+{
+    /**
+     * @memberof sha_512_t
+     * @brief Append data to the hashing context.
+     *
+     * @param self Object instance.
+     * @param data Data to calculate.
+     * @param size Size of input data.
+     *
+     * @remarks This function can be called many times to calculate
+     *          data that is separated into pieces.
+     */
+    assert( self && ( data || !size ) );
+
+    const uint8_t *pos = data;
+    while(size)
+    {
+        unsigned fillsize = shastat_update(self, pos, size);
+        assert( fillsize <= size );
+
+        pos  += fillsize;
+        size -= fillsize;
+    }
+}
+//------------------------------------------------------------------------------
+void sha_512_final(sha_512_t *self, void *dest)
+{
+    /**
+     * @memberof sha_512_t
+     * @brief Finish the calculation and get the hash result.
+     *
+     * @param self Object instance.
+     * @param dest A buffer to receive the 64-bytes (or 48-bytes for SHA-384) hash data.
+     *
+     * @remarks The context must be initialised again before it can be reused.
+     */
+    assert( self && dest );
+    shastat_final(self, dest);
 }
 //------------------------------------------------------------------------------
@@ -0,0 +1,132 @@
+#include "sha_ni.h"
+
+#ifdef SHA_NI_AVAILABLE
+
+#include <immintrin.h>
+
+/*
+ * The message words of the next group are prepared while the rounds of the current group
+ * are running, so that the message schedule instructions can be overlapped with the rounds.
+ * All group index expressions below are constants, and they will be folded by the compiler.
+ */
+
+//------------------------------------------------------------------------------
+#define SHA1_GROUP(g)                                                       \
+{                                                                           \
+    __m128i *e_cur   = ( (g) & 1 )?( &e1 ):( &e0 );                         \
+    __m128i *e_other = ( (g) & 1 )?( &e0 ):( &e1 );                         \
+    __m128i  cur     = msg[ (g) & 3 ];                                      \
+                                                                            \
+    if( (g) == 0 )                                                          \
+        *e_cur = _mm_add_epi32(*e_cur, cur);                                \
+    else                                                                    \
+        *e_cur = _mm_sha1nexte_epu32(*e_cur, cur);                          \
+    *e_other = abcd;                                                        \
+                                                                            \
+    if( 3 <= (g) && (g) <= 18 )                                             \
+        msg[ ((g)+1) & 3 ] = _mm_sha1msg2_epu32(msg[ ((g)+1) & 3 ], cur);   \
+    abcd = _mm_sha1rnds4_epu32(abcd, *e_cur, (g)/5);                        \
+    if( 1 <= (g) && (g) <= 16 )                                             \
+        msg[ ((g)-1) & 3 ] = _mm_sha1msg1_epu32(msg[ ((g)-1) & 3 ], cur);   \
+    if( 2 <= (g) && (g) <= 17 )                                             \
+        msg[ ((g)-2) & 3 ] = _mm_xor_si128(msg[ ((g)-2) & 3 ], cur);        \
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("sha,ssse3,sse4.1")
+void sha_ni_transform_1(uint32_t state[5], const uint8_t *blocks, size_t count)
+{
+    const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090A0B0C0D0E0FULL);
+
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) state), 0x1B);
+    __m128i e0   = _mm_set_epi32(state[4], 0, 0, 0);
+    __m128i e1;
+    __m128i msg[4];
+
+    for(; count; --count, blocks += 64)
+    {
+        __m128i abcd_save = abcd;
+        __m128i e0_save   = e0;
+
+        for(int i=0; i<4; ++i)
+            msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)( blocks + 16*i )), mask);
+
+        SHA1_GROUP( 0) SHA1_GROUP( 1) SHA1_GROUP( 2) SHA1_GROUP( 3) SHA1_GROUP( 4)
+        SHA1_GROUP( 5) SHA1_GROUP( 6) SHA1_GROUP( 7) SHA1_GROUP( 8) SHA1_GROUP( 9)
+        SHA1_GROUP(10) SHA1_GROUP(11) SHA1_GROUP(12) SHA1_GROUP(13) SHA1_GROUP(14)
+        SHA1_GROUP(15) SHA1_GROUP(16) SHA1_GROUP(17) SHA1_GROUP(18) SHA1_GROUP(19)
+
+        e0   = _mm_sha1nexte_epu32(e0, e0_save);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+    }
+
+    _mm_storeu_si128((__m128i*) state, _mm_shuffle_epi32(abcd, 0x1B));
+    state[4] = _mm_extract_epi32(e0, 3);
+}
+//------------------------------------------------------------------------------
+static const uint32_t k256[64] =
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+//------------------------------------------------------------------------------
+#define SHA256_GROUP(g)                                                                 \
+{                                                                                       \
+    __m128i cur = msg[ (g) & 3 ];                                                       \
+    __m128i wk  = _mm_add_epi32(cur, _mm_loadu_si128((const __m128i*)( k256 + 4*(g) )));\
+                                                                                        \
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);                                       \
+    if( 3 <= (g) && (g) <= 14 )                                                         \
+    {                                                                                   \
+        __m128i *next = &msg[ ((g)+1) & 3 ];                                            \
+        *next = _mm_add_epi32(*next, _mm_alignr_epi8(cur, msg[ ((g)-1) & 3 ], 4));      \
+        *next = _mm_sha256msg2_epu32(*next, cur);                                       \
+    }                                                                                   \
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(wk, 0x0E));              \
+    if( 1 <= (g) && (g) <= 12 )                                                         \
+        msg[ ((g)-1) & 3 ] = _mm_sha256msg1_epu32(msg[ ((g)-1) & 3 ], cur);             \
+}
+//------------------------------------------------------------------------------
+CPUFEAT_TARGET("sha,ssse3,sse4.1")
+void sha_ni_transform_256(uint32_t state[8], const uint8_t *blocks, size_t count)
+{
+    const __m128i mask = _mm_set_epi64x(0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL);
+
+    // Rearrange the state to the ABEF/CDGH form used by the instructions.
+    __m128i dcba = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)( state + 0 )), 0xB1);
+    __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)( state + 4 )), 0x1B);
+    __m128i abef = _mm_alignr_epi8(dcba, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, dcba, 0xF0);
+    __m128i msg[4];
+
+    for(; count; --count, blocks += 64)
+    {
+        __m128i abef_save = abef;
+        __m128i cdgh_save = cdgh;
+
+        for(int i=0; i<4; ++i)
+            msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)( blocks + 16*i )), mask);
+
+        SHA256_GROUP( 0) SHA256_GROUP( 1) SHA256_GROUP( 2) SHA256_GROUP( 3)
+        SHA256_GROUP( 4) SHA256_GROUP( 5) SHA256_GROUP( 6) SHA256_GROUP( 7)
+        SHA256_GROUP( 8) SHA256_GROUP( 9) SHA256_GROUP(10) SHA256_GROUP(11)
+        SHA256_GROUP(12) SHA256_GROUP(13) SHA256_GROUP(14) SHA256_GROUP(15)
+
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+    }
+
+    // Restore the state to the normal order.
+    __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+    __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+    _mm_storeu_si128((__m128i*)( state + 0 ), _mm_blend_epi16(feba, dchg, 0xF0));
+    _mm_storeu_si128((__m128i*)( state + 4 ), _mm_alignr_epi8(dchg, feba, 8));
+}
+//------------------------------------------------------------------------------
+
+#endif  // SHA_NI_AVAILABLE
@@ -0,0 +1,40 @@
+/*
+ * PRIVATE USAGE
+ */
+/**
+ * @brief     SHA extensions.
+ * @details   SHA-1 and SHA-256 block functions accelerated by the x86 SHA extensions.
+ * @author    王文佑
+ * @date      2026.10.17
+ * @copyright ZLib Licence
+ * @see       http://www.openfoundry.org/of/projects/2419
+ */
+#ifndef _GEN_SHA_NI_H_
+#define _GEN_SHA_NI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../cpufeat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CPUFEAT_X86
+
+/// Defined if the SHA extension block functions are available.
+#define SHA_NI_AVAILABLE
+
+/// Features needed by the block functions.
+#define SHA_NI_FEATURES ( CPUFEAT_SHA | CPUFEAT_SSSE3 | CPUFEAT_SSE41 )
+
+void sha_ni_transform_1  (uint32_t state[5], const uint8_t *blocks, size_t count);
+void sha_ni_transform_256(uint32_t state[8], const uint8_t *blocks, size_t count);
+
+#endif
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
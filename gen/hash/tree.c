@@ -0,0 +1,160 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+#include "../cpufeat.h"
+#include "../endian.h"
+#include "sha.h"
+#include "tree.h"
+
+#define SHA_256_SIZE 32
+#define THREADS_MAX  64
+
+#define PREFIX_LEAF 0x00
+#define PREFIX_ROOT 0x01
+
+typedef struct job_t
+{
+    const byte_t *src;
+    size_t        size;
+    size_t        leafsize;
+    size_t        count;        // Number of leaves.
+    byte_t       *digests;      // Digests of all leaves.
+    atomic_size_t next;         // Index of the next leaf to be processed.
+} job_t;
+
+//------------------------------------------------------------------------------
+static
+void sha_256_leaf(void *dest, const byte_t *src, size_t size)
+{
+    static const byte_t prefix = PREFIX_LEAF;
+
+    sha_256_t ctx;
+    sha_256_init(&ctx);
+    sha_256_update(&ctx, &prefix, 1);
+    sha_256_update(&ctx, src, size);
+    sha_256_final(&ctx, dest);
+}
+//------------------------------------------------------------------------------
+static
+void sha_256_root_init(sha_256_t *ctx, size_t size, size_t leafsize)
+{
+    byte_t head[1+8+8];
+    uint64_t size_be     = endian_local_to_be_64(size);
+    uint64_t leafsize_be = endian_local_to_be_64(leafsize);
+
+    head[0] = PREFIX_ROOT;
+    memcpy(head + 1, &size_be    , 8);
+    memcpy(head + 9, &leafsize_be, 8);
+
+    sha_256_init(ctx);
+    sha_256_update(ctx, head, sizeof(head));
+}
+//------------------------------------------------------------------------------
+static
+void job_process(job_t *job)
+{
+    size_t index;
+    while( ( index = atomic_fetch_add(&job->next, 1) ) < job->count )
+    {
+        size_t offset = index * job->leafsize;
+        size_t remain = job->size - offset;
+
+        sha_256_leaf(job->digests + index * SHA_256_SIZE,
+                     job->src + offset,
+                     remain < job->leafsize ? remain : job->leafsize);
+    }
+}
+//------------------------------------------------------------------------------
+static
+int job_worker(job_t *job)
+{
+    job_process(job);
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+void sha_256_tree_serial(void *dest, const byte_t *src, size_t size, size_t leafsize, size_t count)
+{
+    sha_256_t ctx;
+    sha_256_root_init(&ctx, size, leafsize);
+
+    for(size_t i=0; i<count; ++i)
+    {
+        byte_t digest[SHA_256_SIZE];
+        size_t remain = size - i * leafsize;
+
+        sha_256_leaf(digest, src + i * leafsize, remain < leafsize ? remain : leafsize);
+        sha_256_update(&ctx, digest, SHA_256_SIZE);
+    }
+
+    sha_256_final(&ctx, dest);
+}
+//------------------------------------------------------------------------------
+void sha_256_tree(void       *dest,
+                  const void *src,
+                  size_t      size,
+                  size_t      leafsize,
+                  unsigned    threads)
+{
+    /**
+     * Calculate the tree mode SHA-256 digest.
+     *
+     * @param dest     A buffer to receive the result, and its size must be 32 bytes at least.
+     * @param src      Data to calculate.
+     * @param size     Size of input data.
+     * @param leafsize Size of each leaf, and ::HASH_TREE_LEAFSIZE_DEFAULT will be used if it is ZERO.
+     * @param threads  Maximum number of threads to use (include the caller),
+     *                 and it will be the number of processors if it is ZERO.
+     *
+     * @remarks Each leaf digest is SHA-256(0x00 || leaf),
+     *          and the root digest is SHA-256(0x01 || size || leafsize || leaf digests),
+     *          where size and leafsize are 64 bits big-endian integers.
+     *          The result is independent of the number of threads.
+     */
+    if( !leafsize ) leafsize = HASH_TREE_LEAFSIZE_DEFAULT;
+    if( !threads  ) threads  = cpufeat_get_cpu_count();
+    if( threads > THREADS_MAX ) threads = THREADS_MAX;
+
+    size_t count = size ? ( size - 1 ) / leafsize + 1 : 1;
+    if( threads > count ) threads = count;
+
+    job_t job =
+    {
+        .src      = src,
+        .size     = size,
+        .leafsize = leafsize,
+        .count    = count,
+        .digests  = threads > 1 ? malloc(count * SHA_256_SIZE) : NULL,
+    };
+
+    if( !job.digests )
+    {
+        sha_256_tree_serial(dest, src, size, leafsize, count);
+        return;
+    }
+
+    atomic_init(&job.next, 0);
+
+    thrd_t   workers[THREADS_MAX];
+    unsigned started = 0;
+    for(unsigned i=1; i<threads; ++i)
+    {
+        if( thrd_success != thrd_create(&workers[started], (thrd_start_t) job_worker, &job) ) break;
+        ++started;
+    }
+
+    // The caller thread works too, and will finish all leaves alone if no worker be started.
+    job_process(&job);
+
+    for(unsigned i=0; i<started; ++i)
+        thrd_join(workers[i], NULL);
+
+    sha_256_t ctx;
+    sha_256_root_init(&ctx, size, leafsize);
+    sha_256_update(&ctx, job.digests, count * SHA_256_SIZE);
+    sha_256_final(&ctx, dest);
+
+    free(job.digests);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,39 @@
+/**
+ * @file
+ * @brief     Tree mode hashing.
+ * @details   Split a large input into fixed size leaves,
+ *            hash all leaves in parallel by worker threads,
+ *            and then combine the leaf digests into a root digest.
+ *
+ * @remarks   The tree digest is a different digest from the plain digest of the same algorithm,
+ *            and they cannot be compared with each other.
+ *            The leaf size is a part of the digest definition,
+ *            so both sides need to use the same leaf size to get the same result.
+ *
+ * @author    王文佑
+ * @date      2026.10.17
+ * @copyright ZLib Licence
+ * @see       http://www.openfoundry.org/of/projects/2419
+ */
+#ifndef _GEN_HASH_TREE_H_
+#define _GEN_HASH_TREE_H_
+
+#include "../type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HASH_TREE_LEAFSIZE_DEFAULT ( 1UL << 20 )  ///< Default leaf size.
+
+void sha_256_tree(void       *dest,
+                  const void *src,
+                  size_t      size,
+                  size_t      leafsize,
+                  unsigned    threads);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
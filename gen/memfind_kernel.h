@@ -0,0 +1,98 @@
+/*
+ * PRIVATE USAGE
+ *
+ * Memory search kernels template.
+ *
+ * This file will be included by the memory object module with the filter macros
+ * defined for a specific instruction set, to generate kernels that test
+ * a block of positions at once by the first and the last byte of the pattern,
+ * and verify the candidates by comparing the whole pattern.
+ *
+ * Macros need to be defined before include :
+ *   LANES            Number of positions tested in a block.
+ *   KERNEL(name)     Decorate the kernel name.
+ *   KERNEL_TARGET    Instruction set decoration of the kernels.
+ *   FILTER_INIT(f,l) Declare the filter constants of the first byte @a f and the last byte @a l.
+ *   FILTER(p,q)      Return the candidates mask of the block, bit k set for position k, where
+ *                    @a p points to the first bytes and @a q points to the last bytes.
+ *                    A mask can have false candidates but must not miss any one.
+ */
+
+//------------------------------------------------------------------------------
+KERNEL_TARGET
+static const byte_t* KERNEL(find_forward)(const byte_t *src,
+                                          size_t        srcsz,
+                                          const byte_t *pat,
+                                          size_t        patsz,
+                                          size_t       *pos,
+                                          size_t       *work)
+{
+    /*
+     * Search from position @a pos to the last block fitting in the data,
+     * and stop early if the verification work exceeds the budget.
+     * @a pos and @a work will be updated to the state that the search stopped at.
+     */
+    const size_t last = patsz - 1;
+    size_t       i    = *pos;
+    FILTER_INIT(pat[0], pat[last]);
+
+    for(; i + LANES + last <= srcsz && *work <= MEMFIND_BUDGET(i); i += LANES)
+    {
+        uint32_t mask = FILTER(src + i, src + i + last);
+        while( mask )
+        {
+            size_t k = i + bits_count_trailing_zeros_32(mask);
+            if( memfind_verify(src + k, pat, patsz) )
+            {
+                *pos = k;
+                return src + k;
+            }
+
+            *work += patsz;
+            mask  &= mask - 1;
+        }
+    }
+
+    *pos = i;
+    return NULL;
+}
+//------------------------------------------------------------------------------
+KERNEL_TARGET
+static const byte_t* KERNEL(find_backward)(const byte_t *src,
+                                           size_t        srcsz,
+                                           const byte_t *pat,
+                                           size_t        patsz,
+                                           size_t       *end,
+                                           size_t       *work)
+{
+    /*
+     * Search backward from the position before @a end to the first block,
+     * and stop early if the verification work exceeds the budget.
+     * @a end and @a work will be updated to the state that the search stopped at.
+     */
+    const size_t last = patsz - 1;
+    size_t       i    = *end;
+    FILTER_INIT(pat[0], pat[last]);
+
+    for(; i >= LANES && *work <= MEMFIND_BUDGET(srcsz - i); i -= LANES)
+    {
+        uint32_t mask = FILTER(src + i - LANES, src + i - LANES + last);
+        while( mask )
+        {
+            int    bit = 31 - bits_count_leading_zeros_32(mask);
+            size_t k   = i - LANES + bit;
+            if( memfind_verify(src + k, pat, patsz) )
+            {
+                *end = k;
+                return src + k;
+            }
+
+            *work += patsz;
+            mask  ^= (uint32_t)1 << bit;
+        }
+    }
+
+    *end = i;
+    return NULL;
+}
+//------------------------------------------------------------------------------
@@ -11,12 +11,224 @@
 #include "utf.h"
 #endif
 
+#include "bits.h"
+#include "cpufeat.h"
+#include "endian.h"
 #include "minmax.h"
 #include "memobj.h"
 
+#ifdef CPUFEAT_X86
+#include <immintrin.h>
+#endif
+
 //------------------------------------------------------------------------------
 //---- Tools -------------------------------------------------------------------
 //------------------------------------------------------------------------------
+
+/*
+ * Memory search
+ *
+ * The data are tested by the first and the last byte of the pattern in blocks of positions,
+ * with the AVX2, SSE2 or 64-bits word kernels, and the candidates are verified by memcmp.
+ * Data full of the pattern bytes will make too many candidates,
+ * then the search turns to the Two-Way algorithm when the verification work
+ * exceeds the budget, to keep the time linear to the data size.
+ */
+
+// The verification work (in bytes) allowed after @a n positions searched.
+#define MEMFIND_BUDGET(n) ( 2 * (n) + 1024 )
+
+//------------------------------------------------------------------------------
+INLINE bool memfind_verify(const byte_t *dat, const byte_t *pat, size_t patsz)
+{
+    return dat[0] == pat[0] &&
+           dat[patsz-1] == pat[patsz-1] &&
+           ( patsz <= 2 || 0 == memcmp(dat + 1, pat + 1, patsz - 2) );
+}
+//------------------------------------------------------------------------------
+INLINE uint64_t memfind_load64(const byte_t *p)
+{
+    uint64_t val;
+    memcpy(&val, p, sizeof(val));
+    return endian_le_to_local_64(val);
+}
+//------------------------------------------------------------------------------
+INLINE uint32_t memfind_filter64(uint64_t diff)
+{
+    /*
+     * Get the mask of zero bytes of a word (in little-endian order),
+     * the bytes above a zero byte may be marked falsely, that is allowed for a filter.
+     */
+    uint64_t zero = ( diff - 0x0101010101010101 ) & ~diff & 0x8080808080808080;
+    return ( ( zero >> 7 ) * 0x0102040810204080 ) >> 56;  // Gather the highest bit of each byte
+}
+//------------------------------------------------------------------------------
+
+// 64-bits word kernels, 8 positions.
+#define LANES            8
+#define KERNEL(name)     name##_x8w
+#define KERNEL_TARGET
+#define FILTER_INIT(f,l) const uint64_t first = UINT64_C(0x0101010101010101) * (uint8_t)(f), \
+                                        final = UINT64_C(0x0101010101010101) * (uint8_t)(l)
+#define FILTER(p,q)      memfind_filter64( ( memfind_load64(p) ^ first ) | ( memfind_load64(q) ^ final ) )
+#include "memfind_kernel.h"
+#undef LANES
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef FILTER_INIT
+#undef FILTER
+
+#ifdef CPUFEAT_X86
+
+// SSE2 kernels, 16 positions.
+#define LANES            16
+#define KERNEL(name)     name##_x16
+#define KERNEL_TARGET    CPUFEAT_TARGET("sse2")
+#define FILTER_INIT(f,l) const __m128i first = _mm_set1_epi8((char)(f)), \
+                                       final = _mm_set1_epi8((char)(l))
+#define FILTER(p,q)      (uint32_t) _mm_movemask_epi8( \
+                             _mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p)), first), \
+                                           _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(q)), final)) )
+#include "memfind_kernel.h"
+#undef LANES
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef FILTER_INIT
+#undef FILTER
+
+// AVX2 kernels, 32 positions.
+#define LANES            32
+#define KERNEL(name)     name##_x32
+#define KERNEL_TARGET    CPUFEAT_TARGET("avx2")
+#define FILTER_INIT(f,l) const __m256i first = _mm256_set1_epi8((char)(f)), \
+                                       final = _mm256_set1_epi8((char)(l))
+#define FILTER(p,q)      (uint32_t) _mm256_movemask_epi8( \
+                             _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p)), first), \
+                                              _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(q)), final)) )
+#include "memfind_kernel.h"
+#undef LANES
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef FILTER_INIT
+#undef FILTER
+
+#endif  // CPUFEAT_X86
+
+/*
+ * The Two-Way algorithm works on views of the data and the pattern,
+ * so that the backward search is the same as the forward search on the reversed view.
+ */
+typedef struct memfind_view_t
+{
+    const byte_t *base;
+    ptrdiff_t     step;  // 1 for the forward view, and -1 for the reversed view.
+} memfind_view_t;
+
+#define VIEW_AT(view, i) ( (view).base[ (ptrdiff_t)(i) * (view).step ] )
+
+//------------------------------------------------------------------------------
+INLINE ptrdiff_t twoway_maxsuf(memfind_view_t pat, ptrdiff_t patsz, bool reversed, ptrdiff_t *period)
+{
+    /*
+     * Find the maximal suffix of the pattern and its period,
+     * in the normal alphabet order, or in the reversed order.
+     */
+    ptrdiff_t ms = -1, j = 0, k = 1, p = 1;
+
+    while( j + k < patsz )
+    {
+        byte_t a = VIEW_AT(pat, j + k);
+        byte_t b = VIEW_AT(pat, ms + k);
+
+        if( reversed ? a > b : a < b )
+        {
+            j += k;
+            k  = 1;
+            p  = j - ms;
+        }
+        else if( a == b )
+        {
+            if( k != p )
+            {
+                ++k;
+            }
+            else
+            {
+                j += p;
+                k  = 1;
+            }
+        }
+        else
+        {
+            ms = j;
+            j  = ms + 1;
+            k  = p = 1;
+        }
+    }
+
+    *period = p;
+    return ms;
+}
+//------------------------------------------------------------------------------
+INLINE ptrdiff_t twoway_search(memfind_view_t src, ptrdiff_t srcsz, memfind_view_t pat, ptrdiff_t patsz)
+{
+    /*
+     * Search the first position of the pattern by the Two-Way algorithm.
+     * Returns -1 if not found.
+     */
+    ptrdiff_t per1, per2;
+    ptrdiff_t ms1 = twoway_maxsuf(pat, patsz, false, &per1);
+    ptrdiff_t ms2 = twoway_maxsuf(pat, patsz, true , &per2);
+    ptrdiff_t ell = ms1 > ms2 ? ms1 : ms2;
+    ptrdiff_t per = ms1 > ms2 ? per1 : per2;
+    ptrdiff_t i, j;
+
+    bool periodic = true;
+    for(i=0; i<=ell && periodic; ++i)
+        periodic = VIEW_AT(pat, i) == VIEW_AT(pat, i + per);
+
+    if( periodic )
+    {
+        ptrdiff_t memory = -1;
+        for(j=0; j<=srcsz-patsz; )
+        {
+            for(i=MAX(ell, memory)+1; i<patsz && VIEW_AT(pat, i) == VIEW_AT(src, i + j); ++i){}
+            if( i < patsz )
+            {
+                j     += i - ell;
+                memory = -1;
+                continue;
+            }
+
+            for(i=ell; i>memory && VIEW_AT(pat, i) == VIEW_AT(src, i + j); --i){}
+            if( i <= memory ) return j;
+
+            j     += per;
+            memory = patsz - per - 1;
+        }
+    }
+    else
+    {
+        per = MAX(ell + 1, patsz - ell - 1) + 1;
+        for(j=0; j<=srcsz-patsz; )
+        {
+            for(i=ell+1; i<patsz && VIEW_AT(pat, i) == VIEW_AT(src, i + j); ++i){}
+            if( i < patsz )
+            {
+                j += i - ell;
+                continue;
+            }
+
+            for(i=ell; i>=0 && VIEW_AT(pat, i) == VIEW_AT(src, i + j); --i){}
+            if( i < 0 ) return j;
+
+            j += per;
+        }
+    }
+
+    return -1;
+}
+//------------------------------------------------------------------------------
 void* memfind(const void* src, size_t srcsz, const void* pattern, size_t patsz)
 {
     /**
@@ -26,21 +238,45 @@ void* memfind(const void* src, size_t srcsz, const void* pattern, size_t patsz)
      * @param pattern 搜尋目標。
      * @param patsz   搜尋目標大小。
      * @return 返回第一個搜尋到資料吻合的資料指標；若搜尋失敗則反回 NULL。
+     *
+     * @remarks 搜尋目標大小為零時將視為搜尋失敗。
      */
-    byte_t *dat;
-    size_t  sizepass;
+    const byte_t *dat  = src;
+    const byte_t *pat  = pattern;
+    const byte_t *res;
+    size_t        pos  = 0;
+    size_t        work = 0;
+
+    if( !src || !pattern || !patsz || patsz > srcsz ) return NULL;
+    if( patsz == 1 ) return memchr(src, pat[0], srcsz);
 
-    while( true )
+#ifdef CPUFEAT_X86
+    if( cpufeat_has(CPUFEAT_AVX2) )
     {
-        dat = memchr(src, *(byte_t*)pattern, srcsz);
-        if( !dat ) break;
-        sizepass = (size_t)dat - (size_t)src + 1;
-        if( sizepass > srcsz ) break;
+        if(( res = find_forward_x32(dat, srcsz, pat, patsz, &pos, &work) )) return (void*) res;
+    }
+    else if( cpufeat_has(CPUFEAT_SSE2) )
+    {
+        if(( res = find_forward_x16(dat, srcsz, pat, patsz, &pos, &work) )) return (void*) res;
+    }
+#endif
+    if(( res = find_forward_x8w(dat, srcsz, pat, patsz, &pos, &work) )) return (void*) res;
+
+    // The remainder positions less than a block
 
-        if( 0 == memcmp(dat, pattern, patsz) ) return dat;
+    for(; pos + patsz <= srcsz && work <= MEMFIND_BUDGET(pos); ++pos, work += patsz)
+    {
+        if( memfind_verify(dat + pos, pat, patsz) ) return (void*)( dat + pos );
+    }
 
-        src    = (byte_t*)src + sizepass;
-        srcsz -= sizepass;
+    // Turn to the Two-Way algorithm if the budget is run out
+
+    if( pos + patsz <= srcsz )
+    {
+        memfind_view_t datview = { dat + pos, 1 };
+        memfind_view_t patview = { pat, 1 };
+        ptrdiff_t      off     = twoway_search(datview, srcsz - pos, patview, patsz);
+        if( off >= 0 ) return (void*)( dat + pos + off );
     }
 
     return NULL;
@@ -55,14 +291,46 @@ void* memrfind(const void* src, size_t srcsz, const void* pattern, size_t patsz)
      * @param pattern 搜尋目標。
      * @param patsz   搜尋目標大小。
      * @return 返回第一個搜尋到資料吻合的資料指標；若搜尋失敗則反回 NULL。
+     *
+     * @remarks 搜尋目標大小為零時將視為搜尋失敗。
      */
-    byte_t *dat = (byte_t*)src + srcsz - patsz;
+    const byte_t *dat  = src;
+    const byte_t *pat  = pattern;
+    const byte_t *res;
+    size_t        end;
+    size_t        work = 0;
+
+    if( !src || !pattern || !patsz || patsz > srcsz ) return NULL;
+    end = srcsz - patsz + 1;  // One past the last position
 
-    while( true )
+#ifdef CPUFEAT_X86
+    if( cpufeat_has(CPUFEAT_AVX2) )
+    {
+        if(( res = find_backward_x32(dat, srcsz, pat, patsz, &end, &work) )) return (void*) res;
+    }
+    else if( cpufeat_has(CPUFEAT_SSE2) )
     {
-        if(( *dat == *(byte_t*)pattern )&&( 0 == memcmp(dat, pattern, patsz) )) return dat;
-        if( dat == src ) break;
-        --dat;
+        if(( res = find_backward_x16(dat, srcsz, pat, patsz, &end, &work) )) return (void*) res;
+    }
+#endif
+    if(( res = find_backward_x8w(dat, srcsz, pat, patsz, &end, &work) )) return (void*) res;
+
+    // The remainder positions less than a block
+
+    for(; end && work <= MEMFIND_BUDGET(srcsz - end); --end, work += patsz)
+    {
+        if( memfind_verify(dat + end - 1, pat, patsz) ) return (void*)( dat + end - 1 );
+    }
+
+    // Turn to the Two-Way algorithm on the reversed view if the budget is run out
+
+    if( end )
+    {
+        size_t         size    = end - 1 + patsz;  // Data size covering the remainder positions
+        memfind_view_t datview = { dat + size - 1, -1 };
+        memfind_view_t patview = { pat + patsz - 1, -1 };
+        ptrdiff_t      off     = twoway_search(datview, size, patview, patsz);
+        if( off >= 0 ) return (void*)( dat + size - patsz - off );
     }
 
     return NULL;
@@ -306,6 +574,35 @@ void abort_if_alloc_fail(const void *buf)
     }
 }
 //------------------------------------------------------------------------------
+static
+byte_t* buf_allocate(arena_t *arena, size_t size)
+{
+    return ( arena )?( arena_allocate(arena, size) ):( malloc(size) );
+}
+//------------------------------------------------------------------------------
+static
+void buf_free(arena_t *arena, byte_t *buf)
+{
+    if( arena )
+        arena_deallocate(arena, buf);
+    else
+        free(buf);
+}
+//------------------------------------------------------------------------------
+static
+void mem_init_buf(mem_t* RESTRICT self, size_t size, arena_t* RESTRICT arena)
+{
+    assert( self );
+
+    self->size_total = memobj_calc_recommended_size(size);
+    self->size       = size;
+    self->arena      = arena;
+    assert( self->size_total >= self->size );
+
+    self->buf = buf_allocate(arena, self->size_total);
+    abort_if_alloc_fail(self->buf);
+}
+//------------------------------------------------------------------------------
 void mem_init(mem_t* RESTRICT self, size_t size)
 {
     /**
@@ -316,14 +613,7 @@ void mem_init(mem_t* RESTRICT self, size_t size)
      * @param self Object instance.
      * @param size The initial buffer size.
      */
-    assert( self );
-
-    self->size_total = memobj_calc_recommended_size(size);
-    self->size       = size;
-    assert( self->size_total >= self->size );
-
-    self->buf = malloc(self->size_total);
-    abort_if_alloc_fail(self->buf);
+    mem_init_buf(self, size, NULL);
 }
 //------------------------------------------------------------------------------
 void mem_init_import(mem_t* RESTRICT self, const void* RESTRICT buffer, size_t size)
@@ -373,7 +663,27 @@ void mem_init_move(mem_t* RESTRICT self, mem_t* RESTRICT src)
     assert( self && src );
 
     *self = *src;
-    mem_init(src, 0);
+    mem_init_buf(src, 0, src->arena);
+}
+//------------------------------------------------------------------------------
+void mem_init_arena(mem_t* RESTRICT self, size_t size, arena_t* RESTRICT arena)
+{
+    /**
+     * @memberof mem_t
+     * @brief Constructor.
+     * @details Initialize object with an initial buffer size, and the buffer is allocated from an arena.
+     *
+     * @param self  Object instance.
+     * @param size  The initial buffer size.
+     * @param arena The arena to allocate buffer from.
+     *
+     * @remarks The buffer goes with the arena when the arena rewound or reset,
+     *          and the object must not be used after that.
+     *          Calling ::mem_deinit is still recommended,
+     *          it gives back the buffer if it is the last one allocated from the arena.
+     */
+    assert( arena );
+    mem_init_buf(self, size, arena);
 }
 //------------------------------------------------------------------------------
 void mem_deinit(mem_t* RESTRICT self)
@@ -383,7 +693,7 @@ void mem_deinit(mem_t* RESTRICT self)
      * @brief Destructor.
      */
     assert( self );
-    free(self->buf);
+    buf_free(self->arena, self->buf);
 }
 //------------------------------------------------------------------------------
 mem_t* mem_create(size_t size)
@@ -401,6 +711,7 @@ mem_t* mem_create(size_t size)
 
     obj->size_total = memobj_calc_recommended_size(size);
     obj->size       = size;
+    obj->arena      = NULL;
     assert( obj->size_total >= obj->size );
 
     obj->buf = malloc(obj->size_total);
@@ -470,7 +781,7 @@ mem_t* mem_create_move(mem_t* RESTRICT src)
     if( !obj ) return NULL;
 
     size_t bufsize = memobj_calc_recommended_size(0);
-    byte_t *buf = malloc(bufsize);
+    byte_t *buf = buf_allocate(src->arena, bufsize);
     if( !buf )
     {
         free(obj);
@@ -573,7 +884,9 @@ bool mem_resize(mem_t* RESTRICT self, size_t size)
         newsize = memobj_calc_recommended_size(size);
         if( newsize < MEMOJB_BLOCKSZ_LARGE ) newsize <<= 1;
 
-        newbuf = realloc(self->buf, newsize);
+        newbuf = ( self->arena )?
+                 ( arena_reallocate(self->arena, self->buf, self->size_total, newsize) ):
+                 ( realloc(self->buf, newsize) );
         if( !newbuf ) return false;
 
         self->size_total = newsize;
@@ -638,14 +951,15 @@ void mem_move_from(mem_t* RESTRICT self, mem_t* RESTRICT src)
      */
     if( !self || !src ) return;
 
-    free(self->buf);
+    buf_free(self->arena, self->buf);
 
     self->size_total = src->size_total;
     self->size       = src->size;
     self->buf        = src->buf;
+    self->arena      = src->arena;
     src->size_total  = memobj_calc_recommended_size(0);
     src->size        = 0;
-    src->buf         = malloc(src->size_total);
+    src->buf         = buf_allocate(src->arena, src->size_total);
     assert( src->buf );
 }
 //------------------------------------------------------------------------------
@@ -18,6 +18,7 @@
 #include "type.h"
 #include "inline.h"
 #include "restrict.h"
+#include "arena.h"
 
 //----------------------------------------
 //---- Global Setting and Tools ----------
@@ -91,12 +92,18 @@ typedef struct mem_t
 
     byte_t *buf;         ///< 資料緩衝區。
 
+    // Private
+
+    arena_t *arena;      // 配置緩衝區所使用的 arena，NULL 表示使用 malloc。
+                         // 這個數值由本類別所私有使用，一般使用者請勿使用及變更此變數。
+
 } mem_t;
 
 void   mem_init       (mem_t* RESTRICT self, size_t size MEMOJB_ARG_DEFAULT(0));
 void   mem_init_import(mem_t* RESTRICT self, const void* RESTRICT buffer, size_t size);
 void   mem_init_clone (mem_t* RESTRICT self, const mem_t* RESTRICT src);
 void   mem_init_move  (mem_t* RESTRICT self, mem_t* RESTRICT src);
+void   mem_init_arena (mem_t* RESTRICT self, size_t size, arena_t* RESTRICT arena);
 void   mem_deinit     (mem_t* RESTRICT self);
 
 mem_t* mem_create          (size_t size MEMOJB_ARG_DEFAULT(0));
@@ -143,6 +150,7 @@ public:
 #if __cplusplus >= 201103L
     TMem(TMem &&Src)                        { mem_init_move  (this, &Src); }            ///< @see mem_t::mem_init_move
 #endif
+    TMem(arena_t *Arena, size_t Size=0)     { mem_init_arena (this, Size, Arena); }     ///< @see mem_t::mem_init_arena
     ~TMem()                                 {      mem_deinit(this); }                  ///< @see mem_t::mem_deinit
 
     TMem& operator=(const TMem &Src)        { if( !mem_import(this, Src.buf, Src.size) ) throw std::bad_alloc(); return *this; }
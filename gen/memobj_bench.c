@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "cpufeat.h"
+#include "memobj.h"
+#include "systime.h"
+
+#define BENCH_DATA_SIZE ( 1024 * 1024 )
+#define BENCH_DURATION  500 // Milliseconds.
+
+typedef void*(*bench_func_t)(const void *src, size_t srcsz, const void *pattern, size_t patsz);
+
+//------------------------------------------------------------------------------
+void* bench_memfind_simple(const void *src, size_t srcsz, const void *pattern, size_t patsz)
+{
+    // The simple search by memchr on the first byte and memcmp.
+    const byte_t *dat = src;
+    const byte_t *end = dat + srcsz - patsz + 1;
+
+    while( dat < end && ( dat = memchr(dat, *(const byte_t*)pattern, end - dat) ) )
+    {
+        if( 0 == memcmp(dat, pattern, patsz) ) return (void*) dat;
+        ++dat;
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+void* bench_memrfind_simple(const void *src, size_t srcsz, const void *pattern, size_t patsz)
+{
+    // The simple backward search byte by byte.
+    const byte_t *dat = (const byte_t*) src + srcsz - patsz;
+
+    while( true )
+    {
+        if( *dat == *(const byte_t*)pattern && 0 == memcmp(dat, pattern, patsz) ) return (void*) dat;
+        if( dat == src ) break;
+        --dat;
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+double bench_throughput(bench_func_t func, const byte_t *data, const byte_t *pattern, size_t patsz)
+{
+    // Run the function repeatedly in a period of time, and return the throughput in MB/s.
+    unsigned rounds = 0;
+
+    volatile const void *res = func(data, BENCH_DATA_SIZE, pattern, patsz);  // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        res = func(data, BENCH_DATA_SIZE, pattern, patsz);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+    (void) res;
+
+    return (double) BENCH_DATA_SIZE * rounds / ( 1024 * 1024 ) / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_print(const char   *name,
+                 bench_func_t  func_simple,
+                 bench_func_t  func,
+                 const byte_t *data,
+                 const char   *pattern)
+{
+    size_t patsz = strlen(pattern);
+
+    double speed_simple = bench_throughput(func_simple, data, (const byte_t*) pattern, patsz);
+
+    cpufeat_set_mask(0);
+    double speed_base = bench_throughput(func, data, (const byte_t*) pattern, patsz);
+
+    cpufeat_set_mask(CPUFEAT_ALL);
+    double speed_fast = bench_throughput(func, data, (const byte_t*) pattern, patsz);
+
+    printf("%-28s simple: %8.1f MB/s, portable: %8.1f MB/s (x%.2f), accelerated: %8.1f MB/s (x%.2f)\n",
+           name,
+           speed_simple,
+           speed_base,
+           speed_base / speed_simple,
+           speed_fast,
+           speed_fast / speed_simple);
+}
+//------------------------------------------------------------------------------
+int main(void)
+{
+    static const char words[] = "GET /index.html HTTP/1.1\r\nHost: example.com\r\nAccept: */*\r\n";
+
+    byte_t *text = malloc(BENCH_DATA_SIZE);
+    byte_t *same = malloc(BENCH_DATA_SIZE);
+    if( !text || !same ) return 1;
+
+    // Typical data : protocol headers, the patterns are not found
+    for(size_t i=0; i<BENCH_DATA_SIZE; ++i)
+        text[i] = words[ i % ( sizeof(words) - 1 ) ];
+
+    // Adversarial data : a single repeated byte, and the patterns match except one byte in the middle
+    memset(same, 'a', BENCH_DATA_SIZE);
+
+    printf("CPU features : 0x%X\n", cpufeat_get_flags());
+    printf("Data size    : %u bytes\n", BENCH_DATA_SIZE);
+
+    bench_print("memfind, 4 bytes"          , bench_memfind_simple , memfind , text, "\r\n\r\n");
+    bench_print("memfind, 16 bytes"         , bench_memfind_simple , memfind , text, "Host: example.cn");
+    bench_print("memfind, 64 bytes"         , bench_memfind_simple , memfind , text,
+                "GET /index.html HTTP/1.1\r\nHost: example.com\r\nAccept: text/html\r\n");
+    bench_print("memrfind, 4 bytes"         , bench_memrfind_simple, memrfind, text, "\r\n\r\n");
+    bench_print("memrfind, 16 bytes"        , bench_memrfind_simple, memrfind, text, "Host: example.cn");
+    bench_print("memfind, adversarial 16"   , bench_memfind_simple , memfind , same, "aaaaaaaabaaaaaaa");
+    bench_print("memfind, adversarial 256"  , bench_memfind_simple , memfind , same,
+                "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+                "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+                "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"
+                "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+    bench_print("memrfind, adversarial 16"  , bench_memrfind_simple, memrfind, same, "aaaaaaaabaaaaaaa");
+
+    free(text);
+    free(same);
+    return 0;
+}
+//------------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 #pragma hdrstop
 #endif
 
+#include "cpufeat.h"
 #include "memobj.h"
 
 #ifdef NDEBUG
@@ -33,6 +34,61 @@ void test_global_tools(void)
         assert( NULL == (byte_t*) memrfind(sample, sizeof(sample), "\x03\x08\x09\x02", 4) );
     }
 
+    // Data search on each position of blocks, and the data full of the pattern bytes
+    {
+        static const unsigned masks[] = { CPUFEAT_ALL, CPUFEAT_SSE2, 0 };
+
+        byte_t data[4096];
+        byte_t pattern[300];
+
+        for(unsigned m=0; m<sizeof(masks)/sizeof(masks[0]); ++m)
+        {
+            cpufeat_set_mask(masks[m]);
+
+            for(size_t patsz=1; patsz<=sizeof(pattern); patsz+=patsz<8?1:37)
+            {
+                memset(data, 'a', sizeof(data));
+                memset(pattern, 'a', patsz);
+                pattern[patsz/2] = 'b';
+
+                assert( NULL == memfind (data, sizeof(data), pattern, patsz) );
+                assert( NULL == memrfind(data, sizeof(data), pattern, patsz) );
+
+                for(size_t pos=0; pos<80; ++pos)
+                {
+                    data[pos+patsz/2] = 'b';
+                    assert( data + pos == memfind(data, sizeof(data), pattern, patsz) );
+                    data[pos+patsz/2] = 'a';
+
+                    size_t posr = sizeof(data) - patsz - pos;
+                    data[posr+patsz/2] = 'b';
+                    assert( data + posr == memrfind(data, sizeof(data), pattern, patsz) );
+                    data[posr+patsz/2] = 'a';
+                }
+
+                data[patsz/2]                    = 'b';
+                data[sizeof(data)/2]             = 'b';
+                data[sizeof(data)-patsz+patsz/2] = 'b';
+                assert( 3 == memfindcount(data, sizeof(data), pattern, patsz) );
+            }
+
+            // Bytes with the highest bit set
+            memset(data, 0xFF, sizeof(data));
+            memcpy(data + 1000, "\x80\xFF\xFF\xFE", 4);
+            assert( data + 1000 == memfind (data, sizeof(data), "\x80\xFF\xFF\xFE", 4) );
+            assert( data + 1000 == memrfind(data, sizeof(data), "\x80\xFF\xFF\xFE", 4) );
+        }
+
+        cpufeat_set_mask(CPUFEAT_ALL);
+
+        assert( NULL == memfind (data, sizeof(data), pattern, 0) );
+        assert( NULL == memrfind(data, sizeof(data), pattern, 0) );
+        assert( NULL == memfind (data, 2, data, 3) );
+        assert( NULL == memrfind(data, 2, data, 3) );
+        assert( data == memfind (data, 3, data, 3) );
+        assert( data == memrfind(data, 3, data, 3) );
+    }
+
     // Data search count and replace;
     {
         const byte_t src[] =
@@ -316,6 +372,53 @@ void test_memory_object(void)
 
         remove(filename);
     }
+
+    // Buffers allocated from an arena
+    {
+        static const byte_t testdata[] = {1,3,5,7,9};
+        arena_t arena;
+        mem_t   mem1, mem2, mem3;
+
+        arena_init(&arena, 0);
+
+        // Grow and append
+        mem_init_arena(&mem1, 0, &arena);
+        mem_init_arena(&mem2, 0, &arena);
+        for(int i=0; i<1000; ++i)
+        {
+            assert( mem_append(&mem1, testdata, sizeof(testdata)) );
+            assert( mem_append(&mem2, testdata, sizeof(testdata)) );
+        }
+        assert( mem1.size == 1000 * sizeof(testdata) );
+        assert( 0 == mem_compare(&mem1, &mem2) );
+        for(int i=0; i<1000; ++i)
+            assert( 0 == memcmp(mem1.buf + i * sizeof(testdata), testdata, sizeof(testdata)) );
+
+        // Move between objects
+        mem_init_move(&mem3, &mem1);
+        assert( mem3.size == 1000 * sizeof(testdata) );
+        assert( mem1.size == 0 );
+        assert( mem_import(&mem1, testdata, sizeof(testdata)) );
+        mem_move_from(&mem2, &mem1);
+        assert( mem2.size == sizeof(testdata) );
+        assert( 0 == memcmp(mem2.buf, testdata, sizeof(testdata)) );
+
+        // Release by the destructors, or just by resetting the arena
+        mem_deinit(&mem1);
+        mem_deinit(&mem2);
+        mem_deinit(&mem3);
+        arena_reset(&arena);
+        assert( 0 == arena_get_used_size(&arena) );
+
+        {
+            TMem mem(&arena, sizeof(testdata));
+            memcpy(mem.Buf(), testdata, sizeof(testdata));
+            mem.Append(testdata, sizeof(testdata));
+            assert( mem.Size() == 2 * sizeof(testdata) );
+        }
+
+        arena_deinit(&arena);
+    }
 }
 
 void test_fixed_buffer_memory_object(void)
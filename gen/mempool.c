@@ -1,11 +1,14 @@
 #include <assert.h>
+#include <stdatomic.h>
 #include <string.h>
+#include <threads.h>
 
 #ifdef __BORLANDC__
 #pragma hdrstop
 #endif
 
 #include "type.h"
+#include "bits.h"
 #include "mempool.h"
 
 // Memory block node align size
@@ -15,29 +18,103 @@ static const size_t node_alignsz = 32;  // WARNING : This value must be the powe
 #pragma pack(push,8)
 typedef struct node_t
 {
-    uint64_t  size;         // Size of this node, include the user data buffer.
-                            // This value will be ZERO if this node is the last node of the list.
-    uint64_t  prev;         // Offset between the head of this node and the head of previous node.
-                            // This value will be ZERO if this node is the last node of the list.
-    bool8_t   inuse;        // The flag to mark if this node have been allocated
-                            // to the client user.
-    byte_t    reserved[7];
-    uint64_t  usersize;     // Size of the data buffer assigned by the user.
-    byte_t    userdata[];   // User data buffer.
+    uint64_t     size;         // Size of this node, include the user data buffer.
+                               // This value will be ZERO if this node is the last node of the list.
+    uint64_t     prev;         // Offset between the head of this node and the head of previous node.
+                               // This value will be ZERO if this node is the last node of the list.
+    bool8_t      inuse;        // The flag to mark if this node have been allocated
+                               // to the client user.
+    atomic_uchar cached;       // The flag to mark if this node is allocated but kept
+                               // in the cache of a thread, in the concurrent mode.
+                               // It is changed without the lock, and read under the lock.
+    byte_t       reserved[6];
+    uint64_t     usersize;     // Size of the data buffer assigned by the user.
+    byte_t       userdata[];   // User data buffer.
 } node_t, node_header_t;
 #pragma pack(pop)
 STATIC_ASSERT( sizeof(node_t) == 32 );
+STATIC_ASSERT( ATOMIC_CHAR_LOCK_FREE == 2 );  // The flag must be address free to be shared between processes.
+
+// Statistics counters, they are updated with the nodes and protected by the same lock
+#pragma pack(push,8)
+typedef struct counters_t
+{
+    uint64_t allocs;        // Number of allocations succeeded.
+    uint64_t frees;         // Number of deallocations.
+    uint64_t fails;         // Number of allocations failed.
+    uint64_t inuse;         // Size of the nodes in use, include the node headers.
+    uint64_t peak;          // The maximum value of inuse.
+    uint64_t searches[MEMPOOL_SEARCH_CLASSES];  // Number of searches of each length class.
+    byte_t   reserved[24];  // Reserved use, and needs to be zeros.
+} counters_t;
+#pragma pack(pop)
+STATIC_ASSERT( sizeof(counters_t) == 128 );
 
 // Memory pool header
 #pragma pack(push,8)
 typedef struct mempool_t
 {
-    uint64_t size;          // Total size of this pool.
-    byte_t   reserved[24];  // Reserved use, and needs to be zeros.
-    node_t   root[];        // The first node of this pool.
+    uint64_t    size;          // Total size of this pool.
+    uint64_t    tlsf;          // Offset of the TLSF control block,
+                               // or ZERO if this pool works in the first-fit mode.
+    atomic_uint lock;          // Spin lock of the concurrent mode.
+    uint32_t    concurrent;    // Non-zero if this pool works in the concurrent mode.
+    uint32_t    serial;        // Identify the pool in the concurrent mode, to discard the caches
+                               // of an old pool that a new pool may be initialized on the same address.
+    byte_t      reserved[4];   // Reserved use, and needs to be zeros.
+    counters_t  counters;      // Statistics counters.
+    node_t      root[];        // The first node of this pool.
 } mempool_t, mempool_header_t;
 #pragma pack(pop)
-STATIC_ASSERT( sizeof(mempool_t) == 32 );
+STATIC_ASSERT( sizeof(mempool_t) == 160 );  // WARNING : This value must be a multiple of the node alignment size.
+STATIC_ASSERT( ATOMIC_INT_LOCK_FREE == 2 );  // The lock must be address free to be shared between processes.
+
+// Two-level segregated fit (TLSF) parameters
+#define TLSF_SL_BITS   3                        // Number of bits to index the second level lists.
+#define TLSF_SL_COUNT  ( 1 << TLSF_SL_BITS )    // Number of second level lists of each first level.
+#define TLSF_FL_SHIFT  6                        // Power of two of the minimum node size.
+#define TLSF_FL_MAX    ( 64 - TLSF_FL_SHIFT )   // Maximum number of first levels.
+
+static const size_t tlsf_node_min = 1 << TLSF_FL_SHIFT;  // Minimum node size in the TLSF mode,
+                                                         // it have room for the free list links.
+
+// TLSF control block, placed behind the node list of the pool
+#pragma pack(push,8)
+typedef struct tlsf_t
+{
+    uint64_t flmap;                 // Bit k is set if any list of the first level k is not empty.
+    uint32_t flcount;               // Number of first levels of this pool.
+    uint32_t reserved;
+    uint8_t  slmap[TLSF_FL_MAX];    // Bit j of slmap[k] is set if the list (k,j) is not empty.
+    uint64_t heads[];               // Offset of the first free node of the list (k,j),
+                                    // at index k*TLSF_SL_COUNT+j; or ZERO if the list is empty.
+} tlsf_t;
+#pragma pack(pop)
+
+// Free list links, placed at the user data buffer of a free node in the TLSF mode
+typedef struct freelink_t
+{
+    uint64_t next;  // Offset of the next free node in the same list, or ZERO if none.
+    uint64_t prev;  // Offset of the previous free node in the same list, or ZERO if none.
+} freelink_t;
+STATIC_ASSERT( sizeof(node_t) + sizeof(freelink_t) <= 1 << TLSF_FL_SHIFT );
+
+// Per-thread caches of the concurrent mode
+#define MAG_CLASSES   8     // Number of node size classes, from 64 to 288 bytes in steps of the alignment.
+#define MAG_CAPACITY  16    // Number of nodes of each class a cache can hold.
+#define MAG_POOLS     4     // Number of pools that a thread can have caches at the same time.
+
+typedef struct magazine_t
+{
+    const mempool_t *pool;                              // The pool of the cached nodes, or NULL if not used.
+    uint32_t         serial;                            // Serial of the pool.
+    uint64_t         allocs, frees, fails;              // Counters not merged to the pool yet.
+    unsigned         count[MAG_CLASSES];                // Number of cached nodes of each class.
+    node_t          *nodes[MAG_CLASSES][MAG_CAPACITY];  // Cached nodes, they are marked in use of the pool.
+} magazine_t;
+
+static thread_local magazine_t magazines[MAG_POOLS];
+static atomic_uint             serial_next = 1;
 
 //------------------------------------------------------------------------------
 //---- Tools -------------------------------------------------------------------
@@ -71,6 +148,18 @@ node_t* node_get_next(node_t *node)
     return ( node->size )?( node ):( NULL );
 }
 //------------------------------------------------------------------------------
+INLINE
+bool node_is_cached(const node_t *node)
+{
+    return atomic_load_explicit(&((node_t*)node)->cached, memory_order_acquire);
+}
+//------------------------------------------------------------------------------
+INLINE
+void node_set_cached(node_t *node, bool cached)
+{
+    atomic_store_explicit(&node->cached, cached, memory_order_release);
+}
+//------------------------------------------------------------------------------
 static
 node_t* node_get_prev(node_t *node)
 {
@@ -134,6 +223,36 @@ void node_merge_next(node_t *node)
 }
 //------------------------------------------------------------------------------
 static
+node_t* node_move_forward(node_t *node_free, node_t *node_used)
+{
+    /*
+     * 將使用中的節點搬移到其前方相鄰的未使用節點的位置，並將未使用的空間移到其後方，
+     * 若後方的節點也未被使用則與其合併。
+     * @param node_free 傳入未使用的節點。
+     * @param node_used 傳入 node_free 的下一個節點，該節點必須是使用中的節點。
+     * @return 傳回搬移後的未使用節點。
+     */
+    uint64_t size_free  = node_free->size;
+    uint64_t prev_free  = node_free->prev;
+    node_t  *node_right = node_get_next(node_used);
+    node_t  *node_moved = node_free;
+    node_t  *node_rest;
+
+    memmove(node_moved, node_used, sizeof(node_t) + node_used->usersize);
+    node_moved->prev = prev_free;
+
+    node_rest = (node_t*)( (byte_t*)node_moved + node_moved->size );
+    memset(node_rest, 0, sizeof(node_t));
+    node_rest->size = size_free;
+    node_rest->prev = node_moved->size;
+
+    if( node_right ) node_right->prev = node_rest->size;
+    if( node_right && !node_right->inuse ) node_merge_next(node_rest);
+
+    return node_rest;
+}
+//------------------------------------------------------------------------------
+static
 node_t* nodelist_init(void* buffer, size_t size)
 {
     /*
@@ -164,13 +283,14 @@ node_t* nodelist_init(void* buffer, size_t size)
 }
 //------------------------------------------------------------------------------
 static
-node_t* nodelist_find_freespace(node_t *start, size_t _reqsz)
+node_t* nodelist_find_freespace(node_t *start, size_t _reqsz, unsigned *steps)
 {
     /*
      * 尋找串列中具有要求的緩衝空間大小，並且尚未被分配出去的節點。
      * @param start 傳入串列的起始結點，搜尋行為會從該結點開始。
      * @param reqsz 傳入要求的結點大小，函式會搜尋具有能夠滿足該空間需求的結點。
      *              注意這個數值指的是整個結點的大小，而不是結點緩衝空間的大小。
+     * @param steps 傳回搜尋過程中所檢查的節點數量。
      * @return 搜尋成功時傳回結點指標；失敗時傳回 NULL。
      */
     size_t  reqsz = calc_align_size(_reqsz);
@@ -178,8 +298,10 @@ node_t* nodelist_find_freespace(node_t *start, size_t _reqsz)
 
     assert( reqsz >= _reqsz );
 
+    *steps = 0;
     while( node )
     {
+        ++*steps;
         if( !node->inuse && node->size >= reqsz )
             break;
 
@@ -189,6 +311,485 @@ node_t* nodelist_find_freespace(node_t *start, size_t _reqsz)
     return node;
 }
 //------------------------------------------------------------------------------
+//---- Statistics --------------------------------------------------------------
+//------------------------------------------------------------------------------
+INLINE
+unsigned stats_class(uint64_t value, unsigned shift, unsigned count)
+{
+    /*
+     * 計算數值所屬的統計分類：分類 k 包含 [2^(k*shift), 2^((k+1)*shift)) 範圍內的數值，
+     * 零歸於第一個分類，超出範圍的數值歸於最後一個分類。
+     */
+    unsigned cls = ( value )?( ( 63 - bits_count_leading_zeros_64(value) ) / shift ):( 0 );
+    return ( cls < count )?( cls ):( count - 1 );
+}
+//------------------------------------------------------------------------------
+INLINE
+void stats_add_inuse(mempool_t *pool, uint64_t size)
+{
+    counters_t *counters = &pool->counters;
+
+    counters->inuse += size;
+    if( counters->peak < counters->inuse ) counters->peak = counters->inuse;
+}
+//------------------------------------------------------------------------------
+INLINE
+void stats_sub_inuse(mempool_t *pool, uint64_t size)
+{
+    assert( pool->counters.inuse >= size );
+    pool->counters.inuse -= size;
+}
+//------------------------------------------------------------------------------
+INLINE
+void stats_count_search(mempool_t *pool, unsigned steps)
+{
+    ++pool->counters.searches[ stats_class(steps, 2, MEMPOOL_SEARCH_CLASSES) ];
+}
+//------------------------------------------------------------------------------
+//---- Two-Level Segregated Fit ------------------------------------------------
+//------------------------------------------------------------------------------
+INLINE
+node_t* tlsf_node_at(const mempool_t *pool, uint64_t offset)
+{
+    return ( offset )?( (node_t*)( (byte_t*)pool + offset ) ):( NULL );
+}
+//------------------------------------------------------------------------------
+INLINE
+uint64_t tlsf_node_offset(const mempool_t *pool, const node_t *node)
+{
+    return (const byte_t*)node - (const byte_t*)pool;
+}
+//------------------------------------------------------------------------------
+INLINE
+tlsf_t* tlsf_get_control(const mempool_t *pool)
+{
+    return ( pool->tlsf )?( (tlsf_t*)( (byte_t*)pool + pool->tlsf ) ):( NULL );
+}
+//------------------------------------------------------------------------------
+INLINE
+void tlsf_mapping(uint64_t size, unsigned *fl, unsigned *sl)
+{
+    /*
+     * 計算節點大小所屬的串列索引：
+     * 第一層為大小的最高位元，第二層將該範圍再線性切分為 TLSF_SL_COUNT 等分。
+     */
+    int msb = 63 - bits_count_leading_zeros_64(size);
+
+    assert( size >= tlsf_node_min );
+
+    *fl = msb - TLSF_FL_SHIFT;
+    *sl = ( size >> ( msb - TLSF_SL_BITS ) ) & ( TLSF_SL_COUNT - 1 );
+}
+//------------------------------------------------------------------------------
+static
+void tlsf_insert(mempool_t *pool, tlsf_t *ctrl, node_t *node)
+{
+    /*
+     * 將一個未使用的節點放入其大小所屬串列的開頭。
+     */
+    uint64_t   offset = tlsf_node_offset(pool, node);
+    freelink_t *link  = (freelink_t*) node->userdata;
+    uint64_t   *head;
+    unsigned    fl, sl;
+
+    tlsf_mapping(node->size, &fl, &sl);
+    assert( fl < ctrl->flcount );
+    head = &ctrl->heads[ fl * TLSF_SL_COUNT + sl ];
+
+    link->next = *head;
+    link->prev = 0;
+    if( *head ) ((freelink_t*) tlsf_node_at(pool, *head)->userdata)->prev = offset;
+    *head = offset;
+
+    ctrl->flmap     |= (uint64_t)1 << fl;
+    ctrl->slmap[fl] |= 1 << sl;
+}
+//------------------------------------------------------------------------------
+static
+void tlsf_remove(mempool_t *pool, tlsf_t *ctrl, node_t *node)
+{
+    /*
+     * 將一個未使用的節點從其所屬的串列中移除。
+     */
+    freelink_t *link = (freelink_t*) node->userdata;
+    unsigned    fl, sl;
+
+    tlsf_mapping(node->size, &fl, &sl);
+
+    if( link->next ) ((freelink_t*) tlsf_node_at(pool, link->next)->userdata)->prev = link->prev;
+    if( link->prev )
+    {
+        ((freelink_t*) tlsf_node_at(pool, link->prev)->userdata)->next = link->next;
+    }
+    else
+    {
+        uint64_t *head = &ctrl->heads[ fl * TLSF_SL_COUNT + sl ];
+
+        assert( *head == tlsf_node_offset(pool, node) );
+        if( !( *head = link->next ) )
+        {
+            ctrl->slmap[fl] &= ~( 1 << sl );
+            if( !ctrl->slmap[fl] ) ctrl->flmap &= ~( (uint64_t)1 << fl );
+        }
+    }
+}
+//------------------------------------------------------------------------------
+static
+node_t* tlsf_find(const mempool_t *pool, const tlsf_t *ctrl, size_t reqsz, unsigned *steps)
+{
+    /*
+     * 尋找能夠滿足要求大小的未使用節點；失敗時傳回 NULL。
+     * 要求大小會先進位到下一個串列的起始大小，因此找到的串列中任一節點皆可使用，
+     * 只需查詢兩層位元圖即可完成搜尋。
+     * 只有在這樣找不到時，才會在要求大小所屬的串列中逐一尋找足夠大的節點。
+     * 搜尋過程中所檢查的串列與節點數量由 steps 傳回。
+     */
+    unsigned fl, sl;
+    uint32_t slbits;
+    uint64_t flbits;
+
+    *steps = 1;
+    tlsf_mapping(reqsz, &fl, &sl);
+    if( fl < ctrl->flcount )
+    {
+        // Round up the requested size to the start of the next list.
+        size_t   round = ( (size_t)1 << ( fl + TLSF_FL_SHIFT - TLSF_SL_BITS ) ) - 1;
+        unsigned fl_up, sl_up;
+
+        tlsf_mapping(reqsz + round, &fl_up, &sl_up);
+
+        slbits = ( fl_up < ctrl->flcount )?( ctrl->slmap[fl_up] & ( ~0U << sl_up ) ):( 0 );
+        flbits = ( fl_up + 1 < ctrl->flcount )?( ctrl->flmap & ( ~(uint64_t)0 << ( fl_up + 1 ) ) ):( 0 );
+        if( !slbits && flbits )
+        {
+            fl_up  = bits_count_trailing_zeros_64(flbits);
+            slbits = ctrl->slmap[fl_up];
+        }
+
+        if( slbits )
+        {
+            sl_up = bits_count_trailing_zeros_32(slbits);
+            return tlsf_node_at(pool, ctrl->heads[ fl_up * TLSF_SL_COUNT + sl_up ]);
+        }
+
+        // Try the nodes in the list of the requested size.
+        {
+            node_t *node = tlsf_node_at(pool, ctrl->heads[ fl * TLSF_SL_COUNT + sl ]);
+
+            while( node && node->size < reqsz )
+            {
+                ++*steps;
+                node = tlsf_node_at(pool, ((const freelink_t*) node->userdata)->next);
+            }
+
+            return node;
+        }
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+static
+void tlsf_split(mempool_t *pool, tlsf_t *ctrl, node_t *node, size_t reqsz)
+{
+    /*
+     * 將節點超出要求大小的部份切割出來，並放入未使用節點的串列。
+     */
+    node_t *rest;
+
+    if( node->size < reqsz + tlsf_node_min ) return;
+    if(( rest = node_separate(node, reqsz) ))
+        tlsf_insert(pool, ctrl, rest);
+}
+//------------------------------------------------------------------------------
+static
+node_t* tlsf_allocate(mempool_t *pool, tlsf_t *ctrl, size_t size)
+{
+    /*
+     * 以 TLSF 模式分配一個節點；失敗時傳回 NULL。
+     */
+    size_t   reqsz;
+    node_t  *node;
+    unsigned steps;
+
+    if( size > pool->size ) return NULL;
+
+    reqsz = calc_align_size(sizeof(node_t) + size);
+    if( reqsz < tlsf_node_min ) reqsz = tlsf_node_min;
+
+    node = tlsf_find(pool, ctrl, reqsz, &steps);
+    stats_count_search(pool, steps);
+    if( !node ) return NULL;
+
+    tlsf_remove(pool, ctrl, node);
+    tlsf_split(pool, ctrl, node, reqsz);
+    node->inuse = true;
+    stats_add_inuse(pool, node->size);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+static
+void tlsf_deallocate(mempool_t *pool, tlsf_t *ctrl, node_t *node)
+{
+    /*
+     * 以 TLSF 模式歸還一個節點，並與相鄰的未使用節點合併。
+     */
+    node_t *node_left  = node_get_prev(node);
+    node_t *node_right = node_get_next(node);
+
+    node->inuse = false;
+    stats_sub_inuse(pool, node->size);
+
+    if( node_right && !node_right->inuse )
+    {
+        tlsf_remove(pool, ctrl, node_right);
+        node_merge_next(node);
+    }
+
+    if( node_left && !node_left->inuse )
+    {
+        tlsf_remove(pool, ctrl, node_left);
+        node_merge_next(node_left);
+        node = node_left;
+    }
+
+    tlsf_insert(pool, ctrl, node);
+}
+//------------------------------------------------------------------------------
+//---- Concurrent Mode ---------------------------------------------------------
+//------------------------------------------------------------------------------
+INLINE
+void pool_lock(mempool_t *pool)
+{
+    /*
+     * 鎖定 Memory Pool 的節點串列。
+     * 鎖位於 Memory Pool 內部，因此可以在共用記憶體中跨行程使用；
+     * 等待時先以唯讀方式檢查，檢查多次仍無法取得時讓出執行緒。
+     */
+    unsigned spins = 0;
+
+    while( atomic_exchange_explicit(&pool->lock, 1, memory_order_acquire) )
+    {
+        while( atomic_load_explicit(&pool->lock, memory_order_relaxed) )
+        {
+            if( ++spins >= 64 )
+            {
+                thrd_yield();
+                spins = 0;
+            }
+        }
+    }
+}
+//------------------------------------------------------------------------------
+INLINE
+void pool_unlock(mempool_t *pool)
+{
+    atomic_store_explicit(&pool->lock, 0, memory_order_release);
+}
+//------------------------------------------------------------------------------
+INLINE
+bool magazine_has_class(uint64_t nodesz)
+{
+    return tlsf_node_min <= nodesz && nodesz < ( MAG_CLASSES + 2 ) * node_alignsz;
+}
+//------------------------------------------------------------------------------
+INLINE
+unsigned magazine_class(uint64_t nodesz)
+{
+    assert( magazine_has_class(nodesz) );
+    return nodesz / node_alignsz - 2;
+}
+//------------------------------------------------------------------------------
+static
+magazine_t* magazine_get(const mempool_t *pool, bool create)
+{
+    /*
+     * 取得呼叫端執行緒屬於指定 Memory Pool 的快取；
+     * 若尚無該 Memory Pool 的快取且 create 為真，則佔用一個空的快取，
+     * 當所有快取皆已被其它 Memory Pool 佔用時傳回 NULL。
+     */
+    magazine_t *vacancy = NULL;
+
+    for(int i=0; i<MAG_POOLS; ++i)
+    {
+        magazine_t *mag = &magazines[i];
+
+        if( mag->pool == pool && mag->serial == pool->serial ) return mag;
+        if( mag->pool == pool ) mag->pool = NULL;  // Left by an old pool, its nodes have gone.
+        if( !mag->pool && !vacancy ) vacancy = mag;
+    }
+
+    if( !create || !vacancy ) return NULL;
+
+    memset(vacancy, 0, sizeof(*vacancy));
+    vacancy->pool   = pool;
+    vacancy->serial = pool->serial;
+
+    return vacancy;
+}
+//------------------------------------------------------------------------------
+static
+void magazine_merge_stats(mempool_t *pool, magazine_t *mag)
+{
+    /*
+     * 將快取所累計的計數併入 Memory Pool，呼叫端必須持有鎖。
+     */
+    pool->counters.allocs += mag->allocs;
+    pool->counters.frees  += mag->frees;
+    pool->counters.fails  += mag->fails;
+
+    mag->allocs = 0;
+    mag->frees  = 0;
+    mag->fails  = 0;
+}
+//------------------------------------------------------------------------------
+static
+void magazine_fill(mempool_t *pool, tlsf_t *ctrl, magazine_t *mag, unsigned cls)
+{
+    /*
+     * 在一次鎖定中分配半個快取容量的節點放入快取。
+     */
+    size_t usersz = ( cls + 2 ) * node_alignsz - sizeof(node_t);
+
+    pool_lock(pool);
+    magazine_merge_stats(pool, mag);
+    while( mag->count[cls] < MAG_CAPACITY / 2 )
+    {
+        node_t *node = tlsf_allocate(pool, ctrl, usersz);
+        if( !node ) break;
+
+        node_set_cached(node, true);
+        mag->nodes[cls][ mag->count[cls]++ ] = node;
+    }
+    pool_unlock(pool);
+}
+//------------------------------------------------------------------------------
+static
+void magazine_drain(mempool_t *pool, tlsf_t *ctrl, magazine_t *mag, unsigned cls, unsigned keep)
+{
+    /*
+     * 在一次鎖定中將快取的節點歸還到剩下 keep 個。
+     */
+    pool_lock(pool);
+    magazine_merge_stats(pool, mag);
+    while( mag->count[cls] > keep )
+    {
+        node_t *node = mag->nodes[cls][ --mag->count[cls] ];
+
+        node_set_cached(node, false);
+        tlsf_deallocate(pool, ctrl, node);
+    }
+    pool_unlock(pool);
+}
+//------------------------------------------------------------------------------
+static
+void magazine_drain_all(mempool_t *pool, tlsf_t *ctrl, magazine_t *mag)
+{
+    /*
+     * 歸還快取中所有的節點。
+     */
+    for(unsigned cls=0; cls<MAG_CLASSES; ++cls)
+    {
+        if( mag->count[cls] ) magazine_drain(pool, ctrl, mag, cls, 0);
+    }
+}
+//------------------------------------------------------------------------------
+static
+node_t* concurrent_allocate_locked(mempool_t *pool, tlsf_t *ctrl, size_t size)
+{
+    /*
+     * 在鎖定中直接由 Memory Pool 分配一個節點；失敗時傳回 NULL。
+     */
+    node_t *node;
+
+    pool_lock(pool);
+    if(( node = tlsf_allocate(pool, ctrl, size) )) ++pool->counters.allocs;
+    pool_unlock(pool);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+static
+node_t* concurrent_allocate(mempool_t *pool, tlsf_t *ctrl, size_t size)
+{
+    /*
+     * 以並行模式分配一個節點；失敗時傳回 NULL。
+     * 小的節點優先由執行緒的快取取得，不需要鎖定。
+     */
+    node_t     *node;
+    magazine_t *mag;
+
+    if( size < MAG_CLASSES * node_alignsz && ( mag = magazine_get(pool, true) ) )
+    {
+        size_t   nodesz = calc_align_size(sizeof(node_t) + size);
+        unsigned cls    = magazine_class( nodesz < tlsf_node_min ? tlsf_node_min : nodesz );
+
+        if( !mag->count[cls] ) magazine_fill(pool, ctrl, mag, cls);
+        if( !mag->count[cls] )
+        {
+            // The space may be held by the caches of other classes.
+            magazine_drain_all(pool, ctrl, mag);
+            magazine_fill(pool, ctrl, mag, cls);
+            if( !mag->count[cls] )
+            {
+                ++mag->fails;
+                return NULL;
+            }
+        }
+
+        node = mag->nodes[cls][ --mag->count[cls] ];
+        node_set_cached(node, false);
+        ++mag->allocs;
+        return node;
+    }
+
+    node = concurrent_allocate_locked(pool, ctrl, size);
+
+    if( !node && ( mag = magazine_get(pool, false) ) )
+    {
+        // The space may be held by the caches.
+        magazine_drain_all(pool, ctrl, mag);
+        node = concurrent_allocate_locked(pool, ctrl, size);
+    }
+
+    if( !node )
+    {
+        pool_lock(pool);
+        ++pool->counters.fails;
+        pool_unlock(pool);
+    }
+
+    return node;
+}
+//------------------------------------------------------------------------------
+static
+void concurrent_deallocate(mempool_t *pool, tlsf_t *ctrl, node_t *node)
+{
+    /*
+     * 以並行模式歸還一個節點。
+     * 小的節點優先放入執行緒的快取，快取已滿時才一次歸還半個快取容量的節點。
+     */
+    magazine_t *mag;
+
+    if( magazine_has_class(node->size) && ( mag = magazine_get(pool, true) ) )
+    {
+        unsigned cls = magazine_class(node->size);
+
+        if( mag->count[cls] == MAG_CAPACITY ) magazine_drain(pool, ctrl, mag, cls, MAG_CAPACITY / 2);
+
+        node_set_cached(node, true);
+        mag->nodes[cls][ mag->count[cls]++ ] = node;
+        ++mag->frees;
+        return;
+    }
+
+    pool_lock(pool);
+    tlsf_deallocate(pool, ctrl, node);
+    ++pool->counters.frees;
+    pool_unlock(pool);
+}
+//------------------------------------------------------------------------------
 //---- Memory Pool -------------------------------------------------------------
 //------------------------------------------------------------------------------
 mempool_t* mempool_init(void* buffer, size_t size)
@@ -215,6 +816,120 @@ mempool_t* mempool_init(void* buffer, size_t size)
     return pool;
 }
 //------------------------------------------------------------------------------
+mempool_t* mempool_init_tlsf(void* buffer, size_t size)
+{
+    /**
+     * @memberof mempool_t
+     * @static
+     * @brief Constructor with the two-level segregated fit (TLSF) mode.
+     *
+     * @param buffer 傳入一個供應給 Memory Pool 使用的資料空間。
+     * @param size   傳入 buffer 的大小。
+     * @return 成功時傳回初始化完成的 Memory Pool 指標，該位址與傳入的 buffer 位址相同，
+     *         即除了表面型態的不同外，buffer 與 Memory Pool 是同一個物件。
+     *         當 buffer 的空間不足以做為 Memory Pool 使用時會傳回 NULL。
+     *
+     * @remarks
+     *     @li 以 ::mempool_init 初始化的 Memory Pool 使用首次適配(first-fit)的方式分配空間，
+     *         分配時需要從頭走訪所有節點，所以分配時間會隨已分配的緩衝區數量增加。
+     *         而本函式初始化的 Memory Pool 將未使用的節點依大小分類串接，
+     *         分配與歸還緩衝區皆只需要常數時間。
+     *     @li 分類串列的控制資料會佔用 Memory Pool 尾端的一部份空間，
+     *         且每個緩衝區最少佔用 64 位元組，較適合有大量緩衝區的應用。
+     *     @li 控制資料同樣以偏移量紀錄，因此 Memory Pool 仍可在不同地址空間中使用，
+     *         其它操作函式的使用方式也與一般的 Memory Pool 相同。
+     */
+    mempool_t *pool = (mempool_t*) buffer;
+    node_t    *first;
+    tlsf_t    *ctrl;
+    size_t     flcount;
+    size_t     ctrlsz;
+    size_t     listsz;
+
+    if( !buffer || size < sizeof(mempool_header_t) + tlsf_node_min ) return NULL;
+
+    flcount = 63 - bits_count_leading_zeros_64(size) - TLSF_FL_SHIFT + 1;
+    ctrlsz  = calc_align_size( sizeof(tlsf_t) + flcount * TLSF_SL_COUNT * sizeof(uint64_t) );
+    if( size < sizeof(mempool_header_t) + ctrlsz ) return NULL;
+
+    listsz = ( size - sizeof(mempool_header_t) - ctrlsz ) / node_alignsz * node_alignsz;
+    first  = nodelist_init(pool->root, listsz);
+    if( !first || first->size < tlsf_node_min ) return NULL;
+
+    memset(pool, 0, sizeof(mempool_header_t));
+    pool->size = size;
+    pool->tlsf = sizeof(mempool_header_t) + listsz;
+
+    ctrl = tlsf_get_control(pool);
+    memset(ctrl, 0, ctrlsz);
+    ctrl->flcount = flcount;
+    tlsf_insert(pool, ctrl, first);
+
+    return pool;
+}
+//------------------------------------------------------------------------------
+mempool_t* mempool_init_concurrent(void* buffer, size_t size)
+{
+    /**
+     * @memberof mempool_t
+     * @static
+     * @brief Constructor with the concurrent mode.
+     *
+     * @param buffer 傳入一個供應給 Memory Pool 使用的資料空間。
+     * @param size   傳入 buffer 的大小。
+     * @return 成功時傳回初始化完成的 Memory Pool 指標，該位址與傳入的 buffer 位址相同，
+     *         即除了表面型態的不同外，buffer 與 Memory Pool 是同一個物件。
+     *         當 buffer 的空間不足以做為 Memory Pool 使用時會傳回 NULL。
+     *
+     * @remarks
+     *     @li 並行模式的 Memory Pool 以 ::mempool_init_tlsf 的方式管理空間，
+     *         並以位於 Memory Pool 內部的鎖保護，因此可以放在共用記憶體中，
+     *         由多個執行緒與多個行程同時使用，不需要外部的鎖。
+     *     @li 每個執行緒會為常用的小緩衝區大小保留少量的節點做為快取，
+     *         大部份的分配與歸還只需存取快取，不需要鎖定。
+     *         快取中的節點不會被計入可用空間，也不會被列舉為已分配的緩衝區。
+     *     @li 執行緒在結束、或是在解除 Memory Pool 的映射之前，
+     *         必須呼叫 ::mempool_flush_cache 歸還快取中的節點，否則這些空間將無法再被使用。
+     *         同樣的，行程在 fork 之前也必須歸還快取。
+     *         在同一個位址重新初始化 Memory Pool 後，執行緒遺留的舊快取會被捨棄，不會再被分配出去。
+     *     @li 持有鎖的行程若異常結束，其它使用者將無法再取得鎖。
+     */
+    mempool_t *pool = mempool_init_tlsf(buffer, size);
+
+    if( pool )
+    {
+        atomic_init(&pool->lock, 0);
+        pool->concurrent = true;
+        pool->serial     = atomic_fetch_add(&serial_next, 1);
+    }
+
+    return pool;
+}
+//------------------------------------------------------------------------------
+void mempool_flush_cache(mempool_t* pool)
+{
+    /**
+     * @memberof mempool_t
+     * @brief 歸還呼叫端執行緒在並行模式 Memory Pool 中所保留的快取節點。
+     *
+     * @param pool Memory Pool 物件。
+     */
+    magazine_t *mag;
+
+    assert( pool );
+
+    if( !pool->concurrent ) return;
+    if( !( mag = magazine_get(pool, false) ) ) return;
+
+    magazine_drain_all(pool, tlsf_get_control(pool), mag);
+
+    pool_lock(pool);
+    magazine_merge_stats(pool, mag);
+    pool_unlock(pool);
+
+    mag->pool = NULL;
+}
+//------------------------------------------------------------------------------
 uint64_t mempool_offset_from_addr(const mempool_t* pool, const void* bufaddr)
 {
     /**
@@ -283,6 +998,8 @@ size_t mempool_get_free_size(const mempool_t* pool)
 
     assert( pool );
 
+    if( pool->concurrent ) pool_lock((mempool_t*)pool);
+
     node = pool->root;
     while( node )
     {
@@ -292,6 +1009,8 @@ size_t mempool_get_free_size(const mempool_t* pool)
         node = node_get_next((node_t*)node);
     }
 
+    if( pool->concurrent ) pool_unlock((mempool_t*)pool);
+
     return size;
 }
 //------------------------------------------------------------------------------
@@ -332,13 +1051,17 @@ void* mempool_get_inuse_next(const mempool_t* pool, const void* bufaddr)
 
     assert( pool );
 
+    if( pool->concurrent ) pool_lock((mempool_t*)pool);
+
     node = ( node )?( node_get_next(node) ):( (node_t*)pool->root );
     while( node )
     {
-        if( node->inuse ) break;
+        if( node->inuse && !node_is_cached(node) ) break;
         node = node_get_next(node);
     }
 
+    if( pool->concurrent ) pool_unlock((mempool_t*)pool);
+
     return ( node )?( node->userdata ):( NULL );
 }
 //------------------------------------------------------------------------------
@@ -353,16 +1076,40 @@ void* mempool_allocate(mempool_t* pool, size_t size)
      * @return 成功時傳回新分配緩衝空間的起始位址；失敗時傳回 NULL。
      */
     size_t  nodesize = sizeof(node_t) + size;
+    tlsf_t *ctrl;
     node_t *node;
 
     assert( pool );
 
-    if(( node = nodelist_find_freespace( pool->root, nodesize ) ))
+    if(( ctrl = tlsf_get_control(pool) ))
     {
-        node_separate(node, nodesize);
-        node->usersize = size;
-        node->inuse    = true;
+        node = ( pool->concurrent )?
+               ( concurrent_allocate(pool, ctrl, size) ):
+               ( tlsf_allocate(pool, ctrl, size) );
     }
+    else
+    {
+        unsigned steps;
+
+        node = nodelist_find_freespace(pool->root, nodesize, &steps);
+        stats_count_search(pool, steps);
+        if( node )
+        {
+            node_separate(node, nodesize);
+            node->inuse = true;
+            stats_add_inuse(pool, node->size);
+        }
+    }
+
+    if( !pool->concurrent )
+    {
+        if( node )
+            ++pool->counters.allocs;
+        else
+            ++pool->counters.fails;
+    }
+
+    if( node ) node->usersize = size;
 
     return ( node )?( node->userdata ):( NULL );
 }
@@ -380,13 +1127,30 @@ void mempool_deallocate(mempool_t* pool, void* bufaddr)
     node_t *node_left;
     node_t *node_centre;
     node_t *node_right;
+    tlsf_t *ctrl;
 
     assert( pool );
 
     node_centre = node_from_useraddr(bufaddr);
     if( !node_centre ) return;
 
+    if(( ctrl = tlsf_get_control(pool) ))
+    {
+        if( pool->concurrent )
+        {
+            concurrent_deallocate(pool, ctrl, node_centre);
+        }
+        else
+        {
+            tlsf_deallocate(pool, ctrl, node_centre);
+            ++pool->counters.frees;
+        }
+        return;
+    }
+
     node_centre->inuse = false;
+    stats_sub_inuse(pool, node_centre->size);
+    ++pool->counters.frees;
 
     node_left  = node_get_prev(node_centre);
     node_right = node_get_next(node_centre);
@@ -432,15 +1196,34 @@ void* mempool_reallocate(mempool_t* pool, void* bufaddr, size_t size)
 
     // Merge next node if it have enough space and is not in using.
     {
-        node_t *node_next = node_get_next(node);
+        tlsf_t *ctrl = tlsf_get_control(pool);
+        node_t *node_next;
+        bool    merged = false;
+
+        if( pool->concurrent ) pool_lock(pool);
 
+        node_next = node_get_next(node);
         if(  node_next                                      &&
             !node_next->inuse                               &&
              nodesz_required < node->size + node_next->size )
         {
+            uint64_t size_old = node->size;
+
+            if( ctrl ) tlsf_remove(pool, ctrl, node_next);
             node_merge_next(node);
             assert( nodesz_required < node->size );
 
+            // Give back the surplus space in the TLSF mode.
+            if( ctrl ) tlsf_split(pool, ctrl, node, nodesz_required);
+            stats_add_inuse(pool, node->size - size_old);
+
+            merged = true;
+        }
+
+        if( pool->concurrent ) pool_unlock(pool);
+
+        if( merged )
+        {
             node->usersize = size;
             return node->userdata;
         }
@@ -458,3 +1241,150 @@ void* mempool_reallocate(mempool_t* pool, void* bufaddr, size_t size)
     }
 }
 //------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+void mempool_get_stats(const mempool_t* pool, mempool_stats_t* stats)
+{
+    /**
+     * @memberof mempool_t
+     * @brief 查詢 Memory Pool 的統計資訊。
+     *
+     * @param pool  Memory Pool 物件。
+     * @param stats 傳回統計資訊。
+     *
+     * @remarks
+     *     @li 計數器在每次分配與歸還時更新，成本很低，因此總是啟用；
+     *         而未使用區塊的資訊需要走訪所有節點，本函式的執行時間與節點數量成正比。
+     *     @li 當分配失敗而 free_size 仍然很大時，若 free_largest 遠小於 free_size
+     *         表示空間已零碎化，可考慮以 ::mempool_defragment 重整；
+     *         否則表示空間確實已被使用，可對照 allocs 與 frees 的差值檢查是否有未歸還的緩衝區。
+     *     @li 並行模式中，執行緒快取所做的分配與歸還次數會在快取存取 Memory Pool
+     *         或呼叫 ::mempool_flush_cache 時才併入計數。
+     */
+    const node_t *node;
+
+    assert( pool && stats );
+
+    memset(stats, 0, sizeof(*stats));
+
+    if( pool->concurrent ) pool_lock((mempool_t*)pool);
+
+    for(node = pool->root; node; node = node_get_next((node_t*)node))
+    {
+        if( node->inuse )
+        {
+            ++stats->inuse_count;
+            if( node_is_cached(node) ) ++stats->cached_count;
+        }
+        else
+        {
+            size_t size = node->size - sizeof(node_t);
+
+            stats->free_size += size;
+            if( stats->free_largest < size ) stats->free_largest = size;
+            ++stats->free_count;
+            ++stats->free_hist[ stats_class(size / node_alignsz, 1, MEMPOOL_FREE_CLASSES) ];
+        }
+    }
+
+    stats->pool_size  = pool->size;
+    stats->inuse_size = pool->counters.inuse;
+    stats->inuse_peak = pool->counters.peak;
+    stats->allocs     = pool->counters.allocs;
+    stats->frees      = pool->counters.frees;
+    stats->fails      = pool->counters.fails;
+    memcpy(stats->search_hist, pool->counters.searches, sizeof(stats->search_hist));
+
+    if( pool->concurrent ) pool_unlock((mempool_t*)pool);
+}
+//------------------------------------------------------------------------------
+void mempool_reset_stats(mempool_t* pool)
+{
+    /**
+     * @memberof mempool_t
+     * @brief 重設 Memory Pool 的統計計數。
+     * @details 分配與歸還的次數及搜尋長度的分佈將被清除，
+     *          而 inuse_size 的最高紀錄將被設為目前的值。
+     *
+     * @param pool Memory Pool 物件。
+     */
+    assert( pool );
+
+    if( pool->concurrent ) pool_lock(pool);
+
+    pool->counters.allocs = 0;
+    pool->counters.frees  = 0;
+    pool->counters.fails  = 0;
+    pool->counters.peak   = pool->counters.inuse;
+    memset(pool->counters.searches, 0, sizeof(pool->counters.searches));
+
+    if( pool->concurrent ) pool_unlock(pool);
+}
+//------------------------------------------------------------------------------
+size_t mempool_defragment(mempool_t* pool, mempool_on_move_t on_move, void* userarg)
+{
+    /**
+     * @memberof mempool_t
+     * @brief 重整 Memory Pool，將已分配的緩衝區往前搬移，使未使用的空間合併。
+     *
+     * @param pool    Memory Pool 物件。
+     * @param on_move 在每個緩衝區被搬移後呼叫，以通知使用者更新該緩衝區的偏移量，此參數可為 NULL。
+     * @param userarg 傳遞給 on_move 的使用者參數。
+     * @return 傳回被搬移的緩衝區數量。
+     *
+     * @remarks
+     *     @li 緩衝區被搬移後，原有的位址與偏移量皆會失效，
+     *         因此本函式只適用於以偏移量參照緩衝區，並能透過 on_move 更新所有參照的使用者。
+     *         在重整期間，其它使用者不可存取 Memory Pool 及其中的緩衝區。
+     *     @li 並行模式中，執行緒快取所保留的節點不會被搬移，
+     *         建議所有執行緒在重整前先呼叫 ::mempool_flush_cache。
+     *         重整期間 Memory Pool 將被鎖定，on_move 不可呼叫 Memory Pool 的函式。
+     */
+    tlsf_t *ctrl;
+    node_t *node;
+    size_t  moved = 0;
+
+    assert( pool );
+
+    if( pool->concurrent ) pool_lock(pool);
+
+    // The free lists will be rebuilt after all nodes moved.
+    if(( ctrl = tlsf_get_control(pool) ))
+    {
+        ctrl->flmap = 0;
+        memset(ctrl->slmap, 0, sizeof(ctrl->slmap));
+        memset(ctrl->heads, 0, ctrl->flcount * TLSF_SL_COUNT * sizeof(ctrl->heads[0]));
+    }
+
+    node = pool->root;
+    while( node )
+    {
+        node_t *node_next = node_get_next(node);
+
+        if( !node->inuse && node_next && node_next->inuse && !node_is_cached(node_next) )
+        {
+            uint64_t oldoff = mempool_offset_from_addr(pool, node_next->userdata);
+            uint64_t newoff = mempool_offset_from_addr(pool, node->userdata);
+
+            node = node_move_forward(node, node_next);
+            if( on_move ) on_move(userarg, oldoff, newoff);
+            ++moved;
+        }
+        else
+        {
+            node = node_next;
+        }
+    }
+
+    if( ctrl )
+    {
+        for(node = pool->root; node; node = node_get_next(node))
+        {
+            if( !node->inuse ) tlsf_insert(pool, ctrl, node);
+        }
+    }
+
+    if( pool->concurrent ) pool_unlock(pool);
+
+    return moved;
+}
+//------------------------------------------------------------------------------
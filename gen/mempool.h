@@ -31,8 +31,49 @@ extern "C" {
  */
 typedef struct mempool_t mempool_t;
 
+#define MEMPOOL_FREE_CLASSES   16  ///< Number of classes of the free blocks histogram.
+#define MEMPOOL_SEARCH_CLASSES 8   ///< Number of classes of the search length histogram.
+
+/**
+ * @memberof mempool_t
+ * @brief Statistics of a memory pool.
+ * @see mempool_t::mempool_get_stats
+ */
+typedef struct mempool_stats_t
+{
+    size_t   pool_size;     ///< 整個 Memory Pool 資料空間的大小。
+    size_t   free_size;     ///< 尚未被分配的緩衝空間總和，與 ::mempool_get_free_size 相同。
+    size_t   free_largest;  ///< 最大的未使用緩衝空間，即單次能夠分配的最大緩衝區大小。
+    size_t   free_count;    ///< 未使用的空間區塊數量。
+    size_t   free_hist[MEMPOOL_FREE_CLASSES];  ///< @brief 未使用區塊依緩衝空間大小分類的數量。
+                                               ///< @details 分類 k 為 [32*2^k, 32*2^(k+1)) 位元組，
+                                               ///<          分類 0 也包含更小的區塊，最後一個分類也包含更大的區塊。
+    size_t   inuse_count;   ///< 已分配的緩衝區數量，包含並行模式中執行緒快取所保留的節點。
+    size_t   cached_count;  ///< 並行模式中執行緒快取所保留的節點數量。
+    size_t   inuse_size;    ///< 已分配的節點所佔用的空間大小，包含節點標頭。
+    size_t   inuse_peak;    ///< inuse_size 的最高紀錄。
+    uint64_t allocs;        ///< 分配成功的次數，包含 ::mempool_reallocate 搬移緩衝區所做的分配。
+    uint64_t frees;         ///< 歸還的次數。
+    uint64_t fails;         ///< 分配失敗的次數。
+    uint64_t search_hist[MEMPOOL_SEARCH_CLASSES];  ///< @brief 分配時搜尋長度的分佈。
+                                                   ///< @details 分類 k 為檢查了 [4^k, 4^(k+1)) 個節點或串列的搜尋，
+                                                   ///<          最後一個分類也包含更長的搜尋。
+} mempool_stats_t;
+
+/**
+ * @memberof mempool_t
+ * @brief Callback to notify that a buffer is moved by ::mempool_defragment.
+ *
+ * @param userarg The user argument passed to ::mempool_defragment.
+ * @param oldoff  The old offset of the buffer.
+ * @param newoff  The new offset of the buffer.
+ */
+typedef void(*mempool_on_move_t)(void *userarg, uint64_t oldoff, uint64_t newoff);
+
 // 緩衝區設定
-mempool_t* mempool_init(void* buffer, size_t size);
+mempool_t* mempool_init           (void* buffer, size_t size);
+mempool_t* mempool_init_tlsf      (void* buffer, size_t size);
+mempool_t* mempool_init_concurrent(void* buffer, size_t size);
 
 // 記憶體位址與偏移量轉換
 uint64_t mempool_offset_from_addr(const mempool_t* pool, const void* bufaddr);
@@ -60,6 +101,14 @@ void* mempool_allocate  (mempool_t* pool, size_t size);
 void  mempool_deallocate(mempool_t* pool, void* bufaddr);
 void* mempool_reallocate(mempool_t* pool, void* bufaddr, size_t size);
 
+// 統計與重整
+void   mempool_get_stats  (const mempool_t* pool, mempool_stats_t* stats);
+void   mempool_reset_stats(mempool_t* pool);
+size_t mempool_defragment (mempool_t* pool, mempool_on_move_t on_move, void* userarg);
+
+// 執行緒快取
+void mempool_flush_cache(mempool_t* pool);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -75,7 +124,9 @@ private:
     TMemPool& operator=(const TMemPool&);   // Not allowed to use
 
 public:
-    static TMemPool* Initialize(void* Buffer, size_t Size) { return (TMemPool*)mempool_init(Buffer, Size); }  ///< @see mempool_t::mempool_init
+    static TMemPool* Initialize          (void* Buffer, size_t Size) { return (TMemPool*)mempool_init           (Buffer, Size); }  ///< @see mempool_t::mempool_init
+    static TMemPool* InitializeTLSF      (void* Buffer, size_t Size) { return (TMemPool*)mempool_init_tlsf      (Buffer, Size); }  ///< @see mempool_t::mempool_init_tlsf
+    static TMemPool* InitializeConcurrent(void* Buffer, size_t Size) { return (TMemPool*)mempool_init_concurrent(Buffer, Size); }  ///< @see mempool_t::mempool_init_concurrent
 
 public:
     uint64_t OffsetFromAddr(const void* BufAddr) const { return mempool_offset_from_addr((const mempool_t*)this, BufAddr); }  ///< @see mempool_t::mempool_offset_from_addr
@@ -93,6 +144,14 @@ public:
     void  Deallocate(void*  BufAddr             ) { return mempool_deallocate((mempool_t*)this, BufAddr); }        ///< @see mempool_t::mempool_deallocate
     void* Reallocate(void*  BufAddr, size_t Size) { return mempool_reallocate((mempool_t*)this, BufAddr, Size); }  ///< @see mempool_t::mempool_reallocate
 
+public:
+    void   GetStats  (mempool_stats_t* Stats) const              { mempool_get_stats  ((const mempool_t*)this, Stats); }           ///< @see mempool_t::mempool_get_stats
+    void   ResetStats()                                          { mempool_reset_stats((mempool_t*)this); }                        ///< @see mempool_t::mempool_reset_stats
+    size_t Defragment(mempool_on_move_t OnMove, void* UserArg)  { return mempool_defragment((mempool_t*)this, OnMove, UserArg); }  ///< @see mempool_t::mempool_defragment
+
+public:
+    void FlushCache() { mempool_flush_cache((mempool_t*)this); }  ///< @see mempool_t::mempool_flush_cache
+
 };
 
 #endif
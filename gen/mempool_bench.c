@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#ifdef __linux__
+    #include <unistd.h>
+    #include <sys/wait.h>
+#endif
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "mempool.h"
+#include "shrdmem.h"
+#include "systime.h"
+
+#define BENCH_POOL_SIZE  ( 64 * 1024 * 1024 )
+#define BENCH_SLOTS      256        // Live blocks of each worker.
+#define BENCH_OPS        1000000    // Operations of each worker.
+#define BENCH_MAX_WORKER 8
+#define BENCH_SHRD_NAME  "mempool_bench"
+
+typedef struct worker_t
+{
+    mempool_t *pool;
+    mtx_t     *lock;    // External lock, or NULL if the pool is concurrent.
+    unsigned   seed;
+    bool       ok;
+} worker_t;
+
+//------------------------------------------------------------------------------
+bool bench_work(mempool_t *pool, mtx_t *lock, unsigned seed)
+{
+    /*
+     * Allocate and deallocate buffers randomly, mostly small ones,
+     * and check that the buffers are not touched by other workers.
+     */
+    byte_t *slots[BENCH_SLOTS] = { NULL };
+    size_t  sizes[BENCH_SLOTS];
+    bool    ok = true;
+
+    for(unsigned i=0; i<BENCH_OPS; ++i)
+    {
+        unsigned k = ( seed = seed * 1103515245 + 12345 ) >> 8 & ( BENCH_SLOTS - 1 );
+        byte_t   mark = k ^ 0x5A;
+
+        if( slots[k] )
+        {
+            ok = ok && slots[k][0] == mark && slots[k][ sizes[k] - 1 ] == mark;
+
+            if( lock ) mtx_lock(lock);
+            mempool_deallocate(pool, slots[k]);
+            if( lock ) mtx_unlock(lock);
+            slots[k] = NULL;
+        }
+        else
+        {
+            unsigned r    = ( seed = seed * 1103515245 + 12345 ) >> 8;
+            size_t   size = ( r & 0xF00 )?( 16 + ( r & 0xEF ) ):( 16 + ( r >> 12 & 0xFFF ) );
+
+            if( lock ) mtx_lock(lock);
+            slots[k] = mempool_allocate(pool, size);
+            if( lock ) mtx_unlock(lock);
+            if( !slots[k] ) return false;
+
+            sizes[k] = size;
+            memset(slots[k], mark, size);
+        }
+    }
+
+    for(unsigned k=0; k<BENCH_SLOTS; ++k)
+    {
+        if( !slots[k] ) continue;
+
+        if( lock ) mtx_lock(lock);
+        mempool_deallocate(pool, slots[k]);
+        if( lock ) mtx_unlock(lock);
+    }
+    mempool_flush_cache(pool);
+
+    return ok;
+}
+//------------------------------------------------------------------------------
+int bench_thread(void *arg)
+{
+    worker_t *worker = arg;
+    worker->ok = bench_work(worker->pool, worker->lock, worker->seed);
+    return 0;
+}
+//------------------------------------------------------------------------------
+bool bench_threads(const char *name, mempool_t *pool, mtx_t *lock, int count)
+{
+    // Run workers on several threads, and print the throughput.
+    worker_t workers[BENCH_MAX_WORKER];
+    thrd_t   threads[BENCH_MAX_WORKER];
+    size_t   freesize = mempool_get_free_size(pool);
+    bool     ok       = true;
+
+    unsigned time_start = systime_get_clock_count();
+    for(int i=0; i<count; ++i)
+    {
+        workers[i] = (worker_t){ .pool = pool, .lock = lock, .seed = i + 1, .ok = false };
+        if( thrd_success != thrd_create(&threads[i], bench_thread, &workers[i]) ) return false;
+    }
+    for(int i=0; i<count; ++i)
+    {
+        thrd_join(threads[i], NULL);
+        ok = ok && workers[i].ok;
+    }
+    unsigned time_passed = systime_get_clock_count() - time_start;
+
+    ok = ok && freesize == mempool_get_free_size(pool);
+    printf("%-12s %d threads   : %8.2f M op/s%s\n",
+           name,
+           count,
+           (double) BENCH_OPS * count / 1e6 / ( time_passed / 1000.0 ),
+           ok ? "" : " FAILED");
+
+    return ok;
+}
+//------------------------------------------------------------------------------
+#ifdef __linux__
+bool bench_processes(int count)
+{
+    // Run workers on several processes sharing a pool, and print the throughput.
+    shrdmem_t *shrd = shrdmem_create_open(BENCH_SHRD_NAME, BENCH_POOL_SIZE, false);
+    mempool_t *pool;
+    size_t     freesize;
+    bool       ok = true;
+
+    if( !shrd ) return false;
+    if( !( pool = mempool_init_concurrent(shrd->buf, shrd->size) ) ) return false;
+    freesize = mempool_get_free_size(pool);
+
+    unsigned time_start = systime_get_clock_count();
+    for(int i=0; i<count; ++i)
+    {
+        if( 0 == fork() )
+        {
+            // Map the pool again, it will be on another address.
+            shrdmem_t *child = shrdmem_create_open_existed(BENCH_SHRD_NAME);
+            _exit( child && bench_work((mempool_t*) child->buf, NULL, i + 1) ? 0 : 1 );
+        }
+    }
+    for(int i=0; i<count; ++i)
+    {
+        int status;
+        ok = ok && wait(&status) > 0 && WIFEXITED(status) && 0 == WEXITSTATUS(status);
+    }
+    unsigned time_passed = systime_get_clock_count() - time_start;
+
+    ok = ok && freesize == mempool_get_free_size(pool);
+    printf("%-12s %d processes : %8.2f M op/s%s\n",
+           "concurrent",
+           count,
+           (double) BENCH_OPS * count / 1e6 / ( time_passed / 1000.0 ),
+           ok ? "" : " FAILED");
+
+    shrdmem_release(shrd);
+    return ok;
+}
+#endif
+//------------------------------------------------------------------------------
+int main(void)
+{
+    byte_t *buf = malloc(BENCH_POOL_SIZE);
+    mtx_t   lock;
+    bool    ok = true;
+
+    if( !buf ) return 1;
+    if( thrd_success != mtx_init(&lock, mtx_plain) ) return 1;
+
+    for(int count=1; count<=BENCH_MAX_WORKER; count*=2)
+    {
+        ok = bench_threads("TLSF+mutex", mempool_init_tlsf(buf, BENCH_POOL_SIZE), &lock, count) && ok;
+        ok = bench_threads("concurrent", mempool_init_concurrent(buf, BENCH_POOL_SIZE), NULL, count) && ok;
+    }
+
+#ifdef __linux__
+    for(int count=1; count<=BENCH_MAX_WORKER; count*=2)
+        ok = bench_processes(count) && ok;
+#endif
+
+    mtx_destroy(&lock);
+    free(buf);
+    return ok ? 0 : 1;
+}
+//------------------------------------------------------------------------------
@@ -2,18 +2,24 @@
  * mempool 測試程式
  */
 #include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <thread>
 
 #ifdef __BORLANDC__
 #pragma hdrstop
 #endif
 
 #include "mempool.h"
+#include "systime.h"
 
 #ifdef NDEBUG
     #error This test program must work with macro "ASSERT" enabled!
 #endif
 
+#define BENCH_DURATION 500 // Milliseconds.
+
 typedef struct testunit_t
 {
     char       *buffer;  // Buffer allocated from the pool
@@ -69,7 +75,16 @@ bool index_magic(size_t index)
     return ( index / 3 % 3 ) == ( index % 3 );
 }
 
-int main(int argc, char *argv[])
+typedef mempool_t*(*pool_init_t)(void* buffer, size_t size);
+
+size_t get_free_size(mempool_t *pool)
+{
+    // Give back the nodes cached by this thread before the query, for the concurrent mode.
+    mempool_flush_cache(pool);
+    return mempool_get_free_size(pool);
+}
+
+void test_pool(pool_init_t init, bool ordered)
 {
     byte_t     poolbuf[4*1024];
     mempool_t *pool;
@@ -77,13 +92,13 @@ int main(int argc, char *argv[])
 
     // Initialize
     memset(poolbuf, 0xEF, sizeof(poolbuf));
-    assert( !mempool_init(poolbuf, 10) );
-    pool = mempool_init(poolbuf, sizeof(poolbuf));
+    assert( !init(poolbuf, 10) );
+    pool = init(poolbuf, sizeof(poolbuf));
     assert( pool );
     assert( sizeof(poolbuf) == mempool_get_pool_size(pool) );
 
     // Test and make backup of the original free size.
-    freetotal = mempool_get_free_size(pool);
+    freetotal = get_free_size(pool);
     assert( 0 < freetotal && freetotal < sizeof(poolbuf) );
 
     // Single buffer allocation test
@@ -93,10 +108,10 @@ int main(int argc, char *argv[])
         buf = (char*) mempool_allocate(pool, 0);
         assert( buf );
         assert( 0 == mempool_get_buffer_size(pool, buf) );
-        assert( freetotal > mempool_get_free_size(pool) );
+        assert( freetotal > get_free_size(pool) );
 
         mempool_deallocate(pool, buf);
-        assert( freetotal == mempool_get_free_size(pool) );
+        assert( freetotal == get_free_size(pool) );
     }
     {
         char     *buf;
@@ -106,7 +121,7 @@ int main(int argc, char *argv[])
         buf = (char*) mempool_allocate(pool, 20);
         assert( buf );
         assert( 20 == mempool_get_buffer_size(pool, buf) );
-        assert( freetotal > mempool_get_free_size(pool) );
+        assert( freetotal > get_free_size(pool) );
 
         // Offset calculation test
         assert( 0    == mempool_offset_from_addr(pool, NULL) );
@@ -117,7 +132,7 @@ int main(int argc, char *argv[])
 
         // Deallocate test
         mempool_deallocate(pool, buf);
-        assert( freetotal == mempool_get_free_size(pool) );
+        assert( freetotal == get_free_size(pool) );
     }
 
     // Multi-buffer allocation test
@@ -135,7 +150,7 @@ int main(int argc, char *argv[])
         }
 
         // Check pool size
-        assert( freetotal > mempool_get_free_size(pool) );
+        assert( freetotal > get_free_size(pool) );
 
         // Fill data
         for(i=0; i<testcnt; ++i)
@@ -155,7 +170,7 @@ int main(int argc, char *argv[])
             mempool_deallocate(pool, testvars[i].buffer);
             testvars[i].buffer = NULL;
         }
-        assert( freetotal == mempool_get_free_size(pool) );
+        assert( freetotal == get_free_size(pool) );
     }
 
     // Multi-buffer repeating allocate and deallocate
@@ -196,7 +211,7 @@ int main(int argc, char *argv[])
         }
 
         // Check pool size
-        assert( freetotal > mempool_get_free_size(pool) );
+        assert( freetotal > get_free_size(pool) );
 
         // Fill data
         for(i=0; i<testcnt; ++i)
@@ -216,7 +231,7 @@ int main(int argc, char *argv[])
             mempool_deallocate(pool, testvars[i].buffer);
             testvars[i].buffer = NULL;
         }
-        assert( freetotal == mempool_get_free_size(pool) );
+        assert( freetotal == get_free_size(pool) );
     }
 
     // Buffer reallocate test
@@ -234,7 +249,7 @@ int main(int argc, char *argv[])
         }
 
         // Check pool size
-        assert( freetotal > mempool_get_free_size(pool) );
+        assert( freetotal > get_free_size(pool) );
 
         // Fill data
         for(i=0; i<testcnt; ++i)
@@ -263,7 +278,7 @@ int main(int argc, char *argv[])
             mempool_deallocate(pool, testvars[i].buffer);
             testvars[i].buffer = NULL;
         }
-        assert( freetotal == mempool_get_free_size(pool) );
+        assert( freetotal == get_free_size(pool) );
     }
 
     // Buffer seek test
@@ -295,7 +310,18 @@ int main(int argc, char *argv[])
         buf = (char*) mempool_get_inuse_first(pool);
         for(i=0; i<testcnt; i+=2)
         {
-            assert( testvars[i].buffer == buf );
+            if( ordered )
+            {
+                assert( testvars[i].buffer == buf );
+            }
+            else
+            {
+                // The buffers may be not in the allocation order, just check that it is one of them.
+                size_t j = 0;
+                while( j < testcnt && testvars[j].buffer != buf ) j += 2;
+                assert( j < testcnt );
+            }
+
             buf = (char*) mempool_get_inuse_next(pool, buf);
         }
         assert( NULL == buf );
@@ -306,8 +332,451 @@ int main(int argc, char *argv[])
             mempool_deallocate(pool, testvars[i].buffer);
             testvars[i].buffer = NULL;
         }
-        assert( freetotal == mempool_get_free_size(pool) );
+        assert( freetotal == get_free_size(pool) );
+    }
+}
+
+void test_relocate(pool_init_t init)
+{
+    static byte_t poolbuf [4*1024];
+    static byte_t poolcopy[4*1024];
+    mempool_t    *pool;
+    uint64_t      offs[testcnt];
+    size_t        freetotal;
+    size_t        i;
+
+    pool = init(poolbuf, sizeof(poolbuf));
+    assert( pool );
+    freetotal = get_free_size(pool);
+
+    // Allocate buffers and deallocate some of them, and record the offsets.
+    for(i=0; i<testcnt; ++i)
+    {
+        char *buf = (char*) mempool_allocate(pool, strlen(testvars[i].sample) + 1);
+        assert( buf );
+        strcpy(buf, testvars[i].sample);
+        offs[i] = mempool_offset_from_addr(pool, buf);
+    }
+    for(i=0; i<testcnt; ++i)
+    {
+        if( !index_magic(i) )
+        {
+            mempool_deallocate(pool, mempool_offset_to_addr(pool, offs[i]));
+            offs[i] = 0;
+        }
+    }
+
+    // Move the pool to another address, and then continue to use it.
+    mempool_flush_cache(pool);
+    memcpy(poolcopy, poolbuf, sizeof(poolbuf));
+    memset(poolbuf, 0xEF, sizeof(poolbuf));
+    pool = (mempool_t*) poolcopy;
+
+    for(i=0; i<testcnt; ++i)
+    {
+        if( !offs[i] )
+        {
+            char *buf = (char*) mempool_allocate(pool, strlen(testvars[i].sample) + 1);
+            assert( buf );
+            strcpy(buf, testvars[i].sample);
+            offs[i] = mempool_offset_from_addr(pool, buf);
+        }
+    }
+    for(i=0; i<testcnt; ++i)
+    {
+        const char *buf = (const char*) mempool_offset_to_addr(pool, offs[i]);
+        assert( 0 == strcmp(buf, testvars[i].sample) );
+        mempool_deallocate(pool, (void*) buf);
+    }
+    assert( freetotal == get_free_size(pool) );
+}
+
+void test_stats(pool_init_t init, bool ordered)
+{
+    static byte_t   poolbuf[64*1024];
+    mempool_t      *pool;
+    mempool_stats_t stats;
+    void           *bufs[testcnt];
+    size_t          freetotal;
+    size_t          i;
+
+    pool = init(poolbuf, sizeof(poolbuf));
+    assert( pool );
+
+    // A new pool has one free block.
+    mempool_get_stats(pool, &stats);
+    freetotal = stats.free_size;
+    assert( stats.pool_size    == sizeof(poolbuf) );
+    assert( stats.free_size    == mempool_get_free_size(pool) );
+    assert( stats.free_largest == stats.free_size );
+    assert( stats.free_count   == 1 );
+    assert( stats.free_hist[10] == 1 );  // 32K ~ 64K
+    assert( stats.inuse_count == 0 && stats.inuse_size == 0 && stats.inuse_peak == 0 );
+    assert( stats.allocs == 0 && stats.frees == 0 && stats.fails == 0 );
+
+    // Allocate buffers, and deallocate some of them to make holes.
+    for(i=0; i<testcnt; ++i)
+        assert(( bufs[i] = mempool_allocate(pool, 100) ));
+    for(i=0; i<testcnt; i+=2)
+        mempool_deallocate(pool, bufs[i]);
+    assert( !mempool_allocate(pool, sizeof(poolbuf)) );
+    mempool_flush_cache(pool);
+
+    mempool_get_stats(pool, &stats);
+    assert( stats.allocs == testcnt );
+    assert( stats.frees  == testcnt / 2 );
+    assert( stats.fails  == 1 );
+    assert( stats.inuse_count == testcnt / 2 );
+    assert( stats.cached_count == 0 );
+    assert( stats.inuse_size >= testcnt / 2 * ( 100 + 32 ) );
+    assert( stats.inuse_peak >= testcnt * ( 100 + 32 ) );
+    assert( ordered ? stats.free_count == testcnt / 2 + 1 : stats.free_count > 1 );
+    assert( stats.free_largest < stats.free_size );
+    assert( stats.free_size == mempool_get_free_size(pool) );
+
+    uint64_t searches = 0;
+    for(i=0; i<MEMPOOL_SEARCH_CLASSES; ++i) searches += stats.search_hist[i];
+    assert( searches >= 1 );
+
+    // Reset the counters, and the peak goes to the current value.
+    mempool_reset_stats(pool);
+    mempool_get_stats(pool, &stats);
+    assert( stats.allocs == 0 && stats.frees == 0 && stats.fails == 0 );
+    assert( stats.inuse_peak == stats.inuse_size );
+    for(i=0; i<MEMPOOL_SEARCH_CLASSES; ++i) assert( stats.search_hist[i] == 0 );
+
+    for(i=1; i<testcnt; i+=2)
+        mempool_deallocate(pool, bufs[i]);
+    mempool_flush_cache(pool);
+
+    mempool_get_stats(pool, &stats);
+    assert( stats.frees == testcnt / 2 );
+    assert( stats.inuse_size == 0 );
+    assert( stats.free_count == 1 );
+    assert( stats.free_size == freetotal );
+}
+
+static void on_move(void *userarg, uint64_t oldoff, uint64_t newoff)
+{
+    uint64_t *offs = (uint64_t*) userarg;
+
+    for(size_t i=0; i<testcnt; ++i)
+    {
+        if( offs[i] == oldoff )
+        {
+            offs[i] = newoff;
+            return;
+        }
+    }
+    assert( false );
+}
+
+void test_defragment(pool_init_t init)
+{
+    static byte_t   poolbuf[16*1024];
+    mempool_t      *pool;
+    mempool_stats_t stats;
+    uint64_t        offs[testcnt];
+    size_t          freetotal;
+    size_t          i;
+
+    pool = init(poolbuf, sizeof(poolbuf));
+    assert( pool );
+    freetotal = get_free_size(pool);
+
+    // Allocate buffers and deallocate some of them, and record the offsets.
+    for(i=0; i<testcnt; ++i)
+    {
+        char *buf = (char*) mempool_allocate(pool, strlen(testvars[i].sample) + 1);
+        assert( buf );
+        strcpy(buf, testvars[i].sample);
+        offs[i] = mempool_offset_from_addr(pool, buf);
+    }
+    for(i=0; i<testcnt; ++i)
+    {
+        if( !index_magic(i) )
+        {
+            mempool_deallocate(pool, mempool_offset_to_addr(pool, offs[i]));
+            offs[i] = 0;
+        }
+    }
+    mempool_flush_cache(pool);
+
+    mempool_get_stats(pool, &stats);
+    assert( stats.free_count > 1 );
+
+    // All free space is merged to one block, and the buffers are kept with the offsets updated.
+    assert( 0 < mempool_defragment(pool, on_move, offs) );
+    mempool_get_stats(pool, &stats);
+    assert( stats.free_count == 1 );
+    assert( stats.free_largest == stats.free_size );
+    assert( 0 == mempool_defragment(pool, on_move, offs) );
+
+    for(i=0; i<testcnt; ++i)
+    {
+        if( offs[i] )
+        {
+            const char *buf = (const char*) mempool_offset_to_addr(pool, offs[i]);
+            assert( 0 == strcmp(buf, testvars[i].sample) );
+            assert( strlen(buf) + 1 == mempool_get_buffer_size(pool, buf) );
+        }
+    }
+
+    // The pool still works after defragmented.
+    assert( mempool_allocate(pool, stats.free_largest / 2) );
+    for(i=0; i<testcnt; ++i)
+    {
+        if( !offs[i] ) continue;
+
+        char *buf = (char*) mempool_offset_to_addr(pool, offs[i]);
+        assert(( buf = (char*) mempool_reallocate(pool, buf, 200) ));
+        assert( 0 == strcmp(buf, testvars[i].sample) );
+        mempool_deallocate(pool, buf);
+    }
+    mempool_deallocate(pool, mempool_get_inuse_first(pool));
+    assert( freetotal == get_free_size(pool) );
+}
+
+void test_random(pool_init_t init)
+{
+    // Random allocate, reallocate and deallocate with data check.
+    static const size_t poolsize = 256*1024;
+    static const size_t slotcnt  = 500;
+    byte_t     *poolbuf = (byte_t*) malloc(poolsize);
+    char       *slots[slotcnt];
+    size_t      sizes[slotcnt];
+    mempool_t  *pool;
+    size_t      freetotal;
+    unsigned    seed = 1;
+    size_t      i;
+
+    assert( poolbuf );
+    pool = init(poolbuf, poolsize);
+    assert( pool );
+    freetotal = get_free_size(pool);
+    memset(slots, 0, sizeof(slots));
+
+    for(i=0; i<100000; ++i)
+    {
+        size_t k    = ( seed = seed * 1103515245 + 12345 ) >> 8 & 0xFFFF;
+        size_t size = ( seed = seed * 1103515245 + 12345 ) >> 8 & 0x3FF;
+        size_t j;
+
+        k %= slotcnt;
+        if( slots[k] )
+        {
+            for(j=0; j<sizes[k]; ++j) assert( slots[k][j] == (char) k );
+
+            if( size & 1 )
+            {
+                mempool_deallocate(pool, slots[k]);
+                slots[k] = NULL;
+                continue;
+            }
+
+            char *buf = (char*) mempool_reallocate(pool, slots[k], size);
+            if( !buf ) continue;
+            slots[k] = buf;
+        }
+        else
+        {
+            if( !( slots[k] = (char*) mempool_allocate(pool, size) ) ) continue;
+        }
+
+        sizes[k] = size;
+        memset(slots[k], (char) k, size);
+    }
+
+    for(i=0; i<slotcnt; ++i)
+    {
+        if( slots[i] ) mempool_deallocate(pool, slots[i]);
+    }
+    assert( freetotal == get_free_size(pool) );
+
+    free(poolbuf);
+}
+
+void test_threads_worker(mempool_t *pool, unsigned seed)
+{
+    static const size_t slotcnt = 200;
+    char   *slots[slotcnt];
+    size_t  sizes[slotcnt];
+    size_t  i;
+
+    memset(slots, 0, sizeof(slots));
+
+    for(i=0; i<200000; ++i)
+    {
+        size_t k    = ( ( seed = seed * 1103515245 + 12345 ) >> 8 ) % slotcnt;
+        size_t size = ( seed = seed * 1103515245 + 12345 ) >> 8 & 0x1FF;
+        char   mark = (char)( seed >> 24 );
+        size_t j;
+
+        if( slots[k] )
+        {
+            for(j=0; j<sizes[k]; ++j) assert( slots[k][j] == slots[k][0] );
+
+            if( size & 1 )
+            {
+                mempool_deallocate(pool, slots[k]);
+                slots[k] = NULL;
+                continue;
+            }
+
+            char *buf = (char*) mempool_reallocate(pool, slots[k], size);
+            if( !buf ) continue;
+            slots[k] = buf;
+        }
+        else
+        {
+            if( !( slots[k] = (char*) mempool_allocate(pool, size) ) ) continue;
+        }
+
+        sizes[k] = size;
+        memset(slots[k], mark, size);
+    }
+
+    for(i=0; i<slotcnt; ++i)
+    {
+        if( slots[i] ) mempool_deallocate(pool, slots[i]);
+    }
+    mempool_flush_cache(pool);
+}
+
+void test_threads(void)
+{
+    // Stress the concurrent mode with several threads.
+    static const size_t poolsize = 1024*1024;
+    static const int    thrdcnt  = 4;
+    byte_t     *poolbuf = (byte_t*) malloc(poolsize);
+    mempool_t  *pool;
+    size_t      freetotal;
+    std::thread threads[thrdcnt];
+
+    assert( poolbuf );
+    pool = mempool_init_concurrent(poolbuf, poolsize);
+    assert( pool );
+    freetotal = mempool_get_free_size(pool);
+
+    for(int i=0; i<thrdcnt; ++i)
+        threads[i] = std::thread(test_threads_worker, pool, i + 1);
+    for(int i=0; i<thrdcnt; ++i)
+        threads[i].join();
+
+    assert( NULL == mempool_get_inuse_first(pool) );
+    assert( freetotal == mempool_get_free_size(pool) );
+
+    free(poolbuf);
+}
+
+void test_reinit(void)
+{
+    // The nodes cached for an old pool must not be used by a new pool on the same address.
+    static const size_t poolsize = 64*1024;
+    byte_t    *poolbuf = (byte_t*) malloc(poolsize);
+    mempool_t *pool;
+    byte_t    *small, *large;
+
+    assert( poolbuf );
+    pool = mempool_init_concurrent(poolbuf, poolsize);
+    assert( pool );
+    assert(( small = (byte_t*) mempool_allocate(pool, 64) ));
+    mempool_deallocate(pool, small);
+
+    pool = mempool_init_concurrent(poolbuf, poolsize);
+    assert( pool );
+    assert(( large = (byte_t*) mempool_allocate(pool, 4096) ));
+    assert(( small = (byte_t*) mempool_allocate(pool, 64) ));
+    assert( small + 64 <= large || large + 4096 <= small );
+
+    mempool_deallocate(pool, small);
+    mempool_deallocate(pool, large);
+    mempool_flush_cache(pool);
+    assert( NULL == mempool_get_inuse_first(pool) );
+
+    free(poolbuf);
+}
+
+void bench_latency(const char *name, pool_init_t init)
+{
+    /*
+     * Measure the average time of an allocation and a deallocation,
+     * with many live blocks in the pool.
+     */
+    static const size_t poolsize = 16*1024*1024;
+    static const size_t livecnt  = 20000;
+    byte_t     *poolbuf = (byte_t*) malloc(poolsize);
+    void      **blocks  = (void**) malloc(livecnt * sizeof(void*));
+    mempool_t  *pool;
+    unsigned    seed   = 1;
+    unsigned    rounds = 0;
+    size_t      i;
+
+    assert( poolbuf && blocks );
+    pool = init(poolbuf, poolsize);
+    assert( pool );
+
+    // Allocate the live blocks, and deallocate a half to make holes.
+    for(i=0; i<livecnt; ++i)
+    {
+        blocks[i] = mempool_allocate(pool, 16 + ( ( seed = seed * 1103515245 + 12345 ) >> 8 & 0xFF ));
+        assert( blocks[i] );
     }
+    for(i=0; i<livecnt; i+=2)
+    {
+        mempool_deallocate(pool, blocks[i]);
+        blocks[i] = NULL;
+    }
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        for(i=0; i<64; ++i)
+        {
+            size_t k    = ( ( seed = seed * 1103515245 + 12345 ) >> 8 ) % livecnt;
+            size_t size = 16 + ( ( seed = seed * 1103515245 + 12345 ) >> 8 & 0xFF );
+
+            if( blocks[k] ) mempool_deallocate(pool, blocks[k]);
+            blocks[k] = mempool_allocate(pool, size);
+            assert( blocks[k] );
+        }
+
+        rounds += 64;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    printf("%-12s : %8.3f us per allocation and deallocation, with %u live blocks\n",
+           name,
+           time_passed * 1000.0 / rounds,
+           (unsigned) livecnt);
+
+    free(blocks);
+    free(poolbuf);
+}
+
+int main(int argc, char *argv[])
+{
+    test_pool(mempool_init           , true );
+    test_pool(mempool_init_tlsf      , true );
+    test_pool(mempool_init_concurrent, false);
+    test_relocate(mempool_init);
+    test_relocate(mempool_init_tlsf);
+    test_relocate(mempool_init_concurrent);
+    test_stats(mempool_init           , true );
+    test_stats(mempool_init_tlsf      , true );
+    test_stats(mempool_init_concurrent, false);
+    test_defragment(mempool_init);
+    test_defragment(mempool_init_tlsf);
+    test_defragment(mempool_init_concurrent);
+    test_random(mempool_init);
+    test_random(mempool_init_tlsf);
+    test_random(mempool_init_concurrent);
+    test_threads();
+    test_reinit();
+
+    bench_latency("first-fit", mempool_init);
+    bench_latency("TLSF"     , mempool_init_tlsf);
 
     return 0;
 }
@@ -2,8 +2,17 @@
 #pragma hdrstop
 #endif
 
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include "cpufeat.h"
+#include "endian.h"
 #include "mtrand.h"
 
+#ifdef CPUFEAT_X86
+#include <immintrin.h>
+#endif
+
 // Constants
 
 #define MM32       397
@@ -18,11 +27,175 @@
 #define MASKL64    0x000000007FFFFFFF
 #define DEFSEED64  5489
 
+#define JUMP_DEGREE  19937                // Degree of the characteristic polynomial of both generators
+#define JUMP_WORDS   MTJUMP_WORDS         // Words of a polynomial with degree JUMP_DEGREE
+#define JUMP_SEQBITS ( 2 * JUMP_DEGREE )  // Sequence length to find the characteristic polynomial
+#define JUMP_SEQSZ   ( JUMP_SEQBITS / 64 + 1 )
+
 // Shared/Default objects
 
 static mt_rand32_t shrd32 = { {0}, NULL, NULL, NULL, NULL };
 static mt_rand64_t shrd64 = { {0}, NULL, NULL, NULL, NULL };
 
+// Twist and temper
+
+//------------------------------------------------------------------------------
+INLINE uint32_t twist32(uint32_t curr, uint32_t next, uint32_t mm)
+{
+    uint32_t r = ( curr & MASKU32 ) | ( next & MASKL32 );
+    return mm ^ ( r >> 1 ) ^ ( ( 0 - ( r & 0x01 ) ) & MATRIX_A32 );  // Add MATRIX-A term if 'r' is an odd number
+}
+//------------------------------------------------------------------------------
+INLINE uint32_t temper32(uint32_t r)
+{
+    r ^= ( r >>  1 );
+    r ^= ( r <<  7 ) & 0x9D2C5680;
+    r ^= ( r << 15 ) & 0xEFC60000;
+    r ^= ( r >> 18 );
+    return r;
+}
+//------------------------------------------------------------------------------
+INLINE uint64_t twist64(uint64_t curr, uint64_t next, uint64_t mm)
+{
+    uint64_t r = ( curr & MASKU64 ) | ( next & MASKL64 );
+    return mm ^ ( r >> 1 ) ^ ( ( 0 - ( r & 0x01 ) ) & MATRIX_A64 );  // Add MATRIX-A term if 'r' is an odd number
+}
+//------------------------------------------------------------------------------
+INLINE uint64_t temper64(uint64_t r)
+{
+    r ^= ( r >> 29 ) & 0x5555555555555555;
+    r ^= ( r << 17 ) & 0x71D67FFFEDA60000;
+    r ^= ( r << 37 ) & 0xFFF7EEE000000000;
+    r ^= ( r >> 43 );
+    return r;
+}
+//------------------------------------------------------------------------------
+static void mt_block32_x1(uint32_t* RESTRICT state, uint32_t* RESTRICT dest)
+{
+    // Twist and temper all items of a 32-bits generator, starting from the first item.
+    int i;
+
+    for(i=0; i<MTRND32_MTXSZ-MM32; ++i)
+        dest[i] = temper32( state[i] = twist32(state[i], state[i+1], state[i+MM32]) );
+    for(; i<MTRND32_MTXSZ-1; ++i)
+        dest[i] = temper32( state[i] = twist32(state[i], state[i+1], state[i+MM32-MTRND32_MTXSZ]) );
+    dest[i] = temper32( state[i] = twist32(state[i], state[0], state[MM32-1]) );
+}
+//------------------------------------------------------------------------------
+static void mt_block64_x1(uint64_t* RESTRICT state, uint64_t* RESTRICT dest)
+{
+    // Twist and temper all items of a 64-bits generator, starting from the first item.
+    int i;
+
+    for(i=0; i<MTRND64_MTXSZ-MM64; ++i)
+        dest[i] = temper64( state[i] = twist64(state[i], state[i+1], state[i+MM64]) );
+    for(; i<MTRND64_MTXSZ-1; ++i)
+        dest[i] = temper64( state[i] = twist64(state[i], state[i+1], state[i+MM64-MTRND64_MTXSZ]) );
+    dest[i] = temper64( state[i] = twist64(state[i], state[0], state[MM64-1]) );
+}
+//------------------------------------------------------------------------------
+
+#ifdef CPUFEAT_X86
+
+// SSE2 kernels, 4 x 32-bits or 2 x 64-bits lanes.
+#define LANES32         4
+#define LANES64         2
+#define VEC             __m128i
+#define KERNEL(name)    name##_x4
+#define KERNEL_TARGET   CPUFEAT_TARGET("sse2")
+#define VLOAD(p)        _mm_loadu_si128((const __m128i*)(p))
+#define VSTORE(p,v)     _mm_storeu_si128((__m128i*)(p), v)
+#define VSET1_32(x)     _mm_set1_epi32((int32_t)(x))
+#define VSET1_64(x)     _mm_set1_epi64x((int64_t)(x))
+#define VAND(a,b)       _mm_and_si128(a, b)
+#define VOR(a,b)        _mm_or_si128(a, b)
+#define VXOR(a,b)       _mm_xor_si128(a, b)
+#define VSUB32(a,b)     _mm_sub_epi32(a, b)
+#define VSUB64(a,b)     _mm_sub_epi64(a, b)
+#define VSHL32(a,n)     _mm_slli_epi32(a, n)
+#define VSHR32(a,n)     _mm_srli_epi32(a, n)
+#define VSHL64(a,n)     _mm_slli_epi64(a, n)
+#define VSHR64(a,n)     _mm_srli_epi64(a, n)
+#include "mtrand_kernel.h"
+#undef LANES32
+#undef LANES64
+#undef VEC
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef VLOAD
+#undef VSTORE
+#undef VSET1_32
+#undef VSET1_64
+#undef VAND
+#undef VOR
+#undef VXOR
+#undef VSUB32
+#undef VSUB64
+#undef VSHL32
+#undef VSHR32
+#undef VSHL64
+#undef VSHR64
+
+// AVX2 kernels, 8 x 32-bits or 4 x 64-bits lanes.
+#define LANES32         8
+#define LANES64         4
+#define VEC             __m256i
+#define KERNEL(name)    name##_x8
+#define KERNEL_TARGET   CPUFEAT_TARGET("avx2")
+#define VLOAD(p)        _mm256_loadu_si256((const __m256i*)(p))
+#define VSTORE(p,v)     _mm256_storeu_si256((__m256i*)(p), v)
+#define VSET1_32(x)     _mm256_set1_epi32((int32_t)(x))
+#define VSET1_64(x)     _mm256_set1_epi64x((int64_t)(x))
+#define VAND(a,b)       _mm256_and_si256(a, b)
+#define VOR(a,b)        _mm256_or_si256(a, b)
+#define VXOR(a,b)       _mm256_xor_si256(a, b)
+#define VSUB32(a,b)     _mm256_sub_epi32(a, b)
+#define VSUB64(a,b)     _mm256_sub_epi64(a, b)
+#define VSHL32(a,n)     _mm256_slli_epi32(a, n)
+#define VSHR32(a,n)     _mm256_srli_epi32(a, n)
+#define VSHL64(a,n)     _mm256_slli_epi64(a, n)
+#define VSHR64(a,n)     _mm256_srli_epi64(a, n)
+#include "mtrand_kernel.h"
+#undef LANES32
+#undef LANES64
+#undef VEC
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef VLOAD
+#undef VSTORE
+#undef VSET1_32
+#undef VSET1_64
+#undef VAND
+#undef VOR
+#undef VXOR
+#undef VSUB32
+#undef VSUB64
+#undef VSHL32
+#undef VSHR32
+#undef VSHL64
+#undef VSHR64
+
+#endif  // CPUFEAT_X86
+
+//------------------------------------------------------------------------------
+static void mt_block32(uint32_t* RESTRICT state, uint32_t* RESTRICT dest)
+{
+#ifdef CPUFEAT_X86
+    if( cpufeat_has(CPUFEAT_AVX2) ) { mt_block32_x8(state, dest); return; }
+    if( cpufeat_has(CPUFEAT_SSE2) ) { mt_block32_x4(state, dest); return; }
+#endif
+    mt_block32_x1(state, dest);
+}
+//------------------------------------------------------------------------------
+static void mt_block64(uint64_t* RESTRICT state, uint64_t* RESTRICT dest)
+{
+#ifdef CPUFEAT_X86
+    if( cpufeat_has(CPUFEAT_AVX2) ) { mt_block64_x8(state, dest); return; }
+    if( cpufeat_has(CPUFEAT_SSE2) ) { mt_block64_x4(state, dest); return; }
+#endif
+    mt_block64_x1(state, dest);
+}
+
 //------------------------------------------------------------------------------
 void mt_srand32(mt_rand32_t* /*optional*/ RESTRICT obj, uint32_t seed)
 {
@@ -56,7 +229,6 @@ uint32_t mt_rand32(mt_rand32_t* /*optional*/ RESTRICT obj)
      *            and a common object will be used automatically.
      * @return The random number generated.
      */
-    static const uint32_t mat[2] = { 0, MATRIX_A32 };
     uint32_t r;
 
     if( !obj ) obj = &shrd32;  // 若使用者不傳入指定的物件則使用預設的全域物件
@@ -68,16 +240,11 @@ uint32_t mt_rand32(mt_rand32_t* /*optional*/ RESTRICT obj)
 
     // Calculate the twisted feedback
 
-    r   = ( *obj->curr & MASKU32 ) | ( *obj->next & MASKL32 );
-    *obj->curr = *obj->mm ^ ( r >> 1 ) ^ mat[ r & 0x01 ];  // Add MATRIX-A term if 'r' is an odd number
+    *obj->curr = twist32(*obj->curr, *obj->next, *obj->mm);
 
     // Calculate the main random number
 
-    r  = *obj->curr;
-    r ^= ( r >>  1 );
-    r ^= ( r <<  7 ) & 0x9D2C5680;
-    r ^= ( r << 15 ) & 0xEFC60000;
-    r ^= ( r >> 18 );
+    r = temper32(*obj->curr);
 
     // Move points to next item
 
@@ -93,6 +260,70 @@ uint32_t mt_rand32(mt_rand32_t* /*optional*/ RESTRICT obj)
     return r;
 }
 //------------------------------------------------------------------------------
+void mt_randfill32(mt_rand32_t* /*optional*/ RESTRICT obj, uint32_t* RESTRICT dest, size_t count)
+{
+    /**
+     * @brief Generate a set of 32-bits random numbers.
+     * @param obj   Generator object.
+     *              This parameter can be NULL if no generator object assigned,
+     *              and a common object will be used automatically.
+     * @param dest  A buffer to receive the random numbers.
+     * @param count Number of random numbers to generate.
+     *
+     * @remarks The numbers generated are the same as calling ::mt_rand32 @a count times,
+     *          but the whole state array will be twisted at once by the SSE2 or AVX2 vectors
+     *          if they are available, and the numbers will be written to the buffer directly.
+     */
+    if( !obj ) obj = &shrd32;  // 若使用者不傳入指定的物件則使用預設的全域物件
+    if( !dest ) return;
+
+    // Initialize object if it is not initailized
+
+    if( obj->end != obj->state + MTRND32_MTXSZ )
+        mt_srand32(obj, DEFSEED32);
+
+    // Use the single number generator until the current item back to the first one
+
+    for(; count && obj->curr != obj->state; --count)
+        *dest++ = mt_rand32(obj);
+
+    // Generate whole blocks, all item pointers will be the same after that
+
+    for(; count >= MTRND32_MTXSZ; count -= MTRND32_MTXSZ, dest += MTRND32_MTXSZ)
+        mt_block32(obj->state, dest);
+
+    for(; count; --count)
+        *dest++ = mt_rand32(obj);
+}
+//------------------------------------------------------------------------------
+void mt_copy32(mt_rand32_t* RESTRICT dest, const mt_rand32_t* /*optional*/ RESTRICT src)
+{
+    /**
+     * @brief Copy a 32-bits random number generator.
+     * @param dest Receive the copy of the generator.
+     * @param src  The generator to be copied.
+     *             This parameter can be NULL to copy the common object.
+     *
+     * @remarks The generator object holds pointers into itself,
+     *          so it cannot be copied by a plain assignment.
+     *          The copy generates the same numbers as the source generator from now on.
+     */
+    if( !dest ) return;
+    if( !src ) src = &shrd32;  // 若使用者不傳入指定的物件則使用預設的全域物件
+
+    if( src->end != src->state + MTRND32_MTXSZ )
+    {
+        mt_srand32(dest, DEFSEED32);
+        return;
+    }
+
+    memcpy(dest->state, src->state, sizeof(dest->state));
+    dest->end  = dest->state + MTRND32_MTXSZ;
+    dest->curr = dest->state + ( src->curr - src->state );
+    dest->next = dest->state + ( src->next - src->state );
+    dest->mm   = dest->state + ( src->mm   - src->state );
+}
+//------------------------------------------------------------------------------
 void mt_srand64(mt_rand64_t* /*optional*/ RESTRICT obj, uint64_t seed)
 {
     /**
@@ -125,7 +356,6 @@ uint64_t mt_rand64(mt_rand64_t* /*optional*/ RESTRICT obj)
      *            and a common object will be used automatically.
      * @return The random number generated.
      */
-    static const uint64_t mat[2] = { 0, MATRIX_A64 };
     uint64_t r;
 
     if( !obj ) obj = &shrd64;  // 若使用者不傳入指定的物件則使用預設的全域物件
@@ -137,16 +367,11 @@ uint64_t mt_rand64(mt_rand64_t* /*optional*/ RESTRICT obj)
 
     // Calculate the twisted feedback
 
-    r   = ( *obj->curr & MASKU64 ) | ( *obj->next & MASKL64 );
-    *obj->curr = *obj->mm ^ ( r >> 1 ) ^ mat[ r & 0x01 ];  // Add MATRIX-A term if 'r' is an odd number
+    *obj->curr = twist64(*obj->curr, *obj->next, *obj->mm);
 
     // Calculate the main random number
 
-    r  = *obj->curr;
-    r ^= ( r >> 29 ) & 0x5555555555555555;
-    r ^= ( r << 17 ) & 0x71D67FFFEDA60000;
-    r ^= ( r << 37 ) & 0xFFF7EEE000000000;
-    r ^= ( r >> 43 );
+    r = temper64(*obj->curr);
 
     // Move points to next item
 
@@ -162,6 +387,70 @@ uint64_t mt_rand64(mt_rand64_t* /*optional*/ RESTRICT obj)
     return r;
 }
 //------------------------------------------------------------------------------
+void mt_randfill64(mt_rand64_t* /*optional*/ RESTRICT obj, uint64_t* RESTRICT dest, size_t count)
+{
+    /**
+     * @brief Generate a set of 64-bits random numbers.
+     * @param obj   Generator object.
+     *              This parameter can be NULL if no generator object assigned,
+     *              and a common object will be used automatically.
+     * @param dest  A buffer to receive the random numbers.
+     * @param count Number of random numbers to generate.
+     *
+     * @remarks The numbers generated are the same as calling ::mt_rand64 @a count times,
+     *          but the whole state array will be twisted at once by the SSE2 or AVX2 vectors
+     *          if they are available, and the numbers will be written to the buffer directly.
+     */
+    if( !obj ) obj = &shrd64;  // 若使用者不傳入指定的物件則使用預設的全域物件
+    if( !dest ) return;
+
+    // Initialize object if it is not initailized
+
+    if( obj->end != obj->state + MTRND64_MTXSZ )
+        mt_srand64(obj, DEFSEED64);
+
+    // Use the single number generator until the current item back to the first one
+
+    for(; count && obj->curr != obj->state; --count)
+        *dest++ = mt_rand64(obj);
+
+    // Generate whole blocks, all item pointers will be the same after that
+
+    for(; count >= MTRND64_MTXSZ; count -= MTRND64_MTXSZ, dest += MTRND64_MTXSZ)
+        mt_block64(obj->state, dest);
+
+    for(; count; --count)
+        *dest++ = mt_rand64(obj);
+}
+//------------------------------------------------------------------------------
+void mt_copy64(mt_rand64_t* RESTRICT dest, const mt_rand64_t* /*optional*/ RESTRICT src)
+{
+    /**
+     * @brief Copy a 64-bits random number generator.
+     * @param dest Receive the copy of the generator.
+     * @param src  The generator to be copied.
+     *             This parameter can be NULL to copy the common object.
+     *
+     * @remarks The generator object holds pointers into itself,
+     *          so it cannot be copied by a plain assignment.
+     *          The copy generates the same numbers as the source generator from now on.
+     */
+    if( !dest ) return;
+    if( !src ) src = &shrd64;  // 若使用者不傳入指定的物件則使用預設的全域物件
+
+    if( src->end != src->state + MTRND64_MTXSZ )
+    {
+        mt_srand64(dest, DEFSEED64);
+        return;
+    }
+
+    memcpy(dest->state, src->state, sizeof(dest->state));
+    dest->end  = dest->state + MTRND64_MTXSZ;
+    dest->curr = dest->state + ( src->curr - src->state );
+    dest->next = dest->state + ( src->next - src->state );
+    dest->mm   = dest->state + ( src->mm   - src->state );
+}
+//------------------------------------------------------------------------------
 void mt_randbin(mt_rand64_t* /*optional*/ RESTRICT obj, void* RESTRICT dest, size_t size)
 {
     /**
@@ -173,17 +462,354 @@ void mt_randbin(mt_rand64_t* /*optional*/ RESTRICT obj, void* RESTRICT dest, siz
      * @param size Size of the output buffer.
      */
     uint8_t  *buf = dest;
+    uint64_t  block[MTRND64_MTXSZ];
     uint64_t  rndval;
+    size_t    head;
 
     if( !obj ) obj = &shrd64;  // 若使用者不傳入指定的物件則使用預設的全域物件
     if( !dest ) return;
 
+    // The first number fills the remainder bytes of the eight bytes units,
+    // and the later numbers fill the units in little-endian byte order.
+
     rndval = mt_rand64(obj);
-    while( size )
+    for(head = size & 0x07; head; --head)
     {
-        if( !( size-- & 0x07 ) ) rndval = mt_rand64(obj);
         *buf++   = rndval & 0xFF;
         rndval >>= 8;
     }
+
+    for(size >>= 3; size; )
+    {
+        // Generate to the end of the state array at most each time,
+        // to let the later calls start from the first item and generate whole blocks.
+        size_t count = obj->curr == obj->state ? MTRND64_MTXSZ : obj->end - obj->curr;
+        if( count > size ) count = size;
+
+        mt_randfill64(obj, block, count);
+        if( endian_is_big_endian() )
+        {
+            for(size_t i=0; i<count; ++i)
+                block[i] = endian_swap_64(block[i]);
+        }
+
+        memcpy(buf, block, count * sizeof(block[0]));
+        buf  += count * sizeof(block[0]);
+        size -= count;
+    }
+}
+//------------------------------------------------------------------------------
+
+// Jump ahead
+
+//------------------------------------------------------------------------------
+INLINE unsigned poly_parity(uint64_t x)
+{
+    x ^= x >> 32;
+    x ^= x >> 16;
+    x ^= x >>  8;
+    x ^= x >>  4;
+    x ^= x >>  2;
+    x ^= x >>  1;
+    return x & 1;
+}
+//------------------------------------------------------------------------------
+INLINE uint64_t poly_window(const uint64_t *poly, int pos, int w)
+{
+    // Get the 64 coefficients starting from the term (pos + 64*w).
+    const uint64_t *p = poly + ( pos >> 6 ) + w;
+    int             s = pos & 63;
+    return s ? ( p[0] >> s ) | ( p[1] << ( 64 - s ) ) : p[0];
+}
+//------------------------------------------------------------------------------
+static void poly_xor_shift(uint64_t *dest, const uint64_t *src, int srcsz, int shift)
+{
+    // dest += src * x^shift, and @a dest must have (srcsz + shift/64 + 1) words at least.
+    int s = shift & 63;
+
+    dest += shift >> 6;
+    if( s )
+    {
+        for(int i=0; i<srcsz; ++i)
+        {
+            dest[i]   ^= src[i] << s;
+            dest[i+1] ^= src[i] >> ( 64 - s );
+        }
+    }
+    else
+    {
+        for(int i=0; i<srcsz; ++i)
+            dest[i] ^= src[i];
+    }
+}
+//------------------------------------------------------------------------------
+static void jump_charpoly(uint64_t phi[JUMP_WORDS], const uint64_t *rseq)
+{
+    /*
+     * Find the characteristic polynomial of the generator by the Berlekamp-Massey algorithm,
+     * from one bit of the generated numbers.
+     * The polynomial is the minimal polynomial of the sequence,
+     * because it is irreducible and the sequence is not zero.
+     *
+     * @param phi  Receive the polynomial.
+     * @param rseq The sequence bits in reversed order, the last bit is the first item,
+     *             so the terms used to verify an item are in the same order as the connection polynomial.
+     */
+    uint64_t conn[JUMP_WORDS+1] = {1};  // Connection polynomial
+    uint64_t prev[JUMP_WORDS+1] = {1};  // Connection polynomial before the last length change
+    uint64_t temp[JUMP_WORDS+1];
+    int      len     = 0;               // Length of the shortest recurrence
+    int      prevlen = 0;
+    int      shift   = 1;
+
+    for(int n=0; n<JUMP_SEQBITS; ++n)
+    {
+        uint64_t disc = 0;
+        for(int w=0; w<=len>>6; ++w)
+            disc ^= conn[w] & poly_window(rseq, JUMP_SEQBITS-1-n, w);
+
+        if( !poly_parity(disc) )
+        {
+            ++shift;
+        }
+        else if( 2*len <= n )
+        {
+            memcpy(temp, conn, sizeof(temp));
+            poly_xor_shift(conn, prev, ( prevlen >> 6 ) + 1, shift);
+            memcpy(prev, temp, sizeof(prev));
+
+            prevlen = len;
+            len     = n + 1 - len;
+            shift   = 1;
+        }
+        else
+        {
+            poly_xor_shift(conn, prev, ( prevlen >> 6 ) + 1, shift);
+            ++shift;
+        }
+    }
+
+    assert( len == JUMP_DEGREE );
+
+    // The characteristic polynomial is the reciprocal of the connection polynomial
+
+    memset(phi, 0, JUMP_WORDS*sizeof(phi[0]));
+    for(int i=0; i<=len; ++i)
+    {
+        if( conn[(len-i)>>6] >> ( (len-i) & 63 ) & 1 )
+            phi[i>>6] |= (uint64_t)1 << ( i & 63 );
+    }
+}
+//------------------------------------------------------------------------------
+static uint64_t poly_spread(uint32_t x)
+{
+    // Insert a zero bit after each bit, that is the square of a polynomial.
+    uint64_t r = x;
+    r = ( r | ( r << 16 ) ) & 0x0000FFFF0000FFFF;
+    r = ( r | ( r <<  8 ) ) & 0x00FF00FF00FF00FF;
+    r = ( r | ( r <<  4 ) ) & 0x0F0F0F0F0F0F0F0F;
+    r = ( r | ( r <<  2 ) ) & 0x3333333333333333;
+    r = ( r | ( r <<  1 ) ) & 0x5555555555555555;
+    return r;
+}
+//------------------------------------------------------------------------------
+static void jump_polypow(uint64_t poly[JUMP_WORDS], const uint64_t phi[JUMP_WORDS], uint64_t steps)
+{
+    // Calculate x^steps mod phi, from the highest bit of the exponent.
+    uint64_t sqr[2*JUMP_WORDS+1];
+    bool     started = false;
+
+    memset(poly, 0, JUMP_WORDS*sizeof(poly[0]));
+    poly[0] = 1;
+
+    for(int bit=63; bit>=0; --bit)
+    {
+        if( started )
+        {
+            // Square the polynomial and reduce it, from the highest term
+            for(int i=0; i<JUMP_WORDS; ++i)
+            {
+                sqr[2*i]   = poly_spread(poly[i]);
+                sqr[2*i+1] = poly_spread(poly[i] >> 32);
+            }
+            sqr[2*JUMP_WORDS] = 0;
+
+            for(int i=2*(JUMP_DEGREE-1); i>=JUMP_DEGREE; --i)
+            {
+                if( sqr[i>>6] >> ( i & 63 ) & 1 )
+                    poly_xor_shift(sqr, phi, JUMP_WORDS, i - JUMP_DEGREE);
+            }
+
+            memcpy(poly, sqr, JUMP_WORDS*sizeof(poly[0]));
+        }
+
+        if( steps >> bit & 1 )
+        {
+            // Multiply by x
+            for(int i=JUMP_WORDS-1; i>0; --i)
+                poly[i] = ( poly[i] << 1 ) | ( poly[i-1] >> 63 );
+            poly[0] <<= 1;
+
+            if( poly[JUMP_DEGREE>>6] >> ( JUMP_DEGREE & 63 ) & 1 )
+            {
+                for(int i=0; i<JUMP_WORDS; ++i)
+                    poly[i] ^= phi[i];
+            }
+
+            started = true;
+        }
+    }
+}
+//------------------------------------------------------------------------------
+void mt_jumpinit32(mt_jump32_t* RESTRICT jump, uint64_t steps)
+{
+    /**
+     * @brief Prepare a jump for the 32-bits random number generator.
+     * @param jump Receive the jump information.
+     * @param steps Number of random numbers to skip by each jump.
+     *
+     * @remarks The preparation costs a fraction of a second for long jumps,
+     *          so prepare it once and use it for all generators.
+     */
+    uint64_t    rseq[JUMP_SEQSZ+JUMP_WORDS+1] = {0};
+    uint64_t    phi[JUMP_WORDS];
+    mt_rand32_t gen;
+
+    assert( jump );
+
+    mt_srand32(&gen, DEFSEED32);
+    for(int n=0; n<JUMP_SEQBITS; ++n)
+    {
+        int i = JUMP_SEQBITS - 1 - n;
+        rseq[i>>6] |= (uint64_t)( mt_rand32(&gen) & 1 ) << ( i & 63 );
+    }
+
+    jump_charpoly(phi, rseq);
+    jump_polypow(jump->poly, phi, steps);
+}
+//------------------------------------------------------------------------------
+void mt_jump32(mt_rand32_t* /*optional*/ RESTRICT obj, const mt_jump32_t* RESTRICT jump)
+{
+    /**
+     * @brief Jump ahead the 32-bits random number generator.
+     * @param obj  Generator object.
+     *             This parameter can be NULL if no generator object assigned,
+     *             and a common object will be used automatically.
+     * @param jump The jump information prepared by ::mt_jumpinit32.
+     *
+     * @remarks The generator will be the same as the one called ::mt_rand32 for the steps of the jump,
+     *          and independent streams can be derived by jumping copies of a generator
+     *          for different times.
+     */
+    uint32_t    acc[MTRND32_MTXSZ];
+    mt_rand32_t work;
+    int         offset;
+
+    if( !obj ) obj = &shrd32;  // 若使用者不傳入指定的物件則使用預設的全域物件
+    if( !jump ) return;
+
+    if( obj->end != obj->state + MTRND32_MTXSZ )
+        mt_srand32(obj, DEFSEED32);
+
+    // Sum the states of the later steps selected by the jump polynomial,
+    // the state items are aligned from the current item.
+
+    mt_copy32(&work, obj);
+    memset(acc, 0, sizeof(acc));
+
+    for(int i=0; i<JUMP_DEGREE; ++i)
+    {
+        if( jump->poly[i>>6] >> ( i & 63 ) & 1 )
+        {
+            offset = work.curr - work.state;
+            for(int j=0; j<MTRND32_MTXSZ-offset; ++j)
+                acc[j] ^= work.state[offset+j];
+            for(int j=MTRND32_MTXSZ-offset; j<MTRND32_MTXSZ; ++j)
+                acc[j] ^= work.state[j-MTRND32_MTXSZ+offset];
+        }
+
+        mt_rand32(&work);
+    }
+
+    memcpy(obj->state, acc, sizeof(obj->state));
+    obj->curr = obj->state;
+    obj->next = obj->state + 1;
+    obj->mm   = obj->state + MM32;
+}
+//------------------------------------------------------------------------------
+void mt_jumpinit64(mt_jump64_t* RESTRICT jump, uint64_t steps)
+{
+    /**
+     * @brief Prepare a jump for the 64-bits random number generator.
+     * @param jump Receive the jump information.
+     * @param steps Number of random numbers to skip by each jump.
+     *
+     * @remarks The preparation costs a fraction of a second for long jumps,
+     *          so prepare it once and use it for all generators.
+     */
+    uint64_t    rseq[JUMP_SEQSZ+JUMP_WORDS+1] = {0};
+    uint64_t    phi[JUMP_WORDS];
+    mt_rand64_t gen;
+
+    assert( jump );
+
+    mt_srand64(&gen, DEFSEED64);
+    for(int n=0; n<JUMP_SEQBITS; ++n)
+    {
+        int i = JUMP_SEQBITS - 1 - n;
+        rseq[i>>6] |= (uint64_t)( mt_rand64(&gen) & 1 ) << ( i & 63 );
+    }
+
+    jump_charpoly(phi, rseq);
+    jump_polypow(jump->poly, phi, steps);
+}
+//------------------------------------------------------------------------------
+void mt_jump64(mt_rand64_t* /*optional*/ RESTRICT obj, const mt_jump64_t* RESTRICT jump)
+{
+    /**
+     * @brief Jump ahead the 64-bits random number generator.
+     * @param obj  Generator object.
+     *             This parameter can be NULL if no generator object assigned,
+     *             and a common object will be used automatically.
+     * @param jump The jump information prepared by ::mt_jumpinit64.
+     *
+     * @remarks The generator will be the same as the one called ::mt_rand64 for the steps of the jump,
+     *          and independent streams can be derived by jumping copies of a generator
+     *          for different times.
+     */
+    uint64_t    acc[MTRND64_MTXSZ];
+    mt_rand64_t work;
+    int         offset;
+
+    if( !obj ) obj = &shrd64;  // 若使用者不傳入指定的物件則使用預設的全域物件
+    if( !jump ) return;
+
+    if( obj->end != obj->state + MTRND64_MTXSZ )
+        mt_srand64(obj, DEFSEED64);
+
+    // Sum the states of the later steps selected by the jump polynomial,
+    // the state items are aligned from the current item.
+
+    mt_copy64(&work, obj);
+    memset(acc, 0, sizeof(acc));
+
+    for(int i=0; i<JUMP_DEGREE; ++i)
+    {
+        if( jump->poly[i>>6] >> ( i & 63 ) & 1 )
+        {
+            offset = work.curr - work.state;
+            for(int j=0; j<MTRND64_MTXSZ-offset; ++j)
+                acc[j] ^= work.state[offset+j];
+            for(int j=MTRND64_MTXSZ-offset; j<MTRND64_MTXSZ; ++j)
+                acc[j] ^= work.state[j-MTRND64_MTXSZ+offset];
+        }
+
+        mt_rand64(&work);
+    }
+
+    memcpy(obj->state, acc, sizeof(obj->state));
+    obj->curr = obj->state;
+    obj->next = obj->state + 1;
+    obj->mm   = obj->state + MM64;
 }
 //------------------------------------------------------------------------------
@@ -42,6 +42,8 @@ typedef struct mt_rand32_t
 
 void     mt_srand32(mt_rand32_t* RESTRICT obj, uint32_t seed);
 uint32_t mt_rand32 (mt_rand32_t* RESTRICT obj);
+void     mt_randfill32(mt_rand32_t* RESTRICT obj, uint32_t* RESTRICT dest, size_t count);
+void     mt_copy32    (mt_rand32_t* RESTRICT dest, const mt_rand32_t* RESTRICT src);
 
 /// Random object - 64 bits version
 typedef struct mt_rand64_t
@@ -56,11 +58,45 @@ typedef struct mt_rand64_t
 
 void     mt_srand64(mt_rand64_t* RESTRICT obj, uint64_t seed);
 uint64_t mt_rand64 (mt_rand64_t* RESTRICT obj);
+void     mt_randfill64(mt_rand64_t* RESTRICT obj, uint64_t* RESTRICT dest, size_t count);
+void     mt_copy64    (mt_rand64_t* RESTRICT dest, const mt_rand64_t* RESTRICT src);
 
 // Random Data Generator
 INLINE void mt_srandbin(mt_rand64_t* RESTRICT obj, uint64_t seed){ mt_srand64(obj, seed); }  ///< Set random seed.
 void        mt_randbin (mt_rand64_t* RESTRICT obj, void* RESTRICT dest, size_t size);
 
+/*
+ * Jump ahead
+ *
+ *     A jump moves a generator forward for a fixed number of steps quickly,
+ * to derive independent streams for multi-thread usage :
+ * seed a generator, copy it for each thread by ::mt_copy32 or ::mt_copy64,
+ * and jump the copy of the n-th thread n times, then each thread can use
+ * as many numbers as the jump steps without overlapping with others.
+ *     Do not copy a generator by assignment, the copy will keep pointers
+ * into the original one, and will be reseeded with the default seed.
+ */
+
+#define MTJUMP_WORDS 312
+
+/// Jump information - 32 bits version
+typedef struct mt_jump32_t
+{
+    uint64_t poly[MTJUMP_WORDS];
+} mt_jump32_t;
+
+void mt_jumpinit32(mt_jump32_t* RESTRICT jump, uint64_t steps);
+void mt_jump32    (mt_rand32_t* RESTRICT obj, const mt_jump32_t* RESTRICT jump);
+
+/// Jump information - 64 bits version
+typedef struct mt_jump64_t
+{
+    uint64_t poly[MTJUMP_WORDS];
+} mt_jump64_t;
+
+void mt_jumpinit64(mt_jump64_t* RESTRICT jump, uint64_t steps);
+void mt_jump64    (mt_rand64_t* RESTRICT obj, const mt_jump64_t* RESTRICT jump);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -0,0 +1,120 @@
+/*
+ * PRIVATE USAGE
+ *
+ * Mersenne Twister block generation kernels template.
+ *
+ * This file will be included by the random number module with the vector operation macros
+ * defined for a specific instruction set, to generate kernels that twist
+ * the whole state array at once and write the tempered numbers out.
+ *
+ * Macros need to be defined before include :
+ *   LANES32         Number of 32-bits lanes.
+ *   LANES64         Number of 64-bits lanes.
+ *   VEC             The vector type.
+ *   KERNEL(name)    Decorate the kernel name.
+ *   KERNEL_TARGET   Instruction set decoration of the kernels.
+ *   VLOAD(p)        Load a vector from memory.
+ *   VSTORE(p,v)     Store a vector to memory.
+ *   VSET1_32(x)     Broadcast a 32-bits value.
+ *   VSET1_64(x)     Broadcast a 64-bits value.
+ *   VAND(a,b)       Bitwise AND.
+ *   VOR(a,b)        Bitwise OR.
+ *   VXOR(a,b)       Bitwise XOR.
+ *   VSUB32(a,b)     Subtraction of 32-bits elements.
+ *   VSUB64(a,b)     Subtraction of 64-bits elements.
+ *   VSHL32(a,n)     Shift 32-bits elements left by a constant.
+ *   VSHR32(a,n)     Shift 32-bits elements right by a constant.
+ *   VSHL64(a,n)     Shift 64-bits elements left by a constant.
+ *   VSHR64(a,n)     Shift 64-bits elements right by a constant.
+ */
+
+//------------------------------------------------------------------------------
+KERNEL_TARGET
+static void KERNEL(mt_block32)(uint32_t* RESTRICT state, uint32_t* RESTRICT dest)
+{
+    /*
+     * Twist and temper all items of a 32-bits generator,
+     * starting from the first item.
+     * The items referred by MM32 offset of the later half are already twisted,
+     * and are far enough to be loaded in the same vector.
+     */
+    const VEC zero  = VSET1_32(0);
+    const VEC one   = VSET1_32(1);
+    const VEC upper = VSET1_32(MASKU32);
+    const VEC lower = VSET1_32(MASKL32);
+    const VEC mata  = VSET1_32(MATRIX_A32);
+    const VEC tmpb  = VSET1_32(0x9D2C5680);
+    const VEC tmpc  = VSET1_32(0xEFC60000);
+    int i;
+
+#define TWIST_VEC(i, m)                                                           \
+    {                                                                             \
+        VEC r = VOR(VAND(VLOAD(state+(i)), upper), VAND(VLOAD(state+(i)+1), lower)); \
+        r = VXOR(VXOR(VLOAD(state+(m)), VSHR32(r, 1)), VAND(VSUB32(zero, VAND(r, one)), mata)); \
+        VSTORE(state+(i), r);                                                     \
+        r = VXOR(r, VSHR32(r, 1));                                                \
+        r = VXOR(r, VAND(VSHL32(r, 7), tmpb));                                    \
+        r = VXOR(r, VAND(VSHL32(r, 15), tmpc));                                   \
+        r = VXOR(r, VSHR32(r, 18));                                               \
+        VSTORE(dest+(i), r);                                                      \
+    }
+
+    for(i=0; i+LANES32<=MTRND32_MTXSZ-MM32; i+=LANES32)
+        TWIST_VEC(i, i+MM32)
+    for(; i<MTRND32_MTXSZ-MM32; ++i)
+        dest[i] = temper32( state[i] = twist32(state[i], state[i+1], state[i+MM32]) );
+
+    for(; i+LANES32<=MTRND32_MTXSZ-1; i+=LANES32)
+        TWIST_VEC(i, i+MM32-MTRND32_MTXSZ)
+    for(; i<MTRND32_MTXSZ-1; ++i)
+        dest[i] = temper32( state[i] = twist32(state[i], state[i+1], state[i+MM32-MTRND32_MTXSZ]) );
+
+    dest[i] = temper32( state[i] = twist32(state[i], state[0], state[MM32-1]) );
+
+#undef TWIST_VEC
+}
+//------------------------------------------------------------------------------
+KERNEL_TARGET
+static void KERNEL(mt_block64)(uint64_t* RESTRICT state, uint64_t* RESTRICT dest)
+{
+    /*
+     * Twist and temper all items of a 64-bits generator,
+     * starting from the first item.
+     */
+    const VEC zero  = VSET1_64(0);
+    const VEC one   = VSET1_64(1);
+    const VEC upper = VSET1_64(MASKU64);
+    const VEC lower = VSET1_64(MASKL64);
+    const VEC mata  = VSET1_64(MATRIX_A64);
+    const VEC tmpa  = VSET1_64(0x5555555555555555);
+    const VEC tmpb  = VSET1_64(0x71D67FFFEDA60000);
+    const VEC tmpc  = VSET1_64(0xFFF7EEE000000000);
+    int i;
+
+#define TWIST_VEC(i, m)                                                           \
+    {                                                                             \
+        VEC r = VOR(VAND(VLOAD(state+(i)), upper), VAND(VLOAD(state+(i)+1), lower)); \
+        r = VXOR(VXOR(VLOAD(state+(m)), VSHR64(r, 1)), VAND(VSUB64(zero, VAND(r, one)), mata)); \
+        VSTORE(state+(i), r);                                                     \
+        r = VXOR(r, VAND(VSHR64(r, 29), tmpa));                                   \
+        r = VXOR(r, VAND(VSHL64(r, 17), tmpb));                                   \
+        r = VXOR(r, VAND(VSHL64(r, 37), tmpc));                                   \
+        r = VXOR(r, VSHR64(r, 43));                                               \
+        VSTORE(dest+(i), r);                                                      \
+    }
+
+    for(i=0; i+LANES64<=MTRND64_MTXSZ-MM64; i+=LANES64)
+        TWIST_VEC(i, i+MM64)
+    for(; i<MTRND64_MTXSZ-MM64; ++i)
+        dest[i] = temper64( state[i] = twist64(state[i], state[i+1], state[i+MM64]) );
+
+    for(; i+LANES64<=MTRND64_MTXSZ-1; i+=LANES64)
+        TWIST_VEC(i, i+MM64-MTRND64_MTXSZ)
+    for(; i<MTRND64_MTXSZ-1; ++i)
+        dest[i] = temper64( state[i] = twist64(state[i], state[i+1], state[i+MM64-MTRND64_MTXSZ]) );
+
+    dest[i] = temper64( state[i] = twist64(state[i], state[0], state[MM64-1]) );
+
+#undef TWIST_VEC
+}
+//------------------------------------------------------------------------------
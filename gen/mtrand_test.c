@@ -9,6 +9,7 @@
 #pragma hdrstop
 #endif
 
+#include "cpufeat.h"
 #include "mtrand.h"
 
 #ifdef NDEBUG
@@ -155,6 +156,178 @@ bool check_rand_bin(const uint8_t *data1, const uint8_t *data2, size_t bufsz, si
     return true;
 }
 
+void test_rand_fill(void)
+{
+    static const unsigned masks[] = { CPUFEAT_ALL, CPUFEAT_SSE2, 0 };
+    static uint32_t buf32[3*MTRND32_MTXSZ];
+    static uint64_t buf64[3*MTRND64_MTXSZ];
+    int i, m, skip;
+
+    // Block generation must give the same numbers as the single number generation
+
+    for(m=0; m<sizeof(masks)/sizeof(masks[0]); ++m)
+    {
+        cpufeat_set_mask(masks[m]);
+
+        for(skip=0; skip<MTRND32_MTXSZ; skip+=157)
+        {
+            mt_rand32_t gen1, gen2;
+            mt_rand64_t gen3, gen4;
+
+            mt_srand32(&gen1, test_seed_32);
+            mt_srand32(&gen2, test_seed_32);
+            for(i=0; i<skip; ++i)
+                assert( mt_rand32(&gen1) == mt_rand32(&gen2) );
+
+            mt_randfill32(&gen2, buf32, sizeof(buf32)/sizeof(buf32[0]));
+            for(i=0; i<sizeof(buf32)/sizeof(buf32[0]); ++i)
+                assert( buf32[i] == mt_rand32(&gen1) );
+            assert( mt_rand32(&gen1) == mt_rand32(&gen2) );
+
+            mt_srand64(&gen3, test_seed_64);
+            mt_srand64(&gen4, test_seed_64);
+            for(i=0; i<skip; ++i)
+                assert( mt_rand64(&gen3) == mt_rand64(&gen4) );
+
+            mt_randfill64(&gen4, buf64, sizeof(buf64)/sizeof(buf64[0]));
+            for(i=0; i<sizeof(buf64)/sizeof(buf64[0]); ++i)
+                assert( buf64[i] == mt_rand64(&gen3) );
+            assert( mt_rand64(&gen3) == mt_rand64(&gen4) );
+        }
+    }
+
+    cpufeat_set_mask(CPUFEAT_ALL);
+
+    mt_srand32(NULL, test_seed_32);
+    mt_randfill32(NULL, buf32, test_cnt_32);
+    assert( 0 == memcmp(buf32, test_res_32, sizeof(test_res_32)) );
+
+    mt_srand64(NULL, test_seed_64);
+    mt_randfill64(NULL, buf64, test_cnt_64);
+    assert( 0 == memcmp(buf64, test_res_64, sizeof(test_res_64)) );
+
+    // Random data are the numbers in little-endian byte order,
+    // after the remainder bytes filled by the first number.
+
+    {
+        static uint8_t data[8*MTRND64_MTXSZ+5];
+        mt_rand64_t    gen;
+        uint64_t       val;
+
+        mt_srandbin(&gen, test_seed_64);
+        mt_randbin(&gen, data, sizeof(data));
+
+        mt_srand64(NULL, test_seed_64);
+        val = mt_rand64(NULL);
+        for(i=0; i<5; ++i, val >>= 8)
+            assert( data[i] == ( val & 0xFF ) );
+        for(; i<sizeof(data); ++i, val >>= 8)
+        {
+            if( ( i - 5 ) % 8 == 0 ) val = mt_rand64(NULL);
+            assert( data[i] == ( val & 0xFF ) );
+        }
+    }
+}
+
+void test_jump(void)
+{
+    static const uint64_t steps[] = { 0, 1, MTRND64_MTXSZ, 1000 };
+    int i, k;
+
+    // Jumps must give the same generators as the single number generation
+
+    for(k=0; k<sizeof(steps)/sizeof(steps[0]); ++k)
+    {
+        mt_jump32_t jump32;
+        mt_jump64_t jump64;
+        mt_rand32_t gen1, gen2;
+        mt_rand64_t gen3, gen4;
+
+        mt_jumpinit32(&jump32, steps[k]);
+        mt_srand32(&gen1, test_seed_32);
+        mt_srand32(&gen2, test_seed_32);
+        for(i=0; i<100; ++i)
+            assert( mt_rand32(&gen1) == mt_rand32(&gen2) );
+
+        mt_jump32(&gen2, &jump32);
+        for(i=0; i<steps[k]; ++i)
+            mt_rand32(&gen1);
+        for(i=0; i<2*MTRND32_MTXSZ; ++i)
+            assert( mt_rand32(&gen1) == mt_rand32(&gen2) );
+
+        mt_jumpinit64(&jump64, steps[k]);
+        mt_srand64(&gen3, test_seed_64);
+        mt_srand64(&gen4, test_seed_64);
+        for(i=0; i<100; ++i)
+            assert( mt_rand64(&gen3) == mt_rand64(&gen4) );
+
+        mt_jump64(&gen4, &jump64);
+        for(i=0; i<steps[k]; ++i)
+            mt_rand64(&gen3);
+        for(i=0; i<2*MTRND64_MTXSZ; ++i)
+            assert( mt_rand64(&gen3) == mt_rand64(&gen4) );
+    }
+
+    // Two jumps are the same as a double length jump
+
+    {
+        mt_jump32_t jump1, jump2;
+        mt_rand32_t gen1, gen2;
+
+        mt_jumpinit32(&jump1, (uint64_t)1 << 40);
+        mt_jumpinit32(&jump2, (uint64_t)1 << 41);
+        mt_srand32(&gen1, test_seed_32);
+        mt_srand32(&gen2, test_seed_32);
+
+        mt_jump32(&gen1, &jump1);
+        mt_jump32(&gen1, &jump1);
+        mt_jump32(&gen2, &jump2);
+        for(i=0; i<MTRND32_MTXSZ; ++i)
+            assert( mt_rand32(&gen1) == mt_rand32(&gen2) );
+    }
+
+    // Copy a generator for each stream and jump the copies
+
+    {
+        mt_jump32_t jump32;
+        mt_jump64_t jump64;
+        mt_rand32_t base32, streams32[3];
+        mt_rand64_t base64, streams64[3];
+
+        mt_jumpinit32(&jump32, 1000);
+        mt_srand32(&base32, test_seed_32);
+        for(i=0; i<10; ++i)
+            mt_rand32(&base32);
+        for(k=0; k<3; ++k)
+        {
+            mt_copy32(&streams32[k], &base32);
+            for(int n=0; n<k; ++n)
+                mt_jump32(&streams32[k], &jump32);
+        }
+        for(k=0; k<3; ++k)
+        {
+            for(i=0; i<1000; ++i)
+                assert( mt_rand32(&base32) == mt_rand32(&streams32[k]) );
+        }
+
+        mt_jumpinit64(&jump64, 1000);
+        mt_srand64(&base64, test_seed_64);
+        for(i=0; i<10; ++i)
+            mt_rand64(&base64);
+        for(k=0; k<3; ++k)
+        {
+            mt_copy64(&streams64[k], &base64);
+            for(int n=0; n<k; ++n)
+                mt_jump64(&streams64[k], &jump64);
+        }
+        for(k=0; k<3; ++k)
+        {
+            for(i=0; i<1000; ++i)
+                assert( mt_rand64(&base64) == mt_rand64(&streams64[k]) );
+        }
+    }
+}
+
 int main(void)
 {
     int i;
@@ -186,5 +359,8 @@ int main(void)
         assert( check_rand_bin(buf1, buf2, sizeof(buf1), i) );
     }
 
+    test_rand_fill();
+    test_jump();
+
     return 0;
 }
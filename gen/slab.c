@@ -0,0 +1,516 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "slab.h"
+
+// Constants
+
+#define SLAB_ALIGN         sizeof(void*)  // Alignment of objects.
+#define SLAB_PAGEHEAD      SLAB_ALIGN     // Space for the page link at the head of each page.
+#define SLAB_PAGESIZE_DEF  4096           // Default page size.
+#define SLAB_PAGEOBJS_MIN  8              // Minimum objects in a page.
+
+#define CACHE_SLABS     8     // Number of slabs that a thread can have caches at the same time.
+#define CACHE_CAPACITY  32    // Number of objects a cache can hold.
+
+// Shared data of the concurrent mode
+
+typedef struct slab_shared_t
+{
+    mtx_t    lock;
+    unsigned serial;  // Identify the slab, to discard the caches of the slabs destroyed
+                      // that another slab may be created on the same address later.
+} slab_shared_t;
+
+static atomic_uint serial_next = 1;
+
+// Serials of the concurrent slabs alive, to reclaim the caches left by the slabs destroyed
+
+static once_flag   registry_once = ONCE_FLAG_INIT;
+static mtx_t       registry_lock;
+static unsigned   *registry_serials;        // Serials in ascending order.
+static size_t      registry_count;
+static size_t      registry_capacity;
+static atomic_uint registry_generation;     // Increased when a slab destroyed.
+
+// Object caches of each thread
+
+typedef struct cache_t
+{
+    const slab_t *slab;     // The slab of the cached objects, or NULL if not used.
+    unsigned      serial;
+    void         *head;     // Cached objects, linked by the first pointer of each object.
+    unsigned      count;
+} cache_t;
+
+static thread_local cache_t  caches[CACHE_SLABS];
+static thread_local unsigned caches_generation;  // The registry generation at the last sweep.
+
+//------------------------------------------------------------------------------
+INLINE
+void* object_get_next(void *obj)
+{
+    return *(void**) obj;
+}
+//------------------------------------------------------------------------------
+INLINE
+void object_set_next(void *obj, void *next)
+{
+    *(void**) obj = next;
+}
+//------------------------------------------------------------------------------
+static
+void registry_init(void)
+{
+    mtx_init(&registry_lock, mtx_plain);
+}
+//------------------------------------------------------------------------------
+static
+size_t registry_find(unsigned serial)
+{
+    // Return the position of the serial, or the position to insert it; the lock must be held.
+    size_t lower = 0, upper = registry_count;
+
+    while( lower < upper )
+    {
+        size_t middle = lower + ( upper - lower ) / 2;
+        if( registry_serials[middle] < serial )
+            lower = middle + 1;
+        else
+            upper = middle;
+    }
+
+    return lower;
+}
+//------------------------------------------------------------------------------
+static
+void registry_add(unsigned serial)
+{
+    call_once(&registry_once, registry_init);
+    mtx_lock(&registry_lock);
+
+    if( registry_count == registry_capacity )
+    {
+        size_t    capacity = ( registry_capacity )?( 2 * registry_capacity ):( 16 );
+        unsigned *serials  = realloc(registry_serials, capacity * sizeof(unsigned));
+        assert( serials );
+
+        registry_serials  = serials;
+        registry_capacity = capacity;
+    }
+
+    // Serials are taken in ascending order, and mostly appended.
+    size_t pos = registry_find(serial);
+    memmove(registry_serials + pos + 1, registry_serials + pos, ( registry_count - pos ) * sizeof(unsigned));
+    registry_serials[pos] = serial;
+    ++registry_count;
+
+    mtx_unlock(&registry_lock);
+}
+//------------------------------------------------------------------------------
+static
+void registry_remove(unsigned serial)
+{
+    mtx_lock(&registry_lock);
+
+    size_t pos = registry_find(serial);
+    assert( pos < registry_count && registry_serials[pos] == serial );
+    memmove(registry_serials + pos, registry_serials + pos + 1, ( registry_count - pos - 1 ) * sizeof(unsigned));
+    --registry_count;
+
+    if( !registry_count )
+    {
+        free(registry_serials);
+        registry_serials  = NULL;
+        registry_capacity = 0;
+    }
+
+    atomic_fetch_add(&registry_generation, 1);
+    mtx_unlock(&registry_lock);
+}
+//------------------------------------------------------------------------------
+static
+bool caches_sweep(void)
+{
+    /*
+     * Release the caches of the calling thread left by the slabs destroyed,
+     * the objects in them have gone with the pages of their slabs.
+     * Return TRUE if any cache is released.
+     */
+    bool released = false;
+
+    mtx_lock(&registry_lock);
+    caches_generation = atomic_load(&registry_generation);
+
+    for(int i=0; i<CACHE_SLABS; ++i)
+    {
+        cache_t *cache = &caches[i];
+        if( !cache->slab ) continue;
+
+        size_t pos = registry_find(cache->serial);
+        if( pos < registry_count && registry_serials[pos] == cache->serial ) continue;
+
+        cache->slab = NULL;
+        released    = true;
+    }
+
+    mtx_unlock(&registry_lock);
+    return released;
+}
+//------------------------------------------------------------------------------
+static
+void slab_init_mode(slab_t        *slab,
+                    size_t         objsize,
+                    size_t         pagesize,
+                    slab_shared_t *shared,
+                    arena_t       *arena)
+{
+    assert( slab );
+
+    objsize  = ( objsize < sizeof(void*) )?( sizeof(void*) ):( objsize );
+    objsize  = ( objsize + SLAB_ALIGN - 1 ) & ~( SLAB_ALIGN - 1 );
+    pagesize = ( pagesize )?( pagesize ):( SLAB_PAGESIZE_DEF );
+    if( pagesize < SLAB_PAGEHEAD + SLAB_PAGEOBJS_MIN * objsize )
+        pagesize = SLAB_PAGEHEAD + SLAB_PAGEOBJS_MIN * objsize;
+
+    slab->objsize  = objsize;
+    slab->pagesize = pagesize;
+    slab->pages    = NULL;
+    slab->freelist = NULL;
+    slab->bump     = NULL;
+    slab->bumpend  = NULL;
+    slab->count    = 0;
+    slab->shared   = shared;
+    slab->arena    = arena;
+}
+//------------------------------------------------------------------------------
+void slab_init(slab_t *slab, size_t objsize, size_t pagesize)
+{
+    /**
+     * @memberof slab_t
+     * @brief Constructor.
+     *
+     * @param slab     Object instance.
+     * @param objsize  Size of each object.
+     * @param pagesize Size of each page allocated from the system,
+     *                 and ZERO to use the default size.
+     *                 The size will be enlarged if it is too small to hold some objects.
+     */
+    slab_init_mode(slab, objsize, pagesize, NULL, NULL);
+}
+//------------------------------------------------------------------------------
+void slab_init_concurrent(slab_t *slab, size_t objsize, size_t pagesize)
+{
+    /**
+     * @memberof slab_t
+     * @brief Constructor with the concurrent mode.
+     *
+     * @param slab     Object instance.
+     * @param objsize  Size of each object.
+     * @param pagesize Size of each page allocated from the system,
+     *                 and ZERO to use the default size.
+     *                 The size will be enlarged if it is too small to hold some objects.
+     *
+     * @remarks Each thread keeps a small cache of objects of the slab,
+     *          and they can be given back by ::slab_flush_cache before the thread exits.
+     *          The objects cached by a thread exited without that are still counted
+     *          by ::slab_get_count, and cannot be reused until the slab destroyed.
+     *          The caches left will be discarded after the slab destroyed.
+     */
+    slab_shared_t *shared = malloc(sizeof(slab_shared_t));
+    assert( shared );
+
+    mtx_init(&shared->lock, mtx_plain);
+    shared->serial = atomic_fetch_add(&serial_next, 1);
+    registry_add(shared->serial);
+
+    slab_init_mode(slab, objsize, pagesize, shared, NULL);
+}
+//------------------------------------------------------------------------------
+void slab_init_arena(slab_t *slab, size_t objsize, size_t pagesize, arena_t *arena)
+{
+    /**
+     * @memberof slab_t
+     * @brief Constructor with pages taken from an arena.
+     *
+     * @param slab     Object instance.
+     * @param objsize  Size of each object.
+     * @param pagesize Size of each page allocated from the arena,
+     *                 and ZERO to use the default size.
+     *                 The size will be enlarged if it is too small to hold some objects.
+     * @param arena    The arena to take pages from.
+     *
+     * @remarks The pages will not be given back to the arena by ::slab_deinit,
+     *          and they are released when the arena rewound or reset.
+     *          The slab must not be used after that.
+     */
+    assert( arena );
+    slab_init_mode(slab, objsize, pagesize, NULL, arena);
+}
+//------------------------------------------------------------------------------
+void slab_deinit(slab_t *slab)
+{
+    /**
+     * @memberof slab_t
+     * @brief Destructor.
+     *
+     * @param slab Object instance.
+     *
+     * @remarks All objects will be released to the system,
+     *          even if some of them are not given back.
+     */
+    assert( slab );
+
+    while( slab->pages && !slab->arena )
+    {
+        void *page = slab->pages;
+        slab->pages = object_get_next(page);
+        free(page);
+    }
+
+    if( slab->shared )
+    {
+        registry_remove(slab->shared->serial);
+        mtx_destroy(&slab->shared->lock);
+        free(slab->shared);
+    }
+
+    slab_init_mode(slab, slab->objsize, slab->pagesize, NULL, NULL);
+}
+//------------------------------------------------------------------------------
+size_t slab_get_count(const slab_t *slab)
+{
+    /**
+     * @memberof slab_t
+     * @brief Get the number of objects allocated.
+     *
+     * @param slab Object instance.
+     * @return Number of objects allocated, include the objects kept in the caches of threads.
+     */
+    size_t count;
+
+    assert( slab );
+
+    if( slab->shared ) mtx_lock(&slab->shared->lock);
+    count = slab->count;
+    if( slab->shared ) mtx_unlock(&slab->shared->lock);
+
+    return count;
+}
+//------------------------------------------------------------------------------
+static
+void* slab_pop(slab_t *slab)
+{
+    /*
+     * Take an object from the free list, or the unused space of the last page,
+     * or a new page. Return NULL if out of memory.
+     */
+    void *obj;
+
+    if(( obj = slab->freelist ))
+    {
+        slab->freelist = object_get_next(obj);
+    }
+    else
+    {
+        if( !slab->bump || slab->bump + slab->objsize > slab->bumpend )
+        {
+            char *page = ( slab->arena )?
+                         ( arena_allocate(slab->arena, slab->pagesize) ):
+                         ( malloc(slab->pagesize) );
+            if( !page ) return NULL;
+
+            object_set_next(page, slab->pages);
+            slab->pages   = page;
+            slab->bump    = page + SLAB_PAGEHEAD;
+            slab->bumpend = page + slab->pagesize;
+        }
+
+        obj = slab->bump;
+        slab->bump += slab->objsize;
+    }
+
+    ++slab->count;
+    return obj;
+}
+//------------------------------------------------------------------------------
+INLINE
+void slab_push(slab_t *slab, void *obj)
+{
+    object_set_next(obj, slab->freelist);
+    slab->freelist = obj;
+    --slab->count;
+}
+//------------------------------------------------------------------------------
+static
+cache_t* cache_get(const slab_t *slab, bool create)
+{
+    /*
+     * Get the cache of the calling thread for the slab, and claim a cache if not existed
+     * and @a create is TRUE. Return NULL if all caches are used by other slabs.
+     */
+    cache_t *vacancy = NULL;
+
+    for(int i=0; i<CACHE_SLABS; ++i)
+    {
+        cache_t *cache = &caches[i];
+
+        if( cache->slab == slab && cache->serial == slab->shared->serial ) return cache;
+        if( cache->slab == slab ) cache->slab = NULL;  // Left by a destroyed slab.
+        if( !cache->slab && !vacancy ) vacancy = cache;
+    }
+
+    if( !create ) return NULL;
+
+    // Caches may be left by the slabs destroyed on other addresses,
+    // check them only if some slab has been destroyed since the last check.
+    if( !vacancy &&
+        caches_generation != atomic_load_explicit(&registry_generation, memory_order_relaxed) &&
+        caches_sweep() )
+    {
+        for(int i=0; i<CACHE_SLABS && !vacancy; ++i)
+        {
+            if( !caches[i].slab ) vacancy = &caches[i];
+        }
+    }
+
+    if( !vacancy ) return NULL;
+
+    vacancy->slab   = slab;
+    vacancy->serial = slab->shared->serial;
+    vacancy->head   = NULL;
+    vacancy->count  = 0;
+
+    return vacancy;
+}
+//------------------------------------------------------------------------------
+static
+void cache_drain(slab_t *slab, cache_t *cache, unsigned keep)
+{
+    /*
+     * Give back the cached objects to the slab until @a keep objects left.
+     */
+    mtx_lock(&slab->shared->lock);
+    while( cache->count > keep )
+    {
+        void *obj = cache->head;
+        cache->head = object_get_next(obj);
+        --cache->count;
+
+        slab_push(slab, obj);
+    }
+    mtx_unlock(&slab->shared->lock);
+}
+//------------------------------------------------------------------------------
+void* slab_allocate(slab_t *slab)
+{
+    /**
+     * @memberof slab_t
+     * @brief Allocate an object.
+     *
+     * @param slab Object instance.
+     * @return The object allocated; or NULL if out of memory.
+     *         The object is aligned to the size of a pointer.
+     */
+    cache_t *cache;
+    void    *obj;
+
+    assert( slab );
+
+    if( !slab->shared ) return slab_pop(slab);
+
+    if( !( cache = cache_get(slab, true) ) )
+    {
+        mtx_lock(&slab->shared->lock);
+        obj = slab_pop(slab);
+        mtx_unlock(&slab->shared->lock);
+
+        return obj;
+    }
+
+    if( !cache->head )
+    {
+        // Fill a half of the cache in one lock.
+        mtx_lock(&slab->shared->lock);
+        while( cache->count < CACHE_CAPACITY / 2 && ( obj = slab_pop(slab) ) )
+        {
+            object_set_next(obj, cache->head);
+            cache->head = obj;
+            ++cache->count;
+        }
+        mtx_unlock(&slab->shared->lock);
+
+        if( !cache->head ) return NULL;
+    }
+
+    obj = cache->head;
+    cache->head = object_get_next(obj);
+    --cache->count;
+
+    return obj;
+}
+//------------------------------------------------------------------------------
+void slab_deallocate(slab_t *slab, void *obj)
+{
+    /**
+     * @memberof slab_t
+     * @brief Release an object.
+     *
+     * @param slab Object instance.
+     * @param obj  The object to be released, it must be allocated from this slab.
+     *             Nothing will be done if this parameter is NULL.
+     */
+    cache_t *cache;
+
+    assert( slab );
+
+    if( !obj ) return;
+
+    if( !slab->shared )
+    {
+        slab_push(slab, obj);
+        return;
+    }
+
+    if( !( cache = cache_get(slab, true) ) )
+    {
+        mtx_lock(&slab->shared->lock);
+        slab_push(slab, obj);
+        mtx_unlock(&slab->shared->lock);
+        return;
+    }
+
+    if( cache->count == CACHE_CAPACITY ) cache_drain(slab, cache, CACHE_CAPACITY / 2);
+
+    object_set_next(obj, cache->head);
+    cache->head = obj;
+    ++cache->count;
+}
+//------------------------------------------------------------------------------
+void slab_flush_cache(slab_t *slab)
+{
+    /**
+     * @memberof slab_t
+     * @brief Give back the objects cached by the calling thread, in the concurrent mode.
+     *
+     * @param slab Object instance.
+     */
+    cache_t *cache;
+
+    assert( slab );
+
+    if( !slab->shared ) return;
+    if( !( cache = cache_get(slab, false) ) ) return;
+
+    cache_drain(slab, cache, 0);
+    cache->slab = NULL;
+}
+//------------------------------------------------------------------------------
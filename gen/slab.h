@@ -0,0 +1,90 @@
+/**
+ * @file
+ * @brief     Slab allocator.
+ * @details   Object pool of fixed size objects, to replace the frequent small allocations,
+ *            such like the nodes of containers.
+ * @author    王文佑
+ * @date      2026.10.17
+ * @copyright ZLib Licence
+ * @see       http://www.openfoundry.org/of/projects/2419
+ */
+#ifndef _GEN_SLAB_H_
+#define _GEN_SLAB_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "inline.h"
+#include "arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * When to use the slab allocator ?
+ *
+ *     A slab allocator takes memory from the system by pages, and hands out
+ * objects of the same size from them. Released objects are kept in a free list
+ * and reused, so an allocation is just a pointer pop in most cases.
+ * The memory is given back to the system only when the slab is destroyed.
+ *
+ *     A slab initialized by ::slab_init has no lock, and can only be used
+ * by one thread at a time. A slab initialized by ::slab_init_concurrent
+ * can be used by many threads, and each thread keeps a small cache of objects
+ * to avoid the lock in most cases; objects can be released by a thread
+ * other than the one that allocated them. A thread should call
+ * ::slab_flush_cache before it exits, or the objects in its cache stay
+ * counted by ::slab_get_count and cannot be used until ::slab_deinit.
+ *
+ *     The containers (list, queue, stack and map) can be initialized with a slab
+ * to allocate their nodes, and a slab can be shared by many containers
+ * of the same type.
+ *
+ *     A slab initialized by ::slab_init_arena takes its pages from an arena,
+ * and the pages go with the arena when it is rewound or reset; so the slab
+ * and the containers using it must be destroyed or abandoned before that.
+ */
+
+/**
+ * @class slab_t
+ * @brief Slab allocator.
+ */
+typedef struct slab_t
+{
+    // WARNING : All members are private!
+
+    size_t  objsize;    // Size of each object.
+    size_t  pagesize;   // Size of each page.
+    void   *pages;      // Pages allocated, linked by the first pointer of each page.
+    void   *freelist;   // Objects released, linked by the first pointer of each object.
+    char   *bump;       // The next object never used in the last page.
+    char   *bumpend;    // End of the last page.
+    size_t  count;      // Number of objects allocated.
+
+    struct slab_shared_t *shared;  // Lock of the concurrent mode, or NULL.
+    arena_t              *arena;   // The arena to take pages from, or NULL to use malloc.
+
+} slab_t;
+
+// constructor and destructor
+void slab_init           (slab_t *slab, size_t objsize, size_t pagesize);
+void slab_init_concurrent(slab_t *slab, size_t objsize, size_t pagesize);
+void slab_init_arena     (slab_t *slab, size_t objsize, size_t pagesize, arena_t *arena);
+void slab_deinit         (slab_t *slab);
+
+// information
+/// @memberof slab_t @brief Get the object size, it may be larger than the size requested.
+INLINE size_t slab_get_object_size(const slab_t *slab) { return slab->objsize; }
+
+size_t slab_get_count(const slab_t *slab);
+
+// allocation
+void* slab_allocate   (slab_t *slab);
+void  slab_deallocate (slab_t *slab, void *obj);
+void  slab_flush_cache(slab_t *slab);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
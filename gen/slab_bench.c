@@ -0,0 +1,109 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "container/list.h"
+#include "container/map.h"
+#include "slab.h"
+#include "systime.h"
+
+#define BENCH_ITEMS    4096 // Items in a container.
+#define BENCH_DURATION 500  // Milliseconds.
+
+typedef void(*bench_func_t)(slab_t *slab);
+
+//------------------------------------------------------------------------------
+void bench_list(slab_t *slab)
+{
+    // Fill a list, and then keep pushing and popping items.
+    glist_t list;
+
+    if( slab )
+        glist_init_slab(&list, NULL, slab);
+    else
+        glist_init(&list, NULL);
+
+    for(int i=0; i<BENCH_ITEMS; ++i)
+        glist_push_back(&list, NULL);
+    for(int i=0; i<BENCH_ITEMS; ++i)
+    {
+        glist_pop_front(&list);
+        glist_push_back(&list, NULL);
+    }
+
+    glist_deinit(&list);
+}
+//------------------------------------------------------------------------------
+void bench_map(slab_t *slab)
+{
+    // Fill a map with scattered tags, and then erase all.
+    gmap_t map;
+
+    if( slab )
+        gmap_init_slab(&map, NULL, NULL, NULL, slab);
+    else
+        gmap_init(&map, NULL, NULL, NULL);
+
+    for(unsigned i=0; i<BENCH_ITEMS; ++i)
+        gmap_insert(&map, (void*)(uintptr_t)( i * 2654435761U ), NULL);
+    for(unsigned i=0; i<BENCH_ITEMS; ++i)
+        gmap_erase_bytag(&map, (void*)(uintptr_t)( i * 2654435761U ));
+
+    gmap_deinit(&map);
+}
+//------------------------------------------------------------------------------
+double bench_rounds(bench_func_t func, slab_t *slab)
+{
+    // Run the function repeatedly in a period of time, and return the rounds per second.
+    unsigned rounds = 0;
+
+    func(slab);  // Warm up.
+
+    unsigned time_start = systime_get_clock_count();
+    unsigned time_passed;
+    do
+    {
+        func(slab);
+        ++rounds;
+        time_passed = systime_get_clock_count() - time_start;
+    } while( time_passed < BENCH_DURATION );
+
+    return rounds / ( time_passed / 1000.0 );
+}
+//------------------------------------------------------------------------------
+void bench_print(const char *name, bench_func_t func, size_t nodesize)
+{
+    slab_t slab, slab_conc;
+
+    slab_init(&slab, nodesize, 0);
+    slab_init_concurrent(&slab_conc, nodesize, 0);
+
+    double speed_malloc = bench_rounds(func, NULL);
+    double speed_slab   = bench_rounds(func, &slab);
+    double speed_conc   = bench_rounds(func, &slab_conc);
+
+    printf("%-6s malloc %8.1f /s, slab %8.1f /s (x%.2f), concurrent slab %8.1f /s (x%.2f)\n",
+           name,
+           speed_malloc,
+           speed_slab,
+           speed_slab / speed_malloc,
+           speed_conc,
+           speed_conc / speed_malloc);
+
+    slab_flush_cache(&slab_conc);
+    slab_deinit(&slab_conc);
+    slab_deinit(&slab);
+}
+//------------------------------------------------------------------------------
+int main(void)
+{
+    bench_print("glist", bench_list, sizeof(glist_node_t));
+    bench_print("gmap" , bench_map , sizeof(gmap_node_t));
+
+    return 0;
+}
+//------------------------------------------------------------------------------
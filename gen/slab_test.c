@@ -0,0 +1,225 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <threads.h>
+
+#ifdef __BORLANDC__
+#pragma hdrstop
+#endif
+
+#include "slab.h"
+
+#ifdef NDEBUG
+    #error This test program must work with macro "ASSERT" enabled!
+#endif
+
+#define TEST_OBJECTS 10000
+#define TEST_THREADS 4
+#define TEST_SLABS   20
+
+//------------------------------------------------------------------------------
+void test_allocate(void)
+{
+    static void *objs[TEST_OBJECTS];
+    slab_t       slab;
+
+    slab_init(&slab, 20, 0);
+    assert( slab_get_object_size(&slab) >= 20 );
+    assert( slab_get_object_size(&slab) % sizeof(void*) == 0 );
+    assert( 0 == slab_get_count(&slab) );
+
+    // Allocate objects over many pages, they must be aligned and not overlapped.
+    for(int i=0; i<TEST_OBJECTS; ++i)
+    {
+        objs[i] = slab_allocate(&slab);
+        assert( objs[i] );
+        assert( (uintptr_t) objs[i] % sizeof(void*) == 0 );
+        memset(objs[i], i & 0xFF, 20);
+    }
+    assert( TEST_OBJECTS == slab_get_count(&slab) );
+
+    for(int i=0; i<TEST_OBJECTS; ++i)
+    {
+        const unsigned char *obj = objs[i];
+        for(int j=0; j<20; ++j) assert( obj[j] == ( i & 0xFF ) );
+    }
+
+    // Released objects will be reused first.
+    slab_deallocate(&slab, objs[100]);
+    slab_deallocate(&slab, objs[200]);
+    slab_deallocate(&slab, NULL);
+    assert( TEST_OBJECTS - 2 == slab_get_count(&slab) );
+    assert( objs[200] == slab_allocate(&slab) );
+    assert( objs[100] == slab_allocate(&slab) );
+
+    for(int i=0; i<TEST_OBJECTS; ++i)
+        slab_deallocate(&slab, objs[i]);
+    assert( 0 == slab_get_count(&slab) );
+
+    slab_deinit(&slab);
+}
+//------------------------------------------------------------------------------
+void test_small_object(void)
+{
+    // Objects smaller than a pointer, and a page size smaller than objects.
+    slab_t slab;
+
+    slab_init(&slab, 1, 1);
+    assert( slab_get_object_size(&slab) == sizeof(void*) );
+
+    void *obj1 = slab_allocate(&slab);
+    void *obj2 = slab_allocate(&slab);
+    assert( obj1 && obj2 && obj1 != obj2 );
+
+    slab_deinit(&slab);
+    assert( 0 == slab_get_count(&slab) );
+}
+//------------------------------------------------------------------------------
+void test_arena(void)
+{
+    // Pages taken from an arena.
+    static void *objs[TEST_OBJECTS];
+    arena_t      arena;
+    slab_t       slab;
+
+    arena_init(&arena, 0);
+    slab_init_arena(&slab, 24, 1024, &arena);
+
+    for(int i=0; i<TEST_OBJECTS; ++i)
+    {
+        assert(( objs[i] = slab_allocate(&slab) ));
+        memset(objs[i], i & 0xFF, 24);
+    }
+    assert( arena_get_used_size(&arena) >= TEST_OBJECTS * 24 );
+
+    slab_deallocate(&slab, objs[0]);
+    assert( objs[0] == slab_allocate(&slab) );
+
+    // The pages are kept in the arena until it is reset.
+    size_t size = arena_get_used_size(&arena);
+    slab_deinit(&slab);
+    assert( size == arena_get_used_size(&arena) );
+
+    arena_reset(&arena);
+    assert( 0 == arena_get_used_size(&arena) );
+    arena_deinit(&arena);
+}
+//------------------------------------------------------------------------------
+static slab_t  shared_slab;
+static void   *handover[TEST_THREADS][TEST_OBJECTS];
+//------------------------------------------------------------------------------
+int test_thread(void *arg)
+{
+    // Allocate objects and mark them, then check the marks and release them.
+    int id = (int)(intptr_t) arg;
+
+    for(int round=0; round<10; ++round)
+    {
+        for(int i=0; i<TEST_OBJECTS; ++i)
+        {
+            int *obj = slab_allocate(&shared_slab);
+            assert( obj );
+            obj[0] = id;
+            obj[1] = i;
+            handover[id][i] = obj;
+        }
+
+        for(int i=0; i<TEST_OBJECTS; ++i)
+        {
+            int *obj = handover[id][i];
+            assert( obj[0] == id && obj[1] == i );
+            slab_deallocate(&shared_slab, obj);
+            handover[id][i] = NULL;
+        }
+    }
+
+    slab_flush_cache(&shared_slab);
+    return 0;
+}
+//------------------------------------------------------------------------------
+int test_cross_thread(void *arg)
+{
+    // Release objects allocated by the main thread.
+    void **objs = arg;
+
+    for(int i=0; i<TEST_OBJECTS; ++i)
+        slab_deallocate(&shared_slab, objs[i]);
+
+    slab_flush_cache(&shared_slab);
+    return 0;
+}
+//------------------------------------------------------------------------------
+void test_concurrent(void)
+{
+    static void *objs[TEST_OBJECTS];
+    thrd_t       threads[TEST_THREADS];
+
+    slab_init_concurrent(&shared_slab, 2 * sizeof(int), 0);
+
+    // Many threads work at the same time.
+    for(int i=0; i<TEST_THREADS; ++i)
+        assert( thrd_success == thrd_create(&threads[i], test_thread, (void*)(intptr_t) i) );
+    for(int i=0; i<TEST_THREADS; ++i)
+        thrd_join(threads[i], NULL);
+    assert( 0 == slab_get_count(&shared_slab) );
+
+    // Objects released by another thread.
+    for(int i=0; i<TEST_OBJECTS; ++i)
+        assert(( objs[i] = slab_allocate(&shared_slab) ));
+    assert( thrd_success == thrd_create(&threads[0], test_cross_thread, objs) );
+    thrd_join(threads[0], NULL);
+    slab_flush_cache(&shared_slab);
+    assert( 0 == slab_get_count(&shared_slab) );
+
+    // The cache left by a destroyed slab must not be used by a new slab on the same address.
+    assert(( objs[0] = slab_allocate(&shared_slab) ));
+    slab_deallocate(&shared_slab, objs[0]);
+    slab_deinit(&shared_slab);
+
+    slab_init_concurrent(&shared_slab, 2 * sizeof(int), 0);
+    assert(( objs[0] = slab_allocate(&shared_slab) ));
+    assert( 1 <= slab_get_count(&shared_slab) );  // Objects cached by this thread are also counted.
+    memset(objs[0], 0, 2 * sizeof(int));
+    slab_deallocate(&shared_slab, objs[0]);
+    slab_flush_cache(&shared_slab);
+    assert( 0 == slab_get_count(&shared_slab) );
+    slab_deinit(&shared_slab);
+}
+//------------------------------------------------------------------------------
+void test_destroyed_caches(void)
+{
+    // The caches left by destroyed slabs on other addresses must be reclaimed for new slabs.
+    static slab_t slabs[TEST_SLABS];
+    slab_t        slab;
+    void         *obj;
+
+    for(int i=0; i<TEST_SLABS; ++i)
+    {
+        slab_init_concurrent(&slabs[i], sizeof(int), 0);
+        assert(( obj = slab_allocate(&slabs[i]) ));
+        slab_deallocate(&slabs[i], obj);
+        slab_deinit(&slabs[i]);
+    }
+
+    // A cache is claimed, and objects more than requested are taken into it.
+    slab_init_concurrent(&slab, sizeof(int), 0);
+    assert(( obj = slab_allocate(&slab) ));
+    assert( 1 < slab_get_count(&slab) );
+    slab_deallocate(&slab, obj);
+    assert( 0 < slab_get_count(&slab) );
+    slab_flush_cache(&slab);
+    assert( 0 == slab_get_count(&slab) );
+    slab_deinit(&slab);
+}
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    test_allocate();
+    test_small_object();
+    test_arena();
+    test_concurrent();
+    test_destroyed_caches();
+
+    return 0;
+}
+//------------------------------------------------------------------------------